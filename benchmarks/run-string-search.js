@@ -0,0 +1,22 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+
+load('base.js');
+load('string-search.js');
+
+function PrintResult(name, result) {
+  print(name + ': ' + result);
+}
+
+
+function PrintScore(score) {
+  print('----');
+  print('Score: ' + score);
+}
+
+
+BenchmarkSuite.RunSuites({ NotifyResult: PrintResult,
+                           NotifyError: PrintResult,
+                           NotifyScore: PrintScore });
@@ -0,0 +1,81 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Micro benchmarks for String.prototype.indexOf with short patterns in long
+// subjects. The first character of the pattern is either rare in the
+// subject, or occurs at almost every position. Run with
+// run-string-search.js; these are not part of the V8 benchmark suite.
+
+function StringSearchSuite(name, run) {
+  return new BenchmarkSuite(name, 100000, [
+    new Benchmark(name, run, SetupStringSearch, TearDownStringSearch)
+  ]);
+}
+
+var OneByteRareSuite =
+    StringSearchSuite('OneByteRareFirstChar', OneByteRareFirstChar);
+var OneByteDenseSuite =
+    StringSearchSuite('OneByteDenseFirstChar', OneByteDenseFirstChar);
+var TwoByteRareSuite =
+    StringSearchSuite('TwoByteRareFirstChar', TwoByteRareFirstChar);
+var TwoByteDenseSuite =
+    StringSearchSuite('TwoByteDenseFirstChar', TwoByteDenseFirstChar);
+
+var kStringSearchSubjectLength = 1 << 20;
+var oneByteText = null;
+var oneByteRun = null;
+var twoByteText = null;
+var twoByteRun = null;
+
+
+function RepeatString(s, length) {
+  var result = s;
+  // Taking a proper substring flattens the cons string, so that the
+  // searches below do not measure the traversal of cons strings.
+  while (result.length <= length) result += result;
+  return result.substring(0, length);
+}
+
+
+function SetupStringSearch() {
+  oneByteText = RepeatString("the quick brown fox jumps over a lazy dog. ",
+                             kStringSearchSubjectLength);
+  oneByteRun = RepeatString("a", kStringSearchSubjectLength);
+  twoByteText = RepeatString("the quick brown ☃ jumps over a lazy dog. ",
+                             kStringSearchSubjectLength);
+  twoByteRun = RepeatString("☃", kStringSearchSubjectLength);
+}
+
+
+function TearDownStringSearch() {
+  oneByteText = null;
+  oneByteRun = null;
+  twoByteText = null;
+  twoByteRun = null;
+}
+
+
+function CheckNotFound(result) {
+  if (result != -1) throw new Error("Unexpected match at " + result);
+}
+
+
+function OneByteRareFirstChar() {
+  CheckNotFound(oneByteText.indexOf("Zq"));
+}
+
+
+function OneByteDenseFirstChar() {
+  CheckNotFound(oneByteRun.indexOf("ab"));
+}
+
+
+function TwoByteRareFirstChar() {
+  CheckNotFound(twoByteText.indexOf("Zq"));
+}
+
+
+function TwoByteDenseFirstChar() {
+  CheckNotFound(twoByteRun.indexOf("☃b"));
+}
@@ -952,6 +952,17 @@ class V8_EXPORT UnboundScript {
    */
   int GetLineNumber(int code_pos);
 
+  /**
+   * Writes the start positions of the functions of the script that have
+   * been compiled so far to positions, in increasing order, and returns
+   * their number, which may be larger than capacity. Passed as compile hints
+   * to a later compilation of the same source, they let the functions that
+   * ran this time be compiled together with the script (see
+   * ScriptCompiler::Source::SetCompileHints). This walks the heap, so it is
+   * slow.
+   */
+  int GetCompiledFunctionPositions(int* positions, int capacity);
+
   static const int kNoScriptId = 0;
 };
 
@@ -1047,6 +1058,16 @@ class V8_EXPORT ScriptCompiler {
     // alive.
     V8_INLINE const CachedData* GetCachedData() const;
 
+    // Sets the start positions, in increasing order, of functions which are
+    // likely to be called soon after the script runs, e.g. as returned by
+    // UnboundScript::GetCompiledFunctionPositions in an earlier run. These
+    // functions are compiled together with the script rather than on their
+    // first call, which moves their compilation out of the first request
+    // after the script is loaded. The positions are not copied, and must
+    // stay alive until the script is compiled. Compile hints are ignored when
+    // cached data is consumed or produced.
+    V8_INLINE void SetCompileHints(const int* positions, int count);
+
    private:
     friend class ScriptCompiler;
     // Prevent copying. Not implemented.
@@ -1065,6 +1086,10 @@ class V8_EXPORT ScriptCompiler {
     // compilation (if the generate_cached_data flag is passed to
     // ScriptCompiler).
     CachedData* cached_data;
+
+    // Start positions of the functions to compile together with the script.
+    const int* compile_hints;
+    int compile_hint_count;
   };
 
   enum CompileOptions {
@@ -1072,6 +1097,32 @@ class V8_EXPORT ScriptCompiler {
     kProduceDataToCache = 1 << 0
   };
 
+  /**
+   * A persistent store for compilation data, e.g. backed by a directory,
+   * which lets an embedder reuse the data across isolates and processes.
+   * Installed with Isolate::SetScriptCacheStore, it is consulted when a
+   * script that is not in the in-memory compilation cache is compiled.
+   * Keys are printable strings which identify the V8 version, the flags
+   * and the script source. The data is checked before being used, so a
+   * store does not have to guard against corruption.
+   */
+  class V8_EXPORT CacheStore {
+   public:
+    virtual ~CacheStore() {}
+
+    /**
+     * Returns the data stored under the key, or NULL. Ownership of the
+     * returned CachedData is transferred to V8.
+     */
+    virtual CachedData* Lookup(const char* key) = 0;
+
+    /**
+     * Stores the data under the key. The data is only valid for the
+     * duration of the call.
+     */
+    virtual void Store(const char* key, const uint8_t* data, int length) = 0;
+  };
+
   /**
    * Compiles the specified script (context-independent).
    *
@@ -1301,6 +1352,56 @@ class V8_EXPORT JSON {
    * \return The corresponding value if successfully parsed.
    */
   static Local<Value> Parse(Local<String> json_string);
+
+  /**
+   * Tries to parse |length| bytes of UTF-8 encoded JSON at |data| and returns
+   * the result as value if successful. ASCII input is copied into a one-byte
+   * string without UTF-8 decoding. If length is -1, |data| is assumed to be
+   * null-terminated. The buffer is not retained after the call.
+   *
+   * External one-byte strings passed to the overload above are likewise
+   * parsed in place.
+   */
+  static Local<Value> Parse(Isolate* isolate, const char* data,
+                            int length = -1);
+
+  /**
+   * Parses a JSON text that arrives in chunks, for example from a socket.
+   * The chunks are collected outside of the JavaScript heap and parsed by
+   * Finish(), so that no intermediate strings are built per chunk.
+   *
+   * ASCII text is handed over to the heap as an external string and parsed
+   * in place, so it is not copied again. Other text is decoded from UTF-8
+   * into a new string first. Latin-1 text is not supported and must be
+   * converted to UTF-8 before it is appended.
+   */
+  class V8_EXPORT StreamingParser {
+   public:
+    explicit StreamingParser(Isolate* isolate);
+    ~StreamingParser();
+
+    /**
+     * Appends |length| bytes of UTF-8 encoded text at |data|.
+     */
+    void Append(const char* data, int length);
+
+    /**
+     * Parses the text appended so far and resets the parser for reuse.
+     * Returns an empty handle if parsing throws an exception, including a
+     * RangeError if the appended text exceeds the maximum string length.
+     */
+    Local<Value> Finish();
+
+   private:
+    Isolate* isolate_;
+    char* buffer_;
+    int length_;
+    int capacity_;
+
+    // Disallow copying and assigning.
+    StreamingParser(const StreamingParser&);
+    void operator=(const StreamingParser&);
+  };
 };
 
 
@@ -1840,6 +1941,22 @@ class V8_EXPORT String : public Primitive {
    */
   bool MakeExternal(ExternalAsciiStringResource* resource);
 
+  enum ExternalFileEncoding { kOneByteFile, kTwoByteFile };
+
+  /**
+   * Creates a new external string with the contents of a file, which is
+   * mapped into memory read-only instead of being copied. The file is
+   * unmapped when the external string is no longer live on V8's heap, and it
+   * must not be modified while it is mapped. A one-byte file holds Latin-1
+   * characters, a two-byte file UTF-16 code units in native byte order.
+   * Returns an empty handle if the file cannot be mapped, e.g. because it is
+   * empty, or if it is too long for a string.
+   */
+  static Local<String> NewExternalFromFile(
+      Isolate* isolate,
+      const char* file_name,
+      ExternalFileEncoding encoding = kOneByteFile);
+
   /**
    * Returns true if this string can be made external.
    */
@@ -3875,6 +3992,23 @@ class V8_EXPORT ResourceConstraints {
   void set_code_range_size(size_t value) {
     code_range_size_ = value;
   }
+  /**
+   * Sizes of the primary and secondary tables of the megamorphic stub cache,
+   * as the base 2 logarithm of the number of entries. Zero selects the
+   * default. Only takes effect before the isolate is initialized.
+   */
+  int stub_cache_primary_table_bits() const {
+    return stub_cache_primary_table_bits_;
+  }
+  void set_stub_cache_primary_table_bits(int value) {
+    stub_cache_primary_table_bits_ = value;
+  }
+  int stub_cache_secondary_table_bits() const {
+    return stub_cache_secondary_table_bits_;
+  }
+  void set_stub_cache_secondary_table_bits(int value) {
+    stub_cache_secondary_table_bits_ = value;
+  }
 
  private:
   int max_semi_space_size_;
@@ -3883,6 +4017,8 @@ class V8_EXPORT ResourceConstraints {
   uint32_t* stack_limit_;
   int max_available_threads_;
   size_t code_range_size_;
+  int stub_cache_primary_table_bits_;
+  int stub_cache_secondary_table_bits_;
 };
 
 
@@ -4369,6 +4505,13 @@ class V8_EXPORT Isolate {
    */
   void SetEventLogger(LogEventCallback that);
 
+  /**
+   * Sets the persistent store for compilation data of scripts compiled in
+   * this isolate, or removes it if store is NULL. The store is not owned by
+   * the isolate and must outlive it.
+   */
+  void SetScriptCacheStore(ScriptCompiler::CacheStore* store);
+
   /**
    * Adds a callback to notify the host application when a script finished
    * running.  If a script re-enters the runtime during executing, the
@@ -5587,7 +5730,7 @@ class Internals {
   static const int kNullValueRootIndex = 7;
   static const int kTrueValueRootIndex = 8;
   static const int kFalseValueRootIndex = 9;
-  static const int kEmptyStringRootIndex = 161;
+  static const int kEmptyStringRootIndex = 162;
 
   // The external allocation limit should be below 256 MB on all architectures
   // to avoid that resource-constrained embedders run low on memory.
@@ -6131,12 +6274,17 @@ ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
       resource_line_offset(origin.ResourceLineOffset()),
       resource_column_offset(origin.ResourceColumnOffset()),
       resource_is_shared_cross_origin(origin.ResourceIsSharedCrossOrigin()),
-      cached_data(data) {}
+      cached_data(data),
+      compile_hints(NULL),
+      compile_hint_count(0) {}
 
 
 ScriptCompiler::Source::Source(Local<String> string,
                                CachedData* data)
-    : source_string(string), cached_data(data) {}
+    : source_string(string),
+      cached_data(data),
+      compile_hints(NULL),
+      compile_hint_count(0) {}
 
 
 ScriptCompiler::Source::~Source() {
@@ -6150,6 +6298,13 @@ const ScriptCompiler::CachedData* ScriptCompiler::Source::GetCachedData()
 }
 
 
+void ScriptCompiler::Source::SetCompileHints(const int* positions,
+                                             int count) {
+  compile_hints = positions;
+  compile_hint_count = count;
+}
+
+
 Handle<Boolean> Boolean::New(Isolate* isolate, bool value) {
   return value ? True(isolate) : False(isolate);
 }
@@ -4,7 +4,7 @@ TOOLSET := target
 TARGET := All
 ### Rules for final target.
 $(obj).target/build/All.stamp: TOOLSET := $(TOOLSET)
-$(obj).target/build/All.stamp: $(builddir)/shell $(builddir)/process $(builddir)/lineprocessor $(builddir)/d8 $(builddir)/cctest $(obj).target/test/cctest/resources.stamp FORCE_DO_CMD
+$(obj).target/build/All.stamp: $(builddir)/shell $(builddir)/process $(builddir)/lineprocessor $(builddir)/d8 $(builddir)/cctest $(obj).target/test/cctest/resources.stamp $(builddir)/lexer-shell $(builddir)/parser-shell FORCE_DO_CMD
 	$(call do_cmd,touch)
 
 all_deps += $(obj).target/build/All.stamp
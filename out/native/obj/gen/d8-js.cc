@@ -0,0 +1,1897 @@
+// Copyright 2011 Google Inc. All Rights Reserved.
+
+// This file was generated from .js source files by GYP.  If you
+// want to make changes to this file you should either change the
+// javascript source files or the GYP script.
+
+#include "src/v8.h"
+#include "src/natives.h"
+#include "src/utils.h"
+
+namespace v8 {
+namespace internal {
+
+  static const byte sources[] = { 10, 34, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 34, 59, 10, 83, 116,
+114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115,
+116, 97, 114, 116, 115, 87, 105, 116, 104, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 97, 41, 123, 10, 105, 102, 40, 97, 46, 108, 101, 110, 103, 116, 104,
+62, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 46, 115, 117, 98, 115, 116, 114, 40, 48,
+44, 97, 46, 108, 101, 110, 103, 116, 104, 41, 61, 61, 97, 59, 10, 125, 59, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 108, 111, 103, 49, 48, 40, 97, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 77, 97, 116, 104, 46, 108, 111, 103,
+40, 97, 41, 47, 77, 97, 116, 104, 46, 108, 111, 103, 40, 49, 48, 41, 59, 10,
+125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 84, 111, 73, 110, 115, 112,
+101, 99, 116, 97, 98, 108, 101, 79, 98, 106, 101, 99, 116, 40, 97, 41, 123, 10,
+105, 102, 40, 33, 97, 38, 38, 116, 121, 112, 101, 111, 102, 32, 97, 61, 61, 61,
+39, 111, 98, 106, 101, 99, 116, 39, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 79, 98, 106, 101, 99, 116, 40, 97, 41, 59, 10,
+125, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 116, 67,
+111, 109, 112, 108, 101, 116, 105, 111, 110, 115, 40, 97, 44, 98, 44, 99, 41,
+123, 10, 118, 97, 114, 32, 100, 61, 99, 46, 115, 112, 108, 105, 116, 40, 41, 59,
+10, 99, 61, 100, 46, 112, 111, 112, 40, 41, 59, 10, 118, 97, 114, 32, 101, 61,
+99, 46, 115, 112, 108, 105, 116, 40, 39, 46, 39, 41, 59, 10, 101, 46, 112, 111,
+112, 40, 41, 59, 10, 118, 97, 114, 32, 102, 61, 97, 59, 10, 102, 111, 114, 40,
+118, 97, 114, 32, 103, 61, 48, 59, 103, 60, 101, 46, 108, 101, 110, 103, 116,
+104, 59, 103, 43, 43, 41, 123, 10, 118, 97, 114, 32, 104, 61, 101, 91, 103, 93,
+59, 10, 118, 97, 114, 32, 105, 61, 102, 91, 104, 93, 59, 10, 105, 102, 40, 33,
+105, 41, 123, 10, 114, 101, 116, 117, 114, 110, 91, 93, 59, 10, 125, 10, 102,
+61, 105, 59, 10, 125, 10, 118, 97, 114, 32, 106, 61, 91, 93, 59, 10, 102, 61,
+84, 111, 73, 110, 115, 112, 101, 99, 116, 97, 98, 108, 101, 79, 98, 106, 101,
+99, 116, 40, 102, 41, 59, 10, 119, 104, 105, 108, 101, 40, 116, 121, 112, 101,
+111, 102, 32, 102, 33, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100,
+39, 41, 123, 10, 118, 97, 114, 32, 107, 61, 110, 101, 119, 32, 36, 100, 101, 98,
+117, 103, 46, 79, 98, 106, 101, 99, 116, 77, 105, 114, 114, 111, 114, 40, 102,
+41, 59, 10, 118, 97, 114, 32, 108, 61, 107, 46, 112, 114, 111, 112, 101, 114,
+116, 105, 101, 115, 40, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 103,
+61, 48, 59, 103, 60, 108, 46, 108, 101, 110, 103, 116, 104, 59, 103, 43, 43, 41,
+123, 10, 118, 97, 114, 32, 109, 61, 108, 91, 103, 93, 46, 110, 97, 109, 101, 40,
+41, 59, 10, 105, 102, 40, 116, 121, 112, 101, 111, 102, 32, 109, 61, 61, 61, 39,
+115, 116, 114, 105, 110, 103, 39, 38, 38, 109, 46, 115, 116, 97, 114, 116, 115,
+87, 105, 116, 104, 40, 98, 41, 41, 123, 10, 106, 46, 112, 117, 115, 104, 40,
+109, 41, 59, 10, 125, 10, 125, 10, 102, 61, 84, 111, 73, 110, 115, 112, 101, 99,
+116, 97, 98, 108, 101, 79, 98, 106, 101, 99, 116, 40, 79, 98, 106, 101, 99, 116,
+46, 103, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 102,
+41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 106, 59, 10, 125, 10,
+118, 97, 114, 32, 68, 101, 98, 117, 103, 61, 123, 125, 59, 10, 68, 101, 98, 117,
+103, 46, 68, 101, 98, 117, 103, 69, 118, 101, 110, 116, 61, 123, 66, 114, 101,
+97, 107, 58, 49, 44, 10, 69, 120, 99, 101, 112, 116, 105, 111, 110, 58, 50, 44,
+10, 78, 101, 119, 70, 117, 110, 99, 116, 105, 111, 110, 58, 51, 44, 10, 66, 101,
+102, 111, 114, 101, 67, 111, 109, 112, 105, 108, 101, 58, 52, 44, 10, 65, 102,
+116, 101, 114, 67, 111, 109, 112, 105, 108, 101, 58, 53, 125, 59, 10, 68, 101,
+98, 117, 103, 46, 83, 99, 114, 105, 112, 116, 84, 121, 112, 101, 61, 123, 78,
+97, 116, 105, 118, 101, 58, 48, 44, 10, 69, 120, 116, 101, 110, 115, 105, 111,
+110, 58, 49, 44, 10, 78, 111, 114, 109, 97, 108, 58, 50, 125, 59, 10, 68, 101,
+98, 117, 103, 46, 83, 99, 114, 105, 112, 116, 67, 111, 109, 112, 105, 108, 97,
+116, 105, 111, 110, 84, 121, 112, 101, 61, 123, 72, 111, 115, 116, 58, 48, 44,
+10, 69, 118, 97, 108, 58, 49, 44, 10, 74, 83, 79, 78, 58, 50, 125, 59, 10, 68,
+101, 98, 117, 103, 46, 83, 99, 111, 112, 101, 84, 121, 112, 101, 61, 123, 71,
+108, 111, 98, 97, 108, 58, 48, 44, 10, 76, 111, 99, 97, 108, 58, 49, 44, 10, 87,
+105, 116, 104, 58, 50, 44, 10, 67, 108, 111, 115, 117, 114, 101, 58, 51, 44, 10,
+67, 97, 116, 99, 104, 58, 52, 44, 10, 66, 108, 111, 99, 107, 58, 53, 125, 59,
+10, 118, 97, 114, 32, 107, 78, 111, 70, 114, 97, 109, 101, 61, 45, 49, 59, 10,
+68, 101, 98, 117, 103, 46, 83, 116, 97, 116, 101, 61, 123, 10, 99, 117, 114,
+114, 101, 110, 116, 70, 114, 97, 109, 101, 58, 107, 78, 111, 70, 114, 97, 109,
+101, 44, 10, 100, 105, 115, 112, 108, 97, 121, 83, 111, 117, 114, 99, 101, 83,
+116, 97, 114, 116, 76, 105, 110, 101, 58, 45, 49, 44, 10, 100, 105, 115, 112,
+108, 97, 121, 83, 111, 117, 114, 99, 101, 69, 110, 100, 76, 105, 110, 101, 58,
+45, 49, 44, 10, 99, 117, 114, 114, 101, 110, 116, 83, 111, 117, 114, 99, 101,
+76, 105, 110, 101, 58, 45, 49, 10, 125, 59, 10, 118, 97, 114, 32, 116, 114, 97,
+99, 101, 95, 99, 111, 109, 112, 105, 108, 101, 61, 102, 97, 108, 115, 101, 59,
+10, 118, 97, 114, 32, 116, 114, 97, 99, 101, 95, 100, 101, 98, 117, 103, 95,
+106, 115, 111, 110, 61, 102, 97, 108, 115, 101, 59, 10, 118, 97, 114, 32, 108,
+97, 115, 116, 95, 99, 109, 100, 61, 39, 39, 59, 10, 118, 97, 114, 32, 114, 101,
+112, 101, 97, 116, 95, 99, 109, 100, 95, 108, 105, 110, 101, 61, 39, 39, 59, 10,
+118, 97, 114, 32, 105, 115, 95, 114, 117, 110, 110, 105, 110, 103, 61, 116, 114,
+117, 101, 59, 10, 118, 97, 114, 32, 108, 111, 111, 107, 117, 112, 95, 104, 97,
+110, 100, 108, 101, 61, 110, 117, 108, 108, 59, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 83, 99, 114, 105, 112, 116, 84, 121, 112, 101, 70, 108, 97, 103,
+40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 40, 49, 60, 60, 97, 41, 59,
+10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 101, 98, 117, 103,
+77, 101, 115, 115, 97, 103, 101, 68, 101, 116, 97, 105, 108, 115, 40, 97, 41,
+123, 10, 105, 102, 40, 116, 114, 97, 99, 101, 95, 100, 101, 98, 117, 103, 95,
+106, 115, 111, 110, 41, 123, 10, 112, 114, 105, 110, 116, 40, 34, 114, 101, 99,
+101, 105, 118, 101, 100, 58, 32, 39, 34, 43, 97, 43, 34, 39, 34, 41, 59, 10,
+125, 10, 118, 97, 114, 32, 98, 61, 110, 101, 119, 32, 80, 114, 111, 116, 111,
+99, 111, 108, 80, 97, 99, 107, 97, 103, 101, 40, 97, 41, 59, 10, 105, 115, 95,
+114, 117, 110, 110, 105, 110, 103, 61, 98, 46, 114, 117, 110, 110, 105, 110,
+103, 40, 41, 59, 10, 105, 102, 40, 98, 46, 116, 121, 112, 101, 40, 41, 61, 61,
+39, 101, 118, 101, 110, 116, 39, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+68, 101, 98, 117, 103, 69, 118, 101, 110, 116, 68, 101, 116, 97, 105, 108, 115,
+40, 98, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 68, 101, 98, 117, 103, 82, 101, 115, 112, 111, 110, 115, 101, 68, 101,
+116, 97, 105, 108, 115, 40, 98, 41, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 68, 101, 98, 117, 103, 69, 118, 101, 110, 116, 68, 101,
+116, 97, 105, 108, 115, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 123, 116,
+101, 120, 116, 58, 39, 39, 44, 114, 117, 110, 110, 105, 110, 103, 58, 102, 97,
+108, 115, 101, 125, 59, 10, 98, 46, 114, 117, 110, 110, 105, 110, 103, 61, 97,
+46, 114, 117, 110, 110, 105, 110, 103, 40, 41, 59, 10, 118, 97, 114, 32, 99, 61,
+97, 46, 98, 111, 100, 121, 40, 41, 59, 10, 118, 97, 114, 32, 100, 61, 39, 39,
+59, 10, 115, 119, 105, 116, 99, 104, 40, 97, 46, 101, 118, 101, 110, 116, 40,
+41, 41, 123, 10, 99, 97, 115, 101, 39, 98, 114, 101, 97, 107, 39, 58, 10, 105,
+102, 40, 99, 46, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 115, 41, 123,
+10, 100, 43, 61, 39, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 39, 59, 10,
+105, 102, 40, 99, 46, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 115, 46,
+108, 101, 110, 103, 116, 104, 62, 49, 41, 123, 10, 100, 43, 61, 39, 115, 39, 59,
+10, 125, 10, 100, 43, 61, 39, 32, 35, 39, 59, 10, 102, 111, 114, 40, 118, 97,
+114, 32, 101, 61, 48, 59, 101, 60, 99, 46, 98, 114, 101, 97, 107, 112, 111, 105,
+110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 59, 101, 43, 43, 41, 123, 10,
+105, 102, 40, 101, 62, 48, 41, 123, 10, 100, 43, 61, 39, 44, 32, 35, 39, 59, 10,
+125, 10, 100, 43, 61, 99, 46, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116,
+115, 91, 101, 93, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 100, 43,
+61, 39, 98, 114, 101, 97, 107, 39, 59, 10, 125, 10, 100, 43, 61, 39, 32, 105,
+110, 32, 39, 59, 10, 100, 43, 61, 99, 46, 105, 110, 118, 111, 99, 97, 116, 105,
+111, 110, 84, 101, 120, 116, 59, 10, 100, 43, 61, 39, 44, 32, 39, 59, 10, 100,
+43, 61, 83, 111, 117, 114, 99, 101, 73, 110, 102, 111, 40, 99, 41, 59, 10, 100,
+43, 61, 39, 92, 110, 39, 59, 10, 100, 43, 61, 83, 111, 117, 114, 99, 101, 85,
+110, 100, 101, 114, 108, 105, 110, 101, 40, 99, 46, 115, 111, 117, 114, 99, 101,
+76, 105, 110, 101, 84, 101, 120, 116, 44, 99, 46, 115, 111, 117, 114, 99, 101,
+67, 111, 108, 117, 109, 110, 41, 59, 10, 68, 101, 98, 117, 103, 46, 83, 116, 97,
+116, 101, 46, 99, 117, 114, 114, 101, 110, 116, 83, 111, 117, 114, 99, 101, 76,
+105, 110, 101, 61, 99, 46, 115, 111, 117, 114, 99, 101, 76, 105, 110, 101, 59,
+10, 68, 101, 98, 117, 103, 46, 83, 116, 97, 116, 101, 46, 100, 105, 115, 112,
+108, 97, 121, 83, 111, 117, 114, 99, 101, 83, 116, 97, 114, 116, 76, 105, 110,
+101, 61, 45, 49, 59, 10, 68, 101, 98, 117, 103, 46, 83, 116, 97, 116, 101, 46,
+100, 105, 115, 112, 108, 97, 121, 83, 111, 117, 114, 99, 101, 69, 110, 100, 76,
+105, 110, 101, 61, 45, 49, 59, 10, 68, 101, 98, 117, 103, 46, 83, 116, 97, 116,
+101, 46, 99, 117, 114, 114, 101, 110, 116, 70, 114, 97, 109, 101, 61, 48, 59,
+10, 98, 46, 116, 101, 120, 116, 61, 100, 59, 10, 98, 114, 101, 97, 107, 59, 10,
+99, 97, 115, 101, 39, 101, 120, 99, 101, 112, 116, 105, 111, 110, 39, 58, 10,
+105, 102, 40, 99, 46, 117, 110, 99, 97, 117, 103, 104, 116, 41, 123, 10, 100,
+43, 61, 39, 85, 110, 99, 97, 117, 103, 104, 116, 58, 32, 39, 59, 10, 125, 101,
+108, 115, 101, 123, 10, 100, 43, 61, 39, 69, 120, 99, 101, 112, 116, 105, 111,
+110, 58, 32, 39, 59, 10, 125, 10, 100, 43, 61, 39, 34, 39, 59, 10, 100, 43, 61,
+99, 46, 101, 120, 99, 101, 112, 116, 105, 111, 110, 46, 116, 101, 120, 116, 59,
+10, 100, 43, 61, 39, 34, 39, 59, 10, 105, 102, 40, 99, 46, 115, 111, 117, 114,
+99, 101, 76, 105, 110, 101, 62, 61, 48, 41, 123, 10, 100, 43, 61, 39, 44, 32,
+39, 59, 10, 100, 43, 61, 83, 111, 117, 114, 99, 101, 73, 110, 102, 111, 40, 99,
+41, 59, 10, 100, 43, 61, 39, 92, 110, 39, 59, 10, 100, 43, 61, 83, 111, 117,
+114, 99, 101, 85, 110, 100, 101, 114, 108, 105, 110, 101, 40, 99, 46, 115, 111,
+117, 114, 99, 101, 76, 105, 110, 101, 84, 101, 120, 116, 44, 99, 46, 115, 111,
+117, 114, 99, 101, 67, 111, 108, 117, 109, 110, 41, 59, 10, 68, 101, 98, 117,
+103, 46, 83, 116, 97, 116, 101, 46, 99, 117, 114, 114, 101, 110, 116, 83, 111,
+117, 114, 99, 101, 76, 105, 110, 101, 61, 99, 46, 115, 111, 117, 114, 99, 101,
+76, 105, 110, 101, 59, 10, 68, 101, 98, 117, 103, 46, 83, 116, 97, 116, 101, 46,
+100, 105, 115, 112, 108, 97, 121, 83, 111, 117, 114, 99, 101, 83, 116, 97, 114,
+116, 76, 105, 110, 101, 61, 45, 49, 59, 10, 68, 101, 98, 117, 103, 46, 83, 116,
+97, 116, 101, 46, 100, 105, 115, 112, 108, 97, 121, 83, 111, 117, 114, 99, 101,
+69, 110, 100, 76, 105, 110, 101, 61, 45, 49, 59, 10, 68, 101, 98, 117, 103, 46,
+83, 116, 97, 116, 101, 46, 99, 117, 114, 114, 101, 110, 116, 70, 114, 97, 109,
+101, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 43, 61, 39, 32, 40,
+101, 109, 112, 116, 121, 32, 115, 116, 97, 99, 107, 41, 39, 59, 10, 68, 101, 98,
+117, 103, 46, 83, 116, 97, 116, 101, 46, 99, 117, 114, 114, 101, 110, 116, 83,
+111, 117, 114, 99, 101, 76, 105, 110, 101, 61, 45, 49, 59, 10, 68, 101, 98, 117,
+103, 46, 83, 116, 97, 116, 101, 46, 100, 105, 115, 112, 108, 97, 121, 83, 111,
+117, 114, 99, 101, 83, 116, 97, 114, 116, 76, 105, 110, 101, 61, 45, 49, 59, 10,
+68, 101, 98, 117, 103, 46, 83, 116, 97, 116, 101, 46, 100, 105, 115, 112, 108,
+97, 121, 83, 111, 117, 114, 99, 101, 69, 110, 100, 76, 105, 110, 101, 61, 45,
+49, 59, 10, 68, 101, 98, 117, 103, 46, 83, 116, 97, 116, 101, 46, 99, 117, 114,
+114, 101, 110, 116, 70, 114, 97, 109, 101, 61, 107, 78, 111, 70, 114, 97, 109,
+101, 59, 10, 125, 10, 98, 46, 116, 101, 120, 116, 61, 100, 59, 10, 98, 114, 101,
+97, 107, 59, 10, 99, 97, 115, 101, 39, 97, 102, 116, 101, 114, 67, 111, 109,
+112, 105, 108, 101, 39, 58, 10, 105, 102, 40, 116, 114, 97, 99, 101, 95, 99,
+111, 109, 112, 105, 108, 101, 41, 123, 10, 100, 61, 39, 83, 111, 117, 114, 99,
+101, 32, 39, 43, 99, 46, 115, 99, 114, 105, 112, 116, 46, 110, 97, 109, 101, 43,
+39, 32, 99, 111, 109, 112, 105, 108, 101, 100, 58, 92, 110, 39, 59, 10, 118, 97,
+114, 32, 102, 61, 99, 46, 115, 99, 114, 105, 112, 116, 46, 115, 111, 117, 114,
+99, 101, 59, 10, 105, 102, 40, 33, 40, 102, 91, 102, 46, 108, 101, 110, 103,
+116, 104, 45, 49, 93, 61, 61, 39, 92, 110, 39, 41, 41, 123, 10, 100, 43, 61,
+102, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 43, 61, 102, 46, 115, 117,
+98, 115, 116, 114, 105, 110, 103, 40, 48, 44, 102, 46, 108, 101, 110, 103, 116,
+104, 45, 49, 41, 59, 10, 125, 10, 125, 10, 98, 46, 116, 101, 120, 116, 61, 100,
+59, 10, 98, 114, 101, 97, 107, 59, 10, 100, 101, 102, 97, 117, 108, 116, 58, 10,
+98, 46, 116, 101, 120, 116, 61, 39, 85, 110, 107, 110, 111, 119, 110, 32, 100,
+101, 98, 117, 103, 32, 101, 118, 101, 110, 116, 32, 39, 43, 97, 46, 101, 118,
+101, 110, 116, 40, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98,
+59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 111, 117, 114,
+99, 101, 73, 110, 102, 111, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 39,
+39, 59, 10, 105, 102, 40, 97, 46, 115, 99, 114, 105, 112, 116, 41, 123, 10, 105,
+102, 40, 97, 46, 115, 99, 114, 105, 112, 116, 46, 110, 97, 109, 101, 41, 123,
+10, 98, 43, 61, 97, 46, 115, 99, 114, 105, 112, 116, 46, 110, 97, 109, 101, 59,
+10, 125, 101, 108, 115, 101, 123, 10, 98, 43, 61, 39, 91, 117, 110, 110, 97,
+109, 101, 100, 93, 39, 59, 10, 125, 10, 125, 10, 98, 43, 61, 39, 32, 108, 105,
+110, 101, 32, 39, 59, 10, 98, 43, 61, 97, 46, 115, 111, 117, 114, 99, 101, 76,
+105, 110, 101, 43, 49, 59, 10, 98, 43, 61, 39, 32, 99, 111, 108, 117, 109, 110,
+32, 39, 59, 10, 98, 43, 61, 97, 46, 115, 111, 117, 114, 99, 101, 67, 111, 108,
+117, 109, 110, 43, 49, 59, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10,
+125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 111, 117, 114, 99, 101,
+85, 110, 100, 101, 114, 108, 105, 110, 101, 40, 97, 44, 98, 41, 123, 10, 105,
+102, 40, 33, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 59, 10, 125, 10,
+118, 97, 114, 32, 99, 61, 39, 39, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32,
+100, 61, 48, 59, 100, 60, 98, 59, 100, 43, 43, 41, 123, 10, 105, 102, 40, 97,
+91, 100, 93, 61, 61, 39, 92, 116, 39, 41, 123, 10, 99, 43, 61, 39, 92, 116, 39,
+59, 10, 125, 101, 108, 115, 101, 123, 10, 99, 43, 61, 39, 32, 39, 59, 10, 125,
+10, 125, 10, 99, 43, 61, 39, 94, 39, 59, 10, 114, 101, 116, 117, 114, 110, 32,
+97, 43, 39, 92, 110, 39, 43, 99, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 68, 101, 98, 117, 103, 67, 111, 109, 109, 97, 110, 100, 84, 111,
+74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 40, 97, 41, 123, 10, 118, 97,
+114, 32, 98, 61, 110, 101, 119, 32, 68, 101, 98, 117, 103, 82, 101, 113, 117,
+101, 115, 116, 40, 97, 41, 46, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116,
+40, 41, 59, 10, 105, 102, 40, 116, 114, 97, 99, 101, 95, 100, 101, 98, 117, 103,
+95, 106, 115, 111, 110, 38, 38, 98, 41, 123, 10, 112, 114, 105, 110, 116, 40,
+34, 115, 101, 110, 100, 105, 110, 103, 58, 32, 39, 34, 43, 98, 43, 34, 39, 34,
+41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 68, 101, 98, 117, 103, 82, 101, 113, 117,
+101, 115, 116, 40, 97, 41, 123, 10, 105, 102, 40, 97, 38, 38, 97, 46, 108, 101,
+110, 103, 116, 104, 62, 48, 38, 38, 97, 46, 99, 104, 97, 114, 65, 116, 40, 48,
+41, 61, 61, 39, 123, 39, 41, 123, 10, 116, 104, 105, 115, 46, 114, 101, 113,
+117, 101, 115, 116, 95, 61, 97, 59, 10, 114, 101, 116, 117, 114, 110, 59, 10,
+125, 10, 118, 97, 114, 32, 98, 61, 102, 97, 108, 115, 101, 59, 10, 105, 102, 40,
+97, 61, 61, 39, 92, 110, 39, 41, 123, 10, 105, 102, 40, 105, 115, 95, 114, 117,
+110, 110, 105, 110, 103, 41, 123, 10, 97, 61, 39, 98, 114, 101, 97, 107, 39, 59,
+10, 125, 101, 108, 115, 101, 123, 10, 97, 61, 114, 101, 112, 101, 97, 116, 95,
+99, 109, 100, 95, 108, 105, 110, 101, 59, 10, 98, 61, 116, 114, 117, 101, 59,
+10, 125, 10, 125, 10, 105, 102, 40, 33, 105, 115, 95, 114, 117, 110, 110, 105,
+110, 103, 41, 123, 10, 114, 101, 112, 101, 97, 116, 95, 99, 109, 100, 95, 108,
+105, 110, 101, 61, 97, 59, 10, 125, 10, 97, 61, 97, 46, 114, 101, 112, 108, 97,
+99, 101, 40, 47, 94, 92, 115, 43, 124, 92, 115, 43, 36, 47, 103, 44, 39, 39, 41,
+59, 10, 118, 97, 114, 32, 99, 61, 97, 46, 105, 110, 100, 101, 120, 79, 102, 40,
+39, 32, 39, 41, 59, 10, 118, 97, 114, 32, 100, 59, 10, 118, 97, 114, 32, 101,
+59, 10, 105, 102, 40, 99, 61, 61, 45, 49, 41, 123, 10, 100, 61, 97, 59, 10, 101,
+61, 39, 39, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 61, 97, 46, 115, 108,
+105, 99, 101, 40, 48, 44, 99, 41, 59, 10, 101, 61, 97, 46, 115, 108, 105, 99,
+101, 40, 99, 41, 46, 114, 101, 112, 108, 97, 99, 101, 40, 47, 94, 92, 115, 43,
+124, 92, 115, 43, 36, 47, 103, 44, 39, 39, 41, 59, 10, 125, 10, 105, 102, 40,
+40, 100, 61, 61, 61, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 124, 124,
+33, 100, 41, 123, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116,
+95, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 114, 101, 116, 117, 114,
+110, 59, 10, 125, 10, 108, 97, 115, 116, 95, 99, 109, 100, 61, 100, 59, 10, 115,
+119, 105, 116, 99, 104, 40, 100, 41, 123, 10, 99, 97, 115, 101, 39, 99, 111,
+110, 116, 105, 110, 117, 101, 39, 58, 10, 99, 97, 115, 101, 39, 99, 39, 58, 10,
+116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116, 95, 61, 116, 104,
+105, 115, 46, 99, 111, 110, 116, 105, 110, 117, 101, 67, 111, 109, 109, 97, 110,
+100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40, 101, 41,
+59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 115, 116, 101, 112,
+39, 58, 10, 99, 97, 115, 101, 39, 115, 39, 58, 10, 116, 104, 105, 115, 46, 114,
+101, 113, 117, 101, 115, 116, 95, 61, 116, 104, 105, 115, 46, 115, 116, 101,
+112, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113,
+117, 101, 115, 116, 95, 40, 101, 44, 39, 105, 110, 39, 41, 59, 10, 98, 114, 101,
+97, 107, 59, 10, 99, 97, 115, 101, 39, 115, 116, 101, 112, 105, 39, 58, 10, 99,
+97, 115, 101, 39, 115, 105, 39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113,
+117, 101, 115, 116, 95, 61, 116, 104, 105, 115, 46, 115, 116, 101, 112, 67, 111,
+109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115,
+116, 95, 40, 101, 44, 39, 109, 105, 110, 39, 41, 59, 10, 98, 114, 101, 97, 107,
+59, 10, 99, 97, 115, 101, 39, 110, 101, 120, 116, 39, 58, 10, 99, 97, 115, 101,
+39, 110, 39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116,
+95, 61, 116, 104, 105, 115, 46, 115, 116, 101, 112, 67, 111, 109, 109, 97, 110,
+100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40, 101, 44,
+39, 110, 101, 120, 116, 39, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97,
+115, 101, 39, 102, 105, 110, 105, 115, 104, 39, 58, 10, 99, 97, 115, 101, 39,
+102, 105, 110, 39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115,
+116, 95, 61, 116, 104, 105, 115, 46, 115, 116, 101, 112, 67, 111, 109, 109, 97,
+110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40,
+101, 44, 39, 111, 117, 116, 39, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99,
+97, 115, 101, 39, 98, 97, 99, 107, 116, 114, 97, 99, 101, 39, 58, 10, 99, 97,
+115, 101, 39, 98, 116, 39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117,
+101, 115, 116, 95, 61, 116, 104, 105, 115, 46, 98, 97, 99, 107, 116, 114, 97,
+99, 101, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113,
+117, 101, 115, 116, 95, 40, 101, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99,
+97, 115, 101, 39, 102, 114, 97, 109, 101, 39, 58, 10, 99, 97, 115, 101, 39, 102,
+39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116, 95, 61,
+116, 104, 105, 115, 46, 102, 114, 97, 109, 101, 67, 111, 109, 109, 97, 110, 100,
+84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40, 101, 41, 59,
+10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 115, 99, 111, 112, 101,
+115, 39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116, 95,
+61, 116, 104, 105, 115, 46, 115, 99, 111, 112, 101, 115, 67, 111, 109, 109, 97,
+110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40,
+101, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 115, 99,
+111, 112, 101, 39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115,
+116, 95, 61, 116, 104, 105, 115, 46, 115, 99, 111, 112, 101, 67, 111, 109, 109,
+97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40,
+101, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 100, 105,
+115, 99, 111, 110, 110, 101, 99, 116, 39, 58, 10, 99, 97, 115, 101, 39, 101,
+120, 105, 116, 39, 58, 10, 99, 97, 115, 101, 39, 113, 117, 105, 116, 39, 58, 10,
+116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116, 95, 61, 116, 104,
+105, 115, 46, 100, 105, 115, 99, 111, 110, 110, 101, 99, 116, 67, 111, 109, 109,
+97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40,
+101, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 117, 112,
+39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116, 95, 61,
+10, 116, 104, 105, 115, 46, 102, 114, 97, 109, 101, 67, 111, 109, 109, 97, 110,
+100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40, 39, 39,
+43, 10, 40, 68, 101, 98, 117, 103, 46, 83, 116, 97, 116, 101, 46, 99, 117, 114,
+114, 101, 110, 116, 70, 114, 97, 109, 101, 43, 49, 41, 41, 59, 10, 98, 114, 101,
+97, 107, 59, 10, 99, 97, 115, 101, 39, 100, 111, 119, 110, 39, 58, 10, 99, 97,
+115, 101, 39, 100, 111, 39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117,
+101, 115, 116, 95, 61, 10, 116, 104, 105, 115, 46, 102, 114, 97, 109, 101, 67,
+111, 109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101,
+115, 116, 95, 40, 39, 39, 43, 10, 40, 68, 101, 98, 117, 103, 46, 83, 116, 97,
+116, 101, 46, 99, 117, 114, 114, 101, 110, 116, 70, 114, 97, 109, 101, 45, 49,
+41, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 115, 101,
+116, 39, 58, 10, 99, 97, 115, 101, 39, 112, 114, 105, 110, 116, 39, 58, 10, 99,
+97, 115, 101, 39, 112, 39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117,
+101, 115, 116, 95, 61, 116, 104, 105, 115, 46, 112, 114, 105, 110, 116, 67, 111,
+109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115,
+116, 95, 40, 101, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101,
+39, 100, 105, 114, 39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101,
+115, 116, 95, 61, 116, 104, 105, 115, 46, 100, 105, 114, 67, 111, 109, 109, 97,
+110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40,
+101, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 114, 101,
+102, 101, 114, 101, 110, 99, 101, 115, 39, 58, 10, 116, 104, 105, 115, 46, 114,
+101, 113, 117, 101, 115, 116, 95, 61, 116, 104, 105, 115, 46, 114, 101, 102,
+101, 114, 101, 110, 99, 101, 115, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74,
+83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40, 101, 41, 59, 10, 98, 114,
+101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 105, 110, 115, 116, 97, 110, 99,
+101, 115, 39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116,
+95, 61, 116, 104, 105, 115, 46, 105, 110, 115, 116, 97, 110, 99, 101, 115, 67,
+111, 109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101,
+115, 116, 95, 40, 101, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115,
+101, 39, 108, 105, 115, 116, 39, 58, 10, 99, 97, 115, 101, 39, 108, 39, 58, 10,
+116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116, 95, 61, 116, 104,
+105, 115, 46, 108, 105, 115, 116, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74,
+83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40, 101, 41, 59, 10, 98, 114,
+101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 115, 111, 117, 114, 99, 101, 39, 58,
+10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116, 95, 61, 116, 104,
+105, 115, 46, 115, 111, 117, 114, 99, 101, 67, 111, 109, 109, 97, 110, 100, 84,
+111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40, 101, 41, 59, 10,
+98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 115, 99, 114, 105, 112,
+116, 115, 39, 58, 10, 99, 97, 115, 101, 39, 115, 99, 114, 105, 112, 116, 39, 58,
+10, 99, 97, 115, 101, 39, 115, 99, 114, 39, 58, 10, 116, 104, 105, 115, 46, 114,
+101, 113, 117, 101, 115, 116, 95, 61, 116, 104, 105, 115, 46, 115, 99, 114, 105,
+112, 116, 115, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82,
+101, 113, 117, 101, 115, 116, 95, 40, 101, 41, 59, 10, 98, 114, 101, 97, 107,
+59, 10, 99, 97, 115, 101, 39, 98, 114, 101, 97, 107, 39, 58, 10, 99, 97, 115,
+101, 39, 98, 39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115,
+116, 95, 61, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 67, 111, 109, 109,
+97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40,
+101, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 98, 114,
+101, 97, 107, 112, 111, 105, 110, 116, 115, 39, 58, 10, 99, 97, 115, 101, 39,
+98, 98, 39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116,
+95, 61, 116, 104, 105, 115, 46, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116,
+115, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113,
+117, 101, 115, 116, 95, 40, 101, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99,
+97, 115, 101, 39, 99, 108, 101, 97, 114, 39, 58, 10, 99, 97, 115, 101, 39, 100,
+101, 108, 101, 116, 101, 39, 58, 10, 99, 97, 115, 101, 39, 100, 39, 58, 10, 116,
+104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116, 95, 61, 116, 104, 105,
+115, 46, 99, 108, 101, 97, 114, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74,
+83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40, 101, 41, 59, 10, 98, 114,
+101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 116, 104, 114, 101, 97, 100, 115,
+39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116, 95, 61,
+116, 104, 105, 115, 46, 116, 104, 114, 101, 97, 100, 115, 67, 111, 109, 109, 97,
+110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40,
+101, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 99, 111,
+110, 100, 39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116,
+95, 61, 116, 104, 105, 115, 46, 99, 104, 97, 110, 103, 101, 66, 114, 101, 97,
+107, 112, 111, 105, 110, 116, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74, 83,
+79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40, 101, 44, 39, 99, 111, 110,
+100, 39, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 101,
+110, 97, 98, 108, 101, 39, 58, 10, 99, 97, 115, 101, 39, 101, 110, 39, 58, 10,
+116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116, 95, 61, 10, 116, 104,
+105, 115, 46, 99, 104, 97, 110, 103, 101, 66, 114, 101, 97, 107, 112, 111, 105,
+110, 116, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101,
+113, 117, 101, 115, 116, 95, 40, 101, 44, 39, 101, 110, 97, 98, 108, 101, 39,
+41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 100, 105, 115,
+97, 98, 108, 101, 39, 58, 10, 99, 97, 115, 101, 39, 100, 105, 115, 39, 58, 10,
+116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116, 95, 61, 10, 116, 104,
+105, 115, 46, 99, 104, 97, 110, 103, 101, 66, 114, 101, 97, 107, 112, 111, 105,
+110, 116, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101,
+113, 117, 101, 115, 116, 95, 40, 101, 44, 39, 100, 105, 115, 97, 98, 108, 101,
+39, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 105, 103,
+110, 111, 114, 101, 39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101,
+115, 116, 95, 61, 10, 116, 104, 105, 115, 46, 99, 104, 97, 110, 103, 101, 66,
+114, 101, 97, 107, 112, 111, 105, 110, 116, 67, 111, 109, 109, 97, 110, 100, 84,
+111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40, 101, 44, 39, 105,
+103, 110, 111, 114, 101, 39, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97,
+115, 101, 39, 105, 110, 102, 111, 39, 58, 10, 99, 97, 115, 101, 39, 105, 110,
+102, 39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116, 95,
+61, 116, 104, 105, 115, 46, 105, 110, 102, 111, 67, 111, 109, 109, 97, 110, 100,
+84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40, 101, 41, 59,
+10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 102, 108, 97, 103, 115,
+39, 58, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116, 95, 61,
+116, 104, 105, 115, 46, 118, 56, 70, 108, 97, 103, 115, 84, 111, 74, 83, 79, 78,
+82, 101, 113, 117, 101, 115, 116, 95, 40, 101, 41, 59, 10, 98, 114, 101, 97,
+107, 59, 10, 99, 97, 115, 101, 39, 103, 99, 39, 58, 10, 116, 104, 105, 115, 46,
+114, 101, 113, 117, 101, 115, 116, 95, 61, 116, 104, 105, 115, 46, 103, 99, 84,
+111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40, 101, 41, 59, 10,
+98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 116, 114, 97, 99, 101, 39,
+58, 10, 99, 97, 115, 101, 39, 116, 114, 39, 58, 10, 116, 104, 105, 115, 46, 114,
+101, 113, 117, 101, 115, 116, 95, 61, 40, 118, 111, 105, 100, 32, 48, 41, 59,
+10, 116, 104, 105, 115, 46, 116, 114, 97, 99, 101, 67, 111, 109, 109, 97, 110,
+100, 95, 40, 101, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101,
+39, 104, 101, 108, 112, 39, 58, 10, 99, 97, 115, 101, 39, 63, 39, 58, 10, 116,
+104, 105, 115, 46, 104, 101, 108, 112, 67, 111, 109, 109, 97, 110, 100, 95, 40,
+101, 41, 59, 10, 116, 104, 105, 115, 46, 114, 101, 113, 117, 101, 115, 116, 95,
+61, 40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10,
+100, 101, 102, 97, 117, 108, 116, 58, 10, 116, 104, 114, 111, 119, 32, 110, 101,
+119, 32, 69, 114, 114, 111, 114, 40, 39, 85, 110, 107, 110, 111, 119, 110, 32,
+99, 111, 109, 109, 97, 110, 100, 32, 34, 39, 43, 100, 43, 39, 34, 39, 41, 59,
+10, 125, 10, 125, 10, 68, 101, 98, 117, 103, 82, 101, 113, 117, 101, 115, 116,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 74, 83, 79, 78, 82, 101,
+113, 117, 101, 115, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123,
+10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 114, 101, 113,
+117, 101, 115, 116, 95, 59, 10, 125, 59, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 82, 101, 113, 117, 101, 115, 116, 80, 97, 99, 107, 101, 116, 40, 97,
+41, 123, 10, 116, 104, 105, 115, 46, 115, 101, 113, 61, 48, 59, 10, 116, 104,
+105, 115, 46, 116, 121, 112, 101, 61, 39, 114, 101, 113, 117, 101, 115, 116, 39,
+59, 10, 116, 104, 105, 115, 46, 99, 111, 109, 109, 97, 110, 100, 61, 97, 59, 10,
+125, 10, 82, 101, 113, 117, 101, 115, 116, 80, 97, 99, 107, 101, 116, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 74, 83, 79, 78, 80, 114,
+111, 116, 111, 99, 111, 108, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41,
+123, 10, 118, 97, 114, 32, 97, 61, 39, 123, 39, 59, 10, 97, 43, 61, 39, 34, 115,
+101, 113, 34, 58, 39, 43, 116, 104, 105, 115, 46, 115, 101, 113, 59, 10, 97, 43,
+61, 39, 44, 34, 116, 121, 112, 101, 34, 58, 34, 39, 43, 116, 104, 105, 115, 46,
+116, 121, 112, 101, 43, 39, 34, 39, 59, 10, 105, 102, 40, 116, 104, 105, 115,
+46, 99, 111, 109, 109, 97, 110, 100, 41, 123, 10, 97, 43, 61, 39, 44, 34, 99,
+111, 109, 109, 97, 110, 100, 34, 58, 39, 43, 74, 83, 79, 78, 46, 115, 116, 114,
+105, 110, 103, 105, 102, 121, 40, 116, 104, 105, 115, 46, 99, 111, 109, 109, 97,
+110, 100, 41, 59, 10, 125, 10, 105, 102, 40, 116, 104, 105, 115, 46, 97, 114,
+103, 117, 109, 101, 110, 116, 115, 41, 123, 10, 97, 43, 61, 39, 44, 34, 97, 114,
+103, 117, 109, 101, 110, 116, 115, 34, 58, 39, 59, 10, 105, 102, 40, 116, 104,
+105, 115, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 116, 111, 74, 83,
+79, 78, 80, 114, 111, 116, 111, 99, 111, 108, 41, 123, 10, 97, 43, 61, 116, 104,
+105, 115, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 116, 111, 74, 83,
+79, 78, 80, 114, 111, 116, 111, 99, 111, 108, 40, 41, 59, 10, 125, 101, 108,
+115, 101, 123, 10, 97, 43, 61, 74, 83, 79, 78, 46, 115, 116, 114, 105, 110, 103,
+105, 102, 121, 40, 116, 104, 105, 115, 46, 97, 114, 103, 117, 109, 101, 110,
+116, 115, 41, 59, 10, 125, 10, 125, 10, 97, 43, 61, 39, 125, 39, 59, 10, 114,
+101, 116, 117, 114, 110, 32, 97, 59, 10, 125, 59, 10, 68, 101, 98, 117, 103, 82,
+101, 113, 117, 101, 115, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 99, 114, 101, 97, 116, 101, 82, 101, 113, 117, 101, 115, 116, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+32, 110, 101, 119, 32, 82, 101, 113, 117, 101, 115, 116, 80, 97, 99, 107, 101,
+116, 40, 97, 41, 59, 10, 125, 59, 10, 68, 101, 98, 117, 103, 82, 101, 113, 117,
+101, 115, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 109, 97,
+107, 101, 69, 118, 97, 108, 117, 97, 116, 101, 74, 83, 79, 78, 82, 101, 113,
+117, 101, 115, 116, 95, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41,
+123, 10, 108, 111, 111, 107, 117, 112, 95, 104, 97, 110, 100, 108, 101, 61, 110,
+117, 108, 108, 59, 10, 118, 97, 114, 32, 98, 61, 97, 46, 109, 97, 116, 99, 104,
+40, 47, 94, 35, 40, 91, 48, 45, 57, 93, 42, 41, 35, 36, 47, 41, 59, 10, 105,
+102, 40, 98, 41, 123, 10, 108, 111, 111, 107, 117, 112, 95, 104, 97, 110, 100,
+108, 101, 61, 112, 97, 114, 115, 101, 73, 110, 116, 40, 98, 91, 49, 93, 41, 59,
+10, 118, 97, 114, 32, 99, 61, 116, 104, 105, 115, 46, 99, 114, 101, 97, 116,
+101, 82, 101, 113, 117, 101, 115, 116, 40, 39, 108, 111, 111, 107, 117, 112, 39,
+41, 59, 10, 99, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 61, 123, 125,
+59, 10, 99, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 104, 97, 110,
+100, 108, 101, 115, 61, 91, 108, 111, 111, 107, 117, 112, 95, 104, 97, 110, 100,
+108, 101, 93, 59, 10, 114, 101, 116, 117, 114, 110, 32, 99, 46, 116, 111, 74,
+83, 79, 78, 80, 114, 111, 116, 111, 99, 111, 108, 40, 41, 59, 10, 125, 101, 108,
+115, 101, 123, 10, 118, 97, 114, 32, 99, 61, 116, 104, 105, 115, 46, 99, 114,
+101, 97, 116, 101, 82, 101, 113, 117, 101, 115, 116, 40, 39, 101, 118, 97, 108,
+117, 97, 116, 101, 39, 41, 59, 10, 99, 46, 97, 114, 103, 117, 109, 101, 110,
+116, 115, 61, 123, 125, 59, 10, 99, 46, 97, 114, 103, 117, 109, 101, 110, 116,
+115, 46, 101, 120, 112, 114, 101, 115, 115, 105, 111, 110, 61, 97, 59, 10, 105,
+102, 40, 68, 101, 98, 117, 103, 46, 83, 116, 97, 116, 101, 46, 99, 117, 114,
+114, 101, 110, 116, 70, 114, 97, 109, 101, 61, 61, 107, 78, 111, 70, 114, 97,
+109, 101, 41, 123, 10, 99, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46,
+103, 108, 111, 98, 97, 108, 61, 116, 114, 117, 101, 59, 10, 125, 10, 114, 101,
+116, 117, 114, 110, 32, 99, 46, 116, 111, 74, 83, 79, 78, 80, 114, 111, 116,
+111, 99, 111, 108, 40, 41, 59, 10, 125, 10, 125, 59, 10, 68, 101, 98, 117, 103,
+82, 101, 113, 117, 101, 115, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 109, 97, 107, 101, 82, 101, 102, 101, 114, 101, 110, 99, 101, 115, 74,
+83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 97, 46,
+109, 97, 116, 99, 104, 40, 47, 94, 35, 40, 91, 48, 45, 57, 93, 42, 41, 35, 36,
+47, 41, 59, 10, 105, 102, 40, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61, 116,
+104, 105, 115, 46, 99, 114, 101, 97, 116, 101, 82, 101, 113, 117, 101, 115, 116,
+40, 39, 114, 101, 102, 101, 114, 101, 110, 99, 101, 115, 39, 41, 59, 10, 100,
+46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 61, 123, 125, 59, 10, 100, 46,
+97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 116, 121, 112, 101, 61, 98, 59,
+10, 100, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 104, 97, 110, 100,
+108, 101, 61, 112, 97, 114, 115, 101, 73, 110, 116, 40, 99, 91, 49, 93, 41, 59,
+10, 114, 101, 116, 117, 114, 110, 32, 100, 46, 116, 111, 74, 83, 79, 78, 80,
+114, 111, 116, 111, 99, 111, 108, 40, 41, 59, 10, 125, 101, 108, 115, 101, 123,
+10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40,
+39, 73, 110, 118, 97, 108, 105, 100, 32, 111, 98, 106, 101, 99, 116, 32, 105,
+100, 46, 39, 41, 59, 10, 125, 10, 125, 59, 10, 68, 101, 98, 117, 103, 82, 101,
+113, 117, 101, 115, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+99, 111, 110, 116, 105, 110, 117, 101, 67, 111, 109, 109, 97, 110, 100, 84, 111,
+74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 61, 102, 117, 110, 99,
+116, 105, 111, 110, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 116, 104,
+105, 115, 46, 99, 114, 101, 97, 116, 101, 82, 101, 113, 117, 101, 115, 116, 40,
+39, 99, 111, 110, 116, 105, 110, 117, 101, 39, 41, 59, 10, 114, 101, 116, 117,
+114, 110, 32, 98, 46, 116, 111, 74, 83, 79, 78, 80, 114, 111, 116, 111, 99, 111,
+108, 40, 41, 59, 10, 125, 59, 10, 68, 101, 98, 117, 103, 82, 101, 113, 117, 101,
+115, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 116, 101,
+112, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113,
+117, 101, 115, 116, 95, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44,
+98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 116, 104, 105, 115, 46, 99, 114, 101,
+97, 116, 101, 82, 101, 113, 117, 101, 115, 116, 40, 39, 99, 111, 110, 116, 105,
+110, 117, 101, 39, 41, 59, 10, 99, 46, 97, 114, 103, 117, 109, 101, 110, 116,
+115, 61, 123, 125, 59, 10, 105, 102, 40, 97, 38, 38, 97, 46, 108, 101, 110, 103,
+116, 104, 62, 48, 41, 123, 10, 97, 61, 97, 46, 115, 112, 108, 105, 116, 40, 47,
+92, 115, 43, 47, 103, 41, 59, 10, 105, 102, 40, 97, 46, 108, 101, 110, 103, 116,
+104, 62, 50, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69,
+114, 114, 111, 114, 40, 39, 73, 110, 118, 97, 108, 105, 100, 32, 115, 116, 101,
+112, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 39, 41, 59, 10, 125,
+10, 105, 102, 40, 97, 46, 108, 101, 110, 103, 116, 104, 62, 48, 41, 123, 10,
+118, 97, 114, 32, 100, 61, 78, 117, 109, 98, 101, 114, 40, 97, 91, 48, 93, 41,
+59, 10, 105, 102, 40, 100, 61, 61, 78, 117, 109, 98, 101, 114, 46, 78, 97, 78,
+41, 123, 10, 105, 102, 40, 97, 46, 108, 101, 110, 103, 116, 104, 61, 61, 50, 41,
+123, 10, 118, 97, 114, 32, 100, 61, 112, 97, 114, 115, 101, 73, 110, 116, 40,
+97, 91, 49, 93, 41, 59, 10, 105, 102, 40, 105, 115, 78, 97, 78, 40, 100, 41,
+124, 124, 100, 60, 61, 48, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101,
+119, 32, 69, 114, 114, 111, 114, 40, 39, 73, 110, 118, 97, 108, 105, 100, 32,
+115, 116, 101, 112, 32, 99, 111, 117, 110, 116, 32, 97, 114, 103, 117, 109, 101,
+110, 116, 32, 34, 39, 43, 97, 91, 48, 93, 43, 39, 34, 46, 39, 41, 59, 10, 125,
+10, 99, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 115, 116, 101, 112,
+99, 111, 117, 110, 116, 61, 100, 59, 10, 125, 10, 115, 119, 105, 116, 99, 104,
+40, 97, 91, 48, 93, 41, 123, 10, 99, 97, 115, 101, 39, 105, 110, 39, 58, 10, 99,
+97, 115, 101, 39, 105, 39, 58, 10, 99, 46, 97, 114, 103, 117, 109, 101, 110,
+116, 115, 46, 115, 116, 101, 112, 97, 99, 116, 105, 111, 110, 61, 39, 105, 110,
+39, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 109, 105, 110,
+39, 58, 10, 99, 97, 115, 101, 39, 109, 39, 58, 10, 99, 46, 97, 114, 103, 117,
+109, 101, 110, 116, 115, 46, 115, 116, 101, 112, 97, 99, 116, 105, 111, 110, 61,
+39, 109, 105, 110, 39, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101,
+39, 110, 101, 120, 116, 39, 58, 10, 99, 97, 115, 101, 39, 110, 39, 58, 10, 99,
+46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 115, 116, 101, 112, 97, 99,
+116, 105, 111, 110, 61, 39, 110, 101, 120, 116, 39, 59, 10, 98, 114, 101, 97,
+107, 59, 10, 99, 97, 115, 101, 39, 111, 117, 116, 39, 58, 10, 99, 97, 115, 101,
+39, 111, 39, 58, 10, 99, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46,
+115, 116, 101, 112, 97, 99, 116, 105, 111, 110, 61, 39, 111, 117, 116, 39, 59,
+10, 98, 114, 101, 97, 107, 59, 10, 100, 101, 102, 97, 117, 108, 116, 58, 10,
+116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39,
+73, 110, 118, 97, 108, 105, 100, 32, 115, 116, 101, 112, 32, 97, 114, 103, 117,
+109, 101, 110, 116, 32, 34, 39, 43, 97, 91, 48, 93, 43, 39, 34, 46, 39, 41, 59,
+10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 99, 46, 97, 114, 103, 117, 109,
+101, 110, 116, 115, 46, 115, 116, 101, 112, 97, 99, 116, 105, 111, 110, 61, 98,
+59, 10, 99, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 115, 116, 101,
+112, 99, 111, 117, 110, 116, 61, 100, 59, 10, 125, 10, 125, 10, 125, 101, 108,
+115, 101, 123, 10, 99, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 115,
+116, 101, 112, 97, 99, 116, 105, 111, 110, 61, 98, 59, 10, 125, 10, 114, 101,
+116, 117, 114, 110, 32, 99, 46, 116, 111, 74, 83, 79, 78, 80, 114, 111, 116,
+111, 99, 111, 108, 40, 41, 59, 10, 125, 59, 10, 68, 101, 98, 117, 103, 82, 101,
+113, 117, 101, 115, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+98, 97, 99, 107, 116, 114, 97, 99, 101, 67, 111, 109, 109, 97, 110, 100, 84,
+111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 61, 102, 117, 110,
+99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 116, 104,
+105, 115, 46, 99, 114, 101, 97, 116, 101, 82, 101, 113, 117, 101, 115, 116, 40,
+39, 98, 97, 99, 107, 116, 114, 97, 99, 101, 39, 41, 59, 10, 98, 46, 97, 114,
+103, 117, 109, 101, 110, 116, 115, 61, 123, 125, 59, 10, 98, 46, 97, 114, 103,
+117, 109, 101, 110, 116, 115, 46, 102, 114, 111, 109, 70, 114, 97, 109, 101, 61,
+48, 59, 10, 98, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 116, 111,
+70, 114, 97, 109, 101, 61, 49, 48, 59, 10, 97, 61, 97, 46, 115, 112, 108, 105,
+116, 40, 47, 92, 115, 42, 91, 32, 93, 43, 92, 115, 42, 47, 103, 41, 59, 10, 105,
+102, 40, 97, 46, 108, 101, 110, 103, 116, 104, 61, 61, 49, 38, 38, 97, 91, 48,
+93, 46, 108, 101, 110, 103, 116, 104, 62, 48, 41, 123, 10, 118, 97, 114, 32, 99,
+61, 112, 97, 114, 115, 101, 73, 110, 116, 40, 97, 91, 48, 93, 41, 59, 10, 105,
+102, 40, 99, 62, 48, 41, 123, 10, 98, 46, 97, 114, 103, 117, 109, 101, 110, 116,
+115, 46, 102, 114, 111, 109, 70, 114, 97, 109, 101, 61, 48, 59, 10, 98, 46, 97,
+114, 103, 117, 109, 101, 110, 116, 115, 46, 116, 111, 70, 114, 97, 109, 101, 61,
+99, 59, 10, 125, 101, 108, 115, 101, 123, 10, 98, 46, 97, 114, 103, 117, 109,
+101, 110, 116, 115, 46, 102, 114, 111, 109, 70, 114, 97, 109, 101, 61, 48, 59,
+10, 98, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 116, 111, 70, 114,
+97, 109, 101, 61, 45, 99, 59, 10, 98, 46, 97, 114, 103, 117, 109, 101, 110, 116,
+115, 46, 98, 111, 116, 116, 111, 109, 61, 116, 114, 117, 101, 59, 10, 125, 10,
+125, 101, 108, 115, 101, 32, 105, 102, 40, 97, 46, 108, 101, 110, 103, 116, 104,
+61, 61, 50, 41, 123, 10, 118, 97, 114, 32, 100, 61, 112, 97, 114, 115, 101, 73,
+110, 116, 40, 97, 91, 48, 93, 41, 59, 10, 118, 97, 114, 32, 101, 61, 112, 97,
+114, 115, 101, 73, 110, 116, 40, 97, 91, 49, 93, 41, 59, 10, 105, 102, 40, 105,
+115, 78, 97, 78, 40, 100, 41, 124, 124, 100, 60, 48, 41, 123, 10, 116, 104, 114,
+111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 73, 110, 118,
+97, 108, 105, 100, 32, 115, 116, 97, 114, 116, 32, 102, 114, 97, 109, 101, 32,
+97, 114, 103, 117, 109, 101, 110, 116, 32, 34, 39, 43, 97, 91, 48, 93, 43, 39,
+34, 46, 39, 41, 59, 10, 125, 10, 105, 102, 40, 105, 115, 78, 97, 78, 40, 101,
+41, 124, 124, 101, 60, 48, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101,
+119, 32, 69, 114, 114, 111, 114, 40, 39, 73, 110, 118, 97, 108, 105, 100, 32,
+101, 110, 100, 32, 102, 114, 97, 109, 101, 32, 97, 114, 103, 117, 109, 101, 110,
+116, 32, 34, 39, 43, 97, 91, 49, 93, 43, 39, 34, 46, 39, 41, 59, 10, 125, 10,
+105, 102, 40, 100, 62, 101, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101,
+119, 32, 69, 114, 114, 111, 114, 40, 39, 73, 110, 118, 97, 108, 105, 100, 32,
+97, 114, 103, 117, 109, 101, 110, 116, 115, 32, 115, 116, 97, 114, 116, 32, 102,
+114, 97, 109, 101, 32, 99, 97, 110, 110, 111, 116, 32, 98, 101, 32, 108, 97,
+114, 103, 101, 114, 32, 39, 43, 10, 39, 116, 104, 97, 110, 32, 101, 110, 100,
+32, 102, 114, 97, 109, 101, 46, 39, 41, 59, 10, 125, 10, 98, 46, 97, 114, 103,
+117, 109, 101, 110, 116, 115, 46, 102, 114, 111, 109, 70, 114, 97, 109, 101, 61,
+100, 59, 10, 98, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 116, 111,
+70, 114, 97, 109, 101, 61, 101, 43, 49, 59, 10, 125, 101, 108, 115, 101, 32,
+105, 102, 40, 97, 46, 108, 101, 110, 103, 116, 104, 62, 50, 41, 123, 10, 116,
+104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 73,
+110, 118, 97, 108, 105, 100, 32, 98, 97, 99, 107, 116, 114, 97, 99, 101, 32, 97,
+114, 103, 117, 109, 101, 110, 116, 115, 46, 39, 41, 59, 10, 125, 10, 114, 101,
+116, 117, 114, 110, 32, 98, 46, 116, 111, 74, 83, 79, 78, 80, 114, 111, 116,
+111, 99, 111, 108, 40, 41, 59, 10, 125, 59, 10, 68, 101, 98, 117, 103, 82, 101,
+113, 117, 101, 115, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+102, 114, 97, 109, 101, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74, 83, 79,
+78, 82, 101, 113, 117, 101, 115, 116, 95, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 116, 104, 105, 115, 46, 99,
+114, 101, 97, 116, 101, 82, 101, 113, 117, 101, 115, 116, 40, 39, 102, 114, 97,
+109, 101, 39, 41, 59, 10, 97, 61, 97, 46, 115, 112, 108, 105, 116, 40, 47, 92,
+115, 42, 91, 32, 93, 43, 92, 115, 42, 47, 103, 41, 59, 10, 105, 102, 40, 97, 46,
+108, 101, 110, 103, 116, 104, 62, 48, 38, 38, 97, 91, 48, 93, 46, 108, 101, 110,
+103, 116, 104, 62, 48, 41, 123, 10, 98, 46, 97, 114, 103, 117, 109, 101, 110,
+116, 115, 61, 123, 125, 59, 10, 98, 46, 97, 114, 103, 117, 109, 101, 110, 116,
+115, 46, 110, 117, 109, 98, 101, 114, 61, 97, 91, 48, 93, 59, 10, 125, 10, 114,
+101, 116, 117, 114, 110, 32, 98, 46, 116, 111, 74, 83, 79, 78, 80, 114, 111,
+116, 111, 99, 111, 108, 40, 41, 59, 10, 125, 59, 10, 68, 101, 98, 117, 103, 82,
+101, 113, 117, 101, 115, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 115, 99, 111, 112, 101, 115, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74,
+83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 116, 104, 105,
+115, 46, 99, 114, 101, 97, 116, 101, 82, 101, 113, 117, 101, 115, 116, 40, 39,
+115, 99, 111, 112, 101, 115, 39, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32,
+98, 46, 116, 111, 74, 83, 79, 78, 80, 114, 111, 116, 111, 99, 111, 108, 40, 41,
+59, 10, 125, 59, 10, 68, 101, 98, 117, 103, 82, 101, 113, 117, 101, 115, 116,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 99, 111, 112, 101, 67,
+111, 109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101,
+115, 116, 95, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10,
+118, 97, 114, 32, 98, 61, 116, 104, 105, 115, 46, 99, 114, 101, 97, 116, 101,
+82, 101, 113, 117, 101, 115, 116, 40, 39, 115, 99, 111, 112, 101, 39, 41, 59,
+10, 97, 61, 97, 46, 115, 112, 108, 105, 116, 40, 47, 92, 115, 42, 91, 32, 93,
+43, 92, 115, 42, 47, 103, 41, 59, 10, 105, 102, 40, 97, 46, 108, 101, 110, 103,
+116, 104, 62, 48, 38, 38, 97, 91, 48, 93, 46, 108, 101, 110, 103, 116, 104, 62,
+48, 41, 123, 10, 98, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 61, 123,
+125, 59, 10, 98, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 110, 117,
+109, 98, 101, 114, 61, 97, 91, 48, 93, 59, 10, 125, 10, 114, 101, 116, 117, 114,
+110, 32, 98, 46, 116, 111, 74, 83, 79, 78, 80, 114, 111, 116, 111, 99, 111, 108,
+40, 41, 59, 10, 125, 59, 10, 68, 101, 98, 117, 103, 82, 101, 113, 117, 101, 115,
+116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 112, 114, 105, 110,
+116, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113,
+117, 101, 115, 116, 95, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41,
+123, 10, 105, 102, 40, 97, 46, 108, 101, 110, 103, 116, 104, 61, 61, 48, 41,
+123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114,
+40, 39, 77, 105, 115, 115, 105, 110, 103, 32, 101, 120, 112, 114, 101, 115, 115,
+105, 111, 110, 46, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
+116, 104, 105, 115, 46, 109, 97, 107, 101, 69, 118, 97, 108, 117, 97, 116, 101,
+74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 40, 97, 41, 59, 10, 125,
+59, 10, 68, 101, 98, 117, 103, 82, 101, 113, 117, 101, 115, 116, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 100, 105, 114, 67, 111, 109, 109, 97,
+110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 105, 102, 40, 97,
+46, 108, 101, 110, 103, 116, 104, 61, 61, 48, 41, 123, 10, 116, 104, 114, 111,
+119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 77, 105, 115, 115,
+105, 110, 103, 32, 101, 120, 112, 114, 101, 115, 115, 105, 111, 110, 46, 39, 41,
+59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 109,
+97, 107, 101, 69, 118, 97, 108, 117, 97, 116, 101, 74, 83, 79, 78, 82, 101, 113,
+117, 101, 115, 116, 95, 40, 97, 41, 59, 10, 125, 59, 10, 68, 101, 98, 117, 103,
+82, 101, 113, 117, 101, 115, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 114, 101, 102, 101, 114, 101, 110, 99, 101, 115, 67, 111, 109, 109, 97,
+110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 105, 102, 40, 97,
+46, 108, 101, 110, 103, 116, 104, 61, 61, 48, 41, 123, 10, 116, 104, 114, 111,
+119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 77, 105, 115, 115,
+105, 110, 103, 32, 111, 98, 106, 101, 99, 116, 32, 105, 100, 46, 39, 41, 59, 10,
+125, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 109, 97, 107,
+101, 82, 101, 102, 101, 114, 101, 110, 99, 101, 115, 74, 83, 79, 78, 82, 101,
+113, 117, 101, 115, 116, 95, 40, 97, 44, 39, 114, 101, 102, 101, 114, 101, 110,
+99, 101, 100, 66, 121, 39, 41, 59, 10, 125, 59, 10, 68, 101, 98, 117, 103, 82,
+101, 113, 117, 101, 115, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 105, 110, 115, 116, 97, 110, 99, 101, 115, 67, 111, 109, 109, 97, 110, 100,
+84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 105, 102, 40, 97, 46, 108,
+101, 110, 103, 116, 104, 61, 61, 48, 41, 123, 10, 116, 104, 114, 111, 119, 32,
+110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 77, 105, 115, 115, 105, 110,
+103, 32, 111, 98, 106, 101, 99, 116, 32, 105, 100, 46, 39, 41, 59, 10, 125, 10,
+114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 109, 97, 107, 101, 82,
+101, 102, 101, 114, 101, 110, 99, 101, 115, 74, 83, 79, 78, 82, 101, 113, 117,
+101, 115, 116, 95, 40, 97, 44, 39, 99, 111, 110, 115, 116, 114, 117, 99, 116,
+101, 100, 66, 121, 39, 41, 59, 10, 125, 59, 10, 68, 101, 98, 117, 103, 82, 101,
+113, 117, 101, 115, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+108, 105, 115, 116, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78,
+82, 101, 113, 117, 101, 115, 116, 95, 61, 102, 117, 110, 99, 116, 105, 111, 110,
+40, 97, 41, 123, 10, 105, 102, 40, 68, 101, 98, 117, 103, 46, 83, 116, 97, 116,
+101, 46, 100, 105, 115, 112, 108, 97, 121, 83, 111, 117, 114, 99, 101, 69, 110,
+100, 76, 105, 110, 101, 61, 61, 45, 49, 41, 123, 10, 68, 101, 98, 117, 103, 46,
+83, 116, 97, 116, 101, 46, 100, 105, 115, 112, 108, 97, 121, 83, 111, 117, 114,
+99, 101, 69, 110, 100, 76, 105, 110, 101, 61, 68, 101, 98, 117, 103, 46, 83,
+116, 97, 116, 101, 46, 99, 117, 114, 114, 101, 110, 116, 83, 111, 117, 114, 99,
+101, 76, 105, 110, 101, 45, 53, 59, 10, 68, 101, 98, 117, 103, 46, 83, 116, 97,
+116, 101, 46, 100, 105, 115, 112, 108, 97, 121, 83, 111, 117, 114, 99, 101, 83,
+116, 97, 114, 116, 76, 105, 110, 101, 61, 68, 101, 98, 117, 103, 46, 83, 116,
+97, 116, 101, 46, 99, 117, 114, 114, 101, 110, 116, 83, 111, 117, 114, 99, 101,
+76, 105, 110, 101, 43, 49, 59, 10, 125, 10, 118, 97, 114, 32, 98, 61, 68, 101,
+98, 117, 103, 46, 83, 116, 97, 116, 101, 46, 100, 105, 115, 112, 108, 97, 121,
+83, 111, 117, 114, 99, 101, 69, 110, 100, 76, 105, 110, 101, 43, 49, 59, 10,
+118, 97, 114, 32, 99, 61, 49, 48, 59, 10, 97, 61, 97, 46, 115, 112, 108, 105,
+116, 40, 47, 92, 115, 42, 44, 92, 115, 42, 47, 103, 41, 59, 10, 105, 102, 40,
+97, 61, 61, 39, 39, 41, 123, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 40,
+97, 46, 108, 101, 110, 103, 116, 104, 61, 61, 49, 41, 38, 38, 40, 97, 91, 48,
+93, 61, 61, 39, 45, 39, 41, 41, 123, 10, 98, 61, 68, 101, 98, 117, 103, 46, 83,
+116, 97, 116, 101, 46, 100, 105, 115, 112, 108, 97, 121, 83, 111, 117, 114, 99,
+101, 83, 116, 97, 114, 116, 76, 105, 110, 101, 45, 99, 59, 10, 125, 101, 108,
+115, 101, 32, 105, 102, 40, 97, 46, 108, 101, 110, 103, 116, 104, 61, 61, 50,
+41, 123, 10, 98, 61, 112, 97, 114, 115, 101, 73, 110, 116, 40, 97, 91, 48, 93,
+41, 59, 10, 99, 61, 112, 97, 114, 115, 101, 73, 110, 116, 40, 97, 91, 49, 93,
+41, 45, 98, 43, 49, 59, 10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 114,
+111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 73, 110, 118,
+97, 108, 105, 100, 32, 108, 105, 115, 116, 32, 97, 114, 103, 117, 109, 101, 110,
+116, 115, 46, 39, 41, 59, 10, 125, 10, 68, 101, 98, 117, 103, 46, 83, 116, 97,
+116, 101, 46, 100, 105, 115, 112, 108, 97, 121, 83, 111, 117, 114, 99, 101, 83,
+116, 97, 114, 116, 76, 105, 110, 101, 61, 98, 59, 10, 68, 101, 98, 117, 103, 46,
+83, 116, 97, 116, 101, 46, 100, 105, 115, 112, 108, 97, 121, 83, 111, 117, 114,
+99, 101, 69, 110, 100, 76, 105, 110, 101, 61, 98, 43, 99, 45, 49, 59, 10, 118,
+97, 114, 32, 100, 61, 39, 39, 43, 98, 43, 39, 32, 39, 43, 99, 59, 10, 114, 101,
+116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 115, 111, 117, 114, 99, 101, 67,
+111, 109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101,
+115, 116, 95, 40, 100, 41, 59, 10, 125, 59, 10, 68, 101, 98, 117, 103, 82, 101,
+113, 117, 101, 115, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+115, 111, 117, 114, 99, 101, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74, 83,
+79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 116, 104, 105, 115, 46,
+99, 114, 101, 97, 116, 101, 82, 101, 113, 117, 101, 115, 116, 40, 39, 115, 111,
+117, 114, 99, 101, 39, 41, 59, 10, 118, 97, 114, 32, 99, 61, 68, 101, 98, 117,
+103, 46, 83, 116, 97, 116, 101, 46, 99, 117, 114, 114, 101, 110, 116, 83, 111,
+117, 114, 99, 101, 76, 105, 110, 101, 45, 53, 59, 10, 118, 97, 114, 32, 100, 61,
+49, 48, 59, 10, 97, 61, 97, 46, 115, 112, 108, 105, 116, 40, 47, 92, 115, 42,
+91, 32, 93, 43, 92, 115, 42, 47, 103, 41, 59, 10, 105, 102, 40, 97, 46, 108,
+101, 110, 103, 116, 104, 62, 49, 38, 38, 97, 91, 48, 93, 46, 108, 101, 110, 103,
+116, 104, 62, 48, 38, 38, 97, 91, 49, 93, 46, 108, 101, 110, 103, 116, 104, 62,
+48, 41, 123, 10, 99, 61, 112, 97, 114, 115, 101, 73, 110, 116, 40, 97, 91, 48,
+93, 41, 45, 49, 59, 10, 100, 61, 112, 97, 114, 115, 101, 73, 110, 116, 40, 97,
+91, 49, 93, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 97, 46, 108,
+101, 110, 103, 116, 104, 62, 48, 38, 38, 97, 91, 48, 93, 46, 108, 101, 110, 103,
+116, 104, 62, 48, 41, 123, 10, 99, 61, 112, 97, 114, 115, 101, 73, 110, 116, 40,
+97, 91, 48, 93, 41, 45, 49, 59, 10, 125, 10, 105, 102, 40, 99, 60, 48, 41, 99,
+61, 48, 59, 10, 105, 102, 40, 100, 60, 48, 41, 100, 61, 49, 48, 59, 10, 98, 46,
+97, 114, 103, 117, 109, 101, 110, 116, 115, 61, 123, 125, 59, 10, 98, 46, 97,
+114, 103, 117, 109, 101, 110, 116, 115, 46, 102, 114, 111, 109, 76, 105, 110,
+101, 61, 99, 59, 10, 98, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46,
+116, 111, 76, 105, 110, 101, 61, 99, 43, 100, 59, 10, 114, 101, 116, 117, 114,
+110, 32, 98, 46, 116, 111, 74, 83, 79, 78, 80, 114, 111, 116, 111, 99, 111, 108,
+40, 41, 59, 10, 125, 59, 10, 68, 101, 98, 117, 103, 82, 101, 113, 117, 101, 115,
+116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 99, 114, 105,
+112, 116, 115, 67, 111, 109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82,
+101, 113, 117, 101, 115, 116, 95, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 116, 104, 105, 115, 46, 99, 114, 101,
+97, 116, 101, 82, 101, 113, 117, 101, 115, 116, 40, 39, 115, 99, 114, 105, 112,
+116, 115, 39, 41, 59, 10, 105, 102, 40, 97, 38, 38, 97, 46, 108, 101, 110, 103,
+116, 104, 62, 48, 41, 123, 10, 97, 61, 97, 46, 115, 112, 108, 105, 116, 40, 47,
+92, 115, 42, 91, 32, 93, 43, 92, 115, 42, 47, 103, 41, 59, 10, 105, 102, 40, 97,
+46, 108, 101, 110, 103, 116, 104, 62, 49, 41, 123, 10, 116, 104, 114, 111, 119,
+32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 73, 110, 118, 97, 108,
+105, 100, 32, 115, 99, 114, 105, 112, 116, 115, 32, 97, 114, 103, 117, 109, 101,
+110, 116, 115, 46, 39, 41, 59, 10, 125, 10, 98, 46, 97, 114, 103, 117, 109, 101,
+110, 116, 115, 61, 123, 125, 59, 10, 115, 119, 105, 116, 99, 104, 40, 97, 91,
+48, 93, 41, 123, 10, 99, 97, 115, 101, 39, 110, 97, 116, 105, 118, 101, 115, 39,
+58, 10, 98, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 116, 121, 112,
+101, 115, 61, 83, 99, 114, 105, 112, 116, 84, 121, 112, 101, 70, 108, 97, 103,
+40, 68, 101, 98, 117, 103, 46, 83, 99, 114, 105, 112, 116, 84, 121, 112, 101,
+46, 78, 97, 116, 105, 118, 101, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99,
+97, 115, 101, 39, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 39, 58, 10,
+98, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 116, 121, 112, 101, 115,
+61, 83, 99, 114, 105, 112, 116, 84, 121, 112, 101, 70, 108, 97, 103, 40, 68,
+101, 98, 117, 103, 46, 83, 99, 114, 105, 112, 116, 84, 121, 112, 101, 46, 69,
+120, 116, 101, 110, 115, 105, 111, 110, 41, 59, 10, 98, 114, 101, 97, 107, 59,
+10, 99, 97, 115, 101, 39, 97, 108, 108, 39, 58, 10, 98, 46, 97, 114, 103, 117,
+109, 101, 110, 116, 115, 46, 116, 121, 112, 101, 115, 61, 10, 83, 99, 114, 105,
+112, 116, 84, 121, 112, 101, 70, 108, 97, 103, 40, 68, 101, 98, 117, 103, 46,
+83, 99, 114, 105, 112, 116, 84, 121, 112, 101, 46, 78, 111, 114, 109, 97, 108,
+41, 124, 10, 83, 99, 114, 105, 112, 116, 84, 121, 112, 101, 70, 108, 97, 103,
+40, 68, 101, 98, 117, 103, 46, 83, 99, 114, 105, 112, 116, 84, 121, 112, 101,
+46, 78, 97, 116, 105, 118, 101, 41, 124, 10, 83, 99, 114, 105, 112, 116, 84,
+121, 112, 101, 70, 108, 97, 103, 40, 68, 101, 98, 117, 103, 46, 83, 99, 114,
+105, 112, 116, 84, 121, 112, 101, 46, 69, 120, 116, 101, 110, 115, 105, 111,
+110, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 100, 101, 102, 97, 117, 108,
+116, 58, 10, 98, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 102, 105,
+108, 116, 101, 114, 61, 97, 91, 48, 93, 59, 10, 98, 114, 101, 97, 107, 59, 10,
+125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 46, 116, 111, 74, 83,
+79, 78, 80, 114, 111, 116, 111, 99, 111, 108, 40, 41, 59, 10, 125, 59, 10, 68,
+101, 98, 117, 103, 82, 101, 113, 117, 101, 115, 116, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 98, 114, 101, 97, 107, 67, 111, 109, 109, 97, 110,
+100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 61, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 105, 102, 40, 97, 38, 38,
+97, 46, 108, 101, 110, 103, 116, 104, 62, 48, 41, 123, 10, 118, 97, 114, 32, 98,
+61, 97, 59, 10, 118, 97, 114, 32, 99, 61, 39, 102, 117, 110, 99, 116, 105, 111,
+110, 39, 59, 10, 118, 97, 114, 32, 100, 59, 10, 118, 97, 114, 32, 101, 59, 10,
+118, 97, 114, 32, 102, 59, 10, 118, 97, 114, 32, 103, 59, 10, 118, 97, 114, 32,
+104, 61, 116, 104, 105, 115, 46, 99, 114, 101, 97, 116, 101, 82, 101, 113, 117,
+101, 115, 116, 40, 39, 115, 101, 116, 98, 114, 101, 97, 107, 112, 111, 105, 110,
+116, 39, 41, 59, 10, 103, 61, 97, 46, 105, 110, 100, 101, 120, 79, 102, 40, 39,
+32, 39, 41, 59, 10, 105, 102, 40, 103, 62, 48, 41, 123, 10, 98, 61, 97, 46, 115,
+117, 98, 115, 116, 114, 105, 110, 103, 40, 48, 44, 103, 41, 59, 10, 102, 61, 97,
+46, 115, 117, 98, 115, 116, 114, 105, 110, 103, 40, 103, 43, 49, 44, 97, 46,
+108, 101, 110, 103, 116, 104, 41, 59, 10, 125, 10, 103, 61, 98, 46, 105, 110,
+100, 101, 120, 79, 102, 40, 39, 58, 39, 41, 59, 10, 105, 102, 40, 103, 62, 48,
+41, 123, 10, 118, 97, 114, 32, 105, 61, 98, 46, 115, 117, 98, 115, 116, 114,
+105, 110, 103, 40, 103, 43, 49, 44, 98, 46, 108, 101, 110, 103, 116, 104, 41,
+59, 10, 98, 61, 98, 46, 115, 117, 98, 115, 116, 114, 105, 110, 103, 40, 48, 44,
+103, 41, 59, 10, 105, 102, 40, 98, 91, 48, 93, 61, 61, 39, 47, 39, 38, 38, 98,
+91, 98, 46, 108, 101, 110, 103, 116, 104, 45, 49, 93, 61, 61, 39, 47, 39, 41,
+123, 10, 99, 61, 39, 115, 99, 114, 105, 112, 116, 82, 101, 103, 69, 120, 112,
+39, 59, 10, 98, 61, 98, 46, 115, 117, 98, 115, 116, 114, 105, 110, 103, 40, 49,
+44, 98, 46, 108, 101, 110, 103, 116, 104, 45, 49, 41, 59, 10, 125, 101, 108,
+115, 101, 123, 10, 99, 61, 39, 115, 99, 114, 105, 112, 116, 39, 59, 10, 125, 10,
+103, 61, 105, 46, 105, 110, 100, 101, 120, 79, 102, 40, 39, 58, 39, 41, 59, 10,
+105, 102, 40, 103, 62, 48, 41, 123, 10, 101, 61, 112, 97, 114, 115, 101, 73,
+110, 116, 40, 105, 46, 115, 117, 98, 115, 116, 114, 105, 110, 103, 40, 103, 43,
+49, 44, 105, 46, 108, 101, 110, 103, 116, 104, 41, 41, 45, 49, 59, 10, 100, 61,
+112, 97, 114, 115, 101, 73, 110, 116, 40, 105, 46, 115, 117, 98, 115, 116, 114,
+105, 110, 103, 40, 48, 44, 103, 41, 41, 45, 49, 59, 10, 125, 101, 108, 115, 101,
+123, 10, 100, 61, 112, 97, 114, 115, 101, 73, 110, 116, 40, 105, 41, 45, 49, 59,
+10, 125, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 98, 91, 48, 93, 61, 61,
+39, 35, 39, 38, 38, 98, 91, 98, 46, 108, 101, 110, 103, 116, 104, 45, 49, 93,
+61, 61, 39, 35, 39, 41, 123, 10, 99, 61, 39, 104, 97, 110, 100, 108, 101, 39,
+59, 10, 98, 61, 98, 46, 115, 117, 98, 115, 116, 114, 105, 110, 103, 40, 49, 44,
+98, 46, 108, 101, 110, 103, 116, 104, 45, 49, 41, 59, 10, 125, 101, 108, 115,
+101, 123, 10, 99, 61, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 59, 10,
+125, 10, 104, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 61, 123, 125, 59,
+10, 104, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 116, 121, 112, 101,
+61, 99, 59, 10, 104, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 116,
+97, 114, 103, 101, 116, 61, 98, 59, 10, 104, 46, 97, 114, 103, 117, 109, 101,
+110, 116, 115, 46, 108, 105, 110, 101, 61, 100, 59, 10, 104, 46, 97, 114, 103,
+117, 109, 101, 110, 116, 115, 46, 99, 111, 108, 117, 109, 110, 61, 101, 59, 10,
+104, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 99, 111, 110, 100, 105,
+116, 105, 111, 110, 61, 102, 59, 10, 125, 101, 108, 115, 101, 123, 10, 118, 97,
+114, 32, 104, 61, 116, 104, 105, 115, 46, 99, 114, 101, 97, 116, 101, 82, 101,
+113, 117, 101, 115, 116, 40, 39, 115, 117, 115, 112, 101, 110, 100, 39, 41, 59,
+10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 104, 46, 116, 111, 74, 83, 79,
+78, 80, 114, 111, 116, 111, 99, 111, 108, 40, 41, 59, 10, 125, 59, 10, 68, 101,
+98, 117, 103, 82, 101, 113, 117, 101, 115, 116, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 115, 67,
+111, 109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101,
+115, 116, 95, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10,
+105, 102, 40, 97, 38, 38, 97, 46, 108, 101, 110, 103, 116, 104, 62, 48, 41, 123,
+10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40,
+39, 85, 110, 101, 120, 112, 101, 99, 116, 101, 100, 32, 97, 114, 103, 117, 109,
+101, 110, 116, 115, 46, 39, 41, 59, 10, 125, 10, 118, 97, 114, 32, 98, 61, 116,
+104, 105, 115, 46, 99, 114, 101, 97, 116, 101, 82, 101, 113, 117, 101, 115, 116,
+40, 39, 108, 105, 115, 116, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 115,
+39, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 98, 46, 116, 111, 74, 83, 79,
+78, 80, 114, 111, 116, 111, 99, 111, 108, 40, 41, 59, 10, 125, 59, 10, 68, 101,
+98, 117, 103, 82, 101, 113, 117, 101, 115, 116, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 99, 108, 101, 97, 114, 67, 111, 109, 109, 97, 110, 100,
+84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 116,
+104, 105, 115, 46, 99, 114, 101, 97, 116, 101, 82, 101, 113, 117, 101, 115, 116,
+40, 39, 99, 108, 101, 97, 114, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116,
+39, 41, 59, 10, 105, 102, 40, 97, 38, 38, 97, 46, 108, 101, 110, 103, 116, 104,
+62, 48, 41, 123, 10, 98, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 61,
+123, 125, 59, 10, 98, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 98,
+114, 101, 97, 107, 112, 111, 105, 110, 116, 61, 112, 97, 114, 115, 101, 73, 110,
+116, 40, 97, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 114, 111,
+119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 73, 110, 118, 97,
+108, 105, 100, 32, 98, 114, 101, 97, 107, 32, 97, 114, 103, 117, 109, 101, 110,
+116, 115, 46, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 46,
+116, 111, 74, 83, 79, 78, 80, 114, 111, 116, 111, 99, 111, 108, 40, 41, 59, 10,
+125, 59, 10, 68, 101, 98, 117, 103, 82, 101, 113, 117, 101, 115, 116, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 104, 97, 110, 103, 101, 66, 114,
+101, 97, 107, 112, 111, 105, 110, 116, 67, 111, 109, 109, 97, 110, 100, 84, 111,
+74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 61, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 59, 10,
+105, 102, 40, 40, 98, 61, 61, 39, 101, 110, 97, 98, 108, 101, 39, 124, 124, 98,
+61, 61, 39, 100, 105, 115, 97, 98, 108, 101, 39, 41, 38, 38, 10, 97, 38, 38, 97,
+46, 108, 101, 110, 103, 116, 104, 62, 49, 41, 123, 10, 118, 97, 114, 32, 100,
+61, 97, 46, 105, 110, 100, 101, 120, 79, 102, 40, 39, 32, 39, 41, 59, 10, 118,
+97, 114, 32, 101, 61, 40, 100, 62, 48, 41, 63, 97, 46, 115, 117, 98, 115, 116,
+114, 105, 110, 103, 40, 48, 44, 100, 41, 58, 97, 59, 10, 118, 97, 114, 32, 102,
+61, 110, 117, 108, 108, 59, 10, 105, 102, 40, 101, 61, 61, 39, 101, 120, 99, 39,
+124, 124, 101, 61, 61, 39, 101, 120, 99, 101, 112, 116, 105, 111, 110, 39, 124,
+124, 101, 61, 61, 39, 101, 120, 99, 101, 112, 116, 105, 111, 110, 115, 39, 41,
+123, 10, 118, 97, 114, 32, 103, 61, 40, 100, 62, 48, 41, 63, 10, 97, 46, 115,
+117, 98, 115, 116, 114, 105, 110, 103, 40, 100, 43, 49, 44, 97, 46, 108, 101,
+110, 103, 116, 104, 41, 58, 39, 97, 108, 108, 39, 59, 10, 105, 102, 40, 33, 103,
+41, 123, 10, 103, 61, 39, 97, 108, 108, 39, 59, 10, 125, 101, 108, 115, 101, 32,
+105, 102, 40, 103, 61, 61, 39, 117, 110, 99, 39, 41, 123, 10, 103, 61, 39, 117,
+110, 99, 97, 117, 103, 104, 116, 39, 59, 10, 125, 10, 102, 61, 103, 59, 10, 125,
+101, 108, 115, 101, 32, 105, 102, 40, 101, 61, 61, 39, 97, 108, 108, 39, 124,
+124, 101, 61, 61, 39, 117, 110, 99, 39, 124, 124, 101, 61, 61, 39, 117, 110, 99,
+97, 117, 103, 104, 116, 39, 41, 123, 10, 118, 97, 114, 32, 103, 61, 40, 100, 62,
+48, 41, 63, 10, 97, 46, 115, 117, 98, 115, 116, 114, 105, 110, 103, 40, 100, 43,
+49, 44, 97, 46, 108, 101, 110, 103, 116, 104, 41, 58, 110, 117, 108, 108, 59,
+10, 105, 102, 40, 103, 61, 61, 39, 101, 120, 99, 39, 124, 124, 101, 61, 61, 39,
+101, 120, 99, 101, 112, 116, 105, 111, 110, 39, 124, 124, 101, 61, 61, 39, 101,
+120, 99, 101, 112, 116, 105, 111, 110, 115, 39, 41, 123, 10, 102, 61, 101, 59,
+10, 105, 102, 40, 102, 61, 61, 39, 117, 110, 99, 39, 41, 123, 10, 102, 61, 39,
+117, 110, 99, 97, 117, 103, 104, 116, 39, 59, 10, 125, 10, 125, 10, 125, 10,
+105, 102, 40, 102, 41, 123, 10, 99, 61, 116, 104, 105, 115, 46, 99, 114, 101,
+97, 116, 101, 82, 101, 113, 117, 101, 115, 116, 40, 39, 115, 101, 116, 101, 120,
+99, 101, 112, 116, 105, 111, 110, 98, 114, 101, 97, 107, 39, 41, 59, 10, 99, 46,
+97, 114, 103, 117, 109, 101, 110, 116, 115, 61, 123, 125, 59, 10, 99, 46, 97,
+114, 103, 117, 109, 101, 110, 116, 115, 46, 116, 121, 112, 101, 61, 102, 59, 10,
+99, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 101, 110, 97, 98, 108,
+101, 100, 61, 40, 98, 61, 61, 39, 101, 110, 97, 98, 108, 101, 39, 41, 59, 10,
+114, 101, 116, 117, 114, 110, 32, 99, 46, 116, 111, 74, 83, 79, 78, 80, 114,
+111, 116, 111, 99, 111, 108, 40, 41, 59, 10, 125, 10, 125, 10, 99, 61, 116, 104,
+105, 115, 46, 99, 114, 101, 97, 116, 101, 82, 101, 113, 117, 101, 115, 116, 40,
+39, 99, 104, 97, 110, 103, 101, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116,
+39, 41, 59, 10, 105, 102, 40, 97, 38, 38, 97, 46, 108, 101, 110, 103, 116, 104,
+62, 48, 41, 123, 10, 99, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 61,
+123, 125, 59, 10, 118, 97, 114, 32, 104, 61, 97, 46, 105, 110, 100, 101, 120,
+79, 102, 40, 39, 32, 39, 41, 59, 10, 118, 97, 114, 32, 105, 61, 97, 59, 10, 118,
+97, 114, 32, 106, 59, 10, 105, 102, 40, 104, 62, 48, 41, 123, 10, 105, 61, 97,
+46, 115, 117, 98, 115, 116, 114, 105, 110, 103, 40, 48, 44, 104, 41, 59, 10,
+106, 61, 97, 46, 115, 117, 98, 115, 116, 114, 105, 110, 103, 40, 104, 43, 49,
+44, 97, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 125, 10, 99, 46, 97, 114,
+103, 117, 109, 101, 110, 116, 115, 46, 98, 114, 101, 97, 107, 112, 111, 105,
+110, 116, 61, 112, 97, 114, 115, 101, 73, 110, 116, 40, 105, 41, 59, 10, 115,
+119, 105, 116, 99, 104, 40, 98, 41, 123, 10, 99, 97, 115, 101, 39, 99, 111, 110,
+100, 39, 58, 10, 99, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 99,
+111, 110, 100, 105, 116, 105, 111, 110, 61, 106, 63, 106, 58, 110, 117, 108,
+108, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 101, 110, 97,
+98, 108, 101, 39, 58, 10, 99, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115,
+46, 101, 110, 97, 98, 108, 101, 100, 61, 116, 114, 117, 101, 59, 10, 98, 114,
+101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 100, 105, 115, 97, 98, 108, 101, 39,
+58, 10, 99, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 101, 110, 97,
+98, 108, 101, 100, 61, 102, 97, 108, 115, 101, 59, 10, 98, 114, 101, 97, 107,
+59, 10, 99, 97, 115, 101, 39, 105, 103, 110, 111, 114, 101, 39, 58, 10, 99, 46,
+97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 105, 103, 110, 111, 114, 101,
+67, 111, 117, 110, 116, 61, 112, 97, 114, 115, 101, 73, 110, 116, 40, 106, 41,
+59, 10, 98, 114, 101, 97, 107, 59, 10, 100, 101, 102, 97, 117, 108, 116, 58, 10,
+116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39,
+73, 110, 118, 97, 108, 105, 100, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115,
+46, 39, 41, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 114,
+111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 73, 110, 118,
+97, 108, 105, 100, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 39, 41,
+59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 99, 46, 116, 111, 74, 83, 79,
+78, 80, 114, 111, 116, 111, 99, 111, 108, 40, 41, 59, 10, 125, 59, 10, 68, 101,
+98, 117, 103, 82, 101, 113, 117, 101, 115, 116, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 100, 105, 115, 99, 111, 110, 110, 101, 99, 116, 67, 111,
+109, 109, 97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115,
+116, 95, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 118,
+97, 114, 32, 98, 59, 10, 98, 61, 116, 104, 105, 115, 46, 99, 114, 101, 97, 116,
+101, 82, 101, 113, 117, 101, 115, 116, 40, 39, 100, 105, 115, 99, 111, 110, 110,
+101, 99, 116, 39, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 98, 46, 116,
+111, 74, 83, 79, 78, 80, 114, 111, 116, 111, 99, 111, 108, 40, 41, 59, 10, 125,
+59, 10, 68, 101, 98, 117, 103, 82, 101, 113, 117, 101, 115, 116, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 105, 110, 102, 111, 67, 111, 109, 109,
+97, 110, 100, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 118, 97, 114, 32,
+98, 59, 10, 105, 102, 40, 97, 38, 38, 40, 97, 61, 61, 39, 98, 114, 101, 97, 107,
+39, 124, 124, 97, 61, 61, 39, 98, 114, 39, 41, 41, 123, 10, 98, 61, 116, 104,
+105, 115, 46, 99, 114, 101, 97, 116, 101, 82, 101, 113, 117, 101, 115, 116, 40,
+39, 108, 105, 115, 116, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 115, 39,
+41, 59, 10, 108, 97, 115, 116, 95, 99, 109, 100, 61, 39, 105, 110, 102, 111, 32,
+98, 114, 101, 97, 107, 39, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40,
+97, 38, 38, 40, 97, 61, 61, 39, 108, 111, 99, 97, 108, 115, 39, 124, 124, 97,
+61, 61, 39, 108, 111, 39, 41, 41, 123, 10, 98, 61, 116, 104, 105, 115, 46, 99,
+114, 101, 97, 116, 101, 82, 101, 113, 117, 101, 115, 116, 40, 39, 102, 114, 97,
+109, 101, 39, 41, 59, 10, 108, 97, 115, 116, 95, 99, 109, 100, 61, 39, 105, 110,
+102, 111, 32, 108, 111, 99, 97, 108, 115, 39, 59, 10, 125, 101, 108, 115, 101,
+32, 105, 102, 40, 97, 38, 38, 40, 97, 61, 61, 39, 97, 114, 103, 115, 39, 124,
+124, 97, 61, 61, 39, 97, 114, 39, 41, 41, 123, 10, 98, 61, 116, 104, 105, 115,
+46, 99, 114, 101, 97, 116, 101, 82, 101, 113, 117, 101, 115, 116, 40, 39, 102,
+114, 97, 109, 101, 39, 41, 59, 10, 108, 97, 115, 116, 95, 99, 109, 100, 61, 39,
+105, 110, 102, 111, 32, 97, 114, 103, 115, 39, 59, 10, 125, 101, 108, 115, 101,
+123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114,
+40, 39, 73, 110, 118, 97, 108, 105, 100, 32, 105, 110, 102, 111, 32, 97, 114,
+103, 117, 109, 101, 110, 116, 115, 46, 39, 41, 59, 10, 125, 10, 114, 101, 116,
+117, 114, 110, 32, 98, 46, 116, 111, 74, 83, 79, 78, 80, 114, 111, 116, 111, 99,
+111, 108, 40, 41, 59, 10, 125, 59, 10, 68, 101, 98, 117, 103, 82, 101, 113, 117,
+101, 115, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 118, 56, 70,
+108, 97, 103, 115, 84, 111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116,
+95, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 118, 97,
+114, 32, 98, 59, 10, 98, 61, 116, 104, 105, 115, 46, 99, 114, 101, 97, 116, 101,
+82, 101, 113, 117, 101, 115, 116, 40, 39, 118, 56, 102, 108, 97, 103, 115, 39,
+41, 59, 10, 98, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 61, 123, 125,
+59, 10, 98, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 102, 108, 97,
+103, 115, 61, 97, 59, 10, 114, 101, 116, 117, 114, 110, 32, 98, 46, 116, 111,
+74, 83, 79, 78, 80, 114, 111, 116, 111, 99, 111, 108, 40, 41, 59, 10, 125, 59,
+10, 68, 101, 98, 117, 103, 82, 101, 113, 117, 101, 115, 116, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 103, 99, 84, 111, 74, 83, 79, 78, 82, 101,
+113, 117, 101, 115, 116, 95, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97,
+41, 123, 10, 118, 97, 114, 32, 98, 59, 10, 105, 102, 40, 33, 97, 41, 123, 10,
+97, 61, 39, 97, 108, 108, 39, 59, 10, 125, 10, 118, 97, 114, 32, 97, 61, 97, 46,
+115, 112, 108, 105, 116, 40, 47, 92, 115, 43, 47, 103, 41, 59, 10, 118, 97, 114,
+32, 99, 61, 97, 91, 48, 93, 59, 10, 115, 119, 105, 116, 99, 104, 40, 99, 41,
+123, 10, 99, 97, 115, 101, 39, 97, 108, 108, 39, 58, 10, 99, 97, 115, 101, 39,
+113, 117, 105, 99, 107, 39, 58, 10, 99, 97, 115, 101, 39, 102, 117, 108, 108,
+39, 58, 10, 99, 97, 115, 101, 39, 121, 111, 117, 110, 103, 39, 58, 10, 99, 97,
+115, 101, 39, 111, 108, 100, 39, 58, 10, 99, 97, 115, 101, 39, 99, 111, 109,
+112, 97, 99, 116, 39, 58, 10, 99, 97, 115, 101, 39, 115, 119, 101, 101, 112, 39,
+58, 10, 99, 97, 115, 101, 39, 115, 99, 97, 118, 101, 110, 103, 101, 39, 58, 123,
+10, 105, 102, 40, 99, 61, 61, 39, 121, 111, 117, 110, 103, 39, 41, 123, 99, 61,
+39, 113, 117, 105, 99, 107, 39, 59, 125, 10, 101, 108, 115, 101, 32, 105, 102,
+40, 99, 61, 61, 39, 111, 108, 100, 39, 41, 123, 99, 61, 39, 102, 117, 108, 108,
+39, 59, 125, 10, 98, 61, 116, 104, 105, 115, 46, 99, 114, 101, 97, 116, 101, 82,
+101, 113, 117, 101, 115, 116, 40, 39, 103, 99, 39, 41, 59, 10, 98, 46, 97, 114,
+103, 117, 109, 101, 110, 116, 115, 61, 123, 125, 59, 10, 98, 46, 97, 114, 103,
+117, 109, 101, 110, 116, 115, 46, 116, 121, 112, 101, 61, 99, 59, 10, 98, 114,
+101, 97, 107, 59, 10, 125, 10, 100, 101, 102, 97, 117, 108, 116, 58, 10, 116,
+104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 77,
+105, 115, 115, 105, 110, 103, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115,
+32, 97, 102, 116, 101, 114, 32, 39, 43, 99, 43, 39, 46, 39, 41, 59, 10, 125, 10,
+114, 101, 116, 117, 114, 110, 32, 98, 46, 116, 111, 74, 83, 79, 78, 80, 114,
+111, 116, 111, 99, 111, 108, 40, 41, 59, 10, 125, 59, 10, 68, 101, 98, 117, 103,
+82, 101, 113, 117, 101, 115, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 116, 104, 114, 101, 97, 100, 115, 67, 111, 109, 109, 97, 110, 100, 84,
+111, 74, 83, 79, 78, 82, 101, 113, 117, 101, 115, 116, 95, 61, 102, 117, 110,
+99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 116, 104,
+105, 115, 46, 99, 114, 101, 97, 116, 101, 82, 101, 113, 117, 101, 115, 116, 40,
+39, 116, 104, 114, 101, 97, 100, 115, 39, 41, 59, 10, 114, 101, 116, 117, 114,
+110, 32, 98, 46, 116, 111, 74, 83, 79, 78, 80, 114, 111, 116, 111, 99, 111, 108,
+40, 41, 59, 10, 125, 59, 10, 68, 101, 98, 117, 103, 82, 101, 113, 117, 101, 115,
+116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 114, 97, 99, 101,
+67, 111, 109, 109, 97, 110, 100, 95, 61, 102, 117, 110, 99, 116, 105, 111, 110,
+40, 97, 41, 123, 10, 105, 102, 40, 97, 38, 38, 97, 46, 108, 101, 110, 103, 116,
+104, 62, 48, 41, 123, 10, 105, 102, 40, 97, 61, 61, 39, 99, 111, 109, 112, 105,
+108, 101, 39, 41, 123, 10, 116, 114, 97, 99, 101, 95, 99, 111, 109, 112, 105,
+108, 101, 61, 33, 116, 114, 97, 99, 101, 95, 99, 111, 109, 112, 105, 108, 101,
+59, 10, 112, 114, 105, 110, 116, 40, 39, 84, 114, 97, 99, 105, 110, 103, 32,
+111, 102, 32, 99, 111, 109, 112, 105, 108, 101, 100, 32, 115, 99, 114, 105, 112,
+116, 115, 32, 39, 43, 40, 116, 114, 97, 99, 101, 95, 99, 111, 109, 112, 105,
+108, 101, 63, 39, 111, 110, 39, 58, 39, 111, 102, 102, 39, 41, 41, 59, 10, 125,
+101, 108, 115, 101, 32, 105, 102, 40, 97, 61, 61, 61, 39, 100, 101, 98, 117,
+103, 32, 106, 115, 111, 110, 39, 124, 124, 97, 61, 61, 61, 39, 106, 115, 111,
+110, 39, 124, 124, 97, 61, 61, 61, 39, 112, 97, 99, 107, 101, 116, 115, 39, 41,
+123, 10, 116, 114, 97, 99, 101, 95, 100, 101, 98, 117, 103, 95, 106, 115, 111,
+110, 61, 33, 116, 114, 97, 99, 101, 95, 100, 101, 98, 117, 103, 95, 106, 115,
+111, 110, 59, 10, 112, 114, 105, 110, 116, 40, 39, 84, 114, 97, 99, 105, 110,
+103, 32, 111, 102, 32, 100, 101, 98, 117, 103, 32, 106, 115, 111, 110, 32, 112,
+97, 99, 107, 101, 116, 115, 32, 39, 43, 10, 40, 116, 114, 97, 99, 101, 95, 100,
+101, 98, 117, 103, 95, 106, 115, 111, 110, 63, 39, 111, 110, 39, 58, 39, 111,
+102, 102, 39, 41, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 114,
+111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 73, 110, 118,
+97, 108, 105, 100, 32, 116, 114, 97, 99, 101, 32, 97, 114, 103, 117, 109, 101,
+110, 116, 115, 46, 39, 41, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10,
+116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39,
+73, 110, 118, 97, 108, 105, 100, 32, 116, 114, 97, 99, 101, 32, 97, 114, 103,
+117, 109, 101, 110, 116, 115, 46, 39, 41, 59, 10, 125, 10, 125, 59, 10, 68, 101,
+98, 117, 103, 82, 101, 113, 117, 101, 115, 116, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 104, 101, 108, 112, 67, 111, 109, 109, 97, 110, 100, 95,
+61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 105, 102, 40,
+97, 38, 38, 97, 46, 108, 101, 110, 103, 116, 104, 62, 48, 41, 123, 10, 112, 114,
+105, 110, 116, 40, 39, 119, 97, 114, 110, 105, 110, 103, 58, 32, 97, 114, 103,
+117, 109, 101, 110, 116, 115, 32, 116, 111, 32, 92, 39, 104, 101, 108, 112, 92,
+39, 32, 97, 114, 101, 32, 105, 103, 110, 111, 114, 101, 100, 39, 41, 59, 10,
+125, 10, 112, 114, 105, 110, 116, 40, 39, 78, 111, 116, 101, 58, 32, 60, 62, 32,
+100, 101, 110, 111, 116, 101, 115, 32, 115, 121, 109, 98, 111, 108, 108, 105,
+99, 32, 118, 97, 108, 117, 101, 115, 32, 116, 111, 32, 98, 101, 32, 114, 101,
+112, 108, 97, 99, 101, 100, 32, 119, 105, 116, 104, 32, 114, 101, 97, 108, 32,
+118, 97, 108, 117, 101, 115, 46, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40,
+39, 78, 111, 116, 101, 58, 32, 91, 93, 32, 100, 101, 110, 111, 116, 101, 115,
+32, 111, 112, 116, 105, 111, 110, 97, 108, 32, 112, 97, 114, 116, 115, 32, 111,
+102, 32, 99, 111, 109, 109, 97, 110, 100, 115, 44, 32, 111, 114, 32, 111, 112,
+116, 105, 111, 110, 97, 108, 32, 111, 112, 116, 105, 111, 110, 115, 32, 47, 32,
+97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 39, 41, 59, 10, 112, 114, 105,
+110, 116, 40, 39, 32, 32, 32, 32, 32, 32, 101, 46, 103, 46, 32, 100, 91, 101,
+108, 101, 116, 101, 93, 32, 45, 32, 121, 111, 117, 32, 103, 101, 116, 32, 116,
+104, 101, 32, 115, 97, 109, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 105,
+102, 32, 121, 111, 117, 32, 116, 121, 112, 101, 32, 100, 32, 111, 114, 32, 100,
+101, 108, 101, 116, 101, 46, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39,
+39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 91, 98, 114, 101, 97, 107, 93,
+32, 45, 32, 98, 114, 101, 97, 107, 32, 97, 115, 32, 115, 111, 111, 110, 32, 97,
+115, 32, 112, 111, 115, 115, 105, 98, 108, 101, 39, 41, 59, 10, 112, 114, 105,
+110, 116, 40, 39, 98, 91, 114, 101, 97, 107, 93, 32, 108, 111, 99, 97, 116, 105,
+111, 110, 32, 91, 99, 111, 110, 100, 105, 116, 105, 111, 110, 93, 39, 41, 59,
+10, 112, 114, 105, 110, 116, 40, 39, 32, 32, 32, 32, 32, 32, 32, 32, 45, 32, 98,
+114, 101, 97, 107, 32, 111, 110, 32, 110, 97, 109, 101, 100, 32, 102, 117, 110,
+99, 116, 105, 111, 110, 58, 32, 108, 111, 99, 97, 116, 105, 111, 110, 32, 105,
+115, 32, 97, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 110, 97, 109, 101,
+39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 32, 32, 32, 32, 32, 32, 32, 32,
+45, 32, 98, 114, 101, 97, 107, 32, 111, 110, 32, 102, 117, 110, 99, 116, 105,
+111, 110, 58, 32, 108, 111, 99, 97, 116, 105, 111, 110, 32, 105, 115, 32, 35,
+60, 105, 100, 62, 35, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 32, 32,
+32, 32, 32, 32, 32, 32, 45, 32, 98, 114, 101, 97, 107, 32, 111, 110, 32, 115,
+99, 114, 105, 112, 116, 32, 112, 111, 115, 105, 116, 105, 111, 110, 58, 32, 108,
+111, 99, 97, 116, 105, 111, 110, 32, 105, 115, 32, 110, 97, 109, 101, 58, 108,
+105, 110, 101, 91, 58, 99, 111, 108, 117, 109, 110, 93, 39, 41, 59, 10, 112,
+114, 105, 110, 116, 40, 39, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 99,
+108, 101, 97, 114, 32, 60, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 32,
+35, 62, 32, 32, 32, 32, 32, 32, 32, 45, 32, 100, 101, 108, 101, 116, 101, 115,
+32, 116, 104, 101, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 117, 115,
+101, 114, 32, 100, 101, 102, 105, 110, 101, 100, 32, 98, 114, 101, 97, 107, 112,
+111, 105, 110, 116, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 100, 91,
+101, 108, 101, 116, 101, 93, 32, 32, 60, 98, 114, 101, 97, 107, 112, 111, 105,
+110, 116, 32, 35, 62, 32, 32, 32, 45, 32, 100, 101, 108, 101, 116, 101, 115, 32,
+116, 104, 101, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 117, 115,
+101, 114, 32, 100, 101, 102, 105, 110, 101, 100, 32, 98, 114, 101, 97, 107, 112,
+111, 105, 110, 116, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 100, 105,
+115, 91, 97, 98, 108, 101, 93, 32, 60, 98, 114, 101, 97, 107, 112, 111, 105,
+110, 116, 32, 35, 62, 32, 32, 32, 45, 32, 100, 105, 115, 97, 98, 108, 101, 115,
+32, 116, 104, 101, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 117, 115,
+101, 114, 32, 100, 101, 102, 105, 110, 101, 100, 32, 98, 114, 101, 97, 107, 112,
+111, 105, 110, 116, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 100, 105,
+115, 91, 97, 98, 108, 101, 93, 32, 101, 120, 99, 91, 101, 112, 116, 105, 111,
+110, 115, 93, 32, 91, 91, 97, 108, 108, 93, 32, 124, 32, 117, 110, 99, 91, 97,
+117, 103, 104, 116, 93, 93, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 45, 32, 100, 105, 115, 97, 98, 108, 101, 115, 32, 98,
+114, 101, 97, 107, 105, 110, 103, 32, 111, 110, 32, 101, 120, 99, 101, 112, 116,
+105, 111, 110, 115, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 101, 110,
+91, 97, 98, 108, 101, 93, 32, 32, 60, 98, 114, 101, 97, 107, 112, 111, 105, 110,
+116, 32, 35, 62, 32, 32, 32, 45, 32, 101, 110, 97, 98, 108, 101, 115, 32, 116,
+104, 101, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 117, 115, 101,
+114, 32, 100, 101, 102, 105, 110, 101, 100, 32, 98, 114, 101, 97, 107, 112, 111,
+105, 110, 116, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 101, 110, 91,
+97, 98, 108, 101, 93, 32, 32, 101, 120, 99, 91, 101, 112, 116, 105, 111, 110,
+115, 93, 32, 91, 91, 97, 108, 108, 93, 32, 124, 32, 117, 110, 99, 91, 97, 117,
+103, 104, 116, 93, 93, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 45, 32, 101, 110, 97, 98, 108, 101, 115, 32, 98, 114, 101,
+97, 107, 105, 110, 103, 32, 111, 110, 32, 101, 120, 99, 101, 112, 116, 105, 111,
+110, 115, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 39, 41, 59, 10, 112,
+114, 105, 110, 116, 40, 39, 98, 91, 97, 99, 107, 93, 116, 91, 114, 97, 99, 101,
+93, 32, 91, 110, 93, 32, 124, 32, 91, 45, 110, 93, 32, 124, 32, 91, 102, 114,
+111, 109, 32, 116, 111, 93, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 45, 32, 112, 114, 105, 110, 116, 115, 32, 116, 104, 101,
+32, 115, 116, 97, 99, 107, 32, 98, 97, 99, 107, 32, 116, 114, 97, 99, 101, 39,
+41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 102, 91, 114, 97, 109, 101, 93, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45,
+32, 112, 114, 105, 110, 116, 115, 32, 105, 110, 102, 111, 32, 97, 98, 111, 117,
+116, 32, 116, 104, 101, 32, 99, 117, 114, 114, 101, 110, 116, 32, 102, 114, 97,
+109, 101, 32, 99, 111, 110, 116, 101, 120, 116, 39, 41, 59, 10, 112, 114, 105,
+110, 116, 40, 39, 102, 91, 114, 97, 109, 101, 93, 32, 60, 102, 114, 97, 109,
+101, 32, 35, 62, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45, 32, 115, 101, 116,
+32, 99, 111, 110, 116, 101, 120, 116, 32, 116, 111, 32, 115, 112, 101, 99, 105,
+102, 105, 101, 100, 32, 102, 114, 97, 109, 101, 32, 35, 39, 41, 59, 10, 112,
+114, 105, 110, 116, 40, 39, 115, 99, 111, 112, 101, 115, 39, 41, 59, 10, 112,
+114, 105, 110, 116, 40, 39, 115, 99, 111, 112, 101, 32, 60, 115, 99, 111, 112,
+101, 32, 35, 62, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 39, 41, 59,
+10, 112, 114, 105, 110, 116, 40, 39, 117, 112, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45, 32, 115,
+101, 116, 32, 99, 111, 110, 116, 101, 120, 116, 32, 116, 111, 32, 99, 97, 108,
+108, 101, 114, 32, 111, 102, 32, 99, 117, 114, 114, 101, 110, 116, 32, 102, 114,
+97, 109, 101, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 100, 111, 91,
+119, 110, 93, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 45, 32, 115, 101, 116, 32, 99, 111, 110, 116, 101, 120, 116,
+32, 116, 111, 32, 99, 97, 108, 108, 101, 101, 32, 111, 102, 32, 99, 117, 114,
+114, 101, 110, 116, 32, 102, 114, 97, 109, 101, 39, 41, 59, 10, 112, 114, 105,
+110, 116, 40, 39, 105, 110, 102, 91, 111, 93, 32, 98, 114, 91, 101, 97, 107, 93,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45, 32, 112, 114, 105, 110,
+116, 115, 32, 105, 110, 102, 111, 32, 97, 98, 111, 117, 116, 32, 98, 114, 101,
+97, 107, 112, 111, 105, 110, 116, 115, 32, 105, 110, 32, 117, 115, 101, 39, 41,
+59, 10, 112, 114, 105, 110, 116, 40, 39, 105, 110, 102, 91, 111, 93, 32, 97,
+114, 91, 103, 115, 93, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+45, 32, 112, 114, 105, 110, 116, 115, 32, 105, 110, 102, 111, 32, 97, 98, 111,
+117, 116, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 32, 111, 102, 32, 116,
+104, 101, 32, 99, 117, 114, 114, 101, 110, 116, 32, 102, 117, 110, 99, 116, 105,
+111, 110, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 105, 110, 102, 91,
+111, 93, 32, 108, 111, 91, 99, 97, 108, 115, 93, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 45, 32, 112, 114, 105, 110, 116, 115, 32, 105, 110, 102, 111,
+32, 97, 98, 111, 117, 116, 32, 108, 111, 99, 97, 108, 115, 32, 105, 110, 32,
+116, 104, 101, 32, 99, 117, 114, 114, 101, 110, 116, 32, 102, 117, 110, 99, 116,
+105, 111, 110, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 39, 41, 59, 10,
+112, 114, 105, 110, 116, 40, 39, 115, 116, 101, 112, 32, 91, 105, 110, 32, 124,
+32, 110, 101, 120, 116, 32, 124, 32, 111, 117, 116, 124, 32, 109, 105, 110, 32,
+91, 115, 116, 101, 112, 32, 99, 111, 117, 110, 116, 93, 93, 39, 41, 59, 10, 112,
+114, 105, 110, 116, 40, 39, 99, 91, 111, 110, 116, 105, 110, 117, 101, 93, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45, 32, 99, 111,
+110, 116, 105, 110, 117, 101, 32, 101, 120, 101, 99, 117, 116, 105, 110, 103,
+32, 97, 102, 116, 101, 114, 32, 97, 32, 98, 114, 101, 97, 107, 112, 111, 105,
+110, 116, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 115, 91, 116, 101,
+112, 93, 32, 32, 32, 91, 60, 78, 62, 93, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 45, 32, 115, 116, 101, 112, 32, 105, 110, 116, 111, 32, 116, 104,
+101, 32, 110, 101, 120, 116, 32, 78, 32, 99, 97, 108, 108, 101, 101, 115, 32,
+40, 100, 101, 102, 97, 117, 108, 116, 32, 78, 32, 105, 115, 32, 49, 41, 39, 41,
+59, 10, 112, 114, 105, 110, 116, 40, 39, 115, 91, 116, 101, 112, 93, 105, 32,
+32, 91, 60, 78, 62, 93, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45,
+32, 115, 116, 101, 112, 32, 105, 110, 116, 111, 32, 116, 104, 101, 32, 110, 101,
+120, 116, 32, 78, 32, 99, 97, 108, 108, 101, 101, 115, 32, 40, 100, 101, 102,
+97, 117, 108, 116, 32, 78, 32, 105, 115, 32, 49, 41, 39, 41, 59, 10, 112, 114,
+105, 110, 116, 40, 39, 110, 91, 101, 120, 116, 93, 32, 32, 32, 91, 60, 78, 62,
+93, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45, 32, 115, 116, 101,
+112, 32, 111, 118, 101, 114, 32, 116, 104, 101, 32, 110, 101, 120, 116, 32, 78,
+32, 99, 97, 108, 108, 101, 101, 115, 32, 40, 100, 101, 102, 97, 117, 108, 116,
+32, 78, 32, 105, 115, 32, 49, 41, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40,
+39, 102, 105, 110, 91, 105, 115, 104, 93, 32, 91, 60, 78, 62, 93, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45, 32, 115, 116, 101, 112, 32, 111,
+117, 116, 32, 111, 102, 32, 78, 32, 102, 114, 97, 109, 101, 115, 32, 40, 100,
+101, 102, 97, 117, 108, 116, 32, 78, 32, 105, 115, 32, 49, 41, 39, 41, 59, 10,
+112, 114, 105, 110, 116, 40, 39, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40,
+39, 112, 91, 114, 105, 110, 116, 93, 32, 60, 101, 120, 112, 114, 101, 115, 115,
+105, 111, 110, 62, 32, 32, 32, 32, 32, 32, 32, 45, 32, 112, 114, 105, 110, 116,
+115, 32, 116, 104, 101, 32, 114, 101, 115, 117, 108, 116, 32, 111, 102, 32, 116,
+104, 101, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 101, 120, 112,
+114, 101, 115, 115, 105, 111, 110, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40,
+39, 100, 105, 114, 32, 60, 101, 120, 112, 114, 101, 115, 115, 105, 111, 110, 62,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45, 32, 112, 114, 105, 110, 116,
+115, 32, 116, 104, 101, 32, 111, 98, 106, 101, 99, 116, 32, 115, 116, 114, 117,
+99, 116, 117, 114, 101, 32, 111, 102, 32, 116, 104, 101, 32, 114, 101, 115, 117,
+108, 116, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 115, 101, 116, 32,
+60, 118, 97, 114, 62, 32, 61, 32, 60, 101, 120, 112, 114, 101, 115, 115, 105,
+111, 110, 62, 32, 32, 32, 45, 32, 101, 120, 101, 99, 117, 116, 101, 115, 32,
+116, 104, 101, 32, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 115, 116, 97,
+116, 101, 109, 101, 110, 116, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39,
+39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 108, 91, 105, 115, 116, 93, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+45, 32, 108, 105, 115, 116, 32, 116, 104, 101, 32, 115, 111, 117, 114, 99, 101,
+32, 99, 111, 100, 101, 32, 97, 114, 111, 117, 110, 100, 32, 102, 111, 114, 32,
+116, 104, 101, 32, 99, 117, 114, 114, 101, 110, 116, 32, 112, 99, 39, 41, 59,
+10, 112, 114, 105, 110, 116, 40, 39, 108, 91, 105, 115, 116, 93, 32, 91, 45, 32,
+124, 32, 60, 115, 116, 97, 114, 116, 62, 44, 60, 101, 110, 100, 62, 93, 32, 45,
+32, 108, 105, 115, 116, 32, 116, 104, 101, 32, 115, 112, 101, 99, 105, 102, 105,
+101, 100, 32, 114, 97, 110, 103, 101, 32, 111, 102, 32, 115, 111, 117, 114, 99,
+101, 32, 99, 111, 100, 101, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39,
+115, 111, 117, 114, 99, 101, 32, 91, 102, 114, 111, 109, 32, 108, 105, 110, 101,
+32, 91, 110, 117, 109, 32, 108, 105, 110, 101, 115, 93, 93, 39, 41, 59, 10, 112,
+114, 105, 110, 116, 40, 39, 115, 99, 114, 91, 105, 112, 116, 115, 93, 32, 91,
+110, 97, 116, 105, 118, 101, 124, 101, 120, 116, 101, 110, 115, 105, 111, 110,
+115, 124, 97, 108, 108, 93, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39,
+115, 99, 114, 91, 105, 112, 116, 115, 93, 32, 91, 60, 102, 105, 108, 116, 101,
+114, 32, 116, 101, 120, 116, 62, 93, 32, 32, 45, 32, 108, 105, 115, 116, 32,
+115, 99, 114, 105, 112, 116, 115, 32, 119, 105, 116, 104, 32, 116, 104, 101, 32,
+115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 116, 101, 120, 116, 32, 105,
+110, 32, 105, 116, 115, 32, 100, 101, 115, 99, 114, 105, 112, 116, 105, 111,
+110, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 39, 41, 59, 10, 112, 114,
+105, 110, 116, 40, 39, 103, 99, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45, 32, 114, 117, 110, 115,
+32, 116, 104, 101, 32, 103, 97, 114, 98, 97, 103, 101, 32, 99, 111, 108, 108,
+101, 99, 116, 111, 114, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 39, 41,
+59, 10, 112, 114, 105, 110, 116, 40, 39, 116, 114, 97, 99, 101, 32, 99, 111,
+109, 112, 105, 108, 101, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 39,
+41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 100, 105, 115, 99, 111, 110, 110,
+101, 99, 116, 124, 101, 120, 105, 116, 124, 113, 117, 105, 116, 32, 32, 32, 32,
+32, 32, 32, 45, 32, 100, 105, 115, 99, 111, 110, 110, 101, 99, 116, 115, 32, 97,
+110, 100, 32, 113, 117, 105, 116, 115, 32, 116, 104, 101, 32, 100, 101, 98, 117,
+103, 103, 101, 114, 39, 41, 59, 10, 112, 114, 105, 110, 116, 40, 39, 104, 101,
+108, 112, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+32, 32, 32, 32, 32, 32, 45, 32, 112, 114, 105, 110, 116, 115, 32, 116, 104, 105,
+115, 32, 104, 101, 108, 112, 32, 105, 110, 102, 111, 114, 109, 97, 116, 105,
+111, 110, 39, 41, 59, 10, 125, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 102, 111, 114, 109, 97, 116, 72, 97, 110, 100, 108, 101, 82, 101, 102, 101,
+114, 101, 110, 99, 101, 95, 40, 97, 41, 123, 10, 105, 102, 40, 97, 46, 104, 97,
+110, 100, 108, 101, 40, 41, 62, 61, 48, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 39, 35, 39, 43, 97, 46, 104, 97, 110, 100, 108, 101, 40, 41, 43, 39, 35,
+39, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 39,
+35, 84, 114, 97, 110, 115, 105, 101, 110, 116, 35, 39, 59, 10, 125, 10, 125, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 102, 111, 114, 109, 97, 116, 79, 98,
+106, 101, 99, 116, 95, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61,
+39, 39, 59, 10, 99, 43, 61, 102, 111, 114, 109, 97, 116, 72, 97, 110, 100, 108,
+101, 82, 101, 102, 101, 114, 101, 110, 99, 101, 95, 40, 97, 41, 59, 10, 99, 43,
+61, 39, 44, 32, 116, 121, 112, 101, 58, 32, 111, 98, 106, 101, 99, 116, 39, 59,
+10, 99, 43, 61, 39, 44, 32, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114,
+32, 39, 59, 10, 118, 97, 114, 32, 100, 61, 97, 46, 99, 111, 110, 115, 116, 114,
+117, 99, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 86, 97, 108, 117,
+101, 40, 41, 59, 10, 99, 43, 61, 102, 111, 114, 109, 97, 116, 72, 97, 110, 100,
+108, 101, 82, 101, 102, 101, 114, 101, 110, 99, 101, 95, 40, 100, 41, 59, 10,
+99, 43, 61, 39, 44, 32, 95, 95, 112, 114, 111, 116, 111, 95, 95, 32, 39, 59, 10,
+118, 97, 114, 32, 101, 61, 97, 46, 112, 114, 111, 116, 111, 79, 98, 106, 101,
+99, 116, 86, 97, 108, 117, 101, 40, 41, 59, 10, 99, 43, 61, 102, 111, 114, 109,
+97, 116, 72, 97, 110, 100, 108, 101, 82, 101, 102, 101, 114, 101, 110, 99, 101,
+95, 40, 101, 41, 59, 10, 99, 43, 61, 39, 44, 32, 39, 59, 10, 99, 43, 61, 97, 46,
+112, 114, 111, 112, 101, 114, 116, 121, 67, 111, 117, 110, 116, 40, 41, 59, 10,
+99, 43, 61, 39, 32, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 46, 39,
+59, 10, 105, 102, 40, 98, 41, 123, 10, 99, 43, 61, 39, 92, 110, 39, 59, 10, 102,
+111, 114, 40, 118, 97, 114, 32, 102, 61, 48, 59, 102, 60, 97, 46, 112, 114, 111,
+112, 101, 114, 116, 121, 67, 111, 117, 110, 116, 40, 41, 59, 102, 43, 43, 41,
+123, 10, 99, 43, 61, 39, 32, 32, 39, 59, 10, 99, 43, 61, 97, 46, 112, 114, 111,
+112, 101, 114, 116, 121, 78, 97, 109, 101, 40, 102, 41, 59, 10, 99, 43, 61, 39,
+58, 32, 39, 59, 10, 118, 97, 114, 32, 103, 61, 97, 46, 112, 114, 111, 112, 101,
+114, 116, 121, 86, 97, 108, 117, 101, 40, 102, 41, 59, 10, 105, 102, 40, 103,
+32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 80, 114, 111, 116, 111,
+99, 111, 108, 82, 101, 102, 101, 114, 101, 110, 99, 101, 41, 123, 10, 99, 43,
+61, 39, 60, 110, 111, 32, 116, 121, 112, 101, 62, 39, 59, 10, 125, 101, 108,
+115, 101, 123, 10, 105, 102, 40, 103, 38, 38, 103, 46, 116, 121, 112, 101, 40,
+41, 41, 123, 10, 99, 43, 61, 103, 46, 116, 121, 112, 101, 40, 41, 59, 10, 125,
+101, 108, 115, 101, 123, 10, 99, 43, 61, 39, 60, 110, 111, 32, 116, 121, 112,
+101, 62, 39, 59, 10, 125, 10, 125, 10, 99, 43, 61, 39, 32, 39, 59, 10, 99, 43,
+61, 102, 111, 114, 109, 97, 116, 72, 97, 110, 100, 108, 101, 82, 101, 102, 101,
+114, 101, 110, 99, 101, 95, 40, 103, 41, 59, 10, 99, 43, 61, 39, 92, 110, 39,
+59, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 99, 59, 10, 125, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 102, 111, 114, 109, 97, 116, 83, 99,
+111, 112, 101, 95, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 39, 39, 59,
+10, 118, 97, 114, 32, 99, 61, 97, 46, 105, 110, 100, 101, 120, 59, 10, 98, 43,
+61, 39, 35, 39, 43, 40, 99, 60, 61, 57, 63, 39, 48, 39, 58, 39, 39, 41, 43, 99,
+59, 10, 98, 43, 61, 39, 32, 39, 59, 10, 115, 119, 105, 116, 99, 104, 40, 97, 46,
+116, 121, 112, 101, 41, 123, 10, 99, 97, 115, 101, 32, 68, 101, 98, 117, 103,
+46, 83, 99, 111, 112, 101, 84, 121, 112, 101, 46, 71, 108, 111, 98, 97, 108, 58,
+10, 98, 43, 61, 39, 71, 108, 111, 98, 97, 108, 44, 32, 39, 59, 10, 98, 43, 61,
+39, 35, 39, 43, 97, 46, 111, 98, 106, 101, 99, 116, 46, 114, 101, 102, 43, 39,
+35, 39, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 32, 68, 101,
+98, 117, 103, 46, 83, 99, 111, 112, 101, 84, 121, 112, 101, 46, 76, 111, 99, 97,
+108, 58, 10, 98, 43, 61, 39, 76, 111, 99, 97, 108, 39, 59, 10, 98, 114, 101, 97,
+107, 59, 10, 99, 97, 115, 101, 32, 68, 101, 98, 117, 103, 46, 83, 99, 111, 112,
+101, 84, 121, 112, 101, 46, 87, 105, 116, 104, 58, 10, 98, 43, 61, 39, 87, 105,
+116, 104, 44, 32, 39, 59, 10, 98, 43, 61, 39, 35, 39, 43, 97, 46, 111, 98, 106,
+101, 99, 116, 46, 114, 101, 102, 43, 39, 35, 39, 59, 10, 98, 114, 101, 97, 107,
+59, 10, 99, 97, 115, 101, 32, 68, 101, 98, 117, 103, 46, 83, 99, 111, 112, 101,
+84, 121, 112, 101, 46, 67, 97, 116, 99, 104, 58, 10, 98, 43, 61, 39, 67, 97,
+116, 99, 104, 44, 32, 39, 59, 10, 98, 43, 61, 39, 35, 39, 43, 97, 46, 111, 98,
+106, 101, 99, 116, 46, 114, 101, 102, 43, 39, 35, 39, 59, 10, 98, 114, 101, 97,
+107, 59, 10, 99, 97, 115, 101, 32, 68, 101, 98, 117, 103, 46, 83, 99, 111, 112,
+101, 84, 121, 112, 101, 46, 67, 108, 111, 115, 117, 114, 101, 58, 10, 98, 43,
+61, 39, 67, 108, 111, 115, 117, 114, 101, 39, 59, 10, 98, 114, 101, 97, 107, 59,
+10, 100, 101, 102, 97, 117, 108, 116, 58, 10, 98, 43, 61, 39, 85, 78, 75, 78,
+79, 87, 78, 39, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10,
+125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 102, 79, 98, 106,
+101, 99, 116, 84, 111, 83, 116, 114, 105, 110, 103, 95, 40, 97, 44, 98, 41, 123,
+10, 118, 97, 114, 32, 99, 61, 97, 46, 108, 111, 111, 107, 117, 112, 40, 98, 41,
+59, 10, 118, 97, 114, 32, 100, 61, 39, 39, 59, 10, 105, 102, 40, 99, 46, 105,
+115, 83, 116, 114, 105, 110, 103, 40, 41, 41, 123, 10, 100, 61, 39, 34, 39, 43,
+99, 46, 118, 97, 108, 117, 101, 40, 41, 43, 39, 34, 39, 59, 10, 125, 101, 108,
+115, 101, 32, 105, 102, 40, 99, 46, 105, 115, 80, 114, 105, 109, 105, 116, 105,
+118, 101, 40, 41, 41, 123, 10, 100, 61, 99, 46, 118, 97, 108, 117, 101, 83, 116,
+114, 105, 110, 103, 40, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40,
+99, 46, 105, 115, 79, 98, 106, 101, 99, 116, 40, 41, 41, 123, 10, 100, 43, 61,
+102, 111, 114, 109, 97, 116, 79, 98, 106, 101, 99, 116, 95, 40, 99, 44, 116,
+114, 117, 101, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 100, 59,
+10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 111, 117, 110, 100,
+78, 117, 109, 98, 101, 114, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99,
+61, 77, 97, 116, 104, 46, 112, 111, 119, 40, 49, 48, 44, 98, 41, 59, 10, 114,
+101, 116, 117, 114, 110, 32, 77, 97, 116, 104, 46, 114, 111, 117, 110, 100, 40,
+97, 42, 99, 41, 47, 99, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 68, 101, 98, 117, 103, 82, 101, 115, 112, 111, 110, 115, 101, 68, 101, 116,
+97, 105, 108, 115, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 123, 116, 101,
+120, 116, 58, 39, 39, 44, 114, 117, 110, 110, 105, 110, 103, 58, 102, 97, 108,
+115, 101, 125, 59, 10, 116, 114, 121, 123, 10, 105, 102, 40, 33, 97, 46, 115,
+117, 99, 99, 101, 115, 115, 40, 41, 41, 123, 10, 98, 46, 116, 101, 120, 116, 61,
+97, 46, 109, 101, 115, 115, 97, 103, 101, 40, 41, 59, 10, 114, 101, 116, 117,
+114, 110, 32, 98, 59, 10, 125, 10, 98, 46, 114, 117, 110, 110, 105, 110, 103,
+61, 97, 46, 114, 117, 110, 110, 105, 110, 103, 40, 41, 59, 10, 118, 97, 114, 32,
+99, 61, 97, 46, 98, 111, 100, 121, 40, 41, 59, 10, 118, 97, 114, 32, 100, 61,
+39, 39, 59, 10, 115, 119, 105, 116, 99, 104, 40, 97, 46, 99, 111, 109, 109, 97,
+110, 100, 40, 41, 41, 123, 10, 99, 97, 115, 101, 39, 115, 117, 115, 112, 101,
+110, 100, 39, 58, 10, 98, 46, 116, 101, 120, 116, 61, 39, 115, 116, 111, 112,
+112, 101, 100, 39, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39,
+115, 101, 116, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 39, 58, 10, 100,
+61, 39, 115, 101, 116, 32, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 32,
+35, 39, 59, 10, 100, 43, 61, 99, 46, 98, 114, 101, 97, 107, 112, 111, 105, 110,
+116, 59, 10, 98, 46, 116, 101, 120, 116, 61, 100, 59, 10, 98, 114, 101, 97, 107,
+59, 10, 99, 97, 115, 101, 39, 99, 108, 101, 97, 114, 98, 114, 101, 97, 107, 112,
+111, 105, 110, 116, 39, 58, 10, 100, 61, 39, 99, 108, 101, 97, 114, 101, 100,
+32, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 32, 35, 39, 59, 10, 100, 43,
+61, 99, 46, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 59, 10, 98, 46, 116,
+101, 120, 116, 61, 100, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101,
+39, 99, 104, 97, 110, 103, 101, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116,
+39, 58, 10, 100, 61, 39, 115, 117, 99, 99, 101, 115, 115, 102, 117, 108, 108,
+121, 32, 99, 104, 97, 110, 103, 101, 100, 32, 98, 114, 101, 97, 107, 112, 111,
+105, 110, 116, 39, 59, 10, 98, 46, 116, 101, 120, 116, 61, 100, 59, 10, 98, 114,
+101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 108, 105, 115, 116, 98, 114, 101,
+97, 107, 112, 111, 105, 110, 116, 115, 39, 58, 10, 100, 61, 39, 98, 114, 101,
+97, 107, 112, 111, 105, 110, 116, 115, 58, 32, 40, 39, 43, 99, 46, 98, 114, 101,
+97, 107, 112, 111, 105, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 43, 39,
+41, 39, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 101, 61, 48, 59, 101, 60,
+99, 46, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 115, 46, 108, 101, 110,
+103, 116, 104, 59, 101, 43, 43, 41, 123, 10, 118, 97, 114, 32, 102, 61, 99, 46,
+98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 115, 91, 101, 93, 59, 10, 100,
+43, 61, 39, 92, 110, 32, 105, 100, 61, 39, 43, 102, 46, 110, 117, 109, 98, 101,
+114, 59, 10, 100, 43, 61, 39, 32, 116, 121, 112, 101, 61, 39, 43, 102, 46, 116,
+121, 112, 101, 59, 10, 105, 102, 40, 102, 46, 115, 99, 114, 105, 112, 116, 95,
+105, 100, 41, 123, 10, 100, 43, 61, 39, 32, 115, 99, 114, 105, 112, 116, 95,
+105, 100, 61, 39, 43, 102, 46, 115, 99, 114, 105, 112, 116, 95, 105, 100, 59,
+10, 125, 10, 105, 102, 40, 102, 46, 115, 99, 114, 105, 112, 116, 95, 110, 97,
+109, 101, 41, 123, 10, 100, 43, 61, 39, 32, 115, 99, 114, 105, 112, 116, 95,
+110, 97, 109, 101, 61, 39, 43, 102, 46, 115, 99, 114, 105, 112, 116, 95, 110,
+97, 109, 101, 59, 10, 125, 10, 105, 102, 40, 102, 46, 115, 99, 114, 105, 112,
+116, 95, 114, 101, 103, 101, 120, 112, 41, 123, 10, 100, 43, 61, 39, 32, 115,
+99, 114, 105, 112, 116, 95, 114, 101, 103, 101, 120, 112, 61, 39, 43, 102, 46,
+115, 99, 114, 105, 112, 116, 95, 114, 101, 103, 101, 120, 112, 59, 10, 125, 10,
+100, 43, 61, 39, 32, 108, 105, 110, 101, 61, 39, 43, 40, 102, 46, 108, 105, 110,
+101, 43, 49, 41, 59, 10, 105, 102, 40, 102, 46, 99, 111, 108, 117, 109, 110, 33,
+61, 110, 117, 108, 108, 41, 123, 10, 100, 43, 61, 39, 32, 99, 111, 108, 117,
+109, 110, 61, 39, 43, 40, 102, 46, 99, 111, 108, 117, 109, 110, 43, 49, 41, 59,
+10, 125, 10, 105, 102, 40, 102, 46, 103, 114, 111, 117, 112, 73, 100, 41, 123,
+10, 100, 43, 61, 39, 32, 103, 114, 111, 117, 112, 73, 100, 61, 39, 43, 102, 46,
+103, 114, 111, 117, 112, 73, 100, 59, 10, 125, 10, 105, 102, 40, 102, 46, 105,
+103, 110, 111, 114, 101, 67, 111, 117, 110, 116, 41, 123, 10, 100, 43, 61, 39,
+32, 105, 103, 110, 111, 114, 101, 67, 111, 117, 110, 116, 61, 39, 43, 102, 46,
+105, 103, 110, 111, 114, 101, 67, 111, 117, 110, 116, 59, 10, 125, 10, 105, 102,
+40, 102, 46, 97, 99, 116, 105, 118, 101, 61, 61, 61, 102, 97, 108, 115, 101, 41,
+123, 10, 100, 43, 61, 39, 32, 105, 110, 97, 99, 116, 105, 118, 101, 39, 59, 10,
+125, 10, 105, 102, 40, 102, 46, 99, 111, 110, 100, 105, 116, 105, 111, 110, 41,
+123, 10, 100, 43, 61, 39, 32, 99, 111, 110, 100, 105, 116, 105, 111, 110, 61,
+39, 43, 102, 46, 99, 111, 110, 100, 105, 116, 105, 111, 110, 59, 10, 125, 10,
+100, 43, 61, 39, 32, 104, 105, 116, 95, 99, 111, 117, 110, 116, 61, 39, 43, 102,
+46, 104, 105, 116, 95, 99, 111, 117, 110, 116, 59, 10, 125, 10, 105, 102, 40,
+99, 46, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 115, 46, 108, 101, 110,
+103, 116, 104, 61, 61, 61, 48, 41, 123, 10, 100, 61, 34, 78, 111, 32, 117, 115,
+101, 114, 32, 100, 101, 102, 105, 110, 101, 100, 32, 98, 114, 101, 97, 107, 112,
+111, 105, 110, 116, 115, 92, 110, 34, 59, 10, 125, 101, 108, 115, 101, 123, 10,
+100, 43, 61, 39, 92, 110, 39, 59, 10, 125, 10, 105, 102, 40, 99, 46, 98, 114,
+101, 97, 107, 79, 110, 69, 120, 99, 101, 112, 116, 105, 111, 110, 115, 41, 123,
+10, 100, 43, 61, 39, 42, 32, 98, 114, 101, 97, 107, 105, 110, 103, 32, 111, 110,
+32, 65, 76, 76, 32, 101, 120, 99, 101, 112, 116, 105, 111, 110, 115, 32, 105,
+115, 32, 101, 110, 97, 98, 108, 101, 100, 92, 110, 39, 59, 10, 125, 101, 108,
+115, 101, 32, 105, 102, 40, 99, 46, 98, 114, 101, 97, 107, 79, 110, 85, 110, 99,
+97, 117, 103, 104, 116, 69, 120, 99, 101, 112, 116, 105, 111, 110, 115, 41, 123,
+10, 100, 43, 61, 39, 42, 32, 98, 114, 101, 97, 107, 105, 110, 103, 32, 111, 110,
+32, 85, 78, 67, 65, 85, 71, 72, 84, 32, 101, 120, 99, 101, 112, 116, 105, 111,
+110, 115, 32, 105, 115, 32, 101, 110, 97, 98, 108, 101, 100, 92, 110, 39, 59,
+10, 125, 101, 108, 115, 101, 123, 10, 100, 43, 61, 39, 42, 32, 97, 108, 108, 32,
+101, 120, 99, 101, 112, 116, 105, 111, 110, 32, 98, 114, 101, 97, 107, 112, 111,
+105, 110, 116, 115, 32, 97, 114, 101, 32, 100, 105, 115, 97, 98, 108, 101, 100,
+92, 110, 39, 59, 10, 125, 10, 98, 46, 116, 101, 120, 116, 61, 100, 59, 10, 98,
+114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 115, 101, 116, 101, 120, 99,
+101, 112, 116, 105, 111, 110, 98, 114, 101, 97, 107, 39, 58, 10, 100, 61, 39,
+66, 114, 101, 97, 107, 32, 111, 110, 32, 39, 43, 99, 46, 116, 121, 112, 101, 43,
+39, 32, 101, 120, 99, 101, 112, 116, 105, 111, 110, 115, 58, 32, 39, 59, 10,
+100, 43, 61, 99, 46, 101, 110, 97, 98, 108, 101, 100, 63, 39, 101, 110, 97, 98,
+108, 101, 100, 39, 58, 39, 100, 105, 115, 97, 98, 108, 101, 100, 39, 59, 10, 98,
+46, 116, 101, 120, 116, 61, 100, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97,
+115, 101, 39, 98, 97, 99, 107, 116, 114, 97, 99, 101, 39, 58, 10, 105, 102, 40,
+99, 46, 116, 111, 116, 97, 108, 70, 114, 97, 109, 101, 115, 61, 61, 48, 41, 123,
+10, 100, 61, 39, 40, 101, 109, 112, 116, 121, 32, 115, 116, 97, 99, 107, 41, 39,
+59, 10, 125, 101, 108, 115, 101, 123, 10, 118, 97, 114, 32, 100, 61, 39, 70,
+114, 97, 109, 101, 115, 32, 35, 39, 43, 99, 46, 102, 114, 111, 109, 70, 114, 97,
+109, 101, 43, 39, 32, 116, 111, 32, 35, 39, 43, 10, 40, 99, 46, 116, 111, 70,
+114, 97, 109, 101, 45, 49, 41, 43, 39, 32, 111, 102, 32, 39, 43, 99, 46, 116,
+111, 116, 97, 108, 70, 114, 97, 109, 101, 115, 43, 39, 92, 110, 39, 59, 10, 102,
+111, 114, 40, 101, 61, 48, 59, 101, 60, 99, 46, 102, 114, 97, 109, 101, 115, 46,
+108, 101, 110, 103, 116, 104, 59, 101, 43, 43, 41, 123, 10, 105, 102, 40, 101,
+33, 61, 48, 41, 100, 43, 61, 39, 92, 110, 39, 59, 10, 100, 43, 61, 99, 46, 102,
+114, 97, 109, 101, 115, 91, 101, 93, 46, 116, 101, 120, 116, 59, 10, 125, 10,
+125, 10, 98, 46, 116, 101, 120, 116, 61, 100, 59, 10, 98, 114, 101, 97, 107, 59,
+10, 99, 97, 115, 101, 39, 102, 114, 97, 109, 101, 39, 58, 10, 105, 102, 40, 108,
+97, 115, 116, 95, 99, 109, 100, 61, 61, 61, 39, 105, 110, 102, 111, 32, 108,
+111, 99, 97, 108, 115, 39, 41, 123, 10, 118, 97, 114, 32, 103, 61, 99, 46, 108,
+111, 99, 97, 108, 115, 59, 10, 105, 102, 40, 103, 46, 108, 101, 110, 103, 116,
+104, 61, 61, 61, 48, 41, 123, 10, 100, 61, 39, 78, 111, 32, 108, 111, 99, 97,
+108, 115, 39, 59, 10, 125, 101, 108, 115, 101, 123, 10, 102, 111, 114, 40, 118,
+97, 114, 32, 101, 61, 48, 59, 101, 60, 103, 46, 108, 101, 110, 103, 116, 104,
+59, 101, 43, 43, 41, 123, 10, 118, 97, 114, 32, 104, 61, 103, 91, 101, 93, 59,
+10, 100, 43, 61, 104, 46, 110, 97, 109, 101, 43, 39, 32, 61, 32, 39, 59, 10,
+100, 43, 61, 114, 101, 102, 79, 98, 106, 101, 99, 116, 84, 111, 83, 116, 114,
+105, 110, 103, 95, 40, 97, 44, 104, 46, 118, 97, 108, 117, 101, 46, 114, 101,
+102, 41, 59, 10, 100, 43, 61, 39, 92, 110, 39, 59, 10, 125, 10, 125, 10, 125,
+101, 108, 115, 101, 32, 105, 102, 40, 108, 97, 115, 116, 95, 99, 109, 100, 61,
+61, 61, 39, 105, 110, 102, 111, 32, 97, 114, 103, 115, 39, 41, 123, 10, 118, 97,
+114, 32, 105, 61, 99, 46, 97, 114, 103, 117, 109, 101, 110, 116, 115, 59, 10,
+105, 102, 40, 105, 46, 108, 101, 110, 103, 116, 104, 61, 61, 61, 48, 41, 123,
+10, 100, 61, 39, 78, 111, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 39,
+59, 10, 125, 101, 108, 115, 101, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32,
+101, 61, 48, 59, 101, 60, 105, 46, 108, 101, 110, 103, 116, 104, 59, 101, 43,
+43, 41, 123, 10, 118, 97, 114, 32, 106, 61, 105, 91, 101, 93, 59, 10, 100, 43,
+61, 106, 46, 110, 97, 109, 101, 43, 39, 32, 61, 32, 39, 59, 10, 100, 43, 61,
+114, 101, 102, 79, 98, 106, 101, 99, 116, 84, 111, 83, 116, 114, 105, 110, 103,
+95, 40, 97, 44, 106, 46, 118, 97, 108, 117, 101, 46, 114, 101, 102, 41, 59, 10,
+100, 43, 61, 39, 92, 110, 39, 59, 10, 125, 10, 125, 10, 125, 101, 108, 115, 101,
+123, 10, 100, 61, 83, 111, 117, 114, 99, 101, 85, 110, 100, 101, 114, 108, 105,
+110, 101, 40, 99, 46, 115, 111, 117, 114, 99, 101, 76, 105, 110, 101, 84, 101,
+120, 116, 44, 10, 99, 46, 99, 111, 108, 117, 109, 110, 41, 59, 10, 68, 101, 98,
+117, 103, 46, 83, 116, 97, 116, 101, 46, 99, 117, 114, 114, 101, 110, 116, 83,
+111, 117, 114, 99, 101, 76, 105, 110, 101, 61, 99, 46, 108, 105, 110, 101, 59,
+10, 68, 101, 98, 117, 103, 46, 83, 116, 97, 116, 101, 46, 99, 117, 114, 114,
+101, 110, 116, 70, 114, 97, 109, 101, 61, 99, 46, 105, 110, 100, 101, 120, 59,
+10, 68, 101, 98, 117, 103, 46, 83, 116, 97, 116, 101, 46, 100, 105, 115, 112,
+108, 97, 121, 83, 111, 117, 114, 99, 101, 83, 116, 97, 114, 116, 76, 105, 110,
+101, 61, 45, 49, 59, 10, 68, 101, 98, 117, 103, 46, 83, 116, 97, 116, 101, 46,
+100, 105, 115, 112, 108, 97, 121, 83, 111, 117, 114, 99, 101, 69, 110, 100, 76,
+105, 110, 101, 61, 45, 49, 59, 10, 125, 10, 98, 46, 116, 101, 120, 116, 61, 100,
+59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 115, 99, 111, 112,
+101, 115, 39, 58, 10, 105, 102, 40, 99, 46, 116, 111, 116, 97, 108, 83, 99, 111,
+112, 101, 115, 61, 61, 48, 41, 123, 10, 100, 61, 39, 40, 110, 111, 32, 115, 99,
+111, 112, 101, 115, 41, 39, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 61,
+39, 83, 99, 111, 112, 101, 115, 32, 35, 39, 43, 99, 46, 102, 114, 111, 109, 83,
+99, 111, 112, 101, 43, 39, 32, 116, 111, 32, 35, 39, 43, 10, 40, 99, 46, 116,
+111, 83, 99, 111, 112, 101, 45, 49, 41, 43, 39, 32, 111, 102, 32, 39, 43, 99,
+46, 116, 111, 116, 97, 108, 83, 99, 111, 112, 101, 115, 43, 39, 92, 110, 39, 59,
+10, 102, 111, 114, 40, 101, 61, 48, 59, 101, 60, 99, 46, 115, 99, 111, 112, 101,
+115, 46, 108, 101, 110, 103, 116, 104, 59, 101, 43, 43, 41, 123, 10, 105, 102,
+40, 101, 33, 61, 48, 41, 123, 10, 100, 43, 61, 39, 92, 110, 39, 59, 10, 125, 10,
+100, 43, 61, 102, 111, 114, 109, 97, 116, 83, 99, 111, 112, 101, 95, 40, 99, 46,
+115, 99, 111, 112, 101, 115, 91, 101, 93, 41, 59, 10, 125, 10, 125, 10, 98, 46,
+116, 101, 120, 116, 61, 100, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115,
+101, 39, 115, 99, 111, 112, 101, 39, 58, 10, 100, 43, 61, 102, 111, 114, 109,
+97, 116, 83, 99, 111, 112, 101, 95, 40, 99, 41, 59, 10, 100, 43, 61, 39, 92,
+110, 39, 59, 10, 118, 97, 114, 32, 107, 61, 97, 46, 108, 111, 111, 107, 117,
+112, 40, 99, 46, 111, 98, 106, 101, 99, 116, 46, 114, 101, 102, 41, 59, 10, 100,
+43, 61, 102, 111, 114, 109, 97, 116, 79, 98, 106, 101, 99, 116, 95, 40, 107, 44,
+116, 114, 117, 101, 41, 59, 10, 98, 46, 116, 101, 120, 116, 61, 100, 59, 10, 98,
+114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 101, 118, 97, 108, 117, 97,
+116, 101, 39, 58, 10, 99, 97, 115, 101, 39, 108, 111, 111, 107, 117, 112, 39,
+58, 10, 99, 97, 115, 101, 39, 103, 101, 116, 111, 98, 106, 39, 58, 10, 105, 102,
+40, 108, 97, 115, 116, 95, 99, 109, 100, 61, 61, 39, 112, 39, 124, 124, 108, 97,
+115, 116, 95, 99, 109, 100, 61, 61, 39, 112, 114, 105, 110, 116, 39, 41, 123,
+10, 100, 61, 99, 46, 116, 101, 120, 116, 59, 10, 125, 101, 108, 115, 101, 123,
+10, 118, 97, 114, 32, 108, 59, 10, 105, 102, 40, 108, 111, 111, 107, 117, 112,
+95, 104, 97, 110, 100, 108, 101, 41, 123, 10, 108, 61, 97, 46, 98, 111, 100,
+121, 86, 97, 108, 117, 101, 40, 108, 111, 111, 107, 117, 112, 95, 104, 97, 110,
+100, 108, 101, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 108, 61, 97, 46,
+98, 111, 100, 121, 86, 97, 108, 117, 101, 40, 41, 59, 10, 125, 10, 105, 102, 40,
+108, 46, 105, 115, 79, 98, 106, 101, 99, 116, 40, 41, 41, 123, 10, 100, 43, 61,
+102, 111, 114, 109, 97, 116, 79, 98, 106, 101, 99, 116, 95, 40, 108, 44, 116,
+114, 117, 101, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 43, 61, 39,
+116, 121, 112, 101, 58, 32, 39, 59, 10, 100, 43, 61, 108, 46, 116, 121, 112,
+101, 40, 41, 59, 10, 105, 102, 40, 33, 108, 46, 105, 115, 85, 110, 100, 101,
+102, 105, 110, 101, 100, 40, 41, 38, 38, 33, 108, 46, 105, 115, 78, 117, 108,
+108, 40, 41, 41, 123, 10, 100, 43, 61, 39, 44, 32, 39, 59, 10, 105, 102, 40,
+108, 46, 105, 115, 83, 116, 114, 105, 110, 103, 40, 41, 41, 123, 10, 100, 43,
+61, 39, 34, 39, 59, 10, 125, 10, 100, 43, 61, 108, 46, 118, 97, 108, 117, 101,
+40, 41, 59, 10, 105, 102, 40, 108, 46, 105, 115, 83, 116, 114, 105, 110, 103,
+40, 41, 41, 123, 10, 100, 43, 61, 39, 34, 39, 59, 10, 125, 10, 125, 10, 100, 43,
+61, 39, 92, 110, 39, 59, 10, 125, 10, 125, 10, 98, 46, 116, 101, 120, 116, 61,
+100, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 114, 101, 102,
+101, 114, 101, 110, 99, 101, 115, 39, 58, 10, 118, 97, 114, 32, 109, 61, 99, 46,
+108, 101, 110, 103, 116, 104, 59, 10, 100, 43, 61, 39, 102, 111, 117, 110, 100,
+32, 39, 43, 109, 43, 39, 32, 111, 98, 106, 101, 99, 116, 115, 39, 59, 10, 100,
+43, 61, 39, 92, 110, 39, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 101, 61,
+48, 59, 101, 60, 109, 59, 101, 43, 43, 41, 123, 10, 118, 97, 114, 32, 108, 61,
+97, 46, 98, 111, 100, 121, 86, 97, 108, 117, 101, 40, 101, 41, 59, 10, 100, 43,
+61, 102, 111, 114, 109, 97, 116, 79, 98, 106, 101, 99, 116, 95, 40, 108, 44,
+102, 97, 108, 115, 101, 41, 59, 10, 100, 43, 61, 39, 92, 110, 39, 59, 10, 125,
+10, 98, 46, 116, 101, 120, 116, 61, 100, 59, 10, 98, 114, 101, 97, 107, 59, 10,
+99, 97, 115, 101, 39, 115, 111, 117, 114, 99, 101, 39, 58, 10, 118, 97, 114, 32,
+110, 61, 99, 46, 115, 111, 117, 114, 99, 101, 59, 10, 118, 97, 114, 32, 111, 61,
+99, 46, 102, 114, 111, 109, 76, 105, 110, 101, 43, 49, 59, 10, 118, 97, 114, 32,
+112, 61, 110, 46, 115, 112, 108, 105, 116, 40, 39, 92, 110, 39, 41, 59, 10, 118,
+97, 114, 32, 113, 61, 49, 43, 77, 97, 116, 104, 46, 102, 108, 111, 111, 114, 40,
+108, 111, 103, 49, 48, 40, 111, 43, 112, 46, 108, 101, 110, 103, 116, 104, 41,
+41, 59, 10, 105, 102, 40, 113, 60, 51, 41, 123, 10, 113, 61, 51, 59, 10, 125,
+10, 118, 97, 114, 32, 100, 61, 39, 39, 59, 10, 102, 111, 114, 40, 118, 97, 114,
+32, 114, 61, 48, 59, 114, 60, 112, 46, 108, 101, 110, 103, 116, 104, 59, 114,
+43, 43, 41, 123, 10, 105, 102, 40, 114, 61, 61, 40, 112, 46, 108, 101, 110, 103,
+116, 104, 45, 49, 41, 38, 38, 112, 91, 114, 93, 46, 108, 101, 110, 103, 116,
+104, 61, 61, 48, 41, 123, 10, 98, 114, 101, 97, 107, 59, 10, 125, 10, 118, 97,
+114, 32, 115, 61, 111, 43, 114, 59, 10, 118, 97, 114, 32, 116, 61, 113, 45, 40,
+49, 43, 77, 97, 116, 104, 46, 102, 108, 111, 111, 114, 40, 108, 111, 103, 49,
+48, 40, 115, 41, 41, 41, 59, 10, 105, 102, 40, 115, 61, 61, 68, 101, 98, 117,
+103, 46, 83, 116, 97, 116, 101, 46, 99, 117, 114, 114, 101, 110, 116, 83, 111,
+117, 114, 99, 101, 76, 105, 110, 101, 43, 49, 41, 123, 10, 102, 111, 114, 40,
+118, 97, 114, 32, 101, 61, 48, 59, 101, 60, 113, 59, 101, 43, 43, 41, 123, 10,
+100, 43, 61, 39, 62, 39, 59, 10, 125, 10, 100, 43, 61, 39, 32, 32, 39, 59, 10,
+125, 101, 108, 115, 101, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 101, 61,
+48, 59, 101, 60, 116, 59, 101, 43, 43, 41, 123, 10, 100, 43, 61, 39, 32, 39, 59,
+10, 125, 10, 100, 43, 61, 115, 43, 39, 58, 32, 39, 59, 10, 125, 10, 100, 43, 61,
+112, 91, 114, 93, 59, 10, 100, 43, 61, 39, 92, 110, 39, 59, 10, 125, 10, 98, 46,
+116, 101, 120, 116, 61, 100, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115,
+101, 39, 115, 99, 114, 105, 112, 116, 115, 39, 58, 10, 118, 97, 114, 32, 100,
+61, 39, 39, 59, 10, 102, 111, 114, 40, 101, 61, 48, 59, 101, 60, 99, 46, 108,
+101, 110, 103, 116, 104, 59, 101, 43, 43, 41, 123, 10, 105, 102, 40, 101, 33,
+61, 48, 41, 100, 43, 61, 39, 92, 110, 39, 59, 10, 105, 102, 40, 99, 91, 101, 93,
+46, 105, 100, 41, 123, 10, 100, 43, 61, 99, 91, 101, 93, 46, 105, 100, 59, 10,
+125, 101, 108, 115, 101, 123, 10, 100, 43, 61, 39, 91, 110, 111, 32, 105, 100,
+93, 39, 59, 10, 125, 10, 100, 43, 61, 39, 44, 32, 39, 59, 10, 105, 102, 40, 99,
+91, 101, 93, 46, 110, 97, 109, 101, 41, 123, 10, 100, 43, 61, 99, 91, 101, 93,
+46, 110, 97, 109, 101, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40,
+99, 91, 101, 93, 46, 99, 111, 109, 112, 105, 108, 97, 116, 105, 111, 110, 84,
+121, 112, 101, 61, 61, 68, 101, 98, 117, 103, 46, 83, 99, 114, 105, 112, 116,
+67, 111, 109, 112, 105, 108, 97, 116, 105, 111, 110, 84, 121, 112, 101, 46, 69,
+118, 97, 108, 10, 38, 38, 99, 91, 101, 93, 46, 101, 118, 97, 108, 70, 114, 111,
+109, 83, 99, 114, 105, 112, 116, 10, 41, 123, 10, 100, 43, 61, 39, 101, 118, 97,
+108, 32, 102, 114, 111, 109, 32, 39, 59, 10, 118, 97, 114, 32, 117, 61, 97, 46,
+108, 111, 111, 107, 117, 112, 40, 99, 91, 101, 93, 46, 101, 118, 97, 108, 70,
+114, 111, 109, 83, 99, 114, 105, 112, 116, 46, 114, 101, 102, 41, 59, 10, 100,
+43, 61, 39, 32, 39, 43, 117, 46, 102, 105, 101, 108, 100, 40, 39, 110, 97, 109,
+101, 39, 41, 59, 10, 100, 43, 61, 39, 58, 39, 43, 40, 99, 91, 101, 93, 46, 101,
+118, 97, 108, 70, 114, 111, 109, 76, 111, 99, 97, 116, 105, 111, 110, 46, 108,
+105, 110, 101, 43, 49, 41, 59, 10, 100, 43, 61, 39, 58, 39, 43, 99, 91, 101, 93,
+46, 101, 118, 97, 108, 70, 114, 111, 109, 76, 111, 99, 97, 116, 105, 111, 110,
+46, 99, 111, 108, 117, 109, 110, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102,
+40, 99, 91, 101, 93, 46, 99, 111, 109, 112, 105, 108, 97, 116, 105, 111, 110,
+84, 121, 112, 101, 61, 61, 10, 68, 101, 98, 117, 103, 46, 83, 99, 114, 105, 112,
+116, 67, 111, 109, 112, 105, 108, 97, 116, 105, 111, 110, 84, 121, 112, 101, 46,
+74, 83, 79, 78, 41, 123, 10, 100, 43, 61, 39, 74, 83, 79, 78, 32, 39, 59, 10,
+125, 101, 108, 115, 101, 123, 10, 100, 43, 61, 39, 91, 117, 110, 110, 97, 109,
+101, 100, 93, 32, 39, 59, 10, 125, 10, 125, 10, 100, 43, 61, 39, 32, 40, 108,
+105, 110, 101, 115, 58, 32, 39, 59, 10, 100, 43, 61, 99, 91, 101, 93, 46, 108,
+105, 110, 101, 67, 111, 117, 110, 116, 59, 10, 100, 43, 61, 39, 44, 32, 108,
+101, 110, 103, 116, 104, 58, 32, 39, 59, 10, 100, 43, 61, 99, 91, 101, 93, 46,
+115, 111, 117, 114, 99, 101, 76, 101, 110, 103, 116, 104, 59, 10, 105, 102, 40,
+99, 91, 101, 93, 46, 116, 121, 112, 101, 61, 61, 68, 101, 98, 117, 103, 46, 83,
+99, 114, 105, 112, 116, 84, 121, 112, 101, 46, 78, 97, 116, 105, 118, 101, 41,
+123, 10, 100, 43, 61, 39, 44, 32, 110, 97, 116, 105, 118, 101, 39, 59, 10, 125,
+101, 108, 115, 101, 32, 105, 102, 40, 99, 91, 101, 93, 46, 116, 121, 112, 101,
+61, 61, 68, 101, 98, 117, 103, 46, 83, 99, 114, 105, 112, 116, 84, 121, 112,
+101, 46, 69, 120, 116, 101, 110, 115, 105, 111, 110, 41, 123, 10, 100, 43, 61,
+39, 44, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 39, 59, 10, 125, 10,
+100, 43, 61, 39, 41, 44, 32, 91, 39, 59, 10, 118, 97, 114, 32, 118, 61, 99, 91,
+101, 93, 46, 115, 111, 117, 114, 99, 101, 83, 116, 97, 114, 116, 59, 10, 105,
+102, 40, 118, 46, 108, 101, 110, 103, 116, 104, 62, 52, 48, 41, 123, 10, 118,
+61, 118, 46, 115, 117, 98, 115, 116, 114, 105, 110, 103, 40, 48, 44, 51, 55, 41,
+43, 39, 46, 46, 46, 39, 59, 10, 125, 10, 100, 43, 61, 118, 59, 10, 100, 43, 61,
+39, 93, 39, 59, 10, 125, 10, 105, 102, 40, 99, 46, 108, 101, 110, 103, 116, 104,
+61, 61, 48, 41, 123, 10, 100, 61, 34, 110, 111, 32, 109, 97, 116, 99, 104, 105,
+110, 103, 32, 115, 99, 114, 105, 112, 116, 115, 32, 102, 111, 117, 110, 100, 34,
+59, 10, 125, 10, 98, 46, 116, 101, 120, 116, 61, 100, 59, 10, 98, 114, 101, 97,
+107, 59, 10, 99, 97, 115, 101, 39, 116, 104, 114, 101, 97, 100, 115, 39, 58, 10,
+118, 97, 114, 32, 100, 61, 39, 65, 99, 116, 105, 118, 101, 32, 86, 56, 32, 116,
+104, 114, 101, 97, 100, 115, 58, 32, 39, 43, 99, 46, 116, 111, 116, 97, 108, 84,
+104, 114, 101, 97, 100, 115, 43, 39, 92, 110, 39, 59, 10, 99, 46, 116, 104, 114,
+101, 97, 100, 115, 46, 115, 111, 114, 116, 40, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 119, 44, 120, 41, 123, 114, 101, 116, 117, 114, 110, 32, 119, 46, 105,
+100, 45, 120, 46, 105, 100, 59, 125, 41, 59, 10, 102, 111, 114, 40, 101, 61, 48,
+59, 101, 60, 99, 46, 116, 104, 114, 101, 97, 100, 115, 46, 108, 101, 110, 103,
+116, 104, 59, 101, 43, 43, 41, 123, 10, 100, 43, 61, 99, 46, 116, 104, 114, 101,
+97, 100, 115, 91, 101, 93, 46, 99, 117, 114, 114, 101, 110, 116, 63, 39, 42, 39,
+58, 39, 32, 39, 59, 10, 100, 43, 61, 39, 32, 39, 59, 10, 100, 43, 61, 99, 46,
+116, 104, 114, 101, 97, 100, 115, 91, 101, 93, 46, 105, 100, 59, 10, 100, 43,
+61, 39, 92, 110, 39, 59, 10, 125, 10, 98, 46, 116, 101, 120, 116, 61, 100, 59,
+10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 99, 111, 110, 116, 105,
+110, 117, 101, 39, 58, 10, 98, 46, 116, 101, 120, 116, 61, 34, 40, 114, 117,
+110, 110, 105, 110, 103, 41, 34, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97,
+115, 101, 39, 118, 56, 102, 108, 97, 103, 115, 39, 58, 10, 98, 46, 116, 101,
+120, 116, 61, 34, 102, 108, 97, 103, 115, 32, 115, 101, 116, 34, 59, 10, 98,
+114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 103, 99, 39, 58, 10, 98, 46,
+116, 101, 120, 116, 61, 34, 71, 67, 32, 34, 43, 99, 46, 98, 101, 102, 111, 114,
+101, 43, 34, 32, 61, 62, 32, 34, 43, 99, 46, 97, 102, 116, 101, 114, 59, 10,
+105, 102, 40, 99, 46, 97, 102, 116, 101, 114, 62, 40, 49, 48, 50, 52, 42, 49,
+48, 50, 52, 41, 41, 123, 10, 98, 46, 116, 101, 120, 116, 43, 61, 10, 34, 32, 40,
+34, 43, 114, 111, 117, 110, 100, 78, 117, 109, 98, 101, 114, 40, 99, 46, 98,
+101, 102, 111, 114, 101, 47, 40, 49, 48, 50, 52, 42, 49, 48, 50, 52, 41, 44, 49,
+41, 43, 34, 77, 32, 61, 62, 32, 34, 43, 10, 114, 111, 117, 110, 100, 78, 117,
+109, 98, 101, 114, 40, 99, 46, 97, 102, 116, 101, 114, 47, 40, 49, 48, 50, 52,
+42, 49, 48, 50, 52, 41, 44, 49, 41, 43, 34, 77, 41, 34, 59, 10, 125, 101, 108,
+115, 101, 32, 105, 102, 40, 99, 46, 97, 102, 116, 101, 114, 62, 49, 48, 50, 52,
+41, 123, 10, 98, 46, 116, 101, 120, 116, 43, 61, 10, 34, 32, 40, 34, 43, 114,
+111, 117, 110, 100, 78, 117, 109, 98, 101, 114, 40, 99, 46, 98, 101, 102, 111,
+114, 101, 47, 49, 48, 50, 52, 44, 49, 41, 43, 34, 75, 32, 61, 62, 32, 34, 43,
+10, 114, 111, 117, 110, 100, 78, 117, 109, 98, 101, 114, 40, 99, 46, 97, 102,
+116, 101, 114, 47, 49, 48, 50, 52, 44, 49, 41, 43, 34, 75, 41, 34, 59, 10, 125,
+10, 98, 114, 101, 97, 107, 59, 10, 100, 101, 102, 97, 117, 108, 116, 58, 10, 98,
+46, 116, 101, 120, 116, 61, 10, 39, 82, 101, 115, 112, 111, 110, 115, 101, 32,
+102, 111, 114, 32, 117, 110, 107, 110, 111, 119, 110, 32, 99, 111, 109, 109, 97,
+110, 100, 32, 92, 39, 39, 43, 97, 46, 99, 111, 109, 109, 97, 110, 100, 40, 41,
+43, 39, 92, 39, 39, 43, 10, 39, 32, 40, 39, 43, 97, 46, 114, 97, 119, 95, 106,
+115, 111, 110, 40, 41, 43, 39, 41, 39, 59, 10, 125, 10, 125, 99, 97, 116, 99,
+104, 40, 101, 41, 123, 10, 98, 46, 116, 101, 120, 116, 61, 39, 69, 114, 114,
+111, 114, 58, 32, 34, 39, 43, 101, 43, 39, 34, 32, 102, 111, 114, 109, 97, 116,
+116, 105, 110, 103, 32, 114, 101, 115, 112, 111, 110, 115, 101, 39, 59, 10, 125,
+10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 80, 114, 111, 116, 111, 99, 111, 108, 80, 97, 99, 107,
+97, 103, 101, 40, 97, 41, 123, 10, 116, 104, 105, 115, 46, 114, 97, 119, 95,
+106, 115, 111, 110, 95, 61, 97, 59, 10, 116, 104, 105, 115, 46, 112, 97, 99,
+107, 101, 116, 95, 61, 74, 83, 79, 78, 46, 112, 97, 114, 115, 101, 40, 97, 41,
+59, 10, 116, 104, 105, 115, 46, 114, 101, 102, 115, 95, 61, 91, 93, 59, 10, 105,
+102, 40, 116, 104, 105, 115, 46, 112, 97, 99, 107, 101, 116, 95, 46, 114, 101,
+102, 115, 41, 123, 10, 102, 111, 114, 40, 118, 97, 114, 32, 98, 61, 48, 59, 98,
+60, 116, 104, 105, 115, 46, 112, 97, 99, 107, 101, 116, 95, 46, 114, 101, 102,
+115, 46, 108, 101, 110, 103, 116, 104, 59, 98, 43, 43, 41, 123, 10, 116, 104,
+105, 115, 46, 114, 101, 102, 115, 95, 91, 116, 104, 105, 115, 46, 112, 97, 99,
+107, 101, 116, 95, 46, 114, 101, 102, 115, 91, 98, 93, 46, 104, 97, 110, 100,
+108, 101, 93, 61, 116, 104, 105, 115, 46, 112, 97, 99, 107, 101, 116, 95, 46,
+114, 101, 102, 115, 91, 98, 93, 59, 10, 125, 10, 125, 10, 125, 10, 80, 114, 111,
+116, 111, 99, 111, 108, 80, 97, 99, 107, 97, 103, 101, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 116, 121, 112, 101, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105,
+115, 46, 112, 97, 99, 107, 101, 116, 95, 46, 116, 121, 112, 101, 59, 10, 125,
+59, 10, 80, 114, 111, 116, 111, 99, 111, 108, 80, 97, 99, 107, 97, 103, 101, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 101, 118, 101, 110, 116, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 104, 105, 115, 46, 112, 97, 99, 107, 101, 116, 95, 46, 101, 118,
+101, 110, 116, 59, 10, 125, 59, 10, 80, 114, 111, 116, 111, 99, 111, 108, 80,
+97, 99, 107, 97, 103, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+114, 101, 113, 117, 101, 115, 116, 83, 101, 113, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105,
+115, 46, 112, 97, 99, 107, 101, 116, 95, 46, 114, 101, 113, 117, 101, 115, 116,
+95, 115, 101, 113, 59, 10, 125, 59, 10, 80, 114, 111, 116, 111, 99, 111, 108,
+80, 97, 99, 107, 97, 103, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 114, 117, 110, 110, 105, 110, 103, 61, 102, 117, 110, 99, 116, 105, 111,
+110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46,
+112, 97, 99, 107, 101, 116, 95, 46, 114, 117, 110, 110, 105, 110, 103, 63, 116,
+114, 117, 101, 58, 102, 97, 108, 115, 101, 59, 10, 125, 59, 10, 80, 114, 111,
+116, 111, 99, 111, 108, 80, 97, 99, 107, 97, 103, 101, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 115, 117, 99, 99, 101, 115, 115, 61, 102, 117, 110,
+99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116,
+104, 105, 115, 46, 112, 97, 99, 107, 101, 116, 95, 46, 115, 117, 99, 99, 101,
+115, 115, 63, 116, 114, 117, 101, 58, 102, 97, 108, 115, 101, 59, 10, 125, 59,
+10, 80, 114, 111, 116, 111, 99, 111, 108, 80, 97, 99, 107, 97, 103, 101, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 109, 101, 115, 115, 97, 103,
+101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 46, 112, 97, 99, 107, 101, 116, 95, 46,
+109, 101, 115, 115, 97, 103, 101, 59, 10, 125, 59, 10, 80, 114, 111, 116, 111,
+99, 111, 108, 80, 97, 99, 107, 97, 103, 101, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 99, 111, 109, 109, 97, 110, 100, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105,
+115, 46, 112, 97, 99, 107, 101, 116, 95, 46, 99, 111, 109, 109, 97, 110, 100,
+59, 10, 125, 59, 10, 80, 114, 111, 116, 111, 99, 111, 108, 80, 97, 99, 107, 97,
+103, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 98, 111, 100,
+121, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 46, 112, 97, 99, 107, 101, 116, 95, 46,
+98, 111, 100, 121, 59, 10, 125, 59, 10, 80, 114, 111, 116, 111, 99, 111, 108,
+80, 97, 99, 107, 97, 103, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 98, 111, 100, 121, 86, 97, 108, 117, 101, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 97, 41, 123, 10, 105, 102, 40, 97, 33, 61, 110, 117, 108, 108, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 80, 114, 111, 116,
+111, 99, 111, 108, 86, 97, 108, 117, 101, 40, 116, 104, 105, 115, 46, 112, 97,
+99, 107, 101, 116, 95, 46, 98, 111, 100, 121, 91, 97, 93, 44, 116, 104, 105,
+115, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110,
+32, 110, 101, 119, 32, 80, 114, 111, 116, 111, 99, 111, 108, 86, 97, 108, 117,
+101, 40, 116, 104, 105, 115, 46, 112, 97, 99, 107, 101, 116, 95, 46, 98, 111,
+100, 121, 44, 116, 104, 105, 115, 41, 59, 10, 125, 10, 125, 59, 10, 80, 114,
+111, 116, 111, 99, 111, 108, 80, 97, 99, 107, 97, 103, 101, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 98, 111, 100, 121, 61, 102, 117, 110, 99, 116,
+105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105,
+115, 46, 112, 97, 99, 107, 101, 116, 95, 46, 98, 111, 100, 121, 59, 10, 125, 59,
+10, 80, 114, 111, 116, 111, 99, 111, 108, 80, 97, 99, 107, 97, 103, 101, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 108, 111, 111, 107, 117, 112,
+61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 118, 97, 114,
+32, 98, 61, 116, 104, 105, 115, 46, 114, 101, 102, 115, 95, 91, 97, 93, 59, 10,
+105, 102, 40, 98, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119,
+32, 80, 114, 111, 116, 111, 99, 111, 108, 86, 97, 108, 117, 101, 40, 98, 44,
+116, 104, 105, 115, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 110, 101, 119, 32, 80, 114, 111, 116, 111, 99, 111, 108, 82,
+101, 102, 101, 114, 101, 110, 99, 101, 40, 97, 41, 59, 10, 125, 10, 125, 59, 10,
+80, 114, 111, 116, 111, 99, 111, 108, 80, 97, 99, 107, 97, 103, 101, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 97, 119, 95, 106, 115, 111,
+110, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 46, 114, 97, 119, 95, 106, 115, 111, 110,
+95, 59, 10, 125, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 80, 114,
+111, 116, 111, 99, 111, 108, 86, 97, 108, 117, 101, 40, 97, 44, 98, 41, 123, 10,
+116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 61, 97, 59, 10, 116, 104,
+105, 115, 46, 112, 97, 99, 107, 101, 116, 95, 61, 98, 59, 10, 125, 10, 80, 114,
+111, 116, 111, 99, 111, 108, 86, 97, 108, 117, 101, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 116, 121, 112, 101, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115,
+46, 118, 97, 108, 117, 101, 95, 46, 116, 121, 112, 101, 59, 10, 125, 59, 10, 80,
+114, 111, 116, 111, 99, 111, 108, 86, 97, 108, 117, 101, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 102, 105, 101, 108, 100, 61, 102, 117, 110, 99,
+116, 105, 111, 110, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116,
+104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 91, 97, 93, 59, 10, 125, 59, 10,
+80, 114, 111, 116, 111, 99, 111, 108, 86, 97, 108, 117, 101, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 105, 115, 80, 114, 105, 109, 105, 116, 105,
+118, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 105, 115, 85, 110, 100, 101,
+102, 105, 110, 101, 100, 40, 41, 124, 124, 116, 104, 105, 115, 46, 105, 115, 78,
+117, 108, 108, 40, 41, 124, 124, 116, 104, 105, 115, 46, 105, 115, 66, 111, 111,
+108, 101, 97, 110, 40, 41, 124, 124, 10, 116, 104, 105, 115, 46, 105, 115, 78,
+117, 109, 98, 101, 114, 40, 41, 124, 124, 116, 104, 105, 115, 46, 105, 115, 83,
+116, 114, 105, 110, 103, 40, 41, 59, 10, 125, 59, 10, 80, 114, 111, 116, 111,
+99, 111, 108, 86, 97, 108, 117, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 104, 97, 110, 100, 108, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110,
+40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 118,
+97, 108, 117, 101, 95, 46, 104, 97, 110, 100, 108, 101, 59, 10, 125, 59, 10, 80,
+114, 111, 116, 111, 99, 111, 108, 86, 97, 108, 117, 101, 46, 112, 114, 111, 116,
+111, 116, 121, 112, 101, 46, 105, 115, 85, 110, 100, 101, 102, 105, 110, 101,
+100, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 46, 116,
+121, 112, 101, 61, 61, 39, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 59,
+10, 125, 59, 10, 80, 114, 111, 116, 111, 99, 111, 108, 86, 97, 108, 117, 101,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 78, 117, 108,
+108, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 46, 116,
+121, 112, 101, 61, 61, 39, 110, 117, 108, 108, 39, 59, 10, 125, 59, 10, 80, 114,
+111, 116, 111, 99, 111, 108, 86, 97, 108, 117, 101, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 105, 115, 66, 111, 111, 108, 101, 97, 110, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 46, 116, 121, 112, 101, 61,
+61, 39, 98, 111, 111, 108, 101, 97, 110, 39, 59, 10, 125, 59, 10, 80, 114, 111,
+116, 111, 99, 111, 108, 86, 97, 108, 117, 101, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 105, 115, 78, 117, 109, 98, 101, 114, 61, 102, 117, 110, 99,
+116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104,
+105, 115, 46, 118, 97, 108, 117, 101, 95, 46, 116, 121, 112, 101, 61, 61, 39,
+110, 117, 109, 98, 101, 114, 39, 59, 10, 125, 59, 10, 80, 114, 111, 116, 111,
+99, 111, 108, 86, 97, 108, 117, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 105, 115, 83, 116, 114, 105, 110, 103, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115,
+46, 118, 97, 108, 117, 101, 95, 46, 116, 121, 112, 101, 61, 61, 39, 115, 116,
+114, 105, 110, 103, 39, 59, 10, 125, 59, 10, 80, 114, 111, 116, 111, 99, 111,
+108, 86, 97, 108, 117, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+105, 115, 79, 98, 106, 101, 99, 116, 61, 102, 117, 110, 99, 116, 105, 111, 110,
+40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 118,
+97, 108, 117, 101, 95, 46, 116, 121, 112, 101, 61, 61, 39, 111, 98, 106, 101,
+99, 116, 39, 124, 124, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 46,
+116, 121, 112, 101, 61, 61, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 124,
+124, 10, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 46, 116, 121, 112,
+101, 61, 61, 39, 101, 114, 114, 111, 114, 39, 124, 124, 116, 104, 105, 115, 46,
+118, 97, 108, 117, 101, 95, 46, 116, 121, 112, 101, 61, 61, 39, 114, 101, 103,
+101, 120, 112, 39, 59, 10, 125, 59, 10, 80, 114, 111, 116, 111, 99, 111, 108,
+86, 97, 108, 117, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99,
+111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 70, 117, 110, 99, 116, 105,
+111, 110, 86, 97, 108, 117, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+41, 123, 10, 118, 97, 114, 32, 97, 61, 116, 104, 105, 115, 46, 118, 97, 108,
+117, 101, 95, 46, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 70, 117,
+110, 99, 116, 105, 111, 110, 59, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104,
+105, 115, 46, 112, 97, 99, 107, 101, 116, 95, 46, 108, 111, 111, 107, 117, 112,
+40, 97, 46, 114, 101, 102, 41, 59, 10, 125, 59, 10, 80, 114, 111, 116, 111, 99,
+111, 108, 86, 97, 108, 117, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 112, 114, 111, 116, 111, 79, 98, 106, 101, 99, 116, 86, 97, 108, 117,
+101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 118, 97, 114,
+32, 97, 61, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 46, 112, 114,
+111, 116, 111, 79, 98, 106, 101, 99, 116, 59, 10, 114, 101, 116, 117, 114, 110,
+32, 116, 104, 105, 115, 46, 112, 97, 99, 107, 101, 116, 95, 46, 108, 111, 111,
+107, 117, 112, 40, 97, 46, 114, 101, 102, 41, 59, 10, 125, 59, 10, 80, 114, 111,
+116, 111, 99, 111, 108, 86, 97, 108, 117, 101, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 112, 114, 111, 112, 101, 114, 116, 121, 67, 111, 117, 110,
+116, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 46, 112,
+114, 111, 112, 101, 114, 116, 105, 101, 115, 63, 116, 104, 105, 115, 46, 118,
+97, 108, 117, 101, 95, 46, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 46,
+108, 101, 110, 103, 116, 104, 58, 48, 59, 10, 125, 59, 10, 80, 114, 111, 116,
+111, 99, 111, 108, 86, 97, 108, 117, 101, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 112, 114, 111, 112, 101, 114, 116, 121, 78, 97, 109, 101, 61, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61,
+116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 46, 112, 114, 111, 112, 101,
+114, 116, 105, 101, 115, 91, 97, 93, 59, 10, 114, 101, 116, 117, 114, 110, 32,
+98, 46, 110, 97, 109, 101, 59, 10, 125, 59, 10, 80, 114, 111, 116, 111, 99, 111,
+108, 86, 97, 108, 117, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+112, 114, 111, 112, 101, 114, 116, 121, 73, 110, 100, 101, 120, 61, 102, 117,
+110, 99, 116, 105, 111, 110, 40, 97, 41, 123, 10, 102, 111, 114, 40, 118, 97,
+114, 32, 98, 61, 48, 59, 98, 60, 116, 104, 105, 115, 46, 112, 114, 111, 112,
+101, 114, 116, 121, 67, 111, 117, 110, 116, 40, 41, 59, 98, 43, 43, 41, 123, 10,
+105, 102, 40, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 46, 112, 114,
+111, 112, 101, 114, 116, 105, 101, 115, 91, 98, 93, 46, 110, 97, 109, 101, 61,
+61, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 125,
+10, 114, 101, 116, 117, 114, 110, 32, 110, 117, 108, 108, 59, 10, 125, 59, 10,
+80, 114, 111, 116, 111, 99, 111, 108, 86, 97, 108, 117, 101, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 112, 114, 111, 112, 101, 114, 116, 121, 86,
+97, 108, 117, 101, 61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 123,
+10, 118, 97, 114, 32, 98, 61, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101,
+95, 46, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 91, 97, 93, 59, 10,
+114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 112, 97, 99, 107, 101,
+116, 95, 46, 108, 111, 111, 107, 117, 112, 40, 98, 46, 114, 101, 102, 41, 59,
+10, 125, 59, 10, 80, 114, 111, 116, 111, 99, 111, 108, 86, 97, 108, 117, 101,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 118, 97, 108, 117, 101, 61,
+102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 116, 104, 105, 115, 46, 118, 97, 108, 117, 101, 95, 46, 118, 97, 108,
+117, 101, 59, 10, 125, 59, 10, 80, 114, 111, 116, 111, 99, 111, 108, 86, 97,
+108, 117, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 118, 97,
+108, 117, 101, 83, 116, 114, 105, 110, 103, 61, 102, 117, 110, 99, 116, 105,
+111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115,
+46, 118, 97, 108, 117, 101, 95, 46, 116, 101, 120, 116, 59, 10, 125, 59, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 80, 114, 111, 116, 111, 99, 111, 108,
+82, 101, 102, 101, 114, 101, 110, 99, 101, 40, 97, 41, 123, 10, 116, 104, 105,
+115, 46, 104, 97, 110, 100, 108, 101, 95, 61, 97, 59, 10, 125, 10, 80, 114, 111,
+116, 111, 99, 111, 108, 82, 101, 102, 101, 114, 101, 110, 99, 101, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 104, 97, 110, 100, 108, 101, 61, 102,
+117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+32, 116, 104, 105, 115, 46, 104, 97, 110, 100, 108, 101, 95, 59, 10, 125, 59,
+10, 118, 97, 114, 32, 115, 116, 114, 105, 110, 103, 105, 102, 121, 68, 101, 112,
+116, 104, 76, 105, 109, 105, 116, 61, 52, 59, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 83, 116, 114, 105, 110, 103, 105, 102, 121, 40, 97, 44, 98, 41,
+123, 10, 105, 102, 40, 98, 61, 61, 61, 117, 110, 100, 101, 102, 105, 110, 101,
+100, 41, 10, 98, 61, 115, 116, 114, 105, 110, 103, 105, 102, 121, 68, 101, 112,
+116, 104, 76, 105, 109, 105, 116, 59, 10, 101, 108, 115, 101, 32, 105, 102, 40,
+98, 61, 61, 61, 48, 41, 10, 114, 101, 116, 117, 114, 110, 34, 42, 34, 59, 10,
+115, 119, 105, 116, 99, 104, 40, 116, 121, 112, 101, 111, 102, 32, 97, 41, 123,
+10, 99, 97, 115, 101, 34, 117, 110, 100, 101, 102, 105, 110, 101, 100, 34, 58,
+10, 114, 101, 116, 117, 114, 110, 34, 117, 110, 100, 101, 102, 105, 110, 101,
+100, 34, 59, 10, 99, 97, 115, 101, 34, 98, 111, 111, 108, 101, 97, 110, 34, 58,
+10, 99, 97, 115, 101, 34, 110, 117, 109, 98, 101, 114, 34, 58, 10, 99, 97, 115,
+101, 34, 102, 117, 110, 99, 116, 105, 111, 110, 34, 58, 10, 114, 101, 116, 117,
+114, 110, 32, 97, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 41, 59, 10, 99,
+97, 115, 101, 34, 115, 116, 114, 105, 110, 103, 34, 58, 10, 114, 101, 116, 117,
+114, 110, 34, 92, 34, 34, 43, 97, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40,
+41, 43, 34, 92, 34, 34, 59, 10, 99, 97, 115, 101, 34, 115, 121, 109, 98, 111,
+108, 34, 58, 10, 114, 101, 116, 117, 114, 110, 34, 83, 121, 109, 98, 111, 108,
+40, 34, 43, 40, 97, 46, 110, 97, 109, 101, 63, 83, 116, 114, 105, 110, 103, 105,
+102, 121, 40, 97, 46, 110, 97, 109, 101, 44, 98, 41, 58, 34, 34, 41, 43, 34, 41,
+34, 10, 99, 97, 115, 101, 34, 111, 98, 106, 101, 99, 116, 34, 58, 10, 105, 102,
+40, 40, 97, 61, 61, 61, 110, 117, 108, 108, 41, 41, 114, 101, 116, 117, 114,
+110, 34, 110, 117, 108, 108, 34, 59, 10, 105, 102, 40, 97, 46, 99, 111, 110,
+115, 116, 114, 117, 99, 116, 111, 114, 38, 38, 97, 46, 99, 111, 110, 115, 116,
+114, 117, 99, 116, 111, 114, 46, 110, 97, 109, 101, 61, 61, 61, 34, 65, 114,
+114, 97, 121, 34, 41, 123, 10, 118, 97, 114, 32, 99, 61, 91, 93, 59, 10, 102,
+111, 114, 40, 118, 97, 114, 32, 100, 61, 48, 59, 100, 60, 97, 46, 108, 101, 110,
+103, 116, 104, 59, 43, 43, 100, 41, 123, 10, 99, 46, 112, 117, 115, 104, 40, 10,
+123, 125, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121,
+46, 99, 97, 108, 108, 40, 97, 44, 100, 41, 63, 83, 116, 114, 105, 110, 103, 105,
+102, 121, 40, 97, 91, 100, 93, 44, 98, 45, 49, 41, 58, 34, 34, 41, 59, 10, 125,
+10, 114, 101, 116, 117, 114, 110, 34, 91, 34, 43, 99, 46, 106, 111, 105, 110,
+40, 34, 44, 32, 34, 41, 43, 34, 93, 34, 59, 10, 125, 10, 116, 114, 121, 123, 10,
+118, 97, 114, 32, 101, 61, 83, 116, 114, 105, 110, 103, 40, 97, 41, 59, 10, 105,
+102, 40, 101, 38, 38, 101, 33, 61, 61, 34, 91, 111, 98, 106, 101, 99, 116, 32,
+79, 98, 106, 101, 99, 116, 93, 34, 41, 114, 101, 116, 117, 114, 110, 32, 101,
+59, 10, 125, 99, 97, 116, 99, 104, 40, 101, 41, 123, 125, 10, 118, 97, 114, 32,
+102, 61, 91, 93, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 103, 32, 105, 110,
+32, 97, 41, 123, 10, 118, 97, 114, 32, 104, 61, 79, 98, 106, 101, 99, 116, 46,
+103, 101, 116, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 68, 101,
+115, 99, 114, 105, 112, 116, 111, 114, 40, 97, 44, 103, 41, 59, 10, 105, 102,
+40, 40, 104, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 99, 111,
+110, 116, 105, 110, 117, 101, 59, 10, 105, 102, 40, 34, 118, 97, 108, 117, 101,
+34, 105, 110, 32, 104, 41, 123, 10, 102, 46, 112, 117, 115, 104, 40, 103, 43,
+34, 58, 32, 34, 43, 83, 116, 114, 105, 110, 103, 105, 102, 121, 40, 104, 46,
+118, 97, 108, 117, 101, 44, 98, 45, 49, 41, 41, 59, 10, 125, 10, 105, 102, 40,
+34, 103, 101, 116, 34, 105, 110, 32, 104, 41, 123, 10, 118, 97, 114, 32, 105,
+61, 104, 46, 103, 101, 116, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 41,
+59, 10, 102, 46, 112, 117, 115, 104, 40, 34, 103, 101, 116, 32, 34, 43, 103, 43,
+105, 46, 115, 108, 105, 99, 101, 40, 105, 46, 105, 110, 100, 101, 120, 79, 102,
+40, 39, 40, 39, 41, 41, 41, 59, 10, 125, 10, 105, 102, 40, 34, 115, 101, 116,
+34, 105, 110, 32, 104, 41, 123, 10, 118, 97, 114, 32, 106, 61, 104, 46, 115,
+101, 116, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 41, 59, 10, 102, 46,
+112, 117, 115, 104, 40, 34, 115, 101, 116, 32, 34, 43, 103, 43, 106, 46, 115,
+108, 105, 99, 101, 40, 106, 46, 105, 110, 100, 101, 120, 79, 102, 40, 39, 40,
+39, 41, 41, 41, 59, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 34, 123,
+34, 43, 102, 46, 106, 111, 105, 110, 40, 34, 44, 32, 34, 41, 43, 34, 125, 34,
+59, 10, 100, 101, 102, 97, 117, 108, 116, 58, 10, 114, 101, 116, 117, 114, 110,
+34, 91, 99, 114, 97, 122, 121, 32, 110, 111, 110, 45, 115, 116, 97, 110, 100,
+97, 114, 100, 32, 115, 104, 105, 116, 93, 34, 59, 10, 125, 10, 125, 10, 10 };
+
+  static const char* raw_sources = reinterpret_cast<const char*>(sources);
+
+  template <>
+  int NativesCollection<D8>::GetBuiltinsCount() {
+    return 1;
+  }
+
+  template <>
+  int NativesCollection<D8>::GetDebuggerCount() {
+    return 0;
+  }
+
+  template <>
+  int NativesCollection<D8>::GetIndex(const char* name) {
+    if (strcmp(name, "d8") == 0) return 0;
+    return -1;
+  }
+
+  template <>
+  int NativesCollection<D8>::GetRawScriptsSize() {
+    return 31952;
+  }
+
+  template <>
+  Vector<const char> NativesCollection<D8>::GetRawScriptSource(int index) {
+    if (index == 0) return Vector<const char>(raw_sources + 0, 31952);
+    return Vector<const char>("", 0);
+  }
+
+  template <>
+  Vector<const char> NativesCollection<D8>::GetScriptName(int index) {
+    if (index == 0) return Vector<const char>("native d8.js", 12);
+    return Vector<const char>("", 0);
+  }
+
+  template <>
+  Vector<const byte> NativesCollection<D8>::GetScriptsSource() {
+    return Vector<const byte>(sources, 31952);
+  }
+
+  template <>
+  void NativesCollection<D8>::SetRawScriptsSource(Vector<const char> raw_source) {
+    ASSERT(31952 == raw_source.length());
+    raw_sources = raw_source.start();
+  }
+
+}  // internal
+}  // v8
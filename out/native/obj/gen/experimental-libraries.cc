@@ -1356,19 +1356,19 @@ namespace internal {
 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 105, 102, 40, 104, 43, 103, 62,
 101, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59,
 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103,
-73, 110, 100, 101, 120, 79, 102, 40, 98, 44, 99, 44, 103, 41, 61, 61, 61, 103,
-59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105,
-110, 103, 69, 110, 100, 115, 87, 105, 116, 104, 40, 97, 41, 123, 10, 105, 102,
-40, 40, 116, 104, 105, 115, 61, 61, 110, 117, 108, 108, 41, 38, 38, 33, 40, 37,
-95, 73, 115, 85, 110, 100, 101, 116, 101, 99, 116, 97, 98, 108, 101, 79, 98,
-106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 116, 104, 114, 111, 119,
-32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97,
-108, 108, 101, 100, 95, 111, 110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117,
-110, 100, 101, 102, 105, 110, 101, 100, 39, 44, 91, 34, 83, 116, 114, 105, 110,
-103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 101, 110, 100, 115,
-87, 105, 116, 104, 34, 93, 41, 59, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116,
-121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115,
-41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105,
+77, 97, 116, 99, 104, 101, 115, 65, 116, 40, 98, 44, 99, 44, 103, 41, 59, 10,
+125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103,
+69, 110, 100, 115, 87, 105, 116, 104, 40, 97, 41, 123, 10, 105, 102, 40, 40,
+116, 104, 105, 115, 61, 61, 110, 117, 108, 108, 41, 38, 38, 33, 40, 37, 95, 73,
+115, 85, 110, 100, 101, 116, 101, 99, 116, 97, 98, 108, 101, 79, 98, 106, 101,
+99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 116, 104, 114, 111, 119, 32, 77,
+97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108,
+108, 101, 100, 95, 111, 110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117, 110,
+100, 101, 102, 105, 110, 101, 100, 39, 44, 91, 34, 83, 116, 114, 105, 110, 103,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 101, 110, 100, 115, 87,
+105, 116, 104, 34, 93, 41, 59, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121,
+112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41,
+41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105,
 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105,
 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 105, 102, 40, 40, 37, 95, 73,
 115, 82, 101, 103, 69, 120, 112, 40, 97, 41, 41, 41, 123, 10, 116, 104, 114,
@@ -1392,372 +1392,371 @@ namespace internal {
 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 106, 61, 104, 45, 105,
 59, 10, 105, 102, 40, 106, 60, 48, 41, 123, 10, 114, 101, 116, 117, 114, 110,
 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
-37, 83, 116, 114, 105, 110, 103, 76, 97, 115, 116, 73, 110, 100, 101, 120, 79,
-102, 40, 98, 44, 99, 44, 106, 41, 61, 61, 61, 106, 59, 10, 125, 10, 102, 117,
-110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 67, 111, 110, 116,
-97, 105, 110, 115, 40, 97, 41, 123, 10, 105, 102, 40, 40, 116, 104, 105, 115,
-61, 61, 110, 117, 108, 108, 41, 38, 38, 33, 40, 37, 95, 73, 115, 85, 110, 100,
-101, 116, 101, 99, 116, 97, 98, 108, 101, 79, 98, 106, 101, 99, 116, 40, 116,
-104, 105, 115, 41, 41, 41, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84,
-121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95,
-111, 110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117, 110, 100, 101, 102,
-105, 110, 101, 100, 39, 44, 91, 34, 83, 116, 114, 105, 110, 103, 46, 112, 114,
-111, 116, 111, 116, 121, 112, 101, 46, 99, 111, 110, 116, 97, 105, 110, 115, 34,
-93, 41, 59, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102,
-40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39,
-115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110,
-83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104,
-105, 115, 41, 41, 59, 10, 105, 102, 40, 40, 37, 95, 73, 115, 82, 101, 103, 69,
-120, 112, 40, 97, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107,
-101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 102, 105, 114, 115, 116,
-95, 97, 114, 103, 117, 109, 101, 110, 116, 95, 110, 111, 116, 95, 114, 101, 103,
-101, 120, 112, 34, 44, 10, 91, 34, 83, 116, 114, 105, 110, 103, 46, 112, 114,
-111, 116, 111, 116, 121, 112, 101, 46, 99, 111, 110, 116, 97, 105, 110, 115, 34,
-93, 41, 59, 10, 125, 10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112, 101,
-111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115,
-116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105,
-110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 118, 97,
-114, 32, 100, 61, 48, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101,
-110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 100,
-61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 100,
-61, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 100, 41, 59, 10, 125, 10,
-118, 97, 114, 32, 101, 61, 98, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118,
-97, 114, 32, 103, 61, 77, 97, 116, 104, 77, 105, 110, 40, 77, 97, 116, 104, 77,
-97, 120, 40, 100, 44, 48, 41, 44, 101, 41, 59, 10, 118, 97, 114, 32, 104, 61,
-99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 105, 102, 40, 104, 43, 103, 62,
-101, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59,
-10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103,
-73, 110, 100, 101, 120, 79, 102, 40, 98, 44, 99, 44, 103, 41, 33, 61, 61, 45,
-49, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 120, 116,
+37, 83, 116, 114, 105, 110, 103, 77, 97, 116, 99, 104, 101, 115, 65, 116, 40,
+98, 44, 99, 44, 106, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 83, 116, 114, 105, 110, 103, 67, 111, 110, 116, 97, 105, 110, 115, 40, 97,
+41, 123, 10, 105, 102, 40, 40, 116, 104, 105, 115, 61, 61, 110, 117, 108, 108,
+41, 38, 38, 33, 40, 37, 95, 73, 115, 85, 110, 100, 101, 116, 101, 99, 116, 97,
+98, 108, 101, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41,
+116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114,
+111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 111, 110, 95, 110, 117, 108,
+108, 95, 111, 114, 95, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 44, 91,
+34, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 99, 111, 110, 116, 97, 105, 110, 115, 34, 93, 41, 59, 10, 118, 97, 114,
+32, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65,
+82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110,
+103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110,
+103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59,
+10, 105, 102, 40, 40, 37, 95, 73, 115, 82, 101, 103, 69, 120, 112, 40, 97, 41,
+41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112,
+101, 69, 114, 114, 111, 114, 40, 34, 102, 105, 114, 115, 116, 95, 97, 114, 103,
+117, 109, 101, 110, 116, 95, 110, 111, 116, 95, 114, 101, 103, 101, 120, 112,
+34, 44, 10, 91, 34, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 99, 111, 110, 116, 97, 105, 110, 115, 34, 93, 41, 59,
+10, 125, 10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40,
+37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105,
+110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84,
+111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 118, 97, 114, 32, 100,
+61, 48, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116,
+115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 100, 61, 37, 95,
+65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 100, 61, 84,
+111, 73, 110, 116, 101, 103, 101, 114, 40, 100, 41, 59, 10, 125, 10, 118, 97,
+114, 32, 101, 61, 98, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114,
+32, 103, 61, 77, 97, 116, 104, 77, 105, 110, 40, 77, 97, 116, 104, 77, 97, 120,
+40, 100, 44, 48, 41, 44, 101, 41, 59, 10, 118, 97, 114, 32, 104, 61, 99, 46,
+108, 101, 110, 103, 116, 104, 59, 10, 105, 102, 40, 104, 43, 103, 62, 101, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125,
+10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 73, 110,
+100, 101, 120, 79, 102, 40, 98, 44, 99, 44, 103, 41, 33, 61, 61, 45, 49, 59, 10,
+125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 120, 116, 101, 110, 100,
+83, 116, 114, 105, 110, 103, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 41,
+123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114,
+97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108,
+70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 83, 116, 114, 105, 110, 103,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114,
+97, 121, 40, 10, 34, 114, 101, 112, 101, 97, 116, 34, 44, 83, 116, 114, 105,
+110, 103, 82, 101, 112, 101, 97, 116, 44, 10, 34, 115, 116, 97, 114, 116, 115,
+87, 105, 116, 104, 34, 44, 83, 116, 114, 105, 110, 103, 83, 116, 97, 114, 116,
+115, 87, 105, 116, 104, 44, 10, 34, 101, 110, 100, 115, 87, 105, 116, 104, 34,
+44, 83, 116, 114, 105, 110, 103, 69, 110, 100, 115, 87, 105, 116, 104, 44, 10,
+34, 99, 111, 110, 116, 97, 105, 110, 115, 34, 44, 83, 116, 114, 105, 110, 103,
+67, 111, 110, 116, 97, 105, 110, 115, 10, 41, 41, 59, 10, 125, 10, 69, 120, 116,
 101, 110, 100, 83, 116, 114, 105, 110, 103, 80, 114, 111, 116, 111, 116, 121,
-112, 101, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111,
-116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 73, 110, 115,
-116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 83, 116,
-114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44,
-36, 65, 114, 114, 97, 121, 40, 10, 34, 114, 101, 112, 101, 97, 116, 34, 44, 83,
-116, 114, 105, 110, 103, 82, 101, 112, 101, 97, 116, 44, 10, 34, 115, 116, 97,
-114, 116, 115, 87, 105, 116, 104, 34, 44, 83, 116, 114, 105, 110, 103, 83, 116,
-97, 114, 116, 115, 87, 105, 116, 104, 44, 10, 34, 101, 110, 100, 115, 87, 105,
-116, 104, 34, 44, 83, 116, 114, 105, 110, 103, 69, 110, 100, 115, 87, 105, 116,
-104, 44, 10, 34, 99, 111, 110, 116, 97, 105, 110, 115, 34, 44, 83, 116, 114,
-105, 110, 103, 67, 111, 110, 116, 97, 105, 110, 115, 10, 41, 41, 59, 10, 125,
-10, 69, 120, 116, 101, 110, 100, 83, 116, 114, 105, 110, 103, 80, 114, 111, 116,
-111, 116, 121, 112, 101, 40, 41, 59, 10, 10, 10, 39, 117, 115, 101, 32, 115,
-116, 114, 105, 99, 116, 39, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
-65, 114, 114, 97, 121, 70, 105, 110, 100, 40, 97, 41, 123, 10, 105, 102, 40, 40,
+112, 101, 40, 41, 59, 10, 10, 10, 39, 117, 115, 101, 32, 115, 116, 114, 105, 99,
+116, 39, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97,
+121, 70, 105, 110, 100, 40, 97, 41, 123, 10, 105, 102, 40, 40, 116, 104, 105,
+115, 61, 61, 110, 117, 108, 108, 41, 38, 38, 33, 40, 37, 95, 73, 115, 85, 110,
+100, 101, 116, 101, 99, 116, 97, 98, 108, 101, 79, 98, 106, 101, 99, 116, 40,
+116, 104, 105, 115, 41, 41, 41, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101,
+84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100,
+95, 111, 110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117, 110, 100, 101, 102,
+105, 110, 101, 100, 39, 44, 91, 34, 65, 114, 114, 97, 121, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 102, 105, 110, 100, 34, 93, 41, 59, 10, 118,
+97, 114, 32, 98, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115,
+41, 59, 10, 118, 97, 114, 32, 99, 61, 84, 111, 73, 110, 116, 101, 103, 101, 114,
+40, 98, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 105, 102, 40, 33, 40, 37,
+95, 67, 108, 97, 115, 115, 79, 102, 40, 97, 41, 61, 61, 61, 39, 70, 117, 110,
+99, 116, 105, 111, 110, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77,
+97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108,
+108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98, 108, 101, 39,
+44, 91, 97, 93, 41, 59, 10, 125, 10, 118, 97, 114, 32, 100, 59, 10, 105, 102,
+40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116,
+104, 40, 41, 62, 49, 41, 123, 10, 100, 61, 37, 95, 65, 114, 103, 117, 109, 101,
+110, 116, 115, 40, 49, 41, 59, 10, 125, 10, 105, 102, 40, 40, 100, 61, 61, 110,
+117, 108, 108, 41, 41, 123, 10, 100, 61, 37, 71, 101, 116, 68, 101, 102, 97,
+117, 108, 116, 82, 101, 99, 101, 105, 118, 101, 114, 40, 97, 41, 124, 124, 100,
+59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83,
+112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 100, 41, 41, 38, 38, 37, 73, 115,
+83, 108, 111, 112, 112, 121, 77, 111, 100, 101, 70, 117, 110, 99, 116, 105, 111,
+110, 40, 97, 41, 41, 123, 10, 100, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40,
+100, 41, 59, 10, 125, 10, 102, 111, 114, 40, 118, 97, 114, 32, 101, 61, 48, 59,
+101, 60, 99, 59, 101, 43, 43, 41, 123, 10, 105, 102, 40, 101, 32, 105, 110, 32,
+98, 41, 123, 10, 118, 97, 114, 32, 103, 61, 98, 91, 101, 93, 59, 10, 105, 102,
+40, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 100, 44,
+103, 44, 101, 44, 98, 44, 97, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
+103, 59, 10, 125, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 59, 10,
+125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 70,
+105, 110, 100, 73, 110, 100, 101, 120, 40, 97, 41, 123, 10, 105, 102, 40, 40,
 116, 104, 105, 115, 61, 61, 110, 117, 108, 108, 41, 38, 38, 33, 40, 37, 95, 73,
 115, 85, 110, 100, 101, 116, 101, 99, 116, 97, 98, 108, 101, 79, 98, 106, 101,
 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 116, 104, 114, 111, 119, 32, 77,
 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108,
 108, 101, 100, 95, 111, 110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117, 110,
 100, 101, 102, 105, 110, 101, 100, 39, 44, 91, 34, 65, 114, 114, 97, 121, 46,
-112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 102, 105, 110, 100, 34, 93, 41,
-59, 10, 118, 97, 114, 32, 98, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40, 116,
-104, 105, 115, 41, 59, 10, 118, 97, 114, 32, 99, 61, 84, 111, 73, 110, 116, 101,
-103, 101, 114, 40, 98, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 105, 102,
-40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 97, 41, 61, 61, 61, 39,
-70, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 123, 10, 116, 104, 114, 111,
-119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39,
-99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98,
-108, 101, 39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 118, 97, 114, 32, 100, 59,
-10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101,
-110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 100, 61, 37, 95, 65, 114, 103,
-117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 125, 10, 105, 102, 40, 40,
-100, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10, 100, 61, 37, 71, 101, 116, 68,
-101, 102, 97, 117, 108, 116, 82, 101, 99, 101, 105, 118, 101, 114, 40, 97, 41,
-124, 124, 100, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 33, 40, 37,
-95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 100, 41, 41, 38,
-38, 37, 73, 115, 83, 108, 111, 112, 112, 121, 77, 111, 100, 101, 70, 117, 110,
-99, 116, 105, 111, 110, 40, 97, 41, 41, 123, 10, 100, 61, 84, 111, 79, 98, 106,
-101, 99, 116, 40, 100, 41, 59, 10, 125, 10, 102, 111, 114, 40, 118, 97, 114, 32,
-101, 61, 48, 59, 101, 60, 99, 59, 101, 43, 43, 41, 123, 10, 105, 102, 40, 101,
-32, 105, 110, 32, 98, 41, 123, 10, 118, 97, 114, 32, 103, 61, 98, 91, 101, 93,
-59, 10, 105, 102, 40, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111,
-110, 40, 100, 44, 103, 44, 101, 44, 98, 44, 97, 41, 41, 123, 10, 114, 101, 116,
-117, 114, 110, 32, 103, 59, 10, 125, 10, 125, 10, 125, 10, 114, 101, 116, 117,
-114, 110, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114,
-114, 97, 121, 70, 105, 110, 100, 73, 110, 100, 101, 120, 40, 97, 41, 123, 10,
-105, 102, 40, 40, 116, 104, 105, 115, 61, 61, 110, 117, 108, 108, 41, 38, 38,
-33, 40, 37, 95, 73, 115, 85, 110, 100, 101, 116, 101, 99, 116, 97, 98, 108, 101,
-79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 116, 104, 114,
-111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40,
-39, 99, 97, 108, 108, 101, 100, 95, 111, 110, 95, 110, 117, 108, 108, 95, 111,
-114, 95, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 44, 91, 34, 65, 114,
-114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 102, 105,
-110, 100, 73, 110, 100, 101, 120, 34, 93, 41, 59, 10, 118, 97, 114, 32, 98, 61,
-84, 111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 59, 10, 118, 97,
-114, 32, 99, 61, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 98, 46, 108,
-101, 110, 103, 116, 104, 41, 59, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97,
-115, 115, 79, 102, 40, 97, 41, 61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111,
-110, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84,
-121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95,
-110, 111, 110, 95, 99, 97, 108, 108, 97, 98, 108, 101, 39, 44, 91, 97, 93, 41,
-59, 10, 125, 10, 118, 97, 114, 32, 100, 59, 10, 105, 102, 40, 37, 95, 65, 114,
-103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49,
-41, 123, 10, 100, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40,
-49, 41, 59, 10, 125, 10, 105, 102, 40, 40, 100, 61, 61, 110, 117, 108, 108, 41,
-41, 123, 10, 100, 61, 37, 71, 101, 116, 68, 101, 102, 97, 117, 108, 116, 82,
-101, 99, 101, 105, 118, 101, 114, 40, 97, 41, 124, 124, 100, 59, 10, 125, 101,
-108, 115, 101, 32, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79,
-98, 106, 101, 99, 116, 40, 100, 41, 41, 38, 38, 37, 73, 115, 83, 108, 111, 112,
-112, 121, 77, 111, 100, 101, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41,
-41, 123, 10, 100, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40, 100, 41, 59, 10,
-125, 10, 102, 111, 114, 40, 118, 97, 114, 32, 101, 61, 48, 59, 101, 60, 99, 59,
-101, 43, 43, 41, 123, 10, 105, 102, 40, 101, 32, 105, 110, 32, 98, 41, 123, 10,
-118, 97, 114, 32, 103, 61, 98, 91, 101, 93, 59, 10, 105, 102, 40, 37, 95, 67,
-97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 100, 44, 103, 44, 101,
-44, 98, 44, 97, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 101, 59, 10,
-125, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 125,
-10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 70, 105,
-108, 108, 40, 97, 41, 123, 10, 105, 102, 40, 40, 116, 104, 105, 115, 61, 61,
-110, 117, 108, 108, 41, 38, 38, 33, 40, 37, 95, 73, 115, 85, 110, 100, 101, 116,
-101, 99, 116, 97, 98, 108, 101, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105,
-115, 41, 41, 41, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112,
-101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 111, 110,
-95, 110, 117, 108, 108, 95, 111, 114, 95, 117, 110, 100, 101, 102, 105, 110,
-101, 100, 39, 44, 91, 34, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111,
-116, 121, 112, 101, 46, 102, 105, 108, 108, 34, 93, 41, 59, 10, 118, 97, 114,
-32, 98, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 59,
-10, 118, 97, 114, 32, 99, 61, 40, 98, 46, 108, 101, 110, 103, 116, 104, 62, 62,
-62, 48, 41, 59, 10, 118, 97, 114, 32, 100, 61, 48, 59, 10, 118, 97, 114, 32,
-101, 61, 99, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110,
-116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 100, 61, 37,
-95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 100, 61, 40,
-100, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 63, 48, 58, 40, 37, 95,
-73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 100, 41, 41, 63, 100,
-58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114,
-40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 100, 41, 41, 41, 59, 10, 105, 102,
-40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116,
-104, 40, 41, 62, 50, 41, 123, 10, 101, 61, 37, 95, 65, 114, 103, 117, 109, 101,
-110, 116, 115, 40, 50, 41, 59, 10, 101, 61, 40, 101, 61, 61, 61, 40, 118, 111,
-105, 100, 32, 48, 41, 41, 63, 99, 58, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37,
-73, 83, 95, 86, 65, 82, 40, 101, 41, 41, 63, 101, 58, 37, 78, 117, 109, 98, 101,
-114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98,
-101, 114, 40, 101, 41, 41, 41, 59, 10, 125, 10, 125, 10, 105, 102, 40, 100, 60,
-48, 41, 123, 10, 100, 43, 61, 99, 59, 10, 105, 102, 40, 100, 60, 48, 41, 100,
-61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 100, 62, 99, 41,
-100, 61, 99, 59, 10, 125, 10, 105, 102, 40, 101, 60, 48, 41, 123, 10, 101, 43,
-61, 99, 59, 10, 105, 102, 40, 101, 60, 48, 41, 101, 61, 48, 59, 10, 125, 101,
-108, 115, 101, 123, 10, 105, 102, 40, 101, 62, 99, 41, 101, 61, 99, 59, 10, 125,
-10, 105, 102, 40, 40, 101, 45, 100, 41, 62, 48, 38, 38, 79, 98, 106, 101, 99,
-116, 73, 115, 70, 114, 111, 122, 101, 110, 40, 98, 41, 41, 123, 10, 116, 104,
-114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114,
-40, 34, 97, 114, 114, 97, 121, 95, 102, 117, 110, 99, 116, 105, 111, 110, 115,
-95, 111, 110, 95, 102, 114, 111, 122, 101, 110, 34, 44, 10, 91, 34, 65, 114,
-114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 102, 105,
-108, 108, 34, 93, 41, 59, 10, 125, 10, 102, 111, 114, 40, 59, 100, 60, 101, 59,
-100, 43, 43, 41, 10, 98, 91, 100, 93, 61, 97, 59, 10, 114, 101, 116, 117, 114,
-110, 32, 98, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 72, 97,
-114, 109, 111, 110, 121, 65, 114, 114, 97, 121, 69, 120, 116, 101, 110, 100, 65,
-114, 114, 97, 121, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 41, 123, 10,
-37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112,
-112, 105, 110, 103, 40, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117,
-110, 99, 116, 105, 111, 110, 115, 40, 36, 65, 114, 114, 97, 121, 46, 112, 114,
-111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40,
-10, 34, 102, 105, 110, 100, 34, 44, 65, 114, 114, 97, 121, 70, 105, 110, 100,
-44, 10, 34, 102, 105, 110, 100, 73, 110, 100, 101, 120, 34, 44, 65, 114, 114,
-97, 121, 70, 105, 110, 100, 73, 110, 100, 101, 120, 44, 10, 34, 102, 105, 108,
-108, 34, 44, 65, 114, 114, 97, 121, 70, 105, 108, 108, 10, 41, 41, 59, 10, 125,
-10, 72, 97, 114, 109, 111, 110, 121, 65, 114, 114, 97, 121, 69, 120, 116, 101,
-110, 100, 65, 114, 114, 97, 121, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40,
-41, 59, 10, 10, 10, 39, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 39, 59,
-10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 116, 104, 83, 105, 103,
-110, 40, 97, 41, 123, 10, 97, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37,
-73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101,
-114, 39, 41, 63, 97, 58, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78,
-117, 109, 98, 101, 114, 40, 97, 41, 41, 59, 10, 105, 102, 40, 97, 62, 48, 41,
-114, 101, 116, 117, 114, 110, 32, 49, 59, 10, 105, 102, 40, 97, 60, 48, 41, 114,
-101, 116, 117, 114, 110, 45, 49, 59, 10, 105, 102, 40, 97, 61, 61, 61, 48, 41,
-114, 101, 116, 117, 114, 110, 32, 97, 59, 10, 114, 101, 116, 117, 114, 110, 32,
-36, 78, 97, 78, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77,
-97, 116, 104, 84, 114, 117, 110, 99, 40, 97, 41, 123, 10, 97, 61, 40, 40, 116,
-121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61,
-61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 63, 97, 58, 78, 111, 110, 78, 117,
-109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 59, 10,
-105, 102, 40, 97, 62, 48, 41, 114, 101, 116, 117, 114, 110, 32, 77, 97, 116,
-104, 70, 108, 111, 111, 114, 40, 97, 41, 59, 10, 105, 102, 40, 97, 60, 48, 41,
-114, 101, 116, 117, 114, 110, 32, 77, 97, 116, 104, 67, 101, 105, 108, 40, 97,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 102, 105, 110, 100, 73, 110,
+100, 101, 120, 34, 93, 41, 59, 10, 118, 97, 114, 32, 98, 61, 84, 111, 79, 98,
+106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 59, 10, 118, 97, 114, 32, 99, 61,
+84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 98, 46, 108, 101, 110, 103, 116,
+104, 41, 59, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102,
+40, 97, 41, 61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41,
+123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69,
+114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95,
+99, 97, 108, 108, 97, 98, 108, 101, 39, 44, 91, 97, 93, 41, 59, 10, 125, 10,
+118, 97, 114, 32, 100, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109,
+101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10,
+100, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10,
+125, 10, 105, 102, 40, 40, 100, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10,
+100, 61, 37, 71, 101, 116, 68, 101, 102, 97, 117, 108, 116, 82, 101, 99, 101,
+105, 118, 101, 114, 40, 97, 41, 124, 124, 100, 59, 10, 125, 101, 108, 115, 101,
+32, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101,
+99, 116, 40, 100, 41, 41, 38, 38, 37, 73, 115, 83, 108, 111, 112, 112, 121, 77,
+111, 100, 101, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 41, 123, 10,
+100, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40, 100, 41, 59, 10, 125, 10, 102,
+111, 114, 40, 118, 97, 114, 32, 101, 61, 48, 59, 101, 60, 99, 59, 101, 43, 43,
+41, 123, 10, 105, 102, 40, 101, 32, 105, 110, 32, 98, 41, 123, 10, 118, 97, 114,
+32, 103, 61, 98, 91, 101, 93, 59, 10, 105, 102, 40, 37, 95, 67, 97, 108, 108,
+70, 117, 110, 99, 116, 105, 111, 110, 40, 100, 44, 103, 44, 101, 44, 98, 44, 97,
+41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 101, 59, 10, 125, 10, 125,
+10, 125, 10, 114, 101, 116, 117, 114, 110, 45, 49, 59, 10, 125, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 70, 105, 108, 108, 40,
+97, 41, 123, 10, 105, 102, 40, 40, 116, 104, 105, 115, 61, 61, 110, 117, 108,
+108, 41, 38, 38, 33, 40, 37, 95, 73, 115, 85, 110, 100, 101, 116, 101, 99, 116,
+97, 98, 108, 101, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41,
+116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114,
+111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 111, 110, 95, 110, 117, 108,
+108, 95, 111, 114, 95, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 44, 91,
+34, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
+102, 105, 108, 108, 34, 93, 41, 59, 10, 118, 97, 114, 32, 98, 61, 84, 111, 79,
+98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 59, 10, 118, 97, 114, 32, 99,
+61, 40, 98, 46, 108, 101, 110, 103, 116, 104, 62, 62, 62, 48, 41, 59, 10, 118,
+97, 114, 32, 100, 61, 48, 59, 10, 118, 97, 114, 32, 101, 61, 99, 59, 10, 105,
+102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103,
+116, 104, 40, 41, 62, 49, 41, 123, 10, 100, 61, 37, 95, 65, 114, 103, 117, 109,
+101, 110, 116, 115, 40, 49, 41, 59, 10, 100, 61, 40, 100, 61, 61, 61, 40, 118,
+111, 105, 100, 32, 48, 41, 41, 63, 48, 58, 40, 37, 95, 73, 115, 83, 109, 105,
+40, 37, 73, 83, 95, 86, 65, 82, 40, 100, 41, 41, 63, 100, 58, 37, 78, 117, 109,
+98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117,
+109, 98, 101, 114, 40, 100, 41, 41, 41, 59, 10, 105, 102, 40, 37, 95, 65, 114,
+103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 50,
+41, 123, 10, 101, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40,
+50, 41, 59, 10, 101, 61, 40, 101, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48,
+41, 41, 63, 99, 58, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86,
+65, 82, 40, 101, 41, 41, 63, 101, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111,
+73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40,
+101, 41, 41, 41, 59, 10, 125, 10, 125, 10, 105, 102, 40, 100, 60, 48, 41, 123,
+10, 100, 43, 61, 99, 59, 10, 105, 102, 40, 100, 60, 48, 41, 100, 61, 48, 59, 10,
+125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 100, 62, 99, 41, 100, 61, 99,
+59, 10, 125, 10, 105, 102, 40, 101, 60, 48, 41, 123, 10, 101, 43, 61, 99, 59,
+10, 105, 102, 40, 101, 60, 48, 41, 101, 61, 48, 59, 10, 125, 101, 108, 115, 101,
+123, 10, 105, 102, 40, 101, 62, 99, 41, 101, 61, 99, 59, 10, 125, 10, 105, 102,
+40, 40, 101, 45, 100, 41, 62, 48, 38, 38, 79, 98, 106, 101, 99, 116, 73, 115,
+70, 114, 111, 122, 101, 110, 40, 98, 41, 41, 123, 10, 116, 104, 114, 111, 119,
+32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 97,
+114, 114, 97, 121, 95, 102, 117, 110, 99, 116, 105, 111, 110, 115, 95, 111, 110,
+95, 102, 114, 111, 122, 101, 110, 34, 44, 10, 91, 34, 65, 114, 114, 97, 121, 46,
+112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 102, 105, 108, 108, 34, 93, 41,
+59, 10, 125, 10, 102, 111, 114, 40, 59, 100, 60, 101, 59, 100, 43, 43, 41, 10,
+98, 91, 100, 93, 61, 97, 59, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10,
+125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 72, 97, 114, 109, 111, 110,
+121, 65, 114, 114, 97, 121, 69, 120, 116, 101, 110, 100, 65, 114, 114, 97, 121,
+80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 41, 123, 10, 37, 67, 104, 101,
+99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103,
+40, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105,
+111, 110, 115, 40, 36, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116,
+121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 102, 105, 110,
+100, 34, 44, 65, 114, 114, 97, 121, 70, 105, 110, 100, 44, 10, 34, 102, 105,
+110, 100, 73, 110, 100, 101, 120, 34, 44, 65, 114, 114, 97, 121, 70, 105, 110,
+100, 73, 110, 100, 101, 120, 44, 10, 34, 102, 105, 108, 108, 34, 44, 65, 114,
+114, 97, 121, 70, 105, 108, 108, 10, 41, 41, 59, 10, 125, 10, 72, 97, 114, 109,
+111, 110, 121, 65, 114, 114, 97, 121, 69, 120, 116, 101, 110, 100, 65, 114, 114,
+97, 121, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 41, 59, 10, 10, 10, 39,
+117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 39, 59, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 77, 97, 116, 104, 83, 105, 103, 110, 40, 97, 41, 123,
+10, 97, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65,
+82, 40, 97, 41, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 63, 97,
+58, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101,
+114, 40, 97, 41, 41, 59, 10, 105, 102, 40, 97, 62, 48, 41, 114, 101, 116, 117,
+114, 110, 32, 49, 59, 10, 105, 102, 40, 97, 60, 48, 41, 114, 101, 116, 117, 114,
+110, 45, 49, 59, 10, 105, 102, 40, 97, 61, 61, 61, 48, 41, 114, 101, 116, 117,
+114, 110, 32, 97, 59, 10, 114, 101, 116, 117, 114, 110, 32, 36, 78, 97, 78, 59,
+10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 116, 104, 84,
+114, 117, 110, 99, 40, 97, 41, 123, 10, 97, 61, 40, 40, 116, 121, 112, 101, 111,
+102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 110, 117,
+109, 98, 101, 114, 39, 41, 63, 97, 58, 78, 111, 110, 78, 117, 109, 98, 101, 114,
+84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 59, 10, 105, 102, 40, 97,
+62, 48, 41, 114, 101, 116, 117, 114, 110, 32, 77, 97, 116, 104, 70, 108, 111,
+111, 114, 40, 97, 41, 59, 10, 105, 102, 40, 97, 60, 48, 41, 114, 101, 116, 117,
+114, 110, 32, 77, 97, 116, 104, 67, 101, 105, 108, 40, 97, 41, 59, 10, 105, 102,
+40, 97, 61, 61, 61, 48, 41, 114, 101, 116, 117, 114, 110, 32, 97, 59, 10, 114,
+101, 116, 117, 114, 110, 32, 36, 78, 97, 78, 59, 10, 125, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 77, 97, 116, 104, 83, 105, 110, 104, 40, 97, 41, 123,
+10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61,
+39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 97, 61, 78, 111, 110, 78, 117, 109,
+98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 59, 10, 105, 102,
+40, 97, 61, 61, 61, 48, 124, 124, 33, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37,
+73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 124, 124, 40, 40, 97, 61, 61, 97, 41,
+38, 38, 40, 97, 33, 61, 49, 47, 48, 41, 38, 38, 40, 97, 33, 61, 45, 49, 47, 48,
+41, 41, 41, 41, 114, 101, 116, 117, 114, 110, 32, 97, 59, 10, 114, 101, 116,
+117, 114, 110, 40, 77, 97, 116, 104, 69, 120, 112, 40, 97, 41, 45, 77, 97, 116,
+104, 69, 120, 112, 40, 45, 97, 41, 41, 47, 50, 59, 10, 125, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 77, 97, 116, 104, 67, 111, 115, 104, 40, 97, 41,
+123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61,
+61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 97, 61, 78, 111, 110, 78, 117,
+109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 59, 10, 105,
+102, 40, 33, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82,
+40, 97, 41, 41, 124, 124, 40, 40, 97, 61, 61, 97, 41, 38, 38, 40, 97, 33, 61,
+49, 47, 48, 41, 38, 38, 40, 97, 33, 61, 45, 49, 47, 48, 41, 41, 41, 41, 114,
+101, 116, 117, 114, 110, 32, 77, 97, 116, 104, 65, 98, 115, 40, 97, 41, 59, 10,
+114, 101, 116, 117, 114, 110, 40, 77, 97, 116, 104, 69, 120, 112, 40, 97, 41,
+43, 77, 97, 116, 104, 69, 120, 112, 40, 45, 97, 41, 41, 47, 50, 59, 10, 125, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 116, 104, 84, 97, 110, 104,
+40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97,
+41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 97, 61, 78, 111,
+110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97,
 41, 59, 10, 105, 102, 40, 97, 61, 61, 61, 48, 41, 114, 101, 116, 117, 114, 110,
-32, 97, 59, 10, 114, 101, 116, 117, 114, 110, 32, 36, 78, 97, 78, 59, 10, 125,
-10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 116, 104, 83, 105, 110,
+32, 97, 59, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73,
+83, 95, 86, 65, 82, 40, 97, 41, 41, 124, 124, 40, 40, 97, 61, 61, 97, 41, 38,
+38, 40, 97, 33, 61, 49, 47, 48, 41, 38, 38, 40, 97, 33, 61, 45, 49, 47, 48, 41,
+41, 41, 41, 114, 101, 116, 117, 114, 110, 32, 77, 97, 116, 104, 83, 105, 103,
+110, 40, 97, 41, 59, 10, 118, 97, 114, 32, 98, 61, 77, 97, 116, 104, 69, 120,
+112, 40, 97, 41, 59, 10, 118, 97, 114, 32, 99, 61, 77, 97, 116, 104, 69, 120,
+112, 40, 45, 97, 41, 59, 10, 114, 101, 116, 117, 114, 110, 40, 98, 45, 99, 41,
+47, 40, 98, 43, 99, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 77, 97, 116, 104, 65, 115, 105, 110, 104, 40, 97, 41, 123, 10, 105, 102, 40,
+33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 110, 117, 109,
+98, 101, 114, 39, 41, 41, 97, 61, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84,
+111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 59, 10, 105, 102, 40, 97, 61, 61,
+61, 48, 124, 124, 33, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86,
+65, 82, 40, 97, 41, 41, 124, 124, 40, 40, 97, 61, 61, 97, 41, 38, 38, 40, 97,
+33, 61, 49, 47, 48, 41, 38, 38, 40, 97, 33, 61, 45, 49, 47, 48, 41, 41, 41, 41,
+114, 101, 116, 117, 114, 110, 32, 97, 59, 10, 105, 102, 40, 97, 62, 48, 41, 114,
+101, 116, 117, 114, 110, 32, 77, 97, 116, 104, 76, 111, 103, 40, 97, 43, 77, 97,
+116, 104, 83, 113, 114, 116, 40, 97, 42, 97, 43, 49, 41, 41, 59, 10, 114, 101,
+116, 117, 114, 110, 45, 77, 97, 116, 104, 76, 111, 103, 40, 45, 97, 43, 77, 97,
+116, 104, 83, 113, 114, 116, 40, 97, 42, 97, 43, 49, 41, 41, 59, 10, 125, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 116, 104, 65, 99, 111, 115,
 104, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102,
 40, 97, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 97, 61, 78,
 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40,
-97, 41, 59, 10, 105, 102, 40, 97, 61, 61, 61, 48, 124, 124, 33, 40, 37, 95, 73,
-115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 124, 124, 40,
-40, 97, 61, 61, 97, 41, 38, 38, 40, 97, 33, 61, 49, 47, 48, 41, 38, 38, 40, 97,
-33, 61, 45, 49, 47, 48, 41, 41, 41, 41, 114, 101, 116, 117, 114, 110, 32, 97,
-59, 10, 114, 101, 116, 117, 114, 110, 40, 77, 97, 116, 104, 69, 120, 112, 40,
-97, 41, 45, 77, 97, 116, 104, 69, 120, 112, 40, 45, 97, 41, 41, 47, 50, 59, 10,
-125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 116, 104, 67, 111,
-115, 104, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111,
-102, 40, 97, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 97,
-61, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101,
-114, 40, 97, 41, 59, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 109, 105,
-40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 124, 124, 40, 40, 97, 61, 61,
-97, 41, 38, 38, 40, 97, 33, 61, 49, 47, 48, 41, 38, 38, 40, 97, 33, 61, 45, 49,
-47, 48, 41, 41, 41, 41, 114, 101, 116, 117, 114, 110, 32, 77, 97, 116, 104, 65,
-98, 115, 40, 97, 41, 59, 10, 114, 101, 116, 117, 114, 110, 40, 77, 97, 116, 104,
-69, 120, 112, 40, 97, 41, 43, 77, 97, 116, 104, 69, 120, 112, 40, 45, 97, 41,
-41, 47, 50, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97,
-116, 104, 84, 97, 110, 104, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 116, 121,
-112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39,
-41, 41, 97, 61, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109,
-98, 101, 114, 40, 97, 41, 59, 10, 105, 102, 40, 97, 61, 61, 61, 48, 41, 114,
-101, 116, 117, 114, 110, 32, 97, 59, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115,
-83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 124, 124, 40, 40,
-97, 61, 61, 97, 41, 38, 38, 40, 97, 33, 61, 49, 47, 48, 41, 38, 38, 40, 97, 33,
-61, 45, 49, 47, 48, 41, 41, 41, 41, 114, 101, 116, 117, 114, 110, 32, 77, 97,
-116, 104, 83, 105, 103, 110, 40, 97, 41, 59, 10, 118, 97, 114, 32, 98, 61, 77,
-97, 116, 104, 69, 120, 112, 40, 97, 41, 59, 10, 118, 97, 114, 32, 99, 61, 77,
-97, 116, 104, 69, 120, 112, 40, 45, 97, 41, 59, 10, 114, 101, 116, 117, 114,
-110, 40, 98, 45, 99, 41, 47, 40, 98, 43, 99, 41, 59, 10, 125, 10, 102, 117, 110,
-99, 116, 105, 111, 110, 32, 77, 97, 116, 104, 65, 115, 105, 110, 104, 40, 97,
-41, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61,
-61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 97, 61, 78, 111, 110, 78,
-117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 59, 10,
-105, 102, 40, 97, 61, 61, 61, 48, 124, 124, 33, 40, 37, 95, 73, 115, 83, 109,
-105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 124, 124, 40, 40, 97, 61,
-61, 97, 41, 38, 38, 40, 97, 33, 61, 49, 47, 48, 41, 38, 38, 40, 97, 33, 61, 45,
-49, 47, 48, 41, 41, 41, 41, 114, 101, 116, 117, 114, 110, 32, 97, 59, 10, 105,
-102, 40, 97, 62, 48, 41, 114, 101, 116, 117, 114, 110, 32, 77, 97, 116, 104, 76,
-111, 103, 40, 97, 43, 77, 97, 116, 104, 83, 113, 114, 116, 40, 97, 42, 97, 43,
-49, 41, 41, 59, 10, 114, 101, 116, 117, 114, 110, 45, 77, 97, 116, 104, 76, 111,
-103, 40, 45, 97, 43, 77, 97, 116, 104, 83, 113, 114, 116, 40, 97, 42, 97, 43,
-49, 41, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97,
-116, 104, 65, 99, 111, 115, 104, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 116,
-121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101,
-114, 39, 41, 41, 97, 61, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78,
-117, 109, 98, 101, 114, 40, 97, 41, 59, 10, 105, 102, 40, 97, 60, 49, 41, 114,
-101, 116, 117, 114, 110, 32, 36, 78, 97, 78, 59, 10, 105, 102, 40, 33, 40, 37,
-95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 124,
-124, 40, 40, 97, 61, 61, 97, 41, 38, 38, 40, 97, 33, 61, 49, 47, 48, 41, 38, 38,
-40, 97, 33, 61, 45, 49, 47, 48, 41, 41, 41, 41, 114, 101, 116, 117, 114, 110,
-32, 97, 59, 10, 114, 101, 116, 117, 114, 110, 32, 77, 97, 116, 104, 76, 111,
-103, 40, 97, 43, 77, 97, 116, 104, 83, 113, 114, 116, 40, 97, 43, 49, 41, 42,
-77, 97, 116, 104, 83, 113, 114, 116, 40, 97, 45, 49, 41, 41, 59, 10, 125, 10,
-102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 116, 104, 65, 116, 97, 110,
-104, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102,
-40, 97, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 97, 61, 78,
-111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40,
-97, 41, 59, 10, 105, 102, 40, 97, 61, 61, 61, 48, 41, 114, 101, 116, 117, 114,
-110, 32, 97, 59, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 109, 105, 40,
+97, 41, 59, 10, 105, 102, 40, 97, 60, 49, 41, 114, 101, 116, 117, 114, 110, 32,
+36, 78, 97, 78, 59, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 109, 105, 40,
 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 124, 124, 40, 40, 97, 61, 61, 97,
 41, 38, 38, 40, 97, 33, 61, 49, 47, 48, 41, 38, 38, 40, 97, 33, 61, 45, 49, 47,
-48, 41, 41, 41, 41, 114, 101, 116, 117, 114, 110, 32, 36, 78, 97, 78, 59, 10,
-114, 101, 116, 117, 114, 110, 32, 48, 46, 53, 42, 77, 97, 116, 104, 76, 111,
-103, 40, 40, 49, 43, 97, 41, 47, 40, 49, 45, 97, 41, 41, 59, 10, 125, 10, 102,
-117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 116, 104, 76, 111, 103, 49, 48,
-40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 77, 97, 116, 104, 76,
-111, 103, 40, 97, 41, 42, 48, 46, 52, 51, 52, 50, 57, 52, 52, 56, 49, 57, 48,
-51, 50, 53, 49, 56, 50, 56, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111,
-110, 32, 77, 97, 116, 104, 76, 111, 103, 50, 40, 97, 41, 123, 10, 114, 101, 116,
-117, 114, 110, 32, 77, 97, 116, 104, 76, 111, 103, 40, 97, 41, 42, 49, 46, 52,
-52, 50, 54, 57, 53, 48, 52, 48, 56, 56, 56, 57, 54, 51, 52, 48, 55, 59, 10, 125,
-10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 116, 104, 72, 121, 112,
-111, 116, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 37, 95, 65,
-114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 59,
-10, 118, 97, 114, 32, 100, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110,
-97, 108, 65, 114, 114, 97, 121, 40, 99, 41, 59, 10, 118, 97, 114, 32, 101, 61,
-48, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 103, 61, 48, 59, 103, 60, 99,
-59, 103, 43, 43, 41, 123, 10, 118, 97, 114, 32, 104, 61, 37, 95, 65, 114, 103,
-117, 109, 101, 110, 116, 115, 40, 103, 41, 59, 10, 105, 102, 40, 33, 40, 116,
-121, 112, 101, 111, 102, 40, 104, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101,
-114, 39, 41, 41, 104, 61, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78,
-117, 109, 98, 101, 114, 40, 104, 41, 59, 10, 105, 102, 40, 104, 61, 61, 61, 40,
-49, 47, 48, 41, 124, 124, 104, 61, 61, 61, 45, 40, 49, 47, 48, 41, 41, 114, 101,
-116, 117, 114, 110, 40, 49, 47, 48, 41, 59, 10, 104, 61, 77, 97, 116, 104, 65,
-98, 115, 40, 104, 41, 59, 10, 105, 102, 40, 104, 62, 101, 41, 101, 61, 104, 59,
-10, 100, 91, 103, 93, 61, 104, 59, 10, 125, 10, 105, 102, 40, 101, 61, 61, 61,
-48, 41, 101, 61, 49, 59, 10, 118, 97, 114, 32, 105, 61, 48, 59, 10, 118, 97,
-114, 32, 106, 61, 48, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 103, 61, 48,
-59, 103, 60, 99, 59, 103, 43, 43, 41, 123, 10, 118, 97, 114, 32, 104, 61, 100,
-91, 103, 93, 47, 101, 59, 10, 118, 97, 114, 32, 107, 61, 104, 42, 104, 45, 106,
-59, 10, 118, 97, 114, 32, 108, 61, 105, 43, 107, 59, 10, 106, 61, 40, 108, 45,
-105, 41, 45, 107, 59, 10, 105, 61, 108, 59, 10, 125, 10, 114, 101, 116, 117,
-114, 110, 32, 77, 97, 116, 104, 83, 113, 114, 116, 40, 105, 41, 42, 101, 59, 10,
-125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 116, 104, 70, 114,
-111, 117, 110, 100, 74, 83, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110,
-32, 37, 77, 97, 116, 104, 70, 114, 111, 117, 110, 100, 40, 40, 40, 116, 121,
-112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61,
-39, 110, 117, 109, 98, 101, 114, 39, 41, 63, 97, 58, 78, 111, 110, 78, 117, 109,
-98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 41, 59, 10,
-125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 116, 104, 67, 108,
-122, 51, 50, 40, 97, 41, 123, 10, 97, 61, 84, 111, 85, 105, 110, 116, 51, 50,
-40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40,
-97, 41, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 63, 97, 58, 78,
-111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40,
-97, 41, 41, 41, 59, 10, 105, 102, 40, 97, 61, 61, 48, 41, 114, 101, 116, 117,
-114, 110, 32, 51, 50, 59, 10, 118, 97, 114, 32, 98, 61, 48, 59, 10, 105, 102,
-40, 40, 97, 38, 48, 120, 70, 70, 70, 70, 48, 48, 48, 48, 41, 61, 61, 61, 48, 41,
-123, 97, 60, 60, 61, 49, 54, 59, 98, 43, 61, 49, 54, 59, 125, 59, 10, 105, 102,
-40, 40, 97, 38, 48, 120, 70, 70, 48, 48, 48, 48, 48, 48, 41, 61, 61, 61, 48, 41,
-123, 97, 60, 60, 61, 56, 59, 98, 43, 61, 56, 59, 125, 59, 10, 105, 102, 40, 40,
-97, 38, 48, 120, 70, 48, 48, 48, 48, 48, 48, 48, 41, 61, 61, 61, 48, 41, 123,
-97, 60, 60, 61, 52, 59, 98, 43, 61, 52, 59, 125, 59, 10, 105, 102, 40, 40, 97,
-38, 48, 120, 67, 48, 48, 48, 48, 48, 48, 48, 41, 61, 61, 61, 48, 41, 123, 97,
-60, 60, 61, 50, 59, 98, 43, 61, 50, 59, 125, 59, 10, 105, 102, 40, 40, 97, 38,
-48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 41, 61, 61, 61, 48, 41, 123, 97, 60,
-60, 61, 49, 59, 98, 43, 61, 49, 59, 125, 59, 10, 114, 101, 116, 117, 114, 110,
-32, 98, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 116,
-104, 67, 98, 114, 116, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112,
-101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41,
-41, 97, 61, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98,
-101, 114, 40, 97, 41, 59, 10, 105, 102, 40, 97, 61, 61, 48, 124, 124, 33, 40,
+48, 41, 41, 41, 41, 114, 101, 116, 117, 114, 110, 32, 97, 59, 10, 114, 101, 116,
+117, 114, 110, 32, 77, 97, 116, 104, 76, 111, 103, 40, 97, 43, 77, 97, 116, 104,
+83, 113, 114, 116, 40, 97, 43, 49, 41, 42, 77, 97, 116, 104, 83, 113, 114, 116,
+40, 97, 45, 49, 41, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 77, 97, 116, 104, 65, 116, 97, 110, 104, 40, 97, 41, 123, 10, 105, 102, 40,
+33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 110, 117, 109,
+98, 101, 114, 39, 41, 41, 97, 61, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84,
+111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 59, 10, 105, 102, 40, 97, 61, 61,
+61, 48, 41, 114, 101, 116, 117, 114, 110, 32, 97, 59, 10, 105, 102, 40, 33, 40,
 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41,
 124, 124, 40, 40, 97, 61, 61, 97, 41, 38, 38, 40, 97, 33, 61, 49, 47, 48, 41,
 38, 38, 40, 97, 33, 61, 45, 49, 47, 48, 41, 41, 41, 41, 114, 101, 116, 117, 114,
-110, 32, 97, 59, 10, 114, 101, 116, 117, 114, 110, 32, 97, 62, 61, 48, 63, 67,
-117, 98, 101, 82, 111, 111, 116, 40, 97, 41, 58, 45, 67, 117, 98, 101, 82, 111,
-111, 116, 40, 45, 97, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111,
-110, 32, 67, 117, 98, 101, 82, 111, 111, 116, 40, 97, 41, 123, 10, 118, 97, 114,
-32, 98, 61, 77, 97, 116, 104, 70, 108, 111, 111, 114, 40, 37, 95, 68, 111, 117,
-98, 108, 101, 72, 105, 40, 97, 41, 47, 51, 41, 43, 48, 120, 50, 65, 57, 70, 55,
-56, 57, 51, 59, 10, 118, 97, 114, 32, 99, 61, 37, 95, 67, 111, 110, 115, 116,
-114, 117, 99, 116, 68, 111, 117, 98, 108, 101, 40, 98, 44, 48, 41, 59, 10, 99,
-61, 40, 49, 46, 48, 47, 51, 46, 48, 41, 42, 40, 97, 47, 40, 99, 42, 99, 41, 43,
-50, 42, 99, 41, 59, 10, 59, 10, 99, 61, 40, 49, 46, 48, 47, 51, 46, 48, 41, 42,
-40, 97, 47, 40, 99, 42, 99, 41, 43, 50, 42, 99, 41, 59, 10, 59, 10, 99, 61, 40,
-49, 46, 48, 47, 51, 46, 48, 41, 42, 40, 97, 47, 40, 99, 42, 99, 41, 43, 50, 42,
-99, 41, 59, 10, 59, 10, 114, 101, 116, 117, 114, 110, 40, 49, 46, 48, 47, 51,
-46, 48, 41, 42, 40, 97, 47, 40, 99, 42, 99, 41, 43, 50, 42, 99, 41, 59, 10, 59,
-10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 116, 104, 69,
-120, 112, 109, 49, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112,
-101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41,
-41, 97, 61, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98,
-101, 114, 40, 97, 41, 59, 10, 118, 97, 114, 32, 98, 61, 77, 97, 116, 104, 65,
-98, 115, 40, 97, 41, 59, 10, 105, 102, 40, 98, 60, 50, 69, 45, 55, 41, 123, 10,
+110, 32, 36, 78, 97, 78, 59, 10, 114, 101, 116, 117, 114, 110, 32, 48, 46, 53,
+42, 77, 97, 116, 104, 76, 111, 103, 40, 40, 49, 43, 97, 41, 47, 40, 49, 45, 97,
+41, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 116,
+104, 76, 111, 103, 49, 48, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+32, 77, 97, 116, 104, 76, 111, 103, 40, 97, 41, 42, 48, 46, 52, 51, 52, 50, 57,
+52, 52, 56, 49, 57, 48, 51, 50, 53, 49, 56, 50, 56, 59, 10, 125, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 77, 97, 116, 104, 76, 111, 103, 50, 40, 97, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 77, 97, 116, 104, 76, 111, 103, 40,
+97, 41, 42, 49, 46, 52, 52, 50, 54, 57, 53, 48, 52, 48, 56, 56, 56, 57, 54, 51,
+52, 48, 55, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97,
+116, 104, 72, 121, 112, 111, 116, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32,
+99, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103,
+116, 104, 40, 41, 59, 10, 118, 97, 114, 32, 100, 61, 110, 101, 119, 32, 73, 110,
+116, 101, 114, 110, 97, 108, 65, 114, 114, 97, 121, 40, 99, 41, 59, 10, 118, 97,
+114, 32, 101, 61, 48, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 103, 61, 48,
+59, 103, 60, 99, 59, 103, 43, 43, 41, 123, 10, 118, 97, 114, 32, 104, 61, 37,
+95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 103, 41, 59, 10, 105, 102,
+40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 104, 41, 61, 61, 61, 39, 110, 117,
+109, 98, 101, 114, 39, 41, 41, 104, 61, 78, 111, 110, 78, 117, 109, 98, 101,
+114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 104, 41, 59, 10, 105, 102, 40,
+104, 61, 61, 61, 40, 49, 47, 48, 41, 124, 124, 104, 61, 61, 61, 45, 40, 49, 47,
+48, 41, 41, 114, 101, 116, 117, 114, 110, 40, 49, 47, 48, 41, 59, 10, 104, 61,
+77, 97, 116, 104, 65, 98, 115, 40, 104, 41, 59, 10, 105, 102, 40, 104, 62, 101,
+41, 101, 61, 104, 59, 10, 100, 91, 103, 93, 61, 104, 59, 10, 125, 10, 105, 102,
+40, 101, 61, 61, 61, 48, 41, 101, 61, 49, 59, 10, 118, 97, 114, 32, 105, 61, 48,
+59, 10, 118, 97, 114, 32, 106, 61, 48, 59, 10, 102, 111, 114, 40, 118, 97, 114,
+32, 103, 61, 48, 59, 103, 60, 99, 59, 103, 43, 43, 41, 123, 10, 118, 97, 114,
+32, 104, 61, 100, 91, 103, 93, 47, 101, 59, 10, 118, 97, 114, 32, 107, 61, 104,
+42, 104, 45, 106, 59, 10, 118, 97, 114, 32, 108, 61, 105, 43, 107, 59, 10, 106,
+61, 40, 108, 45, 105, 41, 45, 107, 59, 10, 105, 61, 108, 59, 10, 125, 10, 114,
+101, 116, 117, 114, 110, 32, 77, 97, 116, 104, 83, 113, 114, 116, 40, 105, 41,
+42, 101, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 97,
+116, 104, 70, 114, 111, 117, 110, 100, 74, 83, 40, 97, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 37, 77, 97, 116, 104, 70, 114, 111, 117, 110, 100, 40,
+40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97,
+41, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 63, 97, 58, 78,
+111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40,
+97, 41, 41, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77,
+97, 116, 104, 67, 108, 122, 51, 50, 40, 97, 41, 123, 10, 97, 61, 84, 111, 85,
+105, 110, 116, 51, 50, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83,
+95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39,
+41, 63, 97, 58, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109,
+98, 101, 114, 40, 97, 41, 41, 41, 59, 10, 105, 102, 40, 97, 61, 61, 48, 41, 114,
+101, 116, 117, 114, 110, 32, 51, 50, 59, 10, 118, 97, 114, 32, 98, 61, 48, 59,
+10, 105, 102, 40, 40, 97, 38, 48, 120, 70, 70, 70, 70, 48, 48, 48, 48, 41, 61,
+61, 61, 48, 41, 123, 97, 60, 60, 61, 49, 54, 59, 98, 43, 61, 49, 54, 59, 125,
+59, 10, 105, 102, 40, 40, 97, 38, 48, 120, 70, 70, 48, 48, 48, 48, 48, 48, 41,
+61, 61, 61, 48, 41, 123, 97, 60, 60, 61, 56, 59, 98, 43, 61, 56, 59, 125, 59,
+10, 105, 102, 40, 40, 97, 38, 48, 120, 70, 48, 48, 48, 48, 48, 48, 48, 41, 61,
+61, 61, 48, 41, 123, 97, 60, 60, 61, 52, 59, 98, 43, 61, 52, 59, 125, 59, 10,
+105, 102, 40, 40, 97, 38, 48, 120, 67, 48, 48, 48, 48, 48, 48, 48, 41, 61, 61,
+61, 48, 41, 123, 97, 60, 60, 61, 50, 59, 98, 43, 61, 50, 59, 125, 59, 10, 105,
+102, 40, 40, 97, 38, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 41, 61, 61, 61,
+48, 41, 123, 97, 60, 60, 61, 49, 59, 98, 43, 61, 49, 59, 125, 59, 10, 114, 101,
+116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 77, 97, 116, 104, 67, 98, 114, 116, 40, 97, 41, 123, 10, 105, 102, 40,
+33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 110, 117, 109,
+98, 101, 114, 39, 41, 41, 97, 61, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84,
+111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 59, 10, 105, 102, 40, 97, 61, 61,
+48, 124, 124, 33, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65,
+82, 40, 97, 41, 41, 124, 124, 40, 40, 97, 61, 61, 97, 41, 38, 38, 40, 97, 33,
+61, 49, 47, 48, 41, 38, 38, 40, 97, 33, 61, 45, 49, 47, 48, 41, 41, 41, 41, 114,
+101, 116, 117, 114, 110, 32, 97, 59, 10, 114, 101, 116, 117, 114, 110, 32, 97,
+62, 61, 48, 63, 67, 117, 98, 101, 82, 111, 111, 116, 40, 97, 41, 58, 45, 67,
+117, 98, 101, 82, 111, 111, 116, 40, 45, 97, 41, 59, 10, 125, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 67, 117, 98, 101, 82, 111, 111, 116, 40, 97, 41,
+123, 10, 118, 97, 114, 32, 98, 61, 77, 97, 116, 104, 70, 108, 111, 111, 114, 40,
+37, 95, 68, 111, 117, 98, 108, 101, 72, 105, 40, 97, 41, 47, 51, 41, 43, 48,
+120, 50, 65, 57, 70, 55, 56, 57, 51, 59, 10, 118, 97, 114, 32, 99, 61, 37, 95,
+67, 111, 110, 115, 116, 114, 117, 99, 116, 68, 111, 117, 98, 108, 101, 40, 98,
+44, 48, 41, 59, 10, 99, 61, 40, 49, 46, 48, 47, 51, 46, 48, 41, 42, 40, 97, 47,
+40, 99, 42, 99, 41, 43, 50, 42, 99, 41, 59, 10, 59, 10, 99, 61, 40, 49, 46, 48,
+47, 51, 46, 48, 41, 42, 40, 97, 47, 40, 99, 42, 99, 41, 43, 50, 42, 99, 41, 59,
+10, 59, 10, 99, 61, 40, 49, 46, 48, 47, 51, 46, 48, 41, 42, 40, 97, 47, 40, 99,
+42, 99, 41, 43, 50, 42, 99, 41, 59, 10, 59, 10, 114, 101, 116, 117, 114, 110,
+40, 49, 46, 48, 47, 51, 46, 48, 41, 42, 40, 97, 47, 40, 99, 42, 99, 41, 43, 50,
+42, 99, 41, 59, 10, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+77, 97, 116, 104, 69, 120, 112, 109, 49, 40, 97, 41, 123, 10, 105, 102, 40, 33,
+40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61, 61, 39, 110, 117, 109, 98,
+101, 114, 39, 41, 41, 97, 61, 78, 111, 110, 78, 117, 109, 98, 101, 114, 84, 111,
+78, 117, 109, 98, 101, 114, 40, 97, 41, 59, 10, 118, 97, 114, 32, 98, 61, 77,
+97, 116, 104, 65, 98, 115, 40, 97, 41, 59, 10, 105, 102, 40, 98, 60, 50, 69, 45,
+55, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 97, 42, 40, 49, 43, 97, 42,
+40, 49, 47, 50, 41, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 98,
+60, 54, 69, 45, 53, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 97, 42, 40,
+49, 43, 97, 42, 40, 49, 47, 50, 43, 97, 42, 40, 49, 47, 54, 41, 41, 41, 59, 10,
+125, 101, 108, 115, 101, 32, 105, 102, 40, 98, 60, 50, 69, 45, 50, 41, 123, 10,
 114, 101, 116, 117, 114, 110, 32, 97, 42, 40, 49, 43, 97, 42, 40, 49, 47, 50,
-41, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 98, 60, 54, 69, 45,
-53, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 97, 42, 40, 49, 43, 97, 42,
-40, 49, 47, 50, 43, 97, 42, 40, 49, 47, 54, 41, 41, 41, 59, 10, 125, 101, 108,
-115, 101, 32, 105, 102, 40, 98, 60, 50, 69, 45, 50, 41, 123, 10, 114, 101, 116,
-117, 114, 110, 32, 97, 42, 40, 49, 43, 97, 42, 40, 49, 47, 50, 43, 97, 42, 40,
-49, 47, 54, 43, 10, 97, 42, 40, 49, 47, 50, 52, 43, 97, 42, 40, 49, 47, 49, 50,
-48, 43, 97, 42, 40, 49, 47, 55, 50, 48, 41, 41, 41, 41, 41, 41, 59, 10, 125,
-101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 77, 97, 116, 104,
-69, 120, 112, 40, 97, 41, 45, 49, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99,
-116, 105, 111, 110, 32, 77, 97, 116, 104, 76, 111, 103, 49, 112, 40, 97, 41,
-123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97, 41, 61, 61,
-61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 97, 61, 78, 111, 110, 78, 117,
-109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 59, 10, 118,
-97, 114, 32, 98, 61, 77, 97, 116, 104, 65, 98, 115, 40, 97, 41, 59, 10, 105,
-102, 40, 98, 60, 49, 69, 45, 55, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
-97, 42, 40, 49, 45, 97, 42, 40, 49, 47, 50, 41, 41, 59, 10, 125, 101, 108, 115,
-101, 32, 105, 102, 40, 98, 60, 51, 69, 45, 53, 41, 123, 10, 114, 101, 116, 117,
-114, 110, 32, 97, 42, 40, 49, 45, 97, 42, 40, 49, 47, 50, 45, 97, 42, 40, 49,
-47, 51, 41, 41, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 98, 60,
-55, 69, 45, 51, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 97, 42, 40, 49,
-45, 97, 42, 40, 49, 47, 50, 45, 97, 42, 40, 49, 47, 51, 45, 97, 42, 40, 49, 47,
-52, 45, 10, 97, 42, 40, 49, 47, 53, 45, 97, 42, 40, 49, 47, 54, 45, 97, 42, 40,
-49, 47, 55, 41, 41, 41, 41, 41, 41, 41, 59, 10, 125, 101, 108, 115, 101, 123,
-10, 114, 101, 116, 117, 114, 110, 32, 77, 97, 116, 104, 76, 111, 103, 40, 49,
-43, 97, 41, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
-69, 120, 116, 101, 110, 100, 77, 97, 116, 104, 40, 41, 123, 10, 37, 67, 104,
-101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110,
-103, 40, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116,
-105, 111, 110, 115, 40, 36, 77, 97, 116, 104, 44, 50, 44, 36, 65, 114, 114, 97,
-121, 40, 10, 34, 115, 105, 103, 110, 34, 44, 77, 97, 116, 104, 83, 105, 103,
+43, 97, 42, 40, 49, 47, 54, 43, 10, 97, 42, 40, 49, 47, 50, 52, 43, 97, 42, 40,
+49, 47, 49, 50, 48, 43, 97, 42, 40, 49, 47, 55, 50, 48, 41, 41, 41, 41, 41, 41,
+59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 77,
+97, 116, 104, 69, 120, 112, 40, 97, 41, 45, 49, 59, 10, 125, 10, 125, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 77, 97, 116, 104, 76, 111, 103, 49, 112,
+40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 97,
+41, 61, 61, 61, 39, 110, 117, 109, 98, 101, 114, 39, 41, 41, 97, 61, 78, 111,
+110, 78, 117, 109, 98, 101, 114, 84, 111, 78, 117, 109, 98, 101, 114, 40, 97,
+41, 59, 10, 118, 97, 114, 32, 98, 61, 77, 97, 116, 104, 65, 98, 115, 40, 97, 41,
+59, 10, 105, 102, 40, 98, 60, 49, 69, 45, 55, 41, 123, 10, 114, 101, 116, 117,
+114, 110, 32, 97, 42, 40, 49, 45, 97, 42, 40, 49, 47, 50, 41, 41, 59, 10, 125,
+101, 108, 115, 101, 32, 105, 102, 40, 98, 60, 51, 69, 45, 53, 41, 123, 10, 114,
+101, 116, 117, 114, 110, 32, 97, 42, 40, 49, 45, 97, 42, 40, 49, 47, 50, 45, 97,
+42, 40, 49, 47, 51, 41, 41, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102,
+40, 98, 60, 55, 69, 45, 51, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 97,
+42, 40, 49, 45, 97, 42, 40, 49, 47, 50, 45, 97, 42, 40, 49, 47, 51, 45, 97, 42,
+40, 49, 47, 52, 45, 10, 97, 42, 40, 49, 47, 53, 45, 97, 42, 40, 49, 47, 54, 45,
+97, 42, 40, 49, 47, 55, 41, 41, 41, 41, 41, 41, 41, 59, 10, 125, 101, 108, 115,
+101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 77, 97, 116, 104, 76, 111, 103,
+40, 49, 43, 97, 41, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 69, 120, 116, 101, 110, 100, 77, 97, 116, 104, 40, 41, 123, 10, 37, 67,
+104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105,
+110, 103, 40, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99,
+116, 105, 111, 110, 115, 40, 36, 77, 97, 116, 104, 44, 50, 44, 36, 65, 114, 114,
+97, 121, 40, 10, 34, 115, 105, 103, 110, 34, 44, 77, 97, 116, 104, 83, 105, 103,
 110, 44, 10, 34, 116, 114, 117, 110, 99, 34, 44, 77, 97, 116, 104, 84, 114, 117,
 110, 99, 44, 10, 34, 115, 105, 110, 104, 34, 44, 77, 97, 116, 104, 83, 105, 110,
 104, 44, 10, 34, 99, 111, 115, 104, 34, 44, 77, 97, 116, 104, 67, 111, 115, 104,
@@ -1805,7 +1804,7 @@ namespace internal {
 
   template <>
   int NativesCollection<EXPERIMENTAL>::GetRawScriptsSize() {
-    return 30710;
+    return 30702;
   }
 
   template <>
@@ -1817,9 +1816,9 @@ namespace internal {
     if (index == 4) return Vector<const char>(raw_sources + 14062, 1593);
     if (index == 5) return Vector<const char>(raw_sources + 15655, 4526);
     if (index == 6) return Vector<const char>(raw_sources + 20181, 2024);
-    if (index == 7) return Vector<const char>(raw_sources + 22205, 2560);
-    if (index == 8) return Vector<const char>(raw_sources + 24765, 2056);
-    if (index == 9) return Vector<const char>(raw_sources + 26821, 3889);
+    if (index == 7) return Vector<const char>(raw_sources + 22205, 2552);
+    if (index == 8) return Vector<const char>(raw_sources + 24757, 2056);
+    if (index == 9) return Vector<const char>(raw_sources + 26813, 3889);
     return Vector<const char>("", 0);
   }
 
@@ -1840,12 +1839,12 @@ namespace internal {
 
   template <>
   Vector<const byte> NativesCollection<EXPERIMENTAL>::GetScriptsSource() {
-    return Vector<const byte>(sources, 30710);
+    return Vector<const byte>(sources, 30702);
   }
 
   template <>
   void NativesCollection<EXPERIMENTAL>::SetRawScriptsSource(Vector<const char> raw_source) {
-    ASSERT(30710 == raw_source.length());
+    ASSERT(30702 == raw_source.length());
     raw_sources = raw_source.start();
   }
 
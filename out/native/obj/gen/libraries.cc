@@ -17883,1851 +17883,13 @@ namespace internal {
 97, 110, 103, 101, 34, 44, 79, 98, 106, 101, 99, 116, 78, 111, 116, 105, 102,
 105, 101, 114, 80, 101, 114, 102, 111, 114, 109, 67, 104, 97, 110, 103, 101, 10,
 41, 41, 59, 10, 125, 10, 83, 101, 116, 117, 112, 79, 98, 106, 101, 99, 116, 79,
-98, 115, 101, 114, 118, 101, 40, 41, 59, 10, 10, 10, 34, 117, 115, 101, 32, 115,
-116, 114, 105, 99, 116, 34, 59, 10, 36, 79, 98, 106, 101, 99, 116, 46, 100, 101,
-102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 103, 108, 111,
-98, 97, 108, 44, 34, 73, 110, 116, 108, 34, 44, 123, 101, 110, 117, 109, 101,
-114, 97, 98, 108, 101, 58, 102, 97, 108, 115, 101, 44, 118, 97, 108, 117, 101,
-58, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 118, 97, 114,
-32, 97, 61, 123, 125, 59, 10, 118, 97, 114, 32, 98, 61, 103, 108, 111, 98, 97,
-108, 46, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 118, 97, 114, 32,
-99, 61, 91, 39, 99, 111, 108, 108, 97, 116, 111, 114, 39, 44, 10, 39, 110, 117,
-109, 98, 101, 114, 102, 111, 114, 109, 97, 116, 39, 44, 10, 39, 100, 97, 116,
-101, 102, 111, 114, 109, 97, 116, 39, 44, 10, 39, 98, 114, 101, 97, 107, 105,
-116, 101, 114, 97, 116, 111, 114, 39, 93, 59, 10, 118, 97, 114, 32, 100, 61, 91,
-39, 78, 70, 67, 39, 44, 10, 39, 78, 70, 68, 39, 44, 10, 39, 78, 70, 75, 67, 39,
-44, 10, 39, 78, 70, 75, 68, 39, 93, 59, 10, 118, 97, 114, 32, 103, 61, 123, 10,
-39, 99, 111, 108, 108, 97, 116, 111, 114, 39, 58, 98, 44, 10, 39, 110, 117, 109,
-98, 101, 114, 102, 111, 114, 109, 97, 116, 39, 58, 98, 44, 10, 39, 100, 97, 116,
-101, 102, 111, 114, 109, 97, 116, 39, 58, 98, 44, 10, 39, 98, 114, 101, 97, 107,
-105, 116, 101, 114, 97, 116, 111, 114, 39, 58, 98, 10, 125, 59, 10, 118, 97,
-114, 32, 104, 61, 98, 59, 10, 118, 97, 114, 32, 105, 61, 98, 59, 10, 102, 117,
-110, 99, 116, 105, 111, 110, 32, 71, 101, 116, 85, 110, 105, 99, 111, 100, 101,
-69, 120, 116, 101, 110, 115, 105, 111, 110, 82, 69, 40, 41, 123, 10, 105, 102,
-40, 105, 61, 61, 61, 98, 41, 123, 10, 105, 61, 110, 101, 119, 32, 36, 82, 101,
-103, 69, 120, 112, 40, 39, 45, 117, 40, 45, 91, 97, 45, 122, 48, 45, 57, 93,
-123, 50, 44, 56, 125, 41, 43, 39, 44, 39, 103, 39, 41, 59, 10, 125, 10, 114,
-101, 116, 117, 114, 110, 32, 105, 59, 10, 125, 10, 118, 97, 114, 32, 106, 61,
-98, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 116, 65, 110,
-121, 69, 120, 116, 101, 110, 115, 105, 111, 110, 82, 69, 40, 41, 123, 10, 105,
-102, 40, 106, 61, 61, 61, 98, 41, 123, 10, 106, 61, 110, 101, 119, 32, 36, 82,
-101, 103, 69, 120, 112, 40, 39, 45, 91, 97, 45, 122, 48, 45, 57, 93, 123, 49,
-125, 45, 46, 42, 39, 44, 39, 103, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117,
-114, 110, 32, 106, 59, 10, 125, 10, 118, 97, 114, 32, 107, 61, 98, 59, 10, 102,
-117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 116, 81, 117, 111, 116, 101, 100,
-83, 116, 114, 105, 110, 103, 82, 69, 40, 41, 123, 10, 105, 102, 40, 107, 61, 61,
-61, 98, 41, 123, 10, 107, 61, 110, 101, 119, 32, 36, 82, 101, 103, 69, 120, 112,
-40, 34, 39, 91, 94, 39, 93, 43, 39, 34, 44, 39, 103, 39, 41, 59, 10, 125, 10,
-114, 101, 116, 117, 114, 110, 32, 107, 59, 10, 125, 10, 118, 97, 114, 32, 108,
-61, 98, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 116, 83,
-101, 114, 118, 105, 99, 101, 82, 69, 40, 41, 123, 10, 105, 102, 40, 108, 61, 61,
-61, 98, 41, 123, 10, 108, 61, 10, 110, 101, 119, 32, 36, 82, 101, 103, 69, 120,
-112, 40, 39, 94, 40, 99, 111, 108, 108, 97, 116, 111, 114, 124, 110, 117, 109,
-98, 101, 114, 102, 111, 114, 109, 97, 116, 124, 100, 97, 116, 101, 102, 111,
-114, 109, 97, 116, 124, 98, 114, 101, 97, 107, 105, 116, 101, 114, 97, 116, 111,
-114, 41, 36, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 108, 59,
-10, 125, 10, 118, 97, 114, 32, 109, 61, 98, 59, 10, 102, 117, 110, 99, 116, 105,
-111, 110, 32, 71, 101, 116, 76, 97, 110, 103, 117, 97, 103, 101, 84, 97, 103,
-82, 69, 40, 41, 123, 10, 105, 102, 40, 109, 61, 61, 61, 98, 41, 123, 10, 66,
-117, 105, 108, 100, 76, 97, 110, 103, 117, 97, 103, 101, 84, 97, 103, 82, 69,
-115, 40, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 109, 59, 10,
-125, 10, 118, 97, 114, 32, 111, 61, 98, 59, 10, 102, 117, 110, 99, 116, 105,
-111, 110, 32, 71, 101, 116, 76, 97, 110, 103, 117, 97, 103, 101, 86, 97, 114,
-105, 97, 110, 116, 82, 69, 40, 41, 123, 10, 105, 102, 40, 111, 61, 61, 61, 98,
-41, 123, 10, 66, 117, 105, 108, 100, 76, 97, 110, 103, 117, 97, 103, 101, 84,
-97, 103, 82, 69, 115, 40, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
-111, 59, 10, 125, 10, 118, 97, 114, 32, 113, 61, 98, 59, 10, 102, 117, 110, 99,
-116, 105, 111, 110, 32, 71, 101, 116, 76, 97, 110, 103, 117, 97, 103, 101, 83,
-105, 110, 103, 108, 101, 116, 111, 110, 82, 69, 40, 41, 123, 10, 105, 102, 40,
-113, 61, 61, 61, 98, 41, 123, 10, 66, 117, 105, 108, 100, 76, 97, 110, 103, 117,
-97, 103, 101, 84, 97, 103, 82, 69, 115, 40, 41, 59, 10, 125, 10, 114, 101, 116,
-117, 114, 110, 32, 113, 59, 10, 125, 10, 118, 97, 114, 32, 114, 61, 98, 59, 10,
-102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 116, 84, 105, 109, 101, 122,
-111, 110, 101, 78, 97, 109, 101, 67, 104, 101, 99, 107, 82, 69, 40, 41, 123, 10,
-105, 102, 40, 114, 61, 61, 61, 98, 41, 123, 10, 114, 61, 10, 110, 101, 119, 32,
-36, 82, 101, 103, 69, 120, 112, 40, 39, 94, 40, 91, 65, 45, 90, 97, 45, 122, 93,
-43, 41, 47, 40, 91, 65, 45, 90, 97, 45, 122, 93, 43, 41, 40, 63, 58, 95, 40, 91,
-65, 45, 90, 97, 45, 122, 93, 43, 41, 41, 42, 36, 39, 41, 59, 10, 125, 10, 114,
-101, 116, 117, 114, 110, 32, 114, 59, 10, 125, 10, 118, 97, 114, 32, 117, 61,
-123, 10, 39, 103, 114, 101, 103, 111, 114, 105, 97, 110, 39, 58, 39, 103, 114,
-101, 103, 111, 114, 121, 39, 44, 10, 39, 106, 97, 112, 97, 110, 101, 115, 101,
-39, 58, 39, 106, 97, 112, 97, 110, 101, 115, 101, 39, 44, 10, 39, 98, 117, 100,
-100, 104, 105, 115, 116, 39, 58, 39, 98, 117, 100, 100, 104, 105, 115, 116, 39,
-44, 10, 39, 114, 111, 99, 39, 58, 39, 114, 111, 99, 39, 44, 10, 39, 112, 101,
-114, 115, 105, 97, 110, 39, 58, 39, 112, 101, 114, 115, 105, 97, 110, 39, 44,
-10, 39, 105, 115, 108, 97, 109, 105, 99, 45, 99, 105, 118, 105, 108, 39, 58, 39,
-105, 115, 108, 97, 109, 105, 99, 99, 39, 44, 10, 39, 105, 115, 108, 97, 109,
-105, 99, 39, 58, 39, 105, 115, 108, 97, 109, 105, 99, 39, 44, 10, 39, 104, 101,
-98, 114, 101, 119, 39, 58, 39, 104, 101, 98, 114, 101, 119, 39, 44, 10, 39, 99,
-104, 105, 110, 101, 115, 101, 39, 58, 39, 99, 104, 105, 110, 101, 115, 101, 39,
-44, 10, 39, 105, 110, 100, 105, 97, 110, 39, 58, 39, 105, 110, 100, 105, 97,
-110, 39, 44, 10, 39, 99, 111, 112, 116, 105, 99, 39, 58, 39, 99, 111, 112, 116,
-105, 99, 39, 44, 10, 39, 101, 116, 104, 105, 111, 112, 105, 99, 39, 58, 39, 101,
-116, 104, 105, 111, 112, 105, 99, 39, 44, 10, 39, 101, 116, 104, 105, 111, 112,
-105, 99, 45, 97, 109, 101, 116, 101, 45, 97, 108, 101, 109, 39, 58, 39, 101,
-116, 104, 105, 111, 97, 97, 39, 10, 125, 59, 10, 118, 97, 114, 32, 119, 61, 123,
-10, 39, 107, 110, 39, 58, 123, 39, 112, 114, 111, 112, 101, 114, 116, 121, 39,
-58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44, 39, 116, 121, 112, 101, 39,
-58, 39, 98, 111, 111, 108, 101, 97, 110, 39, 125, 44, 10, 39, 107, 102, 39, 58,
-123, 39, 112, 114, 111, 112, 101, 114, 116, 121, 39, 58, 39, 99, 97, 115, 101,
-70, 105, 114, 115, 116, 39, 44, 39, 116, 121, 112, 101, 39, 58, 39, 115, 116,
-114, 105, 110, 103, 39, 44, 10, 39, 118, 97, 108, 117, 101, 115, 39, 58, 91, 39,
-102, 97, 108, 115, 101, 39, 44, 39, 108, 111, 119, 101, 114, 39, 44, 39, 117,
-112, 112, 101, 114, 39, 93, 125, 10, 125, 59, 10, 118, 97, 114, 32, 122, 61,
-123, 10, 39, 110, 117, 39, 58, 123, 39, 112, 114, 111, 112, 101, 114, 116, 121,
-39, 58, 98, 44, 39, 116, 121, 112, 101, 39, 58, 39, 115, 116, 114, 105, 110,
-103, 39, 125, 10, 125, 59, 10, 118, 97, 114, 32, 65, 61, 123, 10, 39, 99, 97,
-39, 58, 123, 39, 112, 114, 111, 112, 101, 114, 116, 121, 39, 58, 98, 44, 39,
-116, 121, 112, 101, 39, 58, 39, 115, 116, 114, 105, 110, 103, 39, 125, 44, 10,
-39, 110, 117, 39, 58, 123, 39, 112, 114, 111, 112, 101, 114, 116, 121, 39, 58,
-98, 44, 39, 116, 121, 112, 101, 39, 58, 39, 115, 116, 114, 105, 110, 103, 39,
-125, 10, 125, 59, 10, 118, 97, 114, 32, 66, 61, 91, 10, 39, 98, 105, 103, 53,
-104, 97, 110, 39, 44, 39, 100, 105, 99, 116, 39, 44, 39, 100, 105, 114, 101, 99,
-116, 39, 44, 39, 100, 117, 99, 101, 116, 39, 44, 39, 103, 98, 50, 51, 49, 50,
-39, 44, 39, 112, 104, 111, 110, 101, 98, 107, 39, 44, 39, 112, 104, 111, 110,
-101, 116, 105, 99, 39, 44, 10, 39, 112, 105, 110, 121, 105, 110, 39, 44, 39,
-114, 101, 102, 111, 114, 109, 101, 100, 39, 44, 39, 115, 101, 97, 114, 99, 104,
-106, 108, 39, 44, 39, 115, 116, 114, 111, 107, 101, 39, 44, 39, 116, 114, 97,
-100, 39, 44, 39, 117, 110, 105, 104, 97, 110, 39, 44, 39, 122, 104, 117, 121,
-105, 110, 39, 10, 93, 59, 10, 118, 97, 114, 32, 67, 61, 10, 39, 70, 117, 110,
-99, 116, 105, 111, 110, 32, 111, 98, 106, 101, 99, 116, 32, 116, 104, 97, 116,
-92, 39, 115, 32, 110, 111, 116, 32, 97, 32, 99, 111, 110, 115, 116, 114, 117,
-99, 116, 111, 114, 32, 119, 97, 115, 32, 99, 114, 101, 97, 116, 101, 100, 32,
-119, 105, 116, 104, 32, 110, 101, 119, 39, 59, 10, 102, 117, 110, 99, 116, 105,
-111, 110, 32, 97, 100, 100, 66, 111, 117, 110, 100, 77, 101, 116, 104, 111, 100,
-40, 68, 44, 69, 44, 71, 44, 72, 41, 123, 10, 102, 117, 110, 99, 116, 105, 111,
-110, 32, 103, 101, 116, 116, 101, 114, 40, 41, 123, 10, 105, 102, 40, 33, 37,
-73, 115, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73, 110, 116, 108,
-79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 123, 10, 116, 104,
-114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111,
-114, 40, 39, 77, 101, 116, 104, 111, 100, 32, 39, 43, 69, 43, 39, 32, 99, 97,
-108, 108, 101, 100, 32, 111, 110, 32, 97, 32, 39, 43, 10, 39, 110, 111, 110, 45,
-111, 98, 106, 101, 99, 116, 32, 111, 114, 32, 111, 110, 32, 97, 32, 119, 114,
-111, 110, 103, 32, 116, 121, 112, 101, 32, 111, 102, 32, 111, 98, 106, 101, 99,
-116, 46, 39, 41, 59, 10, 125, 10, 118, 97, 114, 32, 73, 61, 39, 95, 95, 98, 111,
-117, 110, 100, 39, 43, 69, 43, 39, 95, 95, 39, 59, 10, 105, 102, 40, 116, 104,
-105, 115, 91, 73, 93, 61, 61, 61, 98, 41, 123, 10, 118, 97, 114, 32, 74, 61,
-116, 104, 105, 115, 59, 10, 118, 97, 114, 32, 75, 59, 10, 105, 102, 40, 72, 61,
-61, 61, 98, 124, 124, 72, 61, 61, 61, 50, 41, 123, 10, 75, 61, 102, 117, 110,
-99, 116, 105, 111, 110, 40, 76, 44, 77, 41, 123, 10, 105, 102, 40, 37, 95, 73,
-115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41,
-123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101,
-69, 114, 114, 111, 114, 40, 67, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114,
-110, 32, 71, 40, 74, 44, 76, 44, 77, 41, 59, 10, 125, 10, 125, 101, 108, 115,
-101, 32, 105, 102, 40, 72, 61, 61, 61, 49, 41, 123, 10, 75, 61, 102, 117, 110,
-99, 116, 105, 111, 110, 40, 76, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67,
-111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10,
-116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114,
-114, 111, 114, 40, 67, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
-71, 40, 74, 44, 76, 41, 59, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 75,
-61, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 105, 102, 40, 37,
-95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40,
-41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121,
-112, 101, 69, 114, 114, 111, 114, 40, 67, 41, 59, 10, 125, 10, 105, 102, 40, 37,
-95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40,
-41, 62, 48, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 71, 40, 74, 44, 37,
-95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 48, 41, 41, 59, 10, 125,
-101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 71, 40, 74, 41,
-59, 10, 125, 10, 125, 10, 125, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83,
-101, 116, 78, 97, 109, 101, 40, 75, 44, 73, 41, 59, 10, 37, 70, 117, 110, 99,
-116, 105, 111, 110, 82, 101, 109, 111, 118, 101, 80, 114, 111, 116, 111, 116,
-121, 112, 101, 40, 75, 41, 59, 10, 37, 83, 101, 116, 78, 97, 116, 105, 118, 101,
-70, 108, 97, 103, 40, 75, 41, 59, 10, 116, 104, 105, 115, 91, 73, 93, 61, 75,
-59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 91, 73,
-93, 59, 10, 125, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 78,
-97, 109, 101, 40, 103, 101, 116, 116, 101, 114, 44, 69, 41, 59, 10, 37, 70, 117,
-110, 99, 116, 105, 111, 110, 82, 101, 109, 111, 118, 101, 80, 114, 111, 116,
-111, 116, 121, 112, 101, 40, 103, 101, 116, 116, 101, 114, 41, 59, 10, 37, 83,
-101, 116, 78, 97, 116, 105, 118, 101, 70, 108, 97, 103, 40, 103, 101, 116, 116,
-101, 114, 41, 59, 10, 79, 98, 106, 101, 99, 116, 68, 101, 102, 105, 110, 101,
-80, 114, 111, 112, 101, 114, 116, 121, 40, 68, 46, 112, 114, 111, 116, 111, 116,
-121, 112, 101, 44, 69, 44, 123, 10, 103, 101, 116, 58, 103, 101, 116, 116, 101,
-114, 44, 10, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 102, 97, 108,
-115, 101, 44, 10, 99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 58,
-116, 114, 117, 101, 10, 125, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105,
-111, 110, 32, 115, 117, 112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108,
-101, 115, 79, 102, 40, 78, 44, 79, 44, 80, 41, 123, 10, 105, 102, 40, 40, 78,
-46, 109, 97, 116, 99, 104, 40, 71, 101, 116, 83, 101, 114, 118, 105, 99, 101,
-82, 69, 40, 41, 41, 61, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10, 116, 104,
-114, 111, 119, 32, 110, 101, 119, 32, 36, 69, 114, 114, 111, 114, 40, 39, 73,
-110, 116, 101, 114, 110, 97, 108, 32, 101, 114, 114, 111, 114, 44, 32, 119, 114,
-111, 110, 103, 32, 115, 101, 114, 118, 105, 99, 101, 32, 116, 121, 112, 101, 58,
-32, 39, 43, 78, 41, 59, 10, 125, 10, 105, 102, 40, 80, 61, 61, 61, 98, 41, 123,
-10, 80, 61, 123, 125, 59, 10, 125, 101, 108, 115, 101, 123, 10, 80, 61, 84, 111,
-79, 98, 106, 101, 99, 116, 40, 80, 41, 59, 10, 125, 10, 118, 97, 114, 32, 81,
-61, 80, 46, 108, 111, 99, 97, 108, 101, 77, 97, 116, 99, 104, 101, 114, 59, 10,
-105, 102, 40, 81, 33, 61, 61, 98, 41, 123, 10, 81, 61, 36, 83, 116, 114, 105,
-110, 103, 40, 81, 41, 59, 10, 105, 102, 40, 81, 33, 61, 61, 39, 108, 111, 111,
-107, 117, 112, 39, 38, 38, 81, 33, 61, 61, 39, 98, 101, 115, 116, 32, 102, 105,
-116, 39, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 82,
-97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 73, 108, 108, 101, 103, 97,
-108, 32, 118, 97, 108, 117, 101, 32, 102, 111, 114, 32, 108, 111, 99, 97, 108,
-101, 77, 97, 116, 99, 104, 101, 114, 58, 39, 43, 81, 41, 59, 10, 125, 10, 125,
-101, 108, 115, 101, 123, 10, 81, 61, 39, 98, 101, 115, 116, 32, 102, 105, 116,
-39, 59, 10, 125, 10, 118, 97, 114, 32, 82, 61, 105, 110, 105, 116, 105, 97, 108,
-105, 122, 101, 76, 111, 99, 97, 108, 101, 76, 105, 115, 116, 40, 79, 41, 59, 10,
-105, 102, 40, 103, 91, 78, 93, 61, 61, 61, 98, 41, 123, 10, 103, 91, 78, 93, 61,
-103, 101, 116, 65, 118, 97, 105, 108, 97, 98, 108, 101, 76, 111, 99, 97, 108,
-101, 115, 79, 102, 40, 78, 41, 59, 10, 125, 10, 105, 102, 40, 81, 61, 61, 61,
-39, 98, 101, 115, 116, 32, 102, 105, 116, 39, 41, 123, 10, 114, 101, 116, 117,
-114, 110, 32, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 76, 111, 99, 97,
-108, 101, 76, 105, 115, 116, 40, 98, 101, 115, 116, 70, 105, 116, 83, 117, 112,
-112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 40, 10,
-82, 44, 103, 91, 78, 93, 41, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110,
-32, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 76, 111, 99, 97, 108, 101,
-76, 105, 115, 116, 40, 108, 111, 111, 107, 117, 112, 83, 117, 112, 112, 111,
-114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 40, 10, 82, 44,
-103, 91, 78, 93, 41, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110,
-32, 108, 111, 111, 107, 117, 112, 83, 117, 112, 112, 111, 114, 116, 101, 100,
-76, 111, 99, 97, 108, 101, 115, 79, 102, 40, 82, 44, 83, 41, 123, 10, 118, 97,
-114, 32, 84, 61, 91, 93, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 85, 61,
-48, 59, 85, 60, 82, 46, 108, 101, 110, 103, 116, 104, 59, 43, 43, 85, 41, 123,
-10, 118, 97, 114, 32, 87, 61, 82, 91, 85, 93, 46, 114, 101, 112, 108, 97, 99,
-101, 40, 71, 101, 116, 85, 110, 105, 99, 111, 100, 101, 69, 120, 116, 101, 110,
-115, 105, 111, 110, 82, 69, 40, 41, 44, 39, 39, 41, 59, 10, 100, 111, 123, 10,
-105, 102, 40, 83, 91, 87, 93, 33, 61, 61, 98, 41, 123, 10, 84, 46, 112, 117,
-115, 104, 40, 82, 91, 85, 93, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 125,
-10, 118, 97, 114, 32, 88, 61, 87, 46, 108, 97, 115, 116, 73, 110, 100, 101, 120,
-79, 102, 40, 39, 45, 39, 41, 59, 10, 105, 102, 40, 88, 61, 61, 61, 45, 49, 41,
-123, 10, 98, 114, 101, 97, 107, 59, 10, 125, 10, 87, 61, 87, 46, 115, 117, 98,
-115, 116, 114, 105, 110, 103, 40, 48, 44, 88, 41, 59, 10, 125, 119, 104, 105,
-108, 101, 40, 116, 114, 117, 101, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114,
-110, 32, 84, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 98,
-101, 115, 116, 70, 105, 116, 83, 117, 112, 112, 111, 114, 116, 101, 100, 76,
-111, 99, 97, 108, 101, 115, 79, 102, 40, 82, 44, 83, 41, 123, 10, 114, 101, 116,
-117, 114, 110, 32, 108, 111, 111, 107, 117, 112, 83, 117, 112, 112, 111, 114,
-116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 40, 82, 44, 83, 41, 59,
-10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 103, 101, 116, 71, 101,
-116, 79, 112, 116, 105, 111, 110, 40, 80, 44, 89, 41, 123, 10, 105, 102, 40, 80,
-61, 61, 61, 98, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36,
-69, 114, 114, 111, 114, 40, 39, 73, 110, 116, 101, 114, 110, 97, 108, 32, 39,
-43, 89, 43, 39, 32, 101, 114, 114, 111, 114, 46, 32, 39, 43, 10, 39, 68, 101,
-102, 97, 117, 108, 116, 32, 111, 112, 116, 105, 111, 110, 115, 32, 97, 114, 101,
-32, 109, 105, 115, 115, 105, 110, 103, 46, 39, 41, 59, 10, 125, 10, 118, 97,
-114, 32, 90, 61, 102, 117, 110, 99, 116, 105, 111, 110, 32, 103, 101, 116, 79,
-112, 116, 105, 111, 110, 40, 97, 97, 44, 97, 98, 44, 97, 99, 44, 97, 100, 41,
-123, 10, 105, 102, 40, 80, 91, 97, 97, 93, 33, 61, 61, 98, 41, 123, 10, 118, 97,
-114, 32, 97, 101, 61, 80, 91, 97, 97, 93, 59, 10, 115, 119, 105, 116, 99, 104,
-40, 97, 98, 41, 123, 10, 99, 97, 115, 101, 39, 98, 111, 111, 108, 101, 97, 110,
-39, 58, 10, 97, 101, 61, 36, 66, 111, 111, 108, 101, 97, 110, 40, 97, 101, 41,
-59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 115, 116, 114, 105,
-110, 103, 39, 58, 10, 97, 101, 61, 36, 83, 116, 114, 105, 110, 103, 40, 97, 101,
-41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 99, 97, 115, 101, 39, 110, 117, 109,
-98, 101, 114, 39, 58, 10, 97, 101, 61, 36, 78, 117, 109, 98, 101, 114, 40, 97,
-101, 41, 59, 10, 98, 114, 101, 97, 107, 59, 10, 100, 101, 102, 97, 117, 108,
-116, 58, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 69, 114, 114,
-111, 114, 40, 39, 73, 110, 116, 101, 114, 110, 97, 108, 32, 101, 114, 114, 111,
-114, 46, 32, 87, 114, 111, 110, 103, 32, 118, 97, 108, 117, 101, 32, 116, 121,
-112, 101, 46, 39, 41, 59, 10, 125, 10, 105, 102, 40, 97, 99, 33, 61, 61, 98, 38,
-38, 97, 99, 46, 105, 110, 100, 101, 120, 79, 102, 40, 97, 101, 41, 61, 61, 61,
-45, 49, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 82, 97,
-110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 86, 97, 108, 117, 101, 32, 39,
-43, 97, 101, 43, 39, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103,
-101, 32, 102, 111, 114, 32, 39, 43, 89, 43, 10, 39, 32, 111, 112, 116, 105, 111,
-110, 115, 32, 112, 114, 111, 112, 101, 114, 116, 121, 32, 39, 43, 97, 97, 41,
-59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 97, 101, 59, 10, 125, 10,
-114, 101, 116, 117, 114, 110, 32, 97, 100, 59, 10, 125, 10, 114, 101, 116, 117,
-114, 110, 32, 90, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
-114, 101, 115, 111, 108, 118, 101, 76, 111, 99, 97, 108, 101, 40, 78, 44, 82,
-44, 80, 41, 123, 10, 82, 61, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101,
-76, 111, 99, 97, 108, 101, 76, 105, 115, 116, 40, 82, 41, 59, 10, 118, 97, 114,
-32, 90, 61, 103, 101, 116, 71, 101, 116, 79, 112, 116, 105, 111, 110, 40, 80,
-44, 78, 41, 59, 10, 118, 97, 114, 32, 81, 61, 90, 40, 39, 108, 111, 99, 97, 108,
-101, 77, 97, 116, 99, 104, 101, 114, 39, 44, 39, 115, 116, 114, 105, 110, 103,
-39, 44, 10, 91, 39, 108, 111, 111, 107, 117, 112, 39, 44, 39, 98, 101, 115, 116,
-32, 102, 105, 116, 39, 93, 44, 39, 98, 101, 115, 116, 32, 102, 105, 116, 39, 41,
-59, 10, 118, 97, 114, 32, 97, 102, 59, 10, 105, 102, 40, 81, 61, 61, 61, 39,
-108, 111, 111, 107, 117, 112, 39, 41, 123, 10, 97, 102, 61, 108, 111, 111, 107,
-117, 112, 77, 97, 116, 99, 104, 101, 114, 40, 78, 44, 82, 41, 59, 10, 125, 101,
-108, 115, 101, 123, 10, 97, 102, 61, 98, 101, 115, 116, 70, 105, 116, 77, 97,
-116, 99, 104, 101, 114, 40, 78, 44, 82, 41, 59, 10, 125, 10, 114, 101, 116, 117,
-114, 110, 32, 97, 102, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110,
-32, 108, 111, 111, 107, 117, 112, 77, 97, 116, 99, 104, 101, 114, 40, 78, 44,
-82, 41, 123, 10, 105, 102, 40, 40, 78, 46, 109, 97, 116, 99, 104, 40, 71, 101,
-116, 83, 101, 114, 118, 105, 99, 101, 82, 69, 40, 41, 41, 61, 61, 61, 110, 117,
-108, 108, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36,
-69, 114, 114, 111, 114, 40, 39, 73, 110, 116, 101, 114, 110, 97, 108, 32, 101,
-114, 114, 111, 114, 44, 32, 119, 114, 111, 110, 103, 32, 115, 101, 114, 118,
-105, 99, 101, 32, 116, 121, 112, 101, 58, 32, 39, 43, 78, 41, 59, 10, 125, 10,
-105, 102, 40, 103, 91, 78, 93, 61, 61, 61, 98, 41, 123, 10, 103, 91, 78, 93, 61,
-103, 101, 116, 65, 118, 97, 105, 108, 97, 98, 108, 101, 76, 111, 99, 97, 108,
-101, 115, 79, 102, 40, 78, 41, 59, 10, 125, 10, 102, 111, 114, 40, 118, 97, 114,
-32, 85, 61, 48, 59, 85, 60, 82, 46, 108, 101, 110, 103, 116, 104, 59, 43, 43,
-85, 41, 123, 10, 118, 97, 114, 32, 87, 61, 82, 91, 85, 93, 46, 114, 101, 112,
-108, 97, 99, 101, 40, 71, 101, 116, 65, 110, 121, 69, 120, 116, 101, 110, 115,
-105, 111, 110, 82, 69, 40, 41, 44, 39, 39, 41, 59, 10, 100, 111, 123, 10, 105,
-102, 40, 103, 91, 78, 93, 91, 87, 93, 33, 61, 61, 98, 41, 123, 10, 118, 97, 114,
-32, 97, 103, 61, 82, 91, 85, 93, 46, 109, 97, 116, 99, 104, 40, 71, 101, 116,
-85, 110, 105, 99, 111, 100, 101, 69, 120, 116, 101, 110, 115, 105, 111, 110, 82,
-69, 40, 41, 41, 59, 10, 118, 97, 114, 32, 97, 104, 61, 40, 97, 103, 61, 61, 61,
-110, 117, 108, 108, 41, 63, 39, 39, 58, 97, 103, 91, 48, 93, 59, 10, 114, 101,
-116, 117, 114, 110, 123, 39, 108, 111, 99, 97, 108, 101, 39, 58, 87, 44, 39,
-101, 120, 116, 101, 110, 115, 105, 111, 110, 39, 58, 97, 104, 44, 39, 112, 111,
-115, 105, 116, 105, 111, 110, 39, 58, 85, 125, 59, 10, 125, 10, 118, 97, 114,
-32, 88, 61, 87, 46, 108, 97, 115, 116, 73, 110, 100, 101, 120, 79, 102, 40, 39,
-45, 39, 41, 59, 10, 105, 102, 40, 88, 61, 61, 61, 45, 49, 41, 123, 10, 98, 114,
-101, 97, 107, 59, 10, 125, 10, 87, 61, 87, 46, 115, 117, 98, 115, 116, 114, 105,
-110, 103, 40, 48, 44, 88, 41, 59, 10, 125, 119, 104, 105, 108, 101, 40, 116,
-114, 117, 101, 41, 59, 10, 125, 10, 105, 102, 40, 104, 61, 61, 61, 98, 41, 123,
-10, 104, 61, 37, 71, 101, 116, 68, 101, 102, 97, 117, 108, 116, 73, 67, 85, 76,
-111, 99, 97, 108, 101, 40, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110,
-123, 39, 108, 111, 99, 97, 108, 101, 39, 58, 104, 44, 39, 101, 120, 116, 101,
-110, 115, 105, 111, 110, 39, 58, 39, 39, 44, 39, 112, 111, 115, 105, 116, 105,
-111, 110, 39, 58, 45, 49, 125, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105,
-111, 110, 32, 98, 101, 115, 116, 70, 105, 116, 77, 97, 116, 99, 104, 101, 114,
-40, 78, 44, 82, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 108, 111, 111,
-107, 117, 112, 77, 97, 116, 99, 104, 101, 114, 40, 78, 44, 82, 41, 59, 10, 125,
-10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 112, 97, 114, 115, 101, 69, 120,
-116, 101, 110, 115, 105, 111, 110, 40, 97, 104, 41, 123, 10, 118, 97, 114, 32,
-97, 105, 61, 97, 104, 46, 115, 112, 108, 105, 116, 40, 39, 45, 39, 41, 59, 10,
-105, 102, 40, 97, 105, 46, 108, 101, 110, 103, 116, 104, 60, 61, 50, 124, 124,
-10, 40, 97, 105, 91, 48, 93, 33, 61, 61, 39, 39, 38, 38, 97, 105, 91, 49, 93,
-33, 61, 61, 39, 117, 39, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 123,
-125, 59, 10, 125, 10, 118, 97, 114, 32, 97, 106, 61, 123, 125, 59, 10, 118, 97,
-114, 32, 97, 107, 61, 98, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 85, 61,
-50, 59, 85, 60, 97, 105, 46, 108, 101, 110, 103, 116, 104, 59, 43, 43, 85, 41,
-123, 10, 118, 97, 114, 32, 72, 61, 97, 105, 91, 85, 93, 46, 108, 101, 110, 103,
-116, 104, 59, 10, 118, 97, 114, 32, 97, 108, 61, 97, 105, 91, 85, 93, 59, 10,
-105, 102, 40, 72, 61, 61, 61, 50, 41, 123, 10, 97, 106, 91, 97, 108, 93, 61, 98,
-59, 10, 97, 107, 61, 97, 108, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40,
-72, 62, 61, 51, 38, 38, 72, 60, 61, 56, 38, 38, 97, 107, 33, 61, 61, 98, 41,
-123, 10, 97, 106, 91, 97, 107, 93, 61, 97, 108, 59, 10, 97, 107, 61, 98, 59, 10,
-125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 123, 125, 59,
-10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 97, 106, 59, 10, 125,
-10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 101, 116, 79, 112, 116, 105,
-111, 110, 115, 40, 97, 109, 44, 97, 106, 44, 97, 110, 44, 90, 44, 97, 111, 41,
-123, 10, 118, 97, 114, 32, 97, 104, 61, 39, 39, 59, 10, 118, 97, 114, 32, 97,
-112, 61, 102, 117, 110, 99, 116, 105, 111, 110, 32, 117, 112, 100, 97, 116, 101,
-69, 120, 116, 101, 110, 115, 105, 111, 110, 40, 97, 113, 44, 97, 101, 41, 123,
-10, 114, 101, 116, 117, 114, 110, 39, 45, 39, 43, 97, 113, 43, 39, 45, 39, 43,
-36, 83, 116, 114, 105, 110, 103, 40, 97, 101, 41, 59, 10, 125, 10, 118, 97, 114,
-32, 97, 114, 61, 102, 117, 110, 99, 116, 105, 111, 110, 32, 117, 112, 100, 97,
-116, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 97, 44, 97, 98, 44, 97,
-101, 41, 123, 10, 105, 102, 40, 97, 98, 61, 61, 61, 39, 98, 111, 111, 108, 101,
-97, 110, 39, 38, 38, 40, 116, 121, 112, 101, 111, 102, 32, 97, 101, 61, 61, 61,
-39, 115, 116, 114, 105, 110, 103, 39, 41, 41, 123, 10, 97, 101, 61, 40, 97, 101,
-61, 61, 61, 39, 116, 114, 117, 101, 39, 41, 63, 116, 114, 117, 101, 58, 102, 97,
-108, 115, 101, 59, 10, 125, 10, 105, 102, 40, 97, 97, 33, 61, 61, 98, 41, 123,
-10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121,
-40, 97, 111, 44, 97, 97, 44, 97, 101, 41, 59, 10, 125, 10, 125, 10, 102, 111,
-114, 40, 118, 97, 114, 32, 97, 113, 32, 105, 110, 32, 97, 110, 41, 123, 10, 105,
-102, 40, 97, 110, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114,
-116, 121, 40, 97, 113, 41, 41, 123, 10, 118, 97, 114, 32, 97, 101, 61, 98, 59,
-10, 118, 97, 114, 32, 97, 115, 61, 97, 110, 91, 97, 113, 93, 59, 10, 105, 102,
-40, 97, 115, 46, 112, 114, 111, 112, 101, 114, 116, 121, 33, 61, 61, 98, 41,
-123, 10, 97, 101, 61, 90, 40, 97, 115, 46, 112, 114, 111, 112, 101, 114, 116,
-121, 44, 97, 115, 46, 116, 121, 112, 101, 44, 97, 115, 46, 118, 97, 108, 117,
-101, 115, 41, 59, 10, 125, 10, 105, 102, 40, 97, 101, 33, 61, 61, 98, 41, 123,
-10, 97, 114, 40, 97, 115, 46, 112, 114, 111, 112, 101, 114, 116, 121, 44, 97,
-115, 46, 116, 121, 112, 101, 44, 97, 101, 41, 59, 10, 97, 104, 43, 61, 97, 112,
-40, 97, 113, 44, 97, 101, 41, 59, 10, 99, 111, 110, 116, 105, 110, 117, 101, 59,
-10, 125, 10, 105, 102, 40, 97, 106, 46, 104, 97, 115, 79, 119, 110, 80, 114,
-111, 112, 101, 114, 116, 121, 40, 97, 113, 41, 41, 123, 10, 97, 101, 61, 97,
-106, 91, 97, 113, 93, 59, 10, 105, 102, 40, 97, 101, 33, 61, 61, 98, 41, 123,
-10, 97, 114, 40, 97, 115, 46, 112, 114, 111, 112, 101, 114, 116, 121, 44, 97,
-115, 46, 116, 121, 112, 101, 44, 97, 101, 41, 59, 10, 97, 104, 43, 61, 97, 112,
-40, 97, 113, 44, 97, 101, 41, 59, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40,
-97, 115, 46, 116, 121, 112, 101, 61, 61, 61, 39, 98, 111, 111, 108, 101, 97,
-110, 39, 41, 123, 10, 97, 114, 40, 97, 115, 46, 112, 114, 111, 112, 101, 114,
-116, 121, 44, 97, 115, 46, 116, 121, 112, 101, 44, 116, 114, 117, 101, 41, 59,
-10, 97, 104, 43, 61, 97, 112, 40, 97, 113, 44, 116, 114, 117, 101, 41, 59, 10,
-125, 10, 125, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 97, 104,
-61, 61, 61, 39, 39, 63, 39, 39, 58, 39, 45, 117, 39, 43, 97, 104, 59, 10, 125,
-10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 102, 114, 101, 101, 122, 101, 65,
-114, 114, 97, 121, 40, 97, 116, 41, 123, 10, 97, 116, 46, 102, 111, 114, 69, 97,
-99, 104, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 97, 108, 44, 97, 117,
-41, 123, 10, 79, 98, 106, 101, 99, 116, 68, 101, 102, 105, 110, 101, 80, 114,
-111, 112, 101, 114, 116, 121, 40, 97, 116, 44, 97, 117, 44, 123, 118, 97, 108,
-117, 101, 58, 97, 108, 44, 10, 99, 111, 110, 102, 105, 103, 117, 114, 97, 98,
-108, 101, 58, 102, 97, 108, 115, 101, 44, 10, 119, 114, 105, 116, 97, 98, 108,
-101, 58, 102, 97, 108, 115, 101, 44, 10, 101, 110, 117, 109, 101, 114, 97, 98,
-108, 101, 58, 116, 114, 117, 101, 125, 41, 59, 10, 125, 41, 59, 10, 79, 98, 106,
-101, 99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116,
-121, 40, 97, 116, 44, 39, 108, 101, 110, 103, 116, 104, 39, 44, 123, 118, 97,
-108, 117, 101, 58, 97, 116, 46, 108, 101, 110, 103, 116, 104, 44, 10, 119, 114,
-105, 116, 97, 98, 108, 101, 58, 102, 97, 108, 115, 101, 125, 41, 59, 10, 114,
-101, 116, 117, 114, 110, 32, 97, 116, 59, 10, 125, 10, 102, 117, 110, 99, 116,
-105, 111, 110, 32, 103, 101, 116, 79, 112, 116, 105, 109, 97, 108, 76, 97, 110,
-103, 117, 97, 103, 101, 84, 97, 103, 40, 97, 118, 44, 97, 102, 41, 123, 10, 105,
-102, 40, 97, 118, 61, 61, 61, 97, 102, 41, 123, 10, 114, 101, 116, 117, 114,
-110, 32, 97, 118, 59, 10, 125, 10, 118, 97, 114, 32, 79, 61, 37, 71, 101, 116,
-76, 97, 110, 103, 117, 97, 103, 101, 84, 97, 103, 86, 97, 114, 105, 97, 110,
-116, 115, 40, 91, 97, 118, 44, 97, 102, 93, 41, 59, 10, 105, 102, 40, 79, 91,
-48, 93, 46, 109, 97, 120, 105, 109, 105, 122, 101, 100, 33, 61, 61, 79, 91, 49,
-93, 46, 109, 97, 120, 105, 109, 105, 122, 101, 100, 41, 123, 10, 114, 101, 116,
-117, 114, 110, 32, 97, 102, 59, 10, 125, 10, 118, 97, 114, 32, 97, 119, 61, 110,
-101, 119, 32, 36, 82, 101, 103, 69, 120, 112, 40, 39, 94, 39, 43, 79, 91, 49,
-93, 46, 98, 97, 115, 101, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 97, 102,
-46, 114, 101, 112, 108, 97, 99, 101, 40, 97, 119, 44, 79, 91, 48, 93, 46, 98,
-97, 115, 101, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
-103, 101, 116, 65, 118, 97, 105, 108, 97, 98, 108, 101, 76, 111, 99, 97, 108,
-101, 115, 79, 102, 40, 78, 41, 123, 10, 118, 97, 114, 32, 97, 120, 61, 37, 65,
-118, 97, 105, 108, 97, 98, 108, 101, 76, 111, 99, 97, 108, 101, 115, 79, 102,
-40, 78, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 85, 32, 105, 110, 32,
-97, 120, 41, 123, 10, 105, 102, 40, 97, 120, 46, 104, 97, 115, 79, 119, 110, 80,
-114, 111, 112, 101, 114, 116, 121, 40, 85, 41, 41, 123, 10, 118, 97, 114, 32,
-97, 121, 61, 85, 46, 109, 97, 116, 99, 104, 40, 47, 94, 40, 91, 97, 45, 122, 93,
-123, 50, 44, 51, 125, 41, 45, 40, 91, 65, 45, 90, 93, 91, 97, 45, 122, 93, 123,
-51, 125, 41, 45, 40, 91, 65, 45, 90, 93, 123, 50, 125, 41, 36, 47, 41, 59, 10,
-105, 102, 40, 97, 121, 33, 61, 61, 110, 117, 108, 108, 41, 123, 10, 97, 120, 91,
-97, 121, 91, 49, 93, 43, 39, 45, 39, 43, 97, 121, 91, 51, 93, 93, 61, 110, 117,
-108, 108, 59, 10, 125, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
-97, 120, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 100, 101,
-102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 122,
-44, 97, 97, 44, 97, 101, 41, 123, 10, 79, 98, 106, 101, 99, 116, 68, 101, 102,
-105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 122, 44, 97, 97,
-44, 10, 123, 118, 97, 108, 117, 101, 58, 97, 101, 44, 119, 114, 105, 116, 97,
-98, 108, 101, 58, 116, 114, 117, 101, 44, 101, 110, 117, 109, 101, 114, 97, 98,
-108, 101, 58, 116, 114, 117, 101, 125, 41, 59, 10, 125, 10, 102, 117, 110, 99,
-116, 105, 111, 110, 32, 97, 100, 100, 87, 69, 80, 114, 111, 112, 101, 114, 116,
-121, 73, 102, 68, 101, 102, 105, 110, 101, 100, 40, 97, 122, 44, 97, 97, 44, 97,
-101, 41, 123, 10, 105, 102, 40, 97, 101, 33, 61, 61, 98, 41, 123, 10, 100, 101,
-102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 122,
-44, 97, 97, 44, 97, 101, 41, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99, 116,
-105, 111, 110, 32, 100, 101, 102, 105, 110, 101, 87, 69, 67, 80, 114, 111, 112,
-101, 114, 116, 121, 40, 97, 122, 44, 97, 97, 44, 97, 101, 41, 123, 10, 79, 98,
-106, 101, 99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114,
-116, 121, 40, 97, 122, 44, 97, 97, 44, 10, 123, 118, 97, 108, 117, 101, 58, 97,
-101, 44, 10, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44,
-10, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44,
-10, 99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 58, 116, 114, 117,
-101, 125, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97,
-100, 100, 87, 69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 73, 102, 68, 101,
-102, 105, 110, 101, 100, 40, 97, 122, 44, 97, 97, 44, 97, 101, 41, 123, 10, 105,
-102, 40, 97, 101, 33, 61, 61, 98, 41, 123, 10, 100, 101, 102, 105, 110, 101, 87,
-69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 122, 44, 97, 97, 44, 97,
-101, 41, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
-116, 111, 84, 105, 116, 108, 101, 67, 97, 115, 101, 87, 111, 114, 100, 40, 97,
-65, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 97, 65, 46, 115, 117, 98,
-115, 116, 114, 40, 48, 44, 49, 41, 46, 116, 111, 85, 112, 112, 101, 114, 67, 97,
-115, 101, 40, 41, 43, 97, 65, 46, 115, 117, 98, 115, 116, 114, 40, 49, 41, 46,
-116, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 41, 59, 10, 125, 10,
-102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 97, 110, 111, 110, 105, 99, 97,
-108, 105, 122, 101, 76, 97, 110, 103, 117, 97, 103, 101, 84, 97, 103, 40, 97,
-66, 41, 123, 10, 105, 102, 40, 116, 121, 112, 101, 111, 102, 32, 97, 66, 33, 61,
-61, 39, 115, 116, 114, 105, 110, 103, 39, 38, 38, 116, 121, 112, 101, 111, 102,
-32, 97, 66, 33, 61, 61, 39, 111, 98, 106, 101, 99, 116, 39, 124, 124, 10, 40,
-97, 66, 61, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10, 116, 104, 114, 111,
-119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40,
-39, 76, 97, 110, 103, 117, 97, 103, 101, 32, 73, 68, 32, 115, 104, 111, 117,
-108, 100, 32, 98, 101, 32, 115, 116, 114, 105, 110, 103, 32, 111, 114, 32, 111,
-98, 106, 101, 99, 116, 46, 39, 41, 59, 10, 125, 10, 118, 97, 114, 32, 97, 67,
-61, 36, 83, 116, 114, 105, 110, 103, 40, 97, 66, 41, 59, 10, 105, 102, 40, 105,
-115, 86, 97, 108, 105, 100, 76, 97, 110, 103, 117, 97, 103, 101, 84, 97, 103,
-40, 97, 67, 41, 61, 61, 61, 102, 97, 108, 115, 101, 41, 123, 10, 116, 104, 114,
-111, 119, 32, 110, 101, 119, 32, 36, 82, 97, 110, 103, 101, 69, 114, 114, 111,
-114, 40, 39, 73, 110, 118, 97, 108, 105, 100, 32, 108, 97, 110, 103, 117, 97,
-103, 101, 32, 116, 97, 103, 58, 32, 39, 43, 97, 67, 41, 59, 10, 125, 10, 118,
-97, 114, 32, 97, 68, 61, 37, 67, 97, 110, 111, 110, 105, 99, 97, 108, 105, 122,
-101, 76, 97, 110, 103, 117, 97, 103, 101, 84, 97, 103, 40, 97, 67, 41, 59, 10,
-105, 102, 40, 97, 68, 61, 61, 61, 39, 105, 110, 118, 97, 108, 105, 100, 45, 116,
-97, 103, 39, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36,
-82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 73, 110, 118, 97, 108,
-105, 100, 32, 108, 97, 110, 103, 117, 97, 103, 101, 32, 116, 97, 103, 58, 32,
-39, 43, 97, 67, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 97, 68,
-59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 105, 110, 105, 116,
-105, 97, 108, 105, 122, 101, 76, 111, 99, 97, 108, 101, 76, 105, 115, 116, 40,
-79, 41, 123, 10, 118, 97, 114, 32, 97, 69, 61, 91, 93, 59, 10, 105, 102, 40, 79,
-61, 61, 61, 98, 41, 123, 10, 97, 69, 61, 91, 93, 59, 10, 125, 101, 108, 115,
-101, 123, 10, 105, 102, 40, 116, 121, 112, 101, 111, 102, 32, 79, 61, 61, 61,
-39, 115, 116, 114, 105, 110, 103, 39, 41, 123, 10, 97, 69, 46, 112, 117, 115,
-104, 40, 99, 97, 110, 111, 110, 105, 99, 97, 108, 105, 122, 101, 76, 97, 110,
-103, 117, 97, 103, 101, 84, 97, 103, 40, 79, 41, 41, 59, 10, 114, 101, 116, 117,
-114, 110, 32, 102, 114, 101, 101, 122, 101, 65, 114, 114, 97, 121, 40, 97, 69,
-41, 59, 10, 125, 10, 118, 97, 114, 32, 97, 70, 61, 84, 111, 79, 98, 106, 101,
-99, 116, 40, 79, 41, 59, 10, 118, 97, 114, 32, 97, 71, 61, 97, 70, 46, 108, 101,
-110, 103, 116, 104, 62, 62, 62, 48, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32,
-97, 72, 61, 48, 59, 97, 72, 60, 97, 71, 59, 97, 72, 43, 43, 41, 123, 10, 105,
-102, 40, 97, 72, 32, 105, 110, 32, 97, 70, 41, 123, 10, 118, 97, 114, 32, 97,
-101, 61, 97, 70, 91, 97, 72, 93, 59, 10, 118, 97, 114, 32, 97, 68, 61, 99, 97,
-110, 111, 110, 105, 99, 97, 108, 105, 122, 101, 76, 97, 110, 103, 117, 97, 103,
-101, 84, 97, 103, 40, 97, 101, 41, 59, 10, 105, 102, 40, 97, 69, 46, 105, 110,
-100, 101, 120, 79, 102, 40, 97, 68, 41, 61, 61, 61, 45, 49, 41, 123, 10, 97, 69,
-46, 112, 117, 115, 104, 40, 97, 68, 41, 59, 10, 125, 10, 125, 10, 125, 10, 125,
-10, 114, 101, 116, 117, 114, 110, 32, 102, 114, 101, 101, 122, 101, 65, 114,
-114, 97, 121, 40, 97, 69, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111,
-110, 32, 105, 115, 86, 97, 108, 105, 100, 76, 97, 110, 103, 117, 97, 103, 101,
-84, 97, 103, 40, 87, 41, 123, 10, 105, 102, 40, 71, 101, 116, 76, 97, 110, 103,
-117, 97, 103, 101, 84, 97, 103, 82, 69, 40, 41, 46, 116, 101, 115, 116, 40, 87,
-41, 61, 61, 61, 102, 97, 108, 115, 101, 41, 123, 10, 114, 101, 116, 117, 114,
-110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 105, 102, 40, 87, 46, 105,
-110, 100, 101, 120, 79, 102, 40, 39, 120, 45, 39, 41, 61, 61, 61, 48, 41, 123,
-10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 10, 87,
-61, 87, 46, 115, 112, 108, 105, 116, 40, 47, 45, 120, 45, 47, 41, 91, 48, 93,
-59, 10, 118, 97, 114, 32, 97, 73, 61, 91, 93, 59, 10, 118, 97, 114, 32, 97, 74,
-61, 91, 93, 59, 10, 118, 97, 114, 32, 97, 121, 61, 87, 46, 115, 112, 108, 105,
-116, 40, 47, 45, 47, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 85, 61,
-49, 59, 85, 60, 97, 121, 46, 108, 101, 110, 103, 116, 104, 59, 85, 43, 43, 41,
-123, 10, 118, 97, 114, 32, 97, 101, 61, 97, 121, 91, 85, 93, 59, 10, 105, 102,
-40, 71, 101, 116, 76, 97, 110, 103, 117, 97, 103, 101, 86, 97, 114, 105, 97,
-110, 116, 82, 69, 40, 41, 46, 116, 101, 115, 116, 40, 97, 101, 41, 61, 61, 61,
-116, 114, 117, 101, 38, 38, 97, 74, 46, 108, 101, 110, 103, 116, 104, 61, 61,
-61, 48, 41, 123, 10, 105, 102, 40, 97, 73, 46, 105, 110, 100, 101, 120, 79, 102,
-40, 97, 101, 41, 61, 61, 61, 45, 49, 41, 123, 10, 97, 73, 46, 112, 117, 115,
-104, 40, 97, 101, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116,
-117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 125, 10, 105, 102,
-40, 71, 101, 116, 76, 97, 110, 103, 117, 97, 103, 101, 83, 105, 110, 103, 108,
-101, 116, 111, 110, 82, 69, 40, 41, 46, 116, 101, 115, 116, 40, 97, 101, 41, 61,
-61, 61, 116, 114, 117, 101, 41, 123, 10, 105, 102, 40, 97, 74, 46, 105, 110,
-100, 101, 120, 79, 102, 40, 97, 101, 41, 61, 61, 61, 45, 49, 41, 123, 10, 97,
-74, 46, 112, 117, 115, 104, 40, 97, 101, 41, 59, 10, 125, 101, 108, 115, 101,
-123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125,
-10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59,
-10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 66, 117, 105, 108, 100,
-76, 97, 110, 103, 117, 97, 103, 101, 84, 97, 103, 82, 69, 115, 40, 41, 123, 10,
-118, 97, 114, 32, 97, 75, 61, 39, 91, 97, 45, 122, 65, 45, 90, 93, 39, 59, 10,
-118, 97, 114, 32, 97, 76, 61, 39, 91, 48, 45, 57, 93, 39, 59, 10, 118, 97, 114,
-32, 97, 77, 61, 39, 40, 39, 43, 97, 75, 43, 39, 124, 39, 43, 97, 76, 43, 39, 41,
-39, 59, 10, 118, 97, 114, 32, 97, 78, 61, 39, 40, 97, 114, 116, 45, 108, 111,
-106, 98, 97, 110, 124, 99, 101, 108, 45, 103, 97, 117, 108, 105, 115, 104, 124,
-110, 111, 45, 98, 111, 107, 124, 110, 111, 45, 110, 121, 110, 124, 122, 104, 45,
-103, 117, 111, 121, 117, 124, 122, 104, 45, 104, 97, 107, 107, 97, 124, 39, 43,
-10, 39, 122, 104, 45, 109, 105, 110, 124, 122, 104, 45, 109, 105, 110, 45, 110,
-97, 110, 124, 122, 104, 45, 120, 105, 97, 110, 103, 41, 39, 59, 10, 118, 97,
-114, 32, 97, 79, 61, 39, 40, 101, 110, 45, 71, 66, 45, 111, 101, 100, 124, 105,
-45, 97, 109, 105, 124, 105, 45, 98, 110, 110, 124, 105, 45, 100, 101, 102, 97,
-117, 108, 116, 124, 105, 45, 101, 110, 111, 99, 104, 105, 97, 110, 124, 105, 45,
-104, 97, 107, 124, 39, 43, 10, 39, 105, 45, 107, 108, 105, 110, 103, 111, 110,
-124, 105, 45, 108, 117, 120, 124, 105, 45, 109, 105, 110, 103, 111, 124, 105,
-45, 110, 97, 118, 97, 106, 111, 124, 105, 45, 112, 119, 110, 124, 105, 45, 116,
-97, 111, 124, 105, 45, 116, 97, 121, 124, 39, 43, 10, 39, 105, 45, 116, 115,
-117, 124, 115, 103, 110, 45, 66, 69, 45, 70, 82, 124, 115, 103, 110, 45, 66, 69,
-45, 78, 76, 124, 115, 103, 110, 45, 67, 72, 45, 68, 69, 41, 39, 59, 10, 118, 97,
-114, 32, 97, 80, 61, 39, 40, 39, 43, 97, 79, 43, 39, 124, 39, 43, 97, 78, 43,
-39, 41, 39, 59, 10, 118, 97, 114, 32, 97, 81, 61, 39, 40, 120, 40, 45, 39, 43,
-97, 77, 43, 39, 123, 49, 44, 56, 125, 41, 43, 41, 39, 59, 10, 118, 97, 114, 32,
-97, 82, 61, 39, 40, 39, 43, 97, 76, 43, 39, 124, 91, 65, 45, 87, 89, 45, 90, 97,
-45, 119, 121, 45, 122, 93, 41, 39, 59, 10, 113, 61, 110, 101, 119, 32, 36, 82,
-101, 103, 69, 120, 112, 40, 39, 94, 39, 43, 97, 82, 43, 39, 36, 39, 44, 39, 105,
-39, 41, 59, 10, 118, 97, 114, 32, 97, 104, 61, 39, 40, 39, 43, 97, 82, 43, 39,
-40, 45, 39, 43, 97, 77, 43, 39, 123, 50, 44, 56, 125, 41, 43, 41, 39, 59, 10,
-118, 97, 114, 32, 97, 83, 61, 39, 40, 39, 43, 97, 77, 43, 39, 123, 53, 44, 56,
-125, 124, 40, 39, 43, 97, 76, 43, 97, 77, 43, 39, 123, 51, 125, 41, 41, 39, 59,
-10, 111, 61, 110, 101, 119, 32, 36, 82, 101, 103, 69, 120, 112, 40, 39, 94, 39,
-43, 97, 83, 43, 39, 36, 39, 44, 39, 105, 39, 41, 59, 10, 118, 97, 114, 32, 97,
-84, 61, 39, 40, 39, 43, 97, 75, 43, 39, 123, 50, 125, 124, 39, 43, 97, 76, 43,
-39, 123, 51, 125, 41, 39, 59, 10, 118, 97, 114, 32, 97, 85, 61, 39, 40, 39, 43,
-97, 75, 43, 39, 123, 52, 125, 41, 39, 59, 10, 118, 97, 114, 32, 97, 86, 61, 39,
-40, 39, 43, 97, 75, 43, 39, 123, 51, 125, 40, 45, 39, 43, 97, 75, 43, 39, 123,
-51, 125, 41, 123, 48, 44, 50, 125, 41, 39, 59, 10, 118, 97, 114, 32, 97, 87, 61,
-39, 40, 39, 43, 97, 75, 43, 39, 123, 50, 44, 51, 125, 40, 45, 39, 43, 97, 86,
-43, 39, 41, 63, 124, 39, 43, 97, 75, 43, 39, 123, 52, 125, 124, 39, 43, 10, 97,
-75, 43, 39, 123, 53, 44, 56, 125, 41, 39, 59, 10, 118, 97, 114, 32, 97, 88, 61,
-97, 87, 43, 39, 40, 45, 39, 43, 97, 85, 43, 39, 41, 63, 40, 45, 39, 43, 97, 84,
-43, 39, 41, 63, 40, 45, 39, 43, 10, 97, 83, 43, 39, 41, 42, 40, 45, 39, 43, 97,
-104, 43, 39, 41, 42, 40, 45, 39, 43, 97, 81, 43, 39, 41, 63, 39, 59, 10, 118,
-97, 114, 32, 97, 89, 61, 10, 39, 94, 40, 39, 43, 97, 88, 43, 39, 124, 39, 43,
-97, 81, 43, 39, 124, 39, 43, 97, 80, 43, 39, 41, 36, 39, 59, 10, 109, 61, 110,
-101, 119, 32, 36, 82, 101, 103, 69, 120, 112, 40, 97, 89, 44, 39, 105, 39, 41,
-59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 105, 110, 105, 116,
-105, 97, 108, 105, 122, 101, 67, 111, 108, 108, 97, 116, 111, 114, 40, 97, 90,
-44, 79, 44, 80, 41, 123, 10, 105, 102, 40, 37, 73, 115, 73, 110, 105, 116, 105,
-97, 108, 105, 122, 101, 100, 73, 110, 116, 108, 79, 98, 106, 101, 99, 116, 40,
-97, 90, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84,
-121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 84, 114, 121, 105, 110, 103, 32,
-116, 111, 32, 114, 101, 45, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 32,
-67, 111, 108, 108, 97, 116, 111, 114, 32, 111, 98, 106, 101, 99, 116, 46, 39,
-41, 59, 10, 125, 10, 105, 102, 40, 80, 61, 61, 61, 98, 41, 123, 10, 80, 61, 123,
-125, 59, 10, 125, 10, 118, 97, 114, 32, 90, 61, 103, 101, 116, 71, 101, 116, 79,
-112, 116, 105, 111, 110, 40, 80, 44, 39, 99, 111, 108, 108, 97, 116, 111, 114,
-39, 41, 59, 10, 118, 97, 114, 32, 98, 97, 61, 123, 125, 59, 10, 100, 101, 102,
-105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 97, 44,
-39, 117, 115, 97, 103, 101, 39, 44, 90, 40, 10, 39, 117, 115, 97, 103, 101, 39,
-44, 39, 115, 116, 114, 105, 110, 103, 39, 44, 91, 39, 115, 111, 114, 116, 39,
-44, 39, 115, 101, 97, 114, 99, 104, 39, 93, 44, 39, 115, 111, 114, 116, 39, 41,
-41, 59, 10, 118, 97, 114, 32, 98, 98, 61, 90, 40, 39, 115, 101, 110, 115, 105,
-116, 105, 118, 105, 116, 121, 39, 44, 39, 115, 116, 114, 105, 110, 103, 39, 44,
-10, 91, 39, 98, 97, 115, 101, 39, 44, 39, 97, 99, 99, 101, 110, 116, 39, 44, 39,
-99, 97, 115, 101, 39, 44, 39, 118, 97, 114, 105, 97, 110, 116, 39, 93, 41, 59,
-10, 105, 102, 40, 98, 98, 61, 61, 61, 98, 38, 38, 98, 97, 46, 117, 115, 97, 103,
-101, 61, 61, 61, 39, 115, 111, 114, 116, 39, 41, 123, 10, 98, 98, 61, 39, 118,
-97, 114, 105, 97, 110, 116, 39, 59, 10, 125, 10, 100, 101, 102, 105, 110, 101,
-87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 97, 44, 39, 115, 101,
-110, 115, 105, 116, 105, 118, 105, 116, 121, 39, 44, 98, 98, 41, 59, 10, 100,
-101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98,
-97, 44, 39, 105, 103, 110, 111, 114, 101, 80, 117, 110, 99, 116, 117, 97, 116,
-105, 111, 110, 39, 44, 90, 40, 10, 39, 105, 103, 110, 111, 114, 101, 80, 117,
-110, 99, 116, 117, 97, 116, 105, 111, 110, 39, 44, 39, 98, 111, 111, 108, 101,
-97, 110, 39, 44, 98, 44, 102, 97, 108, 115, 101, 41, 41, 59, 10, 118, 97, 114,
-32, 87, 61, 114, 101, 115, 111, 108, 118, 101, 76, 111, 99, 97, 108, 101, 40,
-39, 99, 111, 108, 108, 97, 116, 111, 114, 39, 44, 79, 44, 80, 41, 59, 10, 118,
-97, 114, 32, 97, 106, 61, 112, 97, 114, 115, 101, 69, 120, 116, 101, 110, 115,
-105, 111, 110, 40, 87, 46, 101, 120, 116, 101, 110, 115, 105, 111, 110, 41, 59,
-10, 115, 101, 116, 79, 112, 116, 105, 111, 110, 115, 40, 10, 80, 44, 97, 106,
-44, 119, 44, 90, 44, 98, 97, 41, 59, 10, 118, 97, 114, 32, 98, 99, 61, 39, 100,
-101, 102, 97, 117, 108, 116, 39, 59, 10, 118, 97, 114, 32, 97, 104, 61, 39, 39,
-59, 10, 105, 102, 40, 97, 106, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111,
-112, 101, 114, 116, 121, 40, 39, 99, 111, 39, 41, 38, 38, 98, 97, 46, 117, 115,
-97, 103, 101, 61, 61, 61, 39, 115, 111, 114, 116, 39, 41, 123, 10, 105, 102, 40,
-66, 46, 105, 110, 100, 101, 120, 79, 102, 40, 97, 106, 46, 99, 111, 41, 33, 61,
-61, 45, 49, 41, 123, 10, 97, 104, 61, 39, 45, 117, 45, 99, 111, 45, 39, 43, 97,
-106, 46, 99, 111, 59, 10, 98, 99, 61, 97, 106, 46, 99, 111, 59, 10, 125, 10,
-125, 101, 108, 115, 101, 32, 105, 102, 40, 98, 97, 46, 117, 115, 97, 103, 101,
-61, 61, 61, 39, 115, 101, 97, 114, 99, 104, 39, 41, 123, 10, 97, 104, 61, 39,
-45, 117, 45, 99, 111, 45, 115, 101, 97, 114, 99, 104, 39, 59, 10, 125, 10, 100,
-101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98,
-97, 44, 39, 99, 111, 108, 108, 97, 116, 105, 111, 110, 39, 44, 98, 99, 41, 59,
-10, 118, 97, 114, 32, 98, 100, 61, 87, 46, 108, 111, 99, 97, 108, 101, 43, 97,
-104, 59, 10, 118, 97, 114, 32, 97, 102, 61, 79, 98, 106, 101, 99, 116, 68, 101,
-102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 105, 101, 115, 40, 123,
-125, 44, 123, 10, 99, 97, 115, 101, 70, 105, 114, 115, 116, 58, 123, 119, 114,
-105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 99, 111, 108,
-108, 97, 116, 105, 111, 110, 58, 123, 118, 97, 108, 117, 101, 58, 98, 97, 46,
-99, 111, 108, 108, 97, 116, 105, 111, 110, 44, 119, 114, 105, 116, 97, 98, 108,
-101, 58, 116, 114, 117, 101, 125, 44, 10, 105, 103, 110, 111, 114, 101, 80, 117,
-110, 99, 116, 117, 97, 116, 105, 111, 110, 58, 123, 119, 114, 105, 116, 97, 98,
-108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 108, 111, 99, 97, 108, 101, 58,
-123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10,
-110, 117, 109, 101, 114, 105, 99, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101,
-58, 116, 114, 117, 101, 125, 44, 10, 114, 101, 113, 117, 101, 115, 116, 101,
-100, 76, 111, 99, 97, 108, 101, 58, 123, 118, 97, 108, 117, 101, 58, 98, 100,
-44, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10,
-115, 101, 110, 115, 105, 116, 105, 118, 105, 116, 121, 58, 123, 119, 114, 105,
-116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 115, 116, 114, 101,
-110, 103, 116, 104, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114,
-117, 101, 125, 44, 10, 117, 115, 97, 103, 101, 58, 123, 118, 97, 108, 117, 101,
-58, 98, 97, 46, 117, 115, 97, 103, 101, 44, 119, 114, 105, 116, 97, 98, 108,
-101, 58, 116, 114, 117, 101, 125, 10, 125, 41, 59, 10, 118, 97, 114, 32, 98,
-101, 61, 37, 67, 114, 101, 97, 116, 101, 67, 111, 108, 108, 97, 116, 111, 114,
-40, 98, 100, 44, 10, 98, 97, 44, 10, 97, 102, 41, 59, 10, 37, 77, 97, 114, 107,
-65, 115, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73, 110, 116, 108,
-79, 98, 106, 101, 99, 116, 79, 102, 84, 121, 112, 101, 40, 97, 90, 44, 39, 99,
-111, 108, 108, 97, 116, 111, 114, 39, 44, 98, 101, 41, 59, 10, 79, 98, 106, 101,
-99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40,
-97, 90, 44, 39, 114, 101, 115, 111, 108, 118, 101, 100, 39, 44, 123, 118, 97,
-108, 117, 101, 58, 97, 102, 125, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32,
-97, 90, 59, 10, 125, 10, 37, 65, 100, 100, 80, 114, 111, 112, 101, 114, 116,
-121, 40, 97, 44, 39, 67, 111, 108, 108, 97, 116, 111, 114, 39, 44, 102, 117,
-110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 118, 97, 114, 32, 79, 61, 37, 95,
-65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 48, 41, 59, 10, 118, 97, 114,
-32, 80, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59,
-10, 105, 102, 40, 33, 116, 104, 105, 115, 124, 124, 116, 104, 105, 115, 61, 61,
-61, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 97,
-46, 67, 111, 108, 108, 97, 116, 111, 114, 40, 79, 44, 80, 41, 59, 10, 125, 10,
-114, 101, 116, 117, 114, 110, 32, 105, 110, 105, 116, 105, 97, 108, 105, 122,
-101, 67, 111, 108, 108, 97, 116, 111, 114, 40, 84, 111, 79, 98, 106, 101, 99,
-116, 40, 116, 104, 105, 115, 41, 44, 79, 44, 80, 41, 59, 10, 125, 44, 10, 50,
-10, 41, 59, 10, 37, 65, 100, 100, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97,
-46, 67, 111, 108, 108, 97, 116, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121,
-112, 101, 44, 39, 114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116, 105,
-111, 110, 115, 39, 44, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
-105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67,
-97, 108, 108, 40, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119,
-32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 67, 41, 59, 10, 125, 10,
-105, 102, 40, 33, 37, 73, 115, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101,
-100, 73, 110, 116, 108, 79, 98, 106, 101, 99, 116, 79, 102, 84, 121, 112, 101,
-40, 116, 104, 105, 115, 44, 39, 99, 111, 108, 108, 97, 116, 111, 114, 39, 41,
-41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112,
-101, 69, 114, 114, 111, 114, 40, 39, 114, 101, 115, 111, 108, 118, 101, 100, 79,
-112, 116, 105, 111, 110, 115, 32, 109, 101, 116, 104, 111, 100, 32, 99, 97, 108,
-108, 101, 100, 32, 111, 110, 32, 97, 32, 110, 111, 110, 45, 111, 98, 106, 101,
-99, 116, 32, 39, 43, 10, 39, 111, 114, 32, 111, 110, 32, 97, 32, 111, 98, 106,
-101, 99, 116, 32, 116, 104, 97, 116, 32, 105, 115, 32, 110, 111, 116, 32, 73,
-110, 116, 108, 46, 67, 111, 108, 108, 97, 116, 111, 114, 46, 39, 41, 59, 10,
-125, 10, 118, 97, 114, 32, 98, 102, 61, 116, 104, 105, 115, 59, 10, 118, 97,
-114, 32, 87, 61, 103, 101, 116, 79, 112, 116, 105, 109, 97, 108, 76, 97, 110,
-103, 117, 97, 103, 101, 84, 97, 103, 40, 98, 102, 46, 114, 101, 115, 111, 108,
-118, 101, 100, 46, 114, 101, 113, 117, 101, 115, 116, 101, 100, 76, 111, 99, 97,
-108, 101, 44, 10, 98, 102, 46, 114, 101, 115, 111, 108, 118, 101, 100, 46, 108,
-111, 99, 97, 108, 101, 41, 59, 10, 114, 101, 116, 117, 114, 110, 123, 10, 108,
-111, 99, 97, 108, 101, 58, 87, 44, 10, 117, 115, 97, 103, 101, 58, 98, 102, 46,
-114, 101, 115, 111, 108, 118, 101, 100, 46, 117, 115, 97, 103, 101, 44, 10, 115,
-101, 110, 115, 105, 116, 105, 118, 105, 116, 121, 58, 98, 102, 46, 114, 101,
-115, 111, 108, 118, 101, 100, 46, 115, 101, 110, 115, 105, 116, 105, 118, 105,
-116, 121, 44, 10, 105, 103, 110, 111, 114, 101, 80, 117, 110, 99, 116, 117, 97,
-116, 105, 111, 110, 58, 98, 102, 46, 114, 101, 115, 111, 108, 118, 101, 100, 46,
-105, 103, 110, 111, 114, 101, 80, 117, 110, 99, 116, 117, 97, 116, 105, 111,
-110, 44, 10, 110, 117, 109, 101, 114, 105, 99, 58, 98, 102, 46, 114, 101, 115,
-111, 108, 118, 101, 100, 46, 110, 117, 109, 101, 114, 105, 99, 44, 10, 99, 97,
-115, 101, 70, 105, 114, 115, 116, 58, 98, 102, 46, 114, 101, 115, 111, 108, 118,
-101, 100, 46, 99, 97, 115, 101, 70, 105, 114, 115, 116, 44, 10, 99, 111, 108,
-108, 97, 116, 105, 111, 110, 58, 98, 102, 46, 114, 101, 115, 111, 108, 118, 101,
-100, 46, 99, 111, 108, 108, 97, 116, 105, 111, 110, 10, 125, 59, 10, 125, 44,
-10, 50, 10, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116,
-78, 97, 109, 101, 40, 97, 46, 67, 111, 108, 108, 97, 116, 111, 114, 46, 112,
-114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 115, 111, 108, 118, 101,
-100, 79, 112, 116, 105, 111, 110, 115, 44, 39, 114, 101, 115, 111, 108, 118,
-101, 100, 79, 112, 116, 105, 111, 110, 115, 39, 41, 59, 10, 37, 70, 117, 110,
-99, 116, 105, 111, 110, 82, 101, 109, 111, 118, 101, 80, 114, 111, 116, 111,
-116, 121, 112, 101, 40, 97, 46, 67, 111, 108, 108, 97, 116, 111, 114, 46, 112,
-114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 115, 111, 108, 118, 101,
-100, 79, 112, 116, 105, 111, 110, 115, 41, 59, 10, 37, 83, 101, 116, 78, 97,
-116, 105, 118, 101, 70, 108, 97, 103, 40, 97, 46, 67, 111, 108, 108, 97, 116,
-111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 115,
-111, 108, 118, 101, 100, 79, 112, 116, 105, 111, 110, 115, 41, 59, 10, 37, 65,
-100, 100, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 46, 67, 111, 108, 108,
-97, 116, 111, 114, 44, 39, 115, 117, 112, 112, 111, 114, 116, 101, 100, 76, 111,
-99, 97, 108, 101, 115, 79, 102, 39, 44, 102, 117, 110, 99, 116, 105, 111, 110,
-40, 79, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114,
-117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 116, 104, 114, 111, 119,
-32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 67,
-41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 115, 117, 112, 112, 111,
-114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 40, 39, 99, 111,
-108, 108, 97, 116, 111, 114, 39, 44, 79, 44, 37, 95, 65, 114, 103, 117, 109,
-101, 110, 116, 115, 40, 49, 41, 41, 59, 10, 125, 44, 10, 50, 10, 41, 59, 10, 37,
-70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 78, 97, 109, 101, 40, 97,
-46, 67, 111, 108, 108, 97, 116, 111, 114, 46, 115, 117, 112, 112, 111, 114, 116,
-101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 44, 39, 115, 117, 112, 112,
-111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 39, 41, 59,
-10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 82, 101, 109, 111, 118, 101, 80,
-114, 111, 116, 111, 116, 121, 112, 101, 40, 97, 46, 67, 111, 108, 108, 97, 116,
-111, 114, 46, 115, 117, 112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108,
-101, 115, 79, 102, 41, 59, 10, 37, 83, 101, 116, 78, 97, 116, 105, 118, 101, 70,
-108, 97, 103, 40, 97, 46, 67, 111, 108, 108, 97, 116, 111, 114, 46, 115, 117,
-112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 41,
-59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 111, 109, 112, 97, 114,
-101, 40, 97, 90, 44, 76, 44, 77, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
-37, 73, 110, 116, 101, 114, 110, 97, 108, 67, 111, 109, 112, 97, 114, 101, 40,
-37, 71, 101, 116, 73, 109, 112, 108, 70, 114, 111, 109, 73, 110, 105, 116, 105,
-97, 108, 105, 122, 101, 100, 73, 110, 116, 108, 79, 98, 106, 101, 99, 116, 40,
-97, 90, 41, 44, 10, 36, 83, 116, 114, 105, 110, 103, 40, 76, 41, 44, 36, 83,
-116, 114, 105, 110, 103, 40, 77, 41, 41, 59, 10, 125, 59, 10, 97, 100, 100, 66,
-111, 117, 110, 100, 77, 101, 116, 104, 111, 100, 40, 97, 46, 67, 111, 108, 108,
-97, 116, 111, 114, 44, 39, 99, 111, 109, 112, 97, 114, 101, 39, 44, 99, 111,
-109, 112, 97, 114, 101, 44, 50, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111,
-110, 32, 105, 115, 87, 101, 108, 108, 70, 111, 114, 109, 101, 100, 67, 117, 114,
-114, 101, 110, 99, 121, 67, 111, 100, 101, 40, 98, 103, 41, 123, 10, 114, 101,
-116, 117, 114, 110, 32, 116, 121, 112, 101, 111, 102, 32, 98, 103, 61, 61, 34,
-115, 116, 114, 105, 110, 103, 34, 38, 38, 10, 98, 103, 46, 108, 101, 110, 103,
-116, 104, 61, 61, 51, 38, 38, 10, 98, 103, 46, 109, 97, 116, 99, 104, 40, 47,
-91, 94, 65, 45, 90, 97, 45, 122, 93, 47, 41, 61, 61, 110, 117, 108, 108, 59, 10,
-125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 103, 101, 116, 78, 117, 109,
-98, 101, 114, 79, 112, 116, 105, 111, 110, 40, 80, 44, 97, 97, 44, 98, 104, 44,
-98, 105, 44, 98, 106, 41, 123, 10, 118, 97, 114, 32, 97, 101, 61, 80, 91, 97,
-97, 93, 59, 10, 105, 102, 40, 97, 101, 33, 61, 61, 98, 41, 123, 10, 97, 101, 61,
-36, 78, 117, 109, 98, 101, 114, 40, 97, 101, 41, 59, 10, 105, 102, 40, 36, 105,
-115, 78, 97, 78, 40, 97, 101, 41, 124, 124, 97, 101, 60, 98, 104, 124, 124, 97,
-101, 62, 98, 105, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32,
-36, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 97, 97, 43, 39, 32, 118,
-97, 108, 117, 101, 32, 105, 115, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97,
-110, 103, 101, 46, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
-36, 102, 108, 111, 111, 114, 40, 97, 101, 41, 59, 10, 125, 10, 114, 101, 116,
-117, 114, 110, 32, 98, 106, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111,
-110, 32, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 78, 117, 109, 98, 101,
-114, 70, 111, 114, 109, 97, 116, 40, 98, 107, 44, 79, 44, 80, 41, 123, 10, 105,
-102, 40, 37, 73, 115, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73,
-110, 116, 108, 79, 98, 106, 101, 99, 116, 40, 98, 107, 41, 41, 123, 10, 116,
-104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114,
-111, 114, 40, 39, 84, 114, 121, 105, 110, 103, 32, 116, 111, 32, 114, 101, 45,
-105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 32, 78, 117, 109, 98, 101, 114,
-70, 111, 114, 109, 97, 116, 32, 111, 98, 106, 101, 99, 116, 46, 39, 41, 59, 10,
-125, 10, 105, 102, 40, 80, 61, 61, 61, 98, 41, 123, 10, 80, 61, 123, 125, 59,
-10, 125, 10, 118, 97, 114, 32, 90, 61, 103, 101, 116, 71, 101, 116, 79, 112,
-116, 105, 111, 110, 40, 80, 44, 39, 110, 117, 109, 98, 101, 114, 102, 111, 114,
-109, 97, 116, 39, 41, 59, 10, 118, 97, 114, 32, 87, 61, 114, 101, 115, 111, 108,
-118, 101, 76, 111, 99, 97, 108, 101, 40, 39, 110, 117, 109, 98, 101, 114, 102,
-111, 114, 109, 97, 116, 39, 44, 79, 44, 80, 41, 59, 10, 118, 97, 114, 32, 98,
-97, 61, 123, 125, 59, 10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111,
-112, 101, 114, 116, 121, 40, 98, 97, 44, 39, 115, 116, 121, 108, 101, 39, 44,
-90, 40, 10, 39, 115, 116, 121, 108, 101, 39, 44, 39, 115, 116, 114, 105, 110,
-103, 39, 44, 91, 39, 100, 101, 99, 105, 109, 97, 108, 39, 44, 39, 112, 101, 114,
-99, 101, 110, 116, 39, 44, 39, 99, 117, 114, 114, 101, 110, 99, 121, 39, 93, 44,
-39, 100, 101, 99, 105, 109, 97, 108, 39, 41, 41, 59, 10, 118, 97, 114, 32, 98,
-103, 61, 90, 40, 39, 99, 117, 114, 114, 101, 110, 99, 121, 39, 44, 39, 115, 116,
-114, 105, 110, 103, 39, 41, 59, 10, 105, 102, 40, 98, 103, 33, 61, 61, 98, 38,
-38, 33, 105, 115, 87, 101, 108, 108, 70, 111, 114, 109, 101, 100, 67, 117, 114,
-114, 101, 110, 99, 121, 67, 111, 100, 101, 40, 98, 103, 41, 41, 123, 10, 116,
-104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 82, 97, 110, 103, 101, 69, 114,
-114, 111, 114, 40, 39, 73, 110, 118, 97, 108, 105, 100, 32, 99, 117, 114, 114,
-101, 110, 99, 121, 32, 99, 111, 100, 101, 58, 32, 39, 43, 98, 103, 41, 59, 10,
-125, 10, 105, 102, 40, 98, 97, 46, 115, 116, 121, 108, 101, 61, 61, 61, 39, 99,
-117, 114, 114, 101, 110, 99, 121, 39, 38, 38, 98, 103, 61, 61, 61, 98, 41, 123,
-10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69,
-114, 114, 111, 114, 40, 39, 67, 117, 114, 114, 101, 110, 99, 121, 32, 99, 111,
-100, 101, 32, 105, 115, 32, 114, 101, 113, 117, 105, 114, 101, 100, 32, 119,
-105, 116, 104, 32, 99, 117, 114, 114, 101, 110, 99, 121, 32, 115, 116, 121, 108,
-101, 46, 39, 41, 59, 10, 125, 10, 118, 97, 114, 32, 98, 108, 61, 90, 40, 10, 39,
-99, 117, 114, 114, 101, 110, 99, 121, 68, 105, 115, 112, 108, 97, 121, 39, 44,
-39, 115, 116, 114, 105, 110, 103, 39, 44, 91, 39, 99, 111, 100, 101, 39, 44, 39,
-115, 121, 109, 98, 111, 108, 39, 44, 39, 110, 97, 109, 101, 39, 93, 44, 39, 115,
-121, 109, 98, 111, 108, 39, 41, 59, 10, 105, 102, 40, 98, 97, 46, 115, 116, 121,
-108, 101, 61, 61, 61, 39, 99, 117, 114, 114, 101, 110, 99, 121, 39, 41, 123, 10,
-100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40,
-98, 97, 44, 39, 99, 117, 114, 114, 101, 110, 99, 121, 39, 44, 98, 103, 46, 116,
-111, 85, 112, 112, 101, 114, 67, 97, 115, 101, 40, 41, 41, 59, 10, 100, 101,
-102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 97,
-44, 39, 99, 117, 114, 114, 101, 110, 99, 121, 68, 105, 115, 112, 108, 97, 121,
-39, 44, 98, 108, 41, 59, 10, 125, 10, 118, 97, 114, 32, 98, 109, 61, 103, 101,
-116, 78, 117, 109, 98, 101, 114, 79, 112, 116, 105, 111, 110, 40, 80, 44, 39,
-109, 105, 110, 105, 109, 117, 109, 73, 110, 116, 101, 103, 101, 114, 68, 105,
-103, 105, 116, 115, 39, 44, 49, 44, 50, 49, 44, 49, 41, 59, 10, 100, 101, 102,
-105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 97, 44,
-39, 109, 105, 110, 105, 109, 117, 109, 73, 110, 116, 101, 103, 101, 114, 68,
-105, 103, 105, 116, 115, 39, 44, 98, 109, 41, 59, 10, 118, 97, 114, 32, 98, 110,
-61, 103, 101, 116, 78, 117, 109, 98, 101, 114, 79, 112, 116, 105, 111, 110, 40,
-80, 44, 39, 109, 105, 110, 105, 109, 117, 109, 70, 114, 97, 99, 116, 105, 111,
-110, 68, 105, 103, 105, 116, 115, 39, 44, 48, 44, 50, 48, 44, 48, 41, 59, 10,
-100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40,
-98, 97, 44, 39, 109, 105, 110, 105, 109, 117, 109, 70, 114, 97, 99, 116, 105,
-111, 110, 68, 105, 103, 105, 116, 115, 39, 44, 98, 110, 41, 59, 10, 118, 97,
-114, 32, 98, 111, 61, 103, 101, 116, 78, 117, 109, 98, 101, 114, 79, 112, 116,
-105, 111, 110, 40, 80, 44, 39, 109, 97, 120, 105, 109, 117, 109, 70, 114, 97,
-99, 116, 105, 111, 110, 68, 105, 103, 105, 116, 115, 39, 44, 98, 110, 44, 50,
-48, 44, 51, 41, 59, 10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112,
-101, 114, 116, 121, 40, 98, 97, 44, 39, 109, 97, 120, 105, 109, 117, 109, 70,
-114, 97, 99, 116, 105, 111, 110, 68, 105, 103, 105, 116, 115, 39, 44, 98, 111,
-41, 59, 10, 118, 97, 114, 32, 98, 112, 61, 80, 91, 39, 109, 105, 110, 105, 109,
-117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68, 105, 103, 105,
-116, 115, 39, 93, 59, 10, 118, 97, 114, 32, 98, 113, 61, 80, 91, 39, 109, 97,
-120, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68,
-105, 103, 105, 116, 115, 39, 93, 59, 10, 105, 102, 40, 98, 112, 33, 61, 61, 98,
-124, 124, 98, 113, 33, 61, 61, 98, 41, 123, 10, 98, 112, 61, 103, 101, 116, 78,
-117, 109, 98, 101, 114, 79, 112, 116, 105, 111, 110, 40, 80, 44, 39, 109, 105,
-110, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68,
-105, 103, 105, 116, 115, 39, 44, 49, 44, 50, 49, 44, 48, 41, 59, 10, 100, 101,
-102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 97,
-44, 39, 109, 105, 110, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99,
-97, 110, 116, 68, 105, 103, 105, 116, 115, 39, 44, 98, 112, 41, 59, 10, 98, 113,
-61, 103, 101, 116, 78, 117, 109, 98, 101, 114, 79, 112, 116, 105, 111, 110, 40,
-80, 44, 39, 109, 97, 120, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105,
-99, 97, 110, 116, 68, 105, 103, 105, 116, 115, 39, 44, 98, 112, 44, 50, 49, 44,
-50, 49, 41, 59, 10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112,
-101, 114, 116, 121, 40, 98, 97, 44, 39, 109, 97, 120, 105, 109, 117, 109, 83,
-105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68, 105, 103, 105, 116, 115, 39,
-44, 98, 113, 41, 59, 10, 125, 10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114,
-111, 112, 101, 114, 116, 121, 40, 98, 97, 44, 39, 117, 115, 101, 71, 114, 111,
-117, 112, 105, 110, 103, 39, 44, 90, 40, 10, 39, 117, 115, 101, 71, 114, 111,
-117, 112, 105, 110, 103, 39, 44, 39, 98, 111, 111, 108, 101, 97, 110, 39, 44,
-98, 44, 116, 114, 117, 101, 41, 41, 59, 10, 118, 97, 114, 32, 97, 106, 61, 112,
-97, 114, 115, 101, 69, 120, 116, 101, 110, 115, 105, 111, 110, 40, 87, 46, 101,
-120, 116, 101, 110, 115, 105, 111, 110, 41, 59, 10, 118, 97, 114, 32, 97, 104,
-61, 115, 101, 116, 79, 112, 116, 105, 111, 110, 115, 40, 80, 44, 97, 106, 44,
-122, 44, 10, 90, 44, 98, 97, 41, 59, 10, 118, 97, 114, 32, 98, 100, 61, 87, 46,
-108, 111, 99, 97, 108, 101, 43, 97, 104, 59, 10, 118, 97, 114, 32, 97, 102, 61,
-79, 98, 106, 101, 99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101,
-114, 116, 105, 101, 115, 40, 123, 125, 44, 123, 10, 99, 117, 114, 114, 101, 110,
-99, 121, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101,
-125, 44, 10, 99, 117, 114, 114, 101, 110, 99, 121, 68, 105, 115, 112, 108, 97,
-121, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125,
-44, 10, 108, 111, 99, 97, 108, 101, 58, 123, 119, 114, 105, 116, 97, 98, 108,
-101, 58, 116, 114, 117, 101, 125, 44, 10, 109, 97, 120, 105, 109, 117, 109, 70,
-114, 97, 99, 116, 105, 111, 110, 68, 105, 103, 105, 116, 115, 58, 123, 119, 114,
-105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 109, 105, 110,
-105, 109, 117, 109, 70, 114, 97, 99, 116, 105, 111, 110, 68, 105, 103, 105, 116,
-115, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125,
-44, 10, 109, 105, 110, 105, 109, 117, 109, 73, 110, 116, 101, 103, 101, 114, 68,
-105, 103, 105, 116, 115, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116,
-114, 117, 101, 125, 44, 10, 110, 117, 109, 98, 101, 114, 105, 110, 103, 83, 121,
-115, 116, 101, 109, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114,
-117, 101, 125, 44, 10, 114, 101, 113, 117, 101, 115, 116, 101, 100, 76, 111, 99,
-97, 108, 101, 58, 123, 118, 97, 108, 117, 101, 58, 98, 100, 44, 119, 114, 105,
-116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 115, 116, 121, 108,
-101, 58, 123, 118, 97, 108, 117, 101, 58, 98, 97, 46, 115, 116, 121, 108, 101,
-44, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10,
-117, 115, 101, 71, 114, 111, 117, 112, 105, 110, 103, 58, 123, 119, 114, 105,
-116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 10, 125, 41, 59, 10, 105,
-102, 40, 98, 97, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114,
-116, 121, 40, 39, 109, 105, 110, 105, 109, 117, 109, 83, 105, 103, 110, 105,
-102, 105, 99, 97, 110, 116, 68, 105, 103, 105, 116, 115, 39, 41, 41, 123, 10,
-100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40,
-97, 102, 44, 39, 109, 105, 110, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102,
-105, 99, 97, 110, 116, 68, 105, 103, 105, 116, 115, 39, 44, 98, 41, 59, 10, 125,
-10, 105, 102, 40, 98, 97, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112,
-101, 114, 116, 121, 40, 39, 109, 97, 120, 105, 109, 117, 109, 83, 105, 103, 110,
-105, 102, 105, 99, 97, 110, 116, 68, 105, 103, 105, 116, 115, 39, 41, 41, 123,
-10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121,
-40, 97, 102, 44, 39, 109, 97, 120, 105, 109, 117, 109, 83, 105, 103, 110, 105,
-102, 105, 99, 97, 110, 116, 68, 105, 103, 105, 116, 115, 39, 44, 98, 41, 59, 10,
-125, 10, 118, 97, 114, 32, 98, 114, 61, 37, 67, 114, 101, 97, 116, 101, 78, 117,
-109, 98, 101, 114, 70, 111, 114, 109, 97, 116, 40, 98, 100, 44, 10, 98, 97, 44,
-10, 97, 102, 41, 59, 10, 105, 102, 40, 98, 97, 46, 115, 116, 121, 108, 101, 61,
-61, 61, 39, 99, 117, 114, 114, 101, 110, 99, 121, 39, 41, 123, 10, 79, 98, 106,
-101, 99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116,
-121, 40, 97, 102, 44, 39, 99, 117, 114, 114, 101, 110, 99, 121, 68, 105, 115,
-112, 108, 97, 121, 39, 44, 123, 118, 97, 108, 117, 101, 58, 98, 108, 44, 10,
-119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 41, 59, 10,
-125, 10, 37, 77, 97, 114, 107, 65, 115, 73, 110, 105, 116, 105, 97, 108, 105,
-122, 101, 100, 73, 110, 116, 108, 79, 98, 106, 101, 99, 116, 79, 102, 84, 121,
-112, 101, 40, 98, 107, 44, 39, 110, 117, 109, 98, 101, 114, 102, 111, 114, 109,
-97, 116, 39, 44, 98, 114, 41, 59, 10, 79, 98, 106, 101, 99, 116, 68, 101, 102,
-105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 107, 44, 39, 114,
-101, 115, 111, 108, 118, 101, 100, 39, 44, 123, 118, 97, 108, 117, 101, 58, 97,
-102, 125, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 98, 107, 59, 10, 125,
-10, 37, 65, 100, 100, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 44, 39, 78,
-117, 109, 98, 101, 114, 70, 111, 114, 109, 97, 116, 39, 44, 102, 117, 110, 99,
-116, 105, 111, 110, 40, 41, 123, 10, 118, 97, 114, 32, 79, 61, 37, 95, 65, 114,
-103, 117, 109, 101, 110, 116, 115, 40, 48, 41, 59, 10, 118, 97, 114, 32, 80, 61,
-37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 105,
-102, 40, 33, 116, 104, 105, 115, 124, 124, 116, 104, 105, 115, 61, 61, 61, 97,
-41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 97, 46, 78,
-117, 109, 98, 101, 114, 70, 111, 114, 109, 97, 116, 40, 79, 44, 80, 41, 59, 10,
-125, 10, 114, 101, 116, 117, 114, 110, 32, 105, 110, 105, 116, 105, 97, 108,
-105, 122, 101, 78, 117, 109, 98, 101, 114, 70, 111, 114, 109, 97, 116, 40, 84,
-111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 44, 79, 44, 80, 41,
-59, 10, 125, 44, 10, 50, 10, 41, 59, 10, 37, 65, 100, 100, 80, 114, 111, 112,
-101, 114, 116, 121, 40, 97, 46, 78, 117, 109, 98, 101, 114, 70, 111, 114, 109,
-97, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 39, 114, 101, 115,
-111, 108, 118, 101, 100, 79, 112, 116, 105, 111, 110, 115, 39, 44, 102, 117,
-110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67,
-111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10,
-116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114,
-114, 111, 114, 40, 67, 41, 59, 10, 125, 10, 105, 102, 40, 33, 37, 73, 115, 73,
-110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73, 110, 116, 108, 79, 98, 106,
-101, 99, 116, 79, 102, 84, 121, 112, 101, 40, 116, 104, 105, 115, 44, 39, 110,
-117, 109, 98, 101, 114, 102, 111, 114, 109, 97, 116, 39, 41, 41, 123, 10, 116,
-104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114,
-111, 114, 40, 39, 114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116, 105,
-111, 110, 115, 32, 109, 101, 116, 104, 111, 100, 32, 99, 97, 108, 108, 101, 100,
-32, 111, 110, 32, 97, 32, 110, 111, 110, 45, 111, 98, 106, 101, 99, 116, 39, 43,
-10, 39, 32, 111, 114, 32, 111, 110, 32, 97, 32, 111, 98, 106, 101, 99, 116, 32,
-116, 104, 97, 116, 32, 105, 115, 32, 110, 111, 116, 32, 73, 110, 116, 108, 46,
-78, 117, 109, 98, 101, 114, 70, 111, 114, 109, 97, 116, 46, 39, 41, 59, 10, 125,
-10, 118, 97, 114, 32, 98, 115, 61, 116, 104, 105, 115, 59, 10, 118, 97, 114, 32,
-87, 61, 103, 101, 116, 79, 112, 116, 105, 109, 97, 108, 76, 97, 110, 103, 117,
-97, 103, 101, 84, 97, 103, 40, 98, 115, 46, 114, 101, 115, 111, 108, 118, 101,
-100, 46, 114, 101, 113, 117, 101, 115, 116, 101, 100, 76, 111, 99, 97, 108, 101,
-44, 10, 98, 115, 46, 114, 101, 115, 111, 108, 118, 101, 100, 46, 108, 111, 99,
-97, 108, 101, 41, 59, 10, 118, 97, 114, 32, 98, 116, 61, 123, 10, 108, 111, 99,
-97, 108, 101, 58, 87, 44, 10, 110, 117, 109, 98, 101, 114, 105, 110, 103, 83,
-121, 115, 116, 101, 109, 58, 98, 115, 46, 114, 101, 115, 111, 108, 118, 101,
-100, 46, 110, 117, 109, 98, 101, 114, 105, 110, 103, 83, 121, 115, 116, 101,
-109, 44, 10, 115, 116, 121, 108, 101, 58, 98, 115, 46, 114, 101, 115, 111, 108,
-118, 101, 100, 46, 115, 116, 121, 108, 101, 44, 10, 117, 115, 101, 71, 114, 111,
-117, 112, 105, 110, 103, 58, 98, 115, 46, 114, 101, 115, 111, 108, 118, 101,
-100, 46, 117, 115, 101, 71, 114, 111, 117, 112, 105, 110, 103, 44, 10, 109, 105,
-110, 105, 109, 117, 109, 73, 110, 116, 101, 103, 101, 114, 68, 105, 103, 105,
-116, 115, 58, 98, 115, 46, 114, 101, 115, 111, 108, 118, 101, 100, 46, 109, 105,
-110, 105, 109, 117, 109, 73, 110, 116, 101, 103, 101, 114, 68, 105, 103, 105,
-116, 115, 44, 10, 109, 105, 110, 105, 109, 117, 109, 70, 114, 97, 99, 116, 105,
-111, 110, 68, 105, 103, 105, 116, 115, 58, 98, 115, 46, 114, 101, 115, 111, 108,
-118, 101, 100, 46, 109, 105, 110, 105, 109, 117, 109, 70, 114, 97, 99, 116, 105,
-111, 110, 68, 105, 103, 105, 116, 115, 44, 10, 109, 97, 120, 105, 109, 117, 109,
-70, 114, 97, 99, 116, 105, 111, 110, 68, 105, 103, 105, 116, 115, 58, 98, 115,
-46, 114, 101, 115, 111, 108, 118, 101, 100, 46, 109, 97, 120, 105, 109, 117,
-109, 70, 114, 97, 99, 116, 105, 111, 110, 68, 105, 103, 105, 116, 115, 44, 10,
-125, 59, 10, 105, 102, 40, 98, 116, 46, 115, 116, 121, 108, 101, 61, 61, 61, 39,
-99, 117, 114, 114, 101, 110, 99, 121, 39, 41, 123, 10, 100, 101, 102, 105, 110,
-101, 87, 69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 116, 44, 39, 99,
-117, 114, 114, 101, 110, 99, 121, 39, 44, 98, 115, 46, 114, 101, 115, 111, 108,
-118, 101, 100, 46, 99, 117, 114, 114, 101, 110, 99, 121, 41, 59, 10, 100, 101,
-102, 105, 110, 101, 87, 69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98,
-116, 44, 39, 99, 117, 114, 114, 101, 110, 99, 121, 68, 105, 115, 112, 108, 97,
-121, 39, 44, 10, 98, 115, 46, 114, 101, 115, 111, 108, 118, 101, 100, 46, 99,
-117, 114, 114, 101, 110, 99, 121, 68, 105, 115, 112, 108, 97, 121, 41, 59, 10,
-125, 10, 105, 102, 40, 98, 115, 46, 114, 101, 115, 111, 108, 118, 101, 100, 46,
-104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 39, 109,
-105, 110, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110,
-116, 68, 105, 103, 105, 116, 115, 39, 41, 41, 123, 10, 100, 101, 102, 105, 110,
-101, 87, 69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 116, 44, 39,
-109, 105, 110, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97,
-110, 116, 68, 105, 103, 105, 116, 115, 39, 44, 10, 98, 115, 46, 114, 101, 115,
-111, 108, 118, 101, 100, 46, 109, 105, 110, 105, 109, 117, 109, 83, 105, 103,
-110, 105, 102, 105, 99, 97, 110, 116, 68, 105, 103, 105, 116, 115, 41, 59, 10,
-125, 10, 105, 102, 40, 98, 115, 46, 114, 101, 115, 111, 108, 118, 101, 100, 46,
-104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 39, 109,
-97, 120, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116,
-68, 105, 103, 105, 116, 115, 39, 41, 41, 123, 10, 100, 101, 102, 105, 110, 101,
-87, 69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 116, 44, 39, 109, 97,
-120, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 68,
-105, 103, 105, 116, 115, 39, 44, 10, 98, 115, 46, 114, 101, 115, 111, 108, 118,
-101, 100, 46, 109, 97, 120, 105, 109, 117, 109, 83, 105, 103, 110, 105, 102,
-105, 99, 97, 110, 116, 68, 105, 103, 105, 116, 115, 41, 59, 10, 125, 10, 114,
-101, 116, 117, 114, 110, 32, 98, 116, 59, 10, 125, 44, 10, 50, 10, 41, 59, 10,
-37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 78, 97, 109, 101, 40,
-97, 46, 78, 117, 109, 98, 101, 114, 70, 111, 114, 109, 97, 116, 46, 112, 114,
-111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 115, 111, 108, 118, 101, 100,
-79, 112, 116, 105, 111, 110, 115, 44, 10, 39, 114, 101, 115, 111, 108, 118, 101,
-100, 79, 112, 116, 105, 111, 110, 115, 39, 41, 59, 10, 37, 70, 117, 110, 99,
-116, 105, 111, 110, 82, 101, 109, 111, 118, 101, 80, 114, 111, 116, 111, 116,
-121, 112, 101, 40, 97, 46, 78, 117, 109, 98, 101, 114, 70, 111, 114, 109, 97,
-116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 115, 111,
-108, 118, 101, 100, 79, 112, 116, 105, 111, 110, 115, 41, 59, 10, 37, 83, 101,
-116, 78, 97, 116, 105, 118, 101, 70, 108, 97, 103, 40, 97, 46, 78, 117, 109, 98,
-101, 114, 70, 111, 114, 109, 97, 116, 46, 112, 114, 111, 116, 111, 116, 121,
-112, 101, 46, 114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116, 105, 111,
-110, 115, 41, 59, 10, 37, 65, 100, 100, 80, 114, 111, 112, 101, 114, 116, 121,
-40, 97, 46, 78, 117, 109, 98, 101, 114, 70, 111, 114, 109, 97, 116, 44, 39, 115,
-117, 112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102,
-39, 44, 102, 117, 110, 99, 116, 105, 111, 110, 40, 79, 41, 123, 10, 105, 102,
-40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108,
-108, 40, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36,
-84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 67, 41, 59, 10, 125, 10, 114,
-101, 116, 117, 114, 110, 32, 115, 117, 112, 112, 111, 114, 116, 101, 100, 76,
-111, 99, 97, 108, 101, 115, 79, 102, 40, 39, 110, 117, 109, 98, 101, 114, 102,
-111, 114, 109, 97, 116, 39, 44, 79, 44, 37, 95, 65, 114, 103, 117, 109, 101,
-110, 116, 115, 40, 49, 41, 41, 59, 10, 125, 44, 10, 50, 10, 41, 59, 10, 37, 70,
-117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 78, 97, 109, 101, 40, 97, 46,
-78, 117, 109, 98, 101, 114, 70, 111, 114, 109, 97, 116, 46, 115, 117, 112, 112,
-111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 44, 39, 115,
-117, 112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102,
-39, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 82, 101, 109, 111,
-118, 101, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 97, 46, 78, 117, 109,
-98, 101, 114, 70, 111, 114, 109, 97, 116, 46, 115, 117, 112, 112, 111, 114, 116,
-101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 41, 59, 10, 37, 83, 101, 116,
-78, 97, 116, 105, 118, 101, 70, 108, 97, 103, 40, 97, 46, 78, 117, 109, 98, 101,
-114, 70, 111, 114, 109, 97, 116, 46, 115, 117, 112, 112, 111, 114, 116, 101,
-100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 41, 59, 10, 102, 117, 110, 99,
-116, 105, 111, 110, 32, 102, 111, 114, 109, 97, 116, 78, 117, 109, 98, 101, 114,
-40, 98, 114, 44, 97, 101, 41, 123, 10, 118, 97, 114, 32, 98, 117, 61, 36, 78,
-117, 109, 98, 101, 114, 40, 97, 101, 41, 43, 48, 59, 10, 114, 101, 116, 117,
-114, 110, 32, 37, 73, 110, 116, 101, 114, 110, 97, 108, 78, 117, 109, 98, 101,
-114, 70, 111, 114, 109, 97, 116, 40, 37, 71, 101, 116, 73, 109, 112, 108, 70,
-114, 111, 109, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73, 110,
-116, 108, 79, 98, 106, 101, 99, 116, 40, 98, 114, 41, 44, 10, 98, 117, 41, 59,
-10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 112, 97, 114, 115, 101,
-78, 117, 109, 98, 101, 114, 40, 98, 114, 44, 97, 101, 41, 123, 10, 114, 101,
-116, 117, 114, 110, 32, 37, 73, 110, 116, 101, 114, 110, 97, 108, 78, 117, 109,
-98, 101, 114, 80, 97, 114, 115, 101, 40, 37, 71, 101, 116, 73, 109, 112, 108,
-70, 114, 111, 109, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73, 110,
-116, 108, 79, 98, 106, 101, 99, 116, 40, 98, 114, 41, 44, 10, 36, 83, 116, 114,
-105, 110, 103, 40, 97, 101, 41, 41, 59, 10, 125, 10, 97, 100, 100, 66, 111, 117,
-110, 100, 77, 101, 116, 104, 111, 100, 40, 97, 46, 78, 117, 109, 98, 101, 114,
-70, 111, 114, 109, 97, 116, 44, 39, 102, 111, 114, 109, 97, 116, 39, 44, 102,
-111, 114, 109, 97, 116, 78, 117, 109, 98, 101, 114, 44, 49, 41, 59, 10, 97, 100,
-100, 66, 111, 117, 110, 100, 77, 101, 116, 104, 111, 100, 40, 97, 46, 78, 117,
-109, 98, 101, 114, 70, 111, 114, 109, 97, 116, 44, 39, 118, 56, 80, 97, 114,
-115, 101, 39, 44, 112, 97, 114, 115, 101, 78, 117, 109, 98, 101, 114, 44, 49,
-41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 111, 76, 68, 77, 76,
-83, 116, 114, 105, 110, 103, 40, 80, 41, 123, 10, 118, 97, 114, 32, 90, 61, 103,
-101, 116, 71, 101, 116, 79, 112, 116, 105, 111, 110, 40, 80, 44, 39, 100, 97,
-116, 101, 102, 111, 114, 109, 97, 116, 39, 41, 59, 10, 118, 97, 114, 32, 98,
-118, 61, 39, 39, 59, 10, 118, 97, 114, 32, 98, 119, 61, 90, 40, 39, 119, 101,
-101, 107, 100, 97, 121, 39, 44, 39, 115, 116, 114, 105, 110, 103, 39, 44, 91,
-39, 110, 97, 114, 114, 111, 119, 39, 44, 39, 115, 104, 111, 114, 116, 39, 44,
-39, 108, 111, 110, 103, 39, 93, 41, 59, 10, 98, 118, 43, 61, 97, 112, 112, 101,
-110, 100, 84, 111, 76, 68, 77, 76, 83, 116, 114, 105, 110, 103, 40, 10, 98, 119,
-44, 123, 110, 97, 114, 114, 111, 119, 58, 39, 69, 69, 69, 69, 69, 39, 44, 115,
-104, 111, 114, 116, 58, 39, 69, 69, 69, 39, 44, 108, 111, 110, 103, 58, 39, 69,
-69, 69, 69, 39, 125, 41, 59, 10, 98, 119, 61, 90, 40, 39, 101, 114, 97, 39, 44,
-39, 115, 116, 114, 105, 110, 103, 39, 44, 91, 39, 110, 97, 114, 114, 111, 119,
-39, 44, 39, 115, 104, 111, 114, 116, 39, 44, 39, 108, 111, 110, 103, 39, 93, 41,
-59, 10, 98, 118, 43, 61, 97, 112, 112, 101, 110, 100, 84, 111, 76, 68, 77, 76,
-83, 116, 114, 105, 110, 103, 40, 10, 98, 119, 44, 123, 110, 97, 114, 114, 111,
-119, 58, 39, 71, 71, 71, 71, 71, 39, 44, 115, 104, 111, 114, 116, 58, 39, 71,
-71, 71, 39, 44, 108, 111, 110, 103, 58, 39, 71, 71, 71, 71, 39, 125, 41, 59, 10,
-98, 119, 61, 90, 40, 39, 121, 101, 97, 114, 39, 44, 39, 115, 116, 114, 105, 110,
-103, 39, 44, 91, 39, 50, 45, 100, 105, 103, 105, 116, 39, 44, 39, 110, 117, 109,
-101, 114, 105, 99, 39, 93, 41, 59, 10, 98, 118, 43, 61, 97, 112, 112, 101, 110,
-100, 84, 111, 76, 68, 77, 76, 83, 116, 114, 105, 110, 103, 40, 98, 119, 44, 123,
-39, 50, 45, 100, 105, 103, 105, 116, 39, 58, 39, 121, 121, 39, 44, 39, 110, 117,
-109, 101, 114, 105, 99, 39, 58, 39, 121, 39, 125, 41, 59, 10, 98, 119, 61, 90,
-40, 39, 109, 111, 110, 116, 104, 39, 44, 39, 115, 116, 114, 105, 110, 103, 39,
-44, 10, 91, 39, 50, 45, 100, 105, 103, 105, 116, 39, 44, 39, 110, 117, 109, 101,
-114, 105, 99, 39, 44, 39, 110, 97, 114, 114, 111, 119, 39, 44, 39, 115, 104,
-111, 114, 116, 39, 44, 39, 108, 111, 110, 103, 39, 93, 41, 59, 10, 98, 118, 43,
-61, 97, 112, 112, 101, 110, 100, 84, 111, 76, 68, 77, 76, 83, 116, 114, 105,
-110, 103, 40, 98, 119, 44, 123, 39, 50, 45, 100, 105, 103, 105, 116, 39, 58, 39,
-77, 77, 39, 44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 58, 39, 77, 39, 44,
-10, 39, 110, 97, 114, 114, 111, 119, 39, 58, 39, 77, 77, 77, 77, 77, 39, 44, 39,
-115, 104, 111, 114, 116, 39, 58, 39, 77, 77, 77, 39, 44, 39, 108, 111, 110, 103,
-39, 58, 39, 77, 77, 77, 77, 39, 125, 41, 59, 10, 98, 119, 61, 90, 40, 39, 100,
-97, 121, 39, 44, 39, 115, 116, 114, 105, 110, 103, 39, 44, 91, 39, 50, 45, 100,
-105, 103, 105, 116, 39, 44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 93, 41,
-59, 10, 98, 118, 43, 61, 97, 112, 112, 101, 110, 100, 84, 111, 76, 68, 77, 76,
-83, 116, 114, 105, 110, 103, 40, 10, 98, 119, 44, 123, 39, 50, 45, 100, 105,
-103, 105, 116, 39, 58, 39, 100, 100, 39, 44, 39, 110, 117, 109, 101, 114, 105,
-99, 39, 58, 39, 100, 39, 125, 41, 59, 10, 118, 97, 114, 32, 98, 120, 61, 90, 40,
-39, 104, 111, 117, 114, 49, 50, 39, 44, 39, 98, 111, 111, 108, 101, 97, 110, 39,
-41, 59, 10, 98, 119, 61, 90, 40, 39, 104, 111, 117, 114, 39, 44, 39, 115, 116,
-114, 105, 110, 103, 39, 44, 91, 39, 50, 45, 100, 105, 103, 105, 116, 39, 44, 39,
-110, 117, 109, 101, 114, 105, 99, 39, 93, 41, 59, 10, 105, 102, 40, 98, 120, 61,
-61, 61, 98, 41, 123, 10, 98, 118, 43, 61, 97, 112, 112, 101, 110, 100, 84, 111,
-76, 68, 77, 76, 83, 116, 114, 105, 110, 103, 40, 98, 119, 44, 123, 39, 50, 45,
-100, 105, 103, 105, 116, 39, 58, 39, 106, 106, 39, 44, 39, 110, 117, 109, 101,
-114, 105, 99, 39, 58, 39, 106, 39, 125, 41, 59, 10, 125, 101, 108, 115, 101, 32,
-105, 102, 40, 98, 120, 61, 61, 61, 116, 114, 117, 101, 41, 123, 10, 98, 118, 43,
-61, 97, 112, 112, 101, 110, 100, 84, 111, 76, 68, 77, 76, 83, 116, 114, 105,
-110, 103, 40, 98, 119, 44, 123, 39, 50, 45, 100, 105, 103, 105, 116, 39, 58, 39,
-104, 104, 39, 44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 58, 39, 104, 39,
-125, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 98, 118, 43, 61, 97, 112,
-112, 101, 110, 100, 84, 111, 76, 68, 77, 76, 83, 116, 114, 105, 110, 103, 40,
-98, 119, 44, 123, 39, 50, 45, 100, 105, 103, 105, 116, 39, 58, 39, 72, 72, 39,
-44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 58, 39, 72, 39, 125, 41, 59, 10,
-125, 10, 98, 119, 61, 90, 40, 39, 109, 105, 110, 117, 116, 101, 39, 44, 39, 115,
-116, 114, 105, 110, 103, 39, 44, 91, 39, 50, 45, 100, 105, 103, 105, 116, 39,
-44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 93, 41, 59, 10, 98, 118, 43, 61,
-97, 112, 112, 101, 110, 100, 84, 111, 76, 68, 77, 76, 83, 116, 114, 105, 110,
-103, 40, 98, 119, 44, 123, 39, 50, 45, 100, 105, 103, 105, 116, 39, 58, 39, 109,
-109, 39, 44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 58, 39, 109, 39, 125, 41,
-59, 10, 98, 119, 61, 90, 40, 39, 115, 101, 99, 111, 110, 100, 39, 44, 39, 115,
-116, 114, 105, 110, 103, 39, 44, 91, 39, 50, 45, 100, 105, 103, 105, 116, 39,
-44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 93, 41, 59, 10, 98, 118, 43, 61,
-97, 112, 112, 101, 110, 100, 84, 111, 76, 68, 77, 76, 83, 116, 114, 105, 110,
-103, 40, 98, 119, 44, 123, 39, 50, 45, 100, 105, 103, 105, 116, 39, 58, 39, 115,
-115, 39, 44, 39, 110, 117, 109, 101, 114, 105, 99, 39, 58, 39, 115, 39, 125, 41,
-59, 10, 98, 119, 61, 90, 40, 39, 116, 105, 109, 101, 90, 111, 110, 101, 78, 97,
-109, 101, 39, 44, 39, 115, 116, 114, 105, 110, 103, 39, 44, 91, 39, 115, 104,
-111, 114, 116, 39, 44, 39, 108, 111, 110, 103, 39, 93, 41, 59, 10, 98, 118, 43,
-61, 97, 112, 112, 101, 110, 100, 84, 111, 76, 68, 77, 76, 83, 116, 114, 105,
-110, 103, 40, 98, 119, 44, 123, 115, 104, 111, 114, 116, 58, 39, 122, 39, 44,
-108, 111, 110, 103, 58, 39, 122, 122, 122, 122, 39, 125, 41, 59, 10, 114, 101,
-116, 117, 114, 110, 32, 98, 118, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105,
-111, 110, 32, 97, 112, 112, 101, 110, 100, 84, 111, 76, 68, 77, 76, 83, 116,
-114, 105, 110, 103, 40, 98, 119, 44, 98, 121, 41, 123, 10, 105, 102, 40, 98,
-119, 33, 61, 61, 98, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 98, 121, 91,
-98, 119, 93, 59, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117, 114,
-110, 39, 39, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110,
-32, 102, 114, 111, 109, 76, 68, 77, 76, 83, 116, 114, 105, 110, 103, 40, 98,
-118, 41, 123, 10, 98, 118, 61, 98, 118, 46, 114, 101, 112, 108, 97, 99, 101, 40,
-71, 101, 116, 81, 117, 111, 116, 101, 100, 83, 116, 114, 105, 110, 103, 82, 69,
-40, 41, 44, 39, 39, 41, 59, 10, 118, 97, 114, 32, 80, 61, 123, 125, 59, 10, 118,
-97, 114, 32, 98, 122, 61, 98, 118, 46, 109, 97, 116, 99, 104, 40, 47, 69, 123,
-51, 44, 53, 125, 47, 103, 41, 59, 10, 80, 61, 97, 112, 112, 101, 110, 100, 84,
-111, 68, 97, 116, 101, 84, 105, 109, 101, 79, 98, 106, 101, 99, 116, 40, 10, 80,
-44, 39, 119, 101, 101, 107, 100, 97, 121, 39, 44, 98, 122, 44, 123, 69, 69, 69,
-69, 69, 58, 39, 110, 97, 114, 114, 111, 119, 39, 44, 69, 69, 69, 58, 39, 115,
-104, 111, 114, 116, 39, 44, 69, 69, 69, 69, 58, 39, 108, 111, 110, 103, 39, 125,
-41, 59, 10, 98, 122, 61, 98, 118, 46, 109, 97, 116, 99, 104, 40, 47, 71, 123,
-51, 44, 53, 125, 47, 103, 41, 59, 10, 80, 61, 97, 112, 112, 101, 110, 100, 84,
-111, 68, 97, 116, 101, 84, 105, 109, 101, 79, 98, 106, 101, 99, 116, 40, 10, 80,
-44, 39, 101, 114, 97, 39, 44, 98, 122, 44, 123, 71, 71, 71, 71, 71, 58, 39, 110,
-97, 114, 114, 111, 119, 39, 44, 71, 71, 71, 58, 39, 115, 104, 111, 114, 116, 39,
-44, 71, 71, 71, 71, 58, 39, 108, 111, 110, 103, 39, 125, 41, 59, 10, 98, 122,
-61, 98, 118, 46, 109, 97, 116, 99, 104, 40, 47, 121, 123, 49, 44, 50, 125, 47,
-103, 41, 59, 10, 80, 61, 97, 112, 112, 101, 110, 100, 84, 111, 68, 97, 116, 101,
-84, 105, 109, 101, 79, 98, 106, 101, 99, 116, 40, 10, 80, 44, 39, 121, 101, 97,
-114, 39, 44, 98, 122, 44, 123, 121, 58, 39, 110, 117, 109, 101, 114, 105, 99,
-39, 44, 121, 121, 58, 39, 50, 45, 100, 105, 103, 105, 116, 39, 125, 41, 59, 10,
-98, 122, 61, 98, 118, 46, 109, 97, 116, 99, 104, 40, 47, 77, 123, 49, 44, 53,
-125, 47, 103, 41, 59, 10, 80, 61, 97, 112, 112, 101, 110, 100, 84, 111, 68, 97,
-116, 101, 84, 105, 109, 101, 79, 98, 106, 101, 99, 116, 40, 80, 44, 39, 109,
-111, 110, 116, 104, 39, 44, 98, 122, 44, 123, 77, 77, 58, 39, 50, 45, 100, 105,
-103, 105, 116, 39, 44, 10, 77, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44,
-77, 77, 77, 77, 77, 58, 39, 110, 97, 114, 114, 111, 119, 39, 44, 77, 77, 77, 58,
-39, 115, 104, 111, 114, 116, 39, 44, 77, 77, 77, 77, 58, 39, 108, 111, 110, 103,
-39, 125, 41, 59, 10, 98, 122, 61, 98, 118, 46, 109, 97, 116, 99, 104, 40, 47,
-76, 123, 49, 44, 53, 125, 47, 103, 41, 59, 10, 80, 61, 97, 112, 112, 101, 110,
-100, 84, 111, 68, 97, 116, 101, 84, 105, 109, 101, 79, 98, 106, 101, 99, 116,
-40, 80, 44, 39, 109, 111, 110, 116, 104, 39, 44, 98, 122, 44, 123, 76, 76, 58,
-39, 50, 45, 100, 105, 103, 105, 116, 39, 44, 10, 76, 58, 39, 110, 117, 109, 101,
-114, 105, 99, 39, 44, 76, 76, 76, 76, 76, 58, 39, 110, 97, 114, 114, 111, 119,
-39, 44, 76, 76, 76, 58, 39, 115, 104, 111, 114, 116, 39, 44, 76, 76, 76, 76, 58,
-39, 108, 111, 110, 103, 39, 125, 41, 59, 10, 98, 122, 61, 98, 118, 46, 109, 97,
-116, 99, 104, 40, 47, 100, 123, 49, 44, 50, 125, 47, 103, 41, 59, 10, 80, 61,
-97, 112, 112, 101, 110, 100, 84, 111, 68, 97, 116, 101, 84, 105, 109, 101, 79,
-98, 106, 101, 99, 116, 40, 10, 80, 44, 39, 100, 97, 121, 39, 44, 98, 122, 44,
-123, 100, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44, 100, 100, 58, 39,
-50, 45, 100, 105, 103, 105, 116, 39, 125, 41, 59, 10, 98, 122, 61, 98, 118, 46,
-109, 97, 116, 99, 104, 40, 47, 104, 123, 49, 44, 50, 125, 47, 103, 41, 59, 10,
-105, 102, 40, 98, 122, 33, 61, 61, 110, 117, 108, 108, 41, 123, 10, 80, 91, 39,
-104, 111, 117, 114, 49, 50, 39, 93, 61, 116, 114, 117, 101, 59, 10, 125, 10, 80,
-61, 97, 112, 112, 101, 110, 100, 84, 111, 68, 97, 116, 101, 84, 105, 109, 101,
-79, 98, 106, 101, 99, 116, 40, 10, 80, 44, 39, 104, 111, 117, 114, 39, 44, 98,
-122, 44, 123, 104, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44, 104, 104,
-58, 39, 50, 45, 100, 105, 103, 105, 116, 39, 125, 41, 59, 10, 98, 122, 61, 98,
-118, 46, 109, 97, 116, 99, 104, 40, 47, 72, 123, 49, 44, 50, 125, 47, 103, 41,
-59, 10, 105, 102, 40, 98, 122, 33, 61, 61, 110, 117, 108, 108, 41, 123, 10, 80,
-91, 39, 104, 111, 117, 114, 49, 50, 39, 93, 61, 102, 97, 108, 115, 101, 59, 10,
-125, 10, 80, 61, 97, 112, 112, 101, 110, 100, 84, 111, 68, 97, 116, 101, 84,
-105, 109, 101, 79, 98, 106, 101, 99, 116, 40, 10, 80, 44, 39, 104, 111, 117,
-114, 39, 44, 98, 122, 44, 123, 72, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39,
-44, 72, 72, 58, 39, 50, 45, 100, 105, 103, 105, 116, 39, 125, 41, 59, 10, 98,
-122, 61, 98, 118, 46, 109, 97, 116, 99, 104, 40, 47, 109, 123, 49, 44, 50, 125,
-47, 103, 41, 59, 10, 80, 61, 97, 112, 112, 101, 110, 100, 84, 111, 68, 97, 116,
-101, 84, 105, 109, 101, 79, 98, 106, 101, 99, 116, 40, 10, 80, 44, 39, 109, 105,
-110, 117, 116, 101, 39, 44, 98, 122, 44, 123, 109, 58, 39, 110, 117, 109, 101,
-114, 105, 99, 39, 44, 109, 109, 58, 39, 50, 45, 100, 105, 103, 105, 116, 39,
-125, 41, 59, 10, 98, 122, 61, 98, 118, 46, 109, 97, 116, 99, 104, 40, 47, 115,
-123, 49, 44, 50, 125, 47, 103, 41, 59, 10, 80, 61, 97, 112, 112, 101, 110, 100,
-84, 111, 68, 97, 116, 101, 84, 105, 109, 101, 79, 98, 106, 101, 99, 116, 40, 10,
-80, 44, 39, 115, 101, 99, 111, 110, 100, 39, 44, 98, 122, 44, 123, 115, 58, 39,
-110, 117, 109, 101, 114, 105, 99, 39, 44, 115, 115, 58, 39, 50, 45, 100, 105,
-103, 105, 116, 39, 125, 41, 59, 10, 98, 122, 61, 98, 118, 46, 109, 97, 116, 99,
-104, 40, 47, 122, 124, 122, 122, 122, 122, 47, 103, 41, 59, 10, 80, 61, 97, 112,
-112, 101, 110, 100, 84, 111, 68, 97, 116, 101, 84, 105, 109, 101, 79, 98, 106,
-101, 99, 116, 40, 10, 80, 44, 39, 116, 105, 109, 101, 90, 111, 110, 101, 78, 97,
-109, 101, 39, 44, 98, 122, 44, 123, 122, 58, 39, 115, 104, 111, 114, 116, 39,
-44, 122, 122, 122, 122, 58, 39, 108, 111, 110, 103, 39, 125, 41, 59, 10, 114,
-101, 116, 117, 114, 110, 32, 80, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105,
-111, 110, 32, 97, 112, 112, 101, 110, 100, 84, 111, 68, 97, 116, 101, 84, 105,
-109, 101, 79, 98, 106, 101, 99, 116, 40, 80, 44, 98, 119, 44, 98, 122, 44, 98,
-121, 41, 123, 10, 105, 102, 40, 40, 98, 122, 61, 61, 61, 110, 117, 108, 108, 41,
-41, 123, 10, 105, 102, 40, 33, 80, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111,
-112, 101, 114, 116, 121, 40, 98, 119, 41, 41, 123, 10, 100, 101, 102, 105, 110,
-101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 80, 44, 98, 119, 44, 98,
-41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 80, 59, 10, 125, 10, 118,
-97, 114, 32, 97, 97, 61, 98, 122, 91, 48, 93, 59, 10, 100, 101, 102, 105, 110,
-101, 87, 69, 80, 114, 111, 112, 101, 114, 116, 121, 40, 80, 44, 98, 119, 44, 98,
-121, 91, 97, 97, 93, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 80, 59, 10,
-125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 111, 68, 97, 116, 101,
-84, 105, 109, 101, 79, 112, 116, 105, 111, 110, 115, 40, 80, 44, 98, 65, 44, 98,
-66, 41, 123, 10, 105, 102, 40, 80, 61, 61, 61, 98, 41, 123, 10, 80, 61, 123,
-125, 59, 10, 125, 101, 108, 115, 101, 123, 10, 80, 61, 40, 40, 37, 95, 73, 115,
-83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 37, 73, 83, 95, 86, 65, 82, 40,
-80, 41, 41, 41, 63, 80, 58, 84, 111, 79, 98, 106, 101, 99, 116, 40, 80, 41, 41,
-59, 10, 125, 10, 118, 97, 114, 32, 98, 67, 61, 116, 114, 117, 101, 59, 10, 105,
-102, 40, 40, 98, 65, 61, 61, 61, 39, 100, 97, 116, 101, 39, 124, 124, 98, 65,
-61, 61, 61, 39, 97, 110, 121, 39, 41, 38, 38, 10, 40, 80, 46, 119, 101, 101,
-107, 100, 97, 121, 33, 61, 61, 98, 124, 124, 80, 46, 121, 101, 97, 114, 33, 61,
-61, 98, 124, 124, 10, 80, 46, 109, 111, 110, 116, 104, 33, 61, 61, 98, 124, 124,
-80, 46, 100, 97, 121, 33, 61, 61, 98, 41, 41, 123, 10, 98, 67, 61, 102, 97, 108,
-115, 101, 59, 10, 125, 10, 105, 102, 40, 40, 98, 65, 61, 61, 61, 39, 116, 105,
-109, 101, 39, 124, 124, 98, 65, 61, 61, 61, 39, 97, 110, 121, 39, 41, 38, 38,
-10, 40, 80, 46, 104, 111, 117, 114, 33, 61, 61, 98, 124, 124, 80, 46, 109, 105,
-110, 117, 116, 101, 33, 61, 61, 98, 124, 124, 10, 80, 46, 115, 101, 99, 111,
-110, 100, 33, 61, 61, 98, 41, 41, 123, 10, 98, 67, 61, 102, 97, 108, 115, 101,
-59, 10, 125, 10, 105, 102, 40, 98, 67, 38, 38, 40, 98, 66, 61, 61, 61, 39, 100,
-97, 116, 101, 39, 124, 124, 98, 66, 61, 61, 61, 39, 97, 108, 108, 39, 41, 41,
-123, 10, 79, 98, 106, 101, 99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111,
-112, 101, 114, 116, 121, 40, 80, 44, 39, 121, 101, 97, 114, 39, 44, 123, 118,
-97, 108, 117, 101, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44, 10, 119,
-114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 101, 110, 117,
-109, 101, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 99, 111, 110,
-102, 105, 103, 117, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 41, 59,
-10, 79, 98, 106, 101, 99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111, 112,
-101, 114, 116, 121, 40, 80, 44, 39, 109, 111, 110, 116, 104, 39, 44, 123, 118,
-97, 108, 117, 101, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44, 10, 119,
-114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 101, 110, 117,
-109, 101, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 99, 111, 110,
-102, 105, 103, 117, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 41, 59,
-10, 79, 98, 106, 101, 99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111, 112,
-101, 114, 116, 121, 40, 80, 44, 39, 100, 97, 121, 39, 44, 123, 118, 97, 108,
-117, 101, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44, 10, 119, 114, 105,
-116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 101, 110, 117, 109, 101,
-114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 99, 111, 110, 102, 105,
-103, 117, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 41, 59, 10, 125,
-10, 105, 102, 40, 98, 67, 38, 38, 40, 98, 66, 61, 61, 61, 39, 116, 105, 109,
-101, 39, 124, 124, 98, 66, 61, 61, 61, 39, 97, 108, 108, 39, 41, 41, 123, 10,
-79, 98, 106, 101, 99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101,
-114, 116, 121, 40, 80, 44, 39, 104, 111, 117, 114, 39, 44, 123, 118, 97, 108,
-117, 101, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44, 10, 119, 114, 105,
-116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 101, 110, 117, 109, 101,
-114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 99, 111, 110, 102, 105,
-103, 117, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 41, 59, 10, 79,
-98, 106, 101, 99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114,
-116, 121, 40, 80, 44, 39, 109, 105, 110, 117, 116, 101, 39, 44, 123, 118, 97,
-108, 117, 101, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44, 10, 119, 114,
-105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 101, 110, 117, 109,
-101, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 99, 111, 110, 102,
-105, 103, 117, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 41, 59, 10,
-79, 98, 106, 101, 99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101,
-114, 116, 121, 40, 80, 44, 39, 115, 101, 99, 111, 110, 100, 39, 44, 123, 118,
-97, 108, 117, 101, 58, 39, 110, 117, 109, 101, 114, 105, 99, 39, 44, 10, 119,
-114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 101, 110, 117,
-109, 101, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 99, 111, 110,
-102, 105, 103, 117, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 41, 59,
-10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 80, 59, 10, 125, 10, 102, 117,
-110, 99, 116, 105, 111, 110, 32, 105, 110, 105, 116, 105, 97, 108, 105, 122,
-101, 68, 97, 116, 101, 84, 105, 109, 101, 70, 111, 114, 109, 97, 116, 40, 98,
-68, 44, 79, 44, 80, 41, 123, 10, 105, 102, 40, 37, 73, 115, 73, 110, 105, 116,
-105, 97, 108, 105, 122, 101, 100, 73, 110, 116, 108, 79, 98, 106, 101, 99, 116,
-40, 98, 68, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36,
-84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 84, 114, 121, 105, 110, 103,
-32, 116, 111, 32, 114, 101, 45, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101,
-32, 68, 97, 116, 101, 84, 105, 109, 101, 70, 111, 114, 109, 97, 116, 32, 111,
-98, 106, 101, 99, 116, 46, 39, 41, 59, 10, 125, 10, 105, 102, 40, 80, 61, 61,
-61, 98, 41, 123, 10, 80, 61, 123, 125, 59, 10, 125, 10, 118, 97, 114, 32, 87,
-61, 114, 101, 115, 111, 108, 118, 101, 76, 111, 99, 97, 108, 101, 40, 39, 100,
-97, 116, 101, 102, 111, 114, 109, 97, 116, 39, 44, 79, 44, 80, 41, 59, 10, 80,
-61, 116, 111, 68, 97, 116, 101, 84, 105, 109, 101, 79, 112, 116, 105, 111, 110,
-115, 40, 80, 44, 39, 97, 110, 121, 39, 44, 39, 100, 97, 116, 101, 39, 41, 59,
-10, 118, 97, 114, 32, 90, 61, 103, 101, 116, 71, 101, 116, 79, 112, 116, 105,
-111, 110, 40, 80, 44, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97, 116, 39,
-41, 59, 10, 118, 97, 114, 32, 81, 61, 90, 40, 39, 102, 111, 114, 109, 97, 116,
-77, 97, 116, 99, 104, 101, 114, 39, 44, 39, 115, 116, 114, 105, 110, 103, 39,
-44, 10, 91, 39, 98, 97, 115, 105, 99, 39, 44, 39, 98, 101, 115, 116, 32, 102,
-105, 116, 39, 93, 44, 39, 98, 101, 115, 116, 32, 102, 105, 116, 39, 41, 59, 10,
-118, 97, 114, 32, 98, 118, 61, 116, 111, 76, 68, 77, 76, 83, 116, 114, 105, 110,
-103, 40, 80, 41, 59, 10, 118, 97, 114, 32, 98, 69, 61, 99, 97, 110, 111, 110,
-105, 99, 97, 108, 105, 122, 101, 84, 105, 109, 101, 90, 111, 110, 101, 73, 68,
-40, 80, 46, 116, 105, 109, 101, 90, 111, 110, 101, 41, 59, 10, 118, 97, 114, 32,
-98, 97, 61, 123, 125, 59, 10, 118, 97, 114, 32, 97, 106, 61, 112, 97, 114, 115,
-101, 69, 120, 116, 101, 110, 115, 105, 111, 110, 40, 87, 46, 101, 120, 116, 101,
-110, 115, 105, 111, 110, 41, 59, 10, 118, 97, 114, 32, 97, 104, 61, 115, 101,
-116, 79, 112, 116, 105, 111, 110, 115, 40, 80, 44, 97, 106, 44, 65, 44, 10, 90,
-44, 98, 97, 41, 59, 10, 118, 97, 114, 32, 98, 100, 61, 87, 46, 108, 111, 99, 97,
-108, 101, 43, 97, 104, 59, 10, 118, 97, 114, 32, 97, 102, 61, 79, 98, 106, 101,
-99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 105,
-101, 115, 40, 123, 125, 44, 123, 10, 99, 97, 108, 101, 110, 100, 97, 114, 58,
-123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10,
-100, 97, 121, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117,
-101, 125, 44, 10, 101, 114, 97, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101,
-58, 116, 114, 117, 101, 125, 44, 10, 104, 111, 117, 114, 49, 50, 58, 123, 119,
-114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 104, 111,
-117, 114, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101,
-125, 44, 10, 108, 111, 99, 97, 108, 101, 58, 123, 119, 114, 105, 116, 97, 98,
-108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 109, 105, 110, 117, 116, 101, 58,
-123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10,
-109, 111, 110, 116, 104, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116,
-114, 117, 101, 125, 44, 10, 110, 117, 109, 98, 101, 114, 105, 110, 103, 83, 121,
-115, 116, 101, 109, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114,
-117, 101, 125, 44, 10, 112, 97, 116, 116, 101, 114, 110, 58, 123, 119, 114, 105,
-116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 114, 101, 113, 117,
-101, 115, 116, 101, 100, 76, 111, 99, 97, 108, 101, 58, 123, 118, 97, 108, 117,
-101, 58, 98, 100, 44, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117,
-101, 125, 44, 10, 115, 101, 99, 111, 110, 100, 58, 123, 119, 114, 105, 116, 97,
-98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 116, 105, 109, 101, 90, 111,
-110, 101, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101,
-125, 44, 10, 116, 105, 109, 101, 90, 111, 110, 101, 78, 97, 109, 101, 58, 123,
-119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 116,
-122, 58, 123, 118, 97, 108, 117, 101, 58, 98, 69, 44, 119, 114, 105, 116, 97,
-98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 119, 101, 101, 107, 100, 97,
-121, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125,
-44, 10, 121, 101, 97, 114, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58,
-116, 114, 117, 101, 125, 10, 125, 41, 59, 10, 118, 97, 114, 32, 98, 114, 61, 37,
-67, 114, 101, 97, 116, 101, 68, 97, 116, 101, 84, 105, 109, 101, 70, 111, 114,
-109, 97, 116, 40, 10, 98, 100, 44, 123, 115, 107, 101, 108, 101, 116, 111, 110,
-58, 98, 118, 44, 116, 105, 109, 101, 90, 111, 110, 101, 58, 98, 69, 125, 44, 97,
-102, 41, 59, 10, 105, 102, 40, 98, 69, 33, 61, 61, 98, 38, 38, 98, 69, 33, 61,
-61, 97, 102, 46, 116, 105, 109, 101, 90, 111, 110, 101, 41, 123, 10, 116, 104,
-114, 111, 119, 32, 110, 101, 119, 32, 36, 82, 97, 110, 103, 101, 69, 114, 114,
-111, 114, 40, 39, 85, 110, 115, 117, 112, 112, 111, 114, 116, 101, 100, 32, 116,
-105, 109, 101, 32, 122, 111, 110, 101, 32, 115, 112, 101, 99, 105, 102, 105,
-101, 100, 32, 39, 43, 98, 69, 41, 59, 10, 125, 10, 37, 77, 97, 114, 107, 65,
-115, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73, 110, 116, 108, 79,
-98, 106, 101, 99, 116, 79, 102, 84, 121, 112, 101, 40, 98, 68, 44, 39, 100, 97,
-116, 101, 102, 111, 114, 109, 97, 116, 39, 44, 98, 114, 41, 59, 10, 79, 98, 106,
-101, 99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116,
-121, 40, 98, 68, 44, 39, 114, 101, 115, 111, 108, 118, 101, 100, 39, 44, 123,
-118, 97, 108, 117, 101, 58, 97, 102, 125, 41, 59, 10, 114, 101, 116, 117, 114,
-110, 32, 98, 68, 59, 10, 125, 10, 37, 65, 100, 100, 80, 114, 111, 112, 101, 114,
-116, 121, 40, 97, 44, 39, 68, 97, 116, 101, 84, 105, 109, 101, 70, 111, 114,
-109, 97, 116, 39, 44, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10,
-118, 97, 114, 32, 79, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115,
-40, 48, 41, 59, 10, 118, 97, 114, 32, 80, 61, 37, 95, 65, 114, 103, 117, 109,
-101, 110, 116, 115, 40, 49, 41, 59, 10, 105, 102, 40, 33, 116, 104, 105, 115,
-124, 124, 116, 104, 105, 115, 61, 61, 61, 97, 41, 123, 10, 114, 101, 116, 117,
-114, 110, 32, 110, 101, 119, 32, 97, 46, 68, 97, 116, 101, 84, 105, 109, 101,
-70, 111, 114, 109, 97, 116, 40, 79, 44, 80, 41, 59, 10, 125, 10, 114, 101, 116,
-117, 114, 110, 32, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 68, 97, 116,
-101, 84, 105, 109, 101, 70, 111, 114, 109, 97, 116, 40, 84, 111, 79, 98, 106,
-101, 99, 116, 40, 116, 104, 105, 115, 41, 44, 79, 44, 80, 41, 59, 10, 125, 44,
-10, 50, 10, 41, 59, 10, 37, 65, 100, 100, 80, 114, 111, 112, 101, 114, 116, 121,
-40, 97, 46, 68, 97, 116, 101, 84, 105, 109, 101, 70, 111, 114, 109, 97, 116, 46,
-112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 39, 114, 101, 115, 111, 108,
-118, 101, 100, 79, 112, 116, 105, 111, 110, 115, 39, 44, 102, 117, 110, 99, 116,
-105, 111, 110, 40, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110,
-115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 116, 104,
-114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111,
-114, 40, 67, 41, 59, 10, 125, 10, 105, 102, 40, 33, 37, 73, 115, 73, 110, 105,
-116, 105, 97, 108, 105, 122, 101, 100, 73, 110, 116, 108, 79, 98, 106, 101, 99,
-116, 79, 102, 84, 121, 112, 101, 40, 116, 104, 105, 115, 44, 39, 100, 97, 116,
-101, 102, 111, 114, 109, 97, 116, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119,
-32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39,
-114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116, 105, 111, 110, 115, 32,
-109, 101, 116, 104, 111, 100, 32, 99, 97, 108, 108, 101, 100, 32, 111, 110, 32,
-97, 32, 110, 111, 110, 45, 111, 98, 106, 101, 99, 116, 32, 111, 114, 32, 39, 43,
-10, 39, 111, 110, 32, 97, 32, 111, 98, 106, 101, 99, 116, 32, 116, 104, 97, 116,
-32, 105, 115, 32, 110, 111, 116, 32, 73, 110, 116, 108, 46, 68, 97, 116, 101,
-84, 105, 109, 101, 70, 111, 114, 109, 97, 116, 46, 39, 41, 59, 10, 125, 10, 118,
-97, 114, 32, 98, 115, 61, 116, 104, 105, 115, 59, 10, 118, 97, 114, 32, 98, 70,
-61, 102, 114, 111, 109, 76, 68, 77, 76, 83, 116, 114, 105, 110, 103, 40, 98,
-115, 46, 114, 101, 115, 111, 108, 118, 101, 100, 46, 112, 97, 116, 116, 101,
-114, 110, 41, 59, 10, 118, 97, 114, 32, 98, 71, 61, 117, 91, 98, 115, 46, 114,
-101, 115, 111, 108, 118, 101, 100, 46, 99, 97, 108, 101, 110, 100, 97, 114, 93,
-59, 10, 105, 102, 40, 98, 71, 61, 61, 61, 98, 41, 123, 10, 98, 71, 61, 98, 115,
-46, 114, 101, 115, 111, 108, 118, 101, 100, 46, 99, 97, 108, 101, 110, 100, 97,
-114, 59, 10, 125, 10, 118, 97, 114, 32, 87, 61, 103, 101, 116, 79, 112, 116,
-105, 109, 97, 108, 76, 97, 110, 103, 117, 97, 103, 101, 84, 97, 103, 40, 98,
-115, 46, 114, 101, 115, 111, 108, 118, 101, 100, 46, 114, 101, 113, 117, 101,
-115, 116, 101, 100, 76, 111, 99, 97, 108, 101, 44, 10, 98, 115, 46, 114, 101,
-115, 111, 108, 118, 101, 100, 46, 108, 111, 99, 97, 108, 101, 41, 59, 10, 118,
-97, 114, 32, 98, 116, 61, 123, 10, 108, 111, 99, 97, 108, 101, 58, 87, 44, 10,
-110, 117, 109, 98, 101, 114, 105, 110, 103, 83, 121, 115, 116, 101, 109, 58, 98,
-115, 46, 114, 101, 115, 111, 108, 118, 101, 100, 46, 110, 117, 109, 98, 101,
-114, 105, 110, 103, 83, 121, 115, 116, 101, 109, 44, 10, 99, 97, 108, 101, 110,
-100, 97, 114, 58, 98, 71, 44, 10, 116, 105, 109, 101, 90, 111, 110, 101, 58, 98,
-115, 46, 114, 101, 115, 111, 108, 118, 101, 100, 46, 116, 105, 109, 101, 90,
-111, 110, 101, 10, 125, 59, 10, 97, 100, 100, 87, 69, 67, 80, 114, 111, 112,
-101, 114, 116, 121, 73, 102, 68, 101, 102, 105, 110, 101, 100, 40, 98, 116, 44,
-39, 116, 105, 109, 101, 90, 111, 110, 101, 78, 97, 109, 101, 39, 44, 98, 70, 46,
-116, 105, 109, 101, 90, 111, 110, 101, 78, 97, 109, 101, 41, 59, 10, 97, 100,
-100, 87, 69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 73, 102, 68, 101, 102,
-105, 110, 101, 100, 40, 98, 116, 44, 39, 101, 114, 97, 39, 44, 98, 70, 46, 101,
-114, 97, 41, 59, 10, 97, 100, 100, 87, 69, 67, 80, 114, 111, 112, 101, 114, 116,
-121, 73, 102, 68, 101, 102, 105, 110, 101, 100, 40, 98, 116, 44, 39, 121, 101,
-97, 114, 39, 44, 98, 70, 46, 121, 101, 97, 114, 41, 59, 10, 97, 100, 100, 87,
-69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 73, 102, 68, 101, 102, 105, 110,
-101, 100, 40, 98, 116, 44, 39, 109, 111, 110, 116, 104, 39, 44, 98, 70, 46, 109,
-111, 110, 116, 104, 41, 59, 10, 97, 100, 100, 87, 69, 67, 80, 114, 111, 112,
-101, 114, 116, 121, 73, 102, 68, 101, 102, 105, 110, 101, 100, 40, 98, 116, 44,
-39, 100, 97, 121, 39, 44, 98, 70, 46, 100, 97, 121, 41, 59, 10, 97, 100, 100,
-87, 69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 73, 102, 68, 101, 102, 105,
-110, 101, 100, 40, 98, 116, 44, 39, 119, 101, 101, 107, 100, 97, 121, 39, 44,
-98, 70, 46, 119, 101, 101, 107, 100, 97, 121, 41, 59, 10, 97, 100, 100, 87, 69,
-67, 80, 114, 111, 112, 101, 114, 116, 121, 73, 102, 68, 101, 102, 105, 110, 101,
-100, 40, 98, 116, 44, 39, 104, 111, 117, 114, 49, 50, 39, 44, 98, 70, 46, 104,
-111, 117, 114, 49, 50, 41, 59, 10, 97, 100, 100, 87, 69, 67, 80, 114, 111, 112,
-101, 114, 116, 121, 73, 102, 68, 101, 102, 105, 110, 101, 100, 40, 98, 116, 44,
-39, 104, 111, 117, 114, 39, 44, 98, 70, 46, 104, 111, 117, 114, 41, 59, 10, 97,
-100, 100, 87, 69, 67, 80, 114, 111, 112, 101, 114, 116, 121, 73, 102, 68, 101,
-102, 105, 110, 101, 100, 40, 98, 116, 44, 39, 109, 105, 110, 117, 116, 101, 39,
-44, 98, 70, 46, 109, 105, 110, 117, 116, 101, 41, 59, 10, 97, 100, 100, 87, 69,
-67, 80, 114, 111, 112, 101, 114, 116, 121, 73, 102, 68, 101, 102, 105, 110, 101,
-100, 40, 98, 116, 44, 39, 115, 101, 99, 111, 110, 100, 39, 44, 98, 70, 46, 115,
-101, 99, 111, 110, 100, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 98, 116,
-59, 10, 125, 44, 10, 50, 10, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111,
-110, 83, 101, 116, 78, 97, 109, 101, 40, 97, 46, 68, 97, 116, 101, 84, 105, 109,
-101, 70, 111, 114, 109, 97, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112,
-101, 46, 114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116, 105, 111, 110,
-115, 44, 10, 39, 114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116, 105, 111,
-110, 115, 39, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 82, 101,
-109, 111, 118, 101, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 97, 46, 68,
-97, 116, 101, 84, 105, 109, 101, 70, 111, 114, 109, 97, 116, 46, 112, 114, 111,
-116, 111, 116, 121, 112, 101, 46, 114, 101, 115, 111, 108, 118, 101, 100, 79,
-112, 116, 105, 111, 110, 115, 41, 59, 10, 37, 83, 101, 116, 78, 97, 116, 105,
-118, 101, 70, 108, 97, 103, 40, 97, 46, 68, 97, 116, 101, 84, 105, 109, 101, 70,
-111, 114, 109, 97, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
-114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116, 105, 111, 110, 115, 41,
-59, 10, 37, 65, 100, 100, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 46, 68,
-97, 116, 101, 84, 105, 109, 101, 70, 111, 114, 109, 97, 116, 44, 39, 115, 117,
-112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 39,
-44, 102, 117, 110, 99, 116, 105, 111, 110, 40, 79, 41, 123, 10, 105, 102, 40,
-37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108,
-40, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84,
-121, 112, 101, 69, 114, 114, 111, 114, 40, 67, 41, 59, 10, 125, 10, 114, 101,
-116, 117, 114, 110, 32, 115, 117, 112, 112, 111, 114, 116, 101, 100, 76, 111,
-99, 97, 108, 101, 115, 79, 102, 40, 39, 100, 97, 116, 101, 102, 111, 114, 109,
-97, 116, 39, 44, 79, 44, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40,
-49, 41, 41, 59, 10, 125, 44, 10, 50, 10, 41, 59, 10, 37, 70, 117, 110, 99, 116,
-105, 111, 110, 83, 101, 116, 78, 97, 109, 101, 40, 97, 46, 68, 97, 116, 101, 84,
-105, 109, 101, 70, 111, 114, 109, 97, 116, 46, 115, 117, 112, 112, 111, 114,
-116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 44, 39, 115, 117, 112,
-112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 39, 41,
-59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 82, 101, 109, 111, 118, 101,
-80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 97, 46, 68, 97, 116, 101, 84,
-105, 109, 101, 70, 111, 114, 109, 97, 116, 46, 115, 117, 112, 112, 111, 114,
-116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 41, 59, 10, 37, 83, 101,
-116, 78, 97, 116, 105, 118, 101, 70, 108, 97, 103, 40, 97, 46, 68, 97, 116, 101,
-84, 105, 109, 101, 70, 111, 114, 109, 97, 116, 46, 115, 117, 112, 112, 111, 114,
-116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102, 41, 59, 10, 102, 117,
-110, 99, 116, 105, 111, 110, 32, 102, 111, 114, 109, 97, 116, 68, 97, 116, 101,
-40, 98, 114, 44, 98, 72, 41, 123, 10, 118, 97, 114, 32, 98, 73, 59, 10, 105,
-102, 40, 98, 72, 61, 61, 61, 98, 41, 123, 10, 98, 73, 61, 36, 68, 97, 116, 101,
-46, 110, 111, 119, 40, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 98, 73, 61,
-36, 78, 117, 109, 98, 101, 114, 40, 98, 72, 41, 59, 10, 125, 10, 105, 102, 40,
-33, 36, 105, 115, 70, 105, 110, 105, 116, 101, 40, 98, 73, 41, 41, 123, 10, 116,
-104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 82, 97, 110, 103, 101, 69, 114,
-114, 111, 114, 40, 39, 80, 114, 111, 118, 105, 100, 101, 100, 32, 100, 97, 116,
-101, 32, 105, 115, 32, 110, 111, 116, 32, 105, 110, 32, 118, 97, 108, 105, 100,
-32, 114, 97, 110, 103, 101, 46, 39, 41, 59, 10, 125, 10, 114, 101, 116, 117,
-114, 110, 32, 37, 73, 110, 116, 101, 114, 110, 97, 108, 68, 97, 116, 101, 70,
-111, 114, 109, 97, 116, 40, 37, 71, 101, 116, 73, 109, 112, 108, 70, 114, 111,
-109, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73, 110, 116, 108, 79,
-98, 106, 101, 99, 116, 40, 98, 114, 41, 44, 10, 110, 101, 119, 32, 36, 68, 97,
-116, 101, 40, 98, 73, 41, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111,
-110, 32, 112, 97, 114, 115, 101, 68, 97, 116, 101, 40, 98, 114, 44, 97, 101, 41,
-123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 73, 110, 116, 101, 114, 110, 97,
-108, 68, 97, 116, 101, 80, 97, 114, 115, 101, 40, 37, 71, 101, 116, 73, 109,
-112, 108, 70, 114, 111, 109, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101,
-100, 73, 110, 116, 108, 79, 98, 106, 101, 99, 116, 40, 98, 114, 41, 44, 10, 36,
-83, 116, 114, 105, 110, 103, 40, 97, 101, 41, 41, 59, 10, 125, 10, 97, 100, 100,
-66, 111, 117, 110, 100, 77, 101, 116, 104, 111, 100, 40, 97, 46, 68, 97, 116,
-101, 84, 105, 109, 101, 70, 111, 114, 109, 97, 116, 44, 39, 102, 111, 114, 109,
-97, 116, 39, 44, 102, 111, 114, 109, 97, 116, 68, 97, 116, 101, 44, 48, 41, 59,
-10, 97, 100, 100, 66, 111, 117, 110, 100, 77, 101, 116, 104, 111, 100, 40, 97,
-46, 68, 97, 116, 101, 84, 105, 109, 101, 70, 111, 114, 109, 97, 116, 44, 39,
-118, 56, 80, 97, 114, 115, 101, 39, 44, 112, 97, 114, 115, 101, 68, 97, 116,
-101, 44, 49, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 97, 110,
-111, 110, 105, 99, 97, 108, 105, 122, 101, 84, 105, 109, 101, 90, 111, 110, 101,
-73, 68, 40, 98, 74, 41, 123, 10, 105, 102, 40, 98, 74, 61, 61, 61, 98, 41, 123,
-10, 114, 101, 116, 117, 114, 110, 32, 98, 74, 59, 10, 125, 10, 118, 97, 114, 32,
-98, 75, 61, 98, 74, 46, 116, 111, 85, 112, 112, 101, 114, 67, 97, 115, 101, 40,
-41, 59, 10, 105, 102, 40, 98, 75, 61, 61, 61, 39, 85, 84, 67, 39, 124, 124, 98,
-75, 61, 61, 61, 39, 71, 77, 84, 39, 124, 124, 10, 98, 75, 61, 61, 61, 39, 69,
-84, 67, 47, 85, 84, 67, 39, 124, 124, 98, 75, 61, 61, 61, 39, 69, 84, 67, 47,
-71, 77, 84, 39, 41, 123, 10, 114, 101, 116, 117, 114, 110, 39, 85, 84, 67, 39,
-59, 10, 125, 10, 118, 97, 114, 32, 98, 122, 61, 71, 101, 116, 84, 105, 109, 101,
-122, 111, 110, 101, 78, 97, 109, 101, 67, 104, 101, 99, 107, 82, 69, 40, 41, 46,
-101, 120, 101, 99, 40, 98, 74, 41, 59, 10, 105, 102, 40, 40, 98, 122, 61, 61,
-61, 110, 117, 108, 108, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101,
-119, 32, 36, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 69, 120,
-112, 101, 99, 116, 101, 100, 32, 65, 114, 101, 97, 47, 76, 111, 99, 97, 116,
-105, 111, 110, 32, 102, 111, 114, 32, 116, 105, 109, 101, 32, 122, 111, 110,
-101, 44, 32, 103, 111, 116, 32, 39, 43, 98, 74, 41, 59, 10, 125, 10, 118, 97,
-114, 32, 98, 116, 61, 116, 111, 84, 105, 116, 108, 101, 67, 97, 115, 101, 87,
-111, 114, 100, 40, 98, 122, 91, 49, 93, 41, 43, 39, 47, 39, 43, 116, 111, 84,
-105, 116, 108, 101, 67, 97, 115, 101, 87, 111, 114, 100, 40, 98, 122, 91, 50,
-93, 41, 59, 10, 118, 97, 114, 32, 85, 61, 51, 59, 10, 119, 104, 105, 108, 101,
-40, 98, 122, 91, 85, 93, 33, 61, 61, 98, 38, 38, 85, 60, 98, 122, 46, 108, 101,
-110, 103, 116, 104, 41, 123, 10, 98, 116, 61, 98, 116, 43, 39, 95, 39, 43, 116,
-111, 84, 105, 116, 108, 101, 67, 97, 115, 101, 87, 111, 114, 100, 40, 98, 122,
-91, 85, 93, 41, 59, 10, 85, 43, 43, 59, 10, 125, 10, 114, 101, 116, 117, 114,
-110, 32, 98, 116, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
-105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 66, 114, 101, 97, 107, 73, 116,
-101, 114, 97, 116, 111, 114, 40, 98, 76, 44, 79, 44, 80, 41, 123, 10, 105, 102,
-40, 37, 73, 115, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73, 110,
-116, 108, 79, 98, 106, 101, 99, 116, 40, 98, 76, 41, 41, 123, 10, 116, 104, 114,
-111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114,
-40, 39, 84, 114, 121, 105, 110, 103, 32, 116, 111, 32, 114, 101, 45, 105, 110,
-105, 116, 105, 97, 108, 105, 122, 101, 32, 118, 56, 66, 114, 101, 97, 107, 73,
-116, 101, 114, 97, 116, 111, 114, 32, 111, 98, 106, 101, 99, 116, 46, 39, 41,
-59, 10, 125, 10, 105, 102, 40, 80, 61, 61, 61, 98, 41, 123, 10, 80, 61, 123,
-125, 59, 10, 125, 10, 118, 97, 114, 32, 90, 61, 103, 101, 116, 71, 101, 116, 79,
-112, 116, 105, 111, 110, 40, 80, 44, 39, 98, 114, 101, 97, 107, 105, 116, 101,
-114, 97, 116, 111, 114, 39, 41, 59, 10, 118, 97, 114, 32, 98, 97, 61, 123, 125,
-59, 10, 100, 101, 102, 105, 110, 101, 87, 69, 80, 114, 111, 112, 101, 114, 116,
-121, 40, 98, 97, 44, 39, 116, 121, 112, 101, 39, 44, 90, 40, 10, 39, 116, 121,
-112, 101, 39, 44, 39, 115, 116, 114, 105, 110, 103, 39, 44, 91, 39, 99, 104, 97,
-114, 97, 99, 116, 101, 114, 39, 44, 39, 119, 111, 114, 100, 39, 44, 39, 115,
-101, 110, 116, 101, 110, 99, 101, 39, 44, 39, 108, 105, 110, 101, 39, 93, 44,
-39, 119, 111, 114, 100, 39, 41, 41, 59, 10, 118, 97, 114, 32, 87, 61, 114, 101,
-115, 111, 108, 118, 101, 76, 111, 99, 97, 108, 101, 40, 39, 98, 114, 101, 97,
-107, 105, 116, 101, 114, 97, 116, 111, 114, 39, 44, 79, 44, 80, 41, 59, 10, 118,
-97, 114, 32, 97, 102, 61, 79, 98, 106, 101, 99, 116, 68, 101, 102, 105, 110,
-101, 80, 114, 111, 112, 101, 114, 116, 105, 101, 115, 40, 123, 125, 44, 123, 10,
-114, 101, 113, 117, 101, 115, 116, 101, 100, 76, 111, 99, 97, 108, 101, 58, 123,
-118, 97, 108, 117, 101, 58, 87, 46, 108, 111, 99, 97, 108, 101, 44, 119, 114,
-105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 116, 121, 112,
-101, 58, 123, 118, 97, 108, 117, 101, 58, 98, 97, 46, 116, 121, 112, 101, 44,
-119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 125, 44, 10, 108,
-111, 99, 97, 108, 101, 58, 123, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116,
-114, 117, 101, 125, 10, 125, 41, 59, 10, 118, 97, 114, 32, 98, 77, 61, 37, 67,
-114, 101, 97, 116, 101, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111,
-114, 40, 87, 46, 108, 111, 99, 97, 108, 101, 44, 10, 98, 97, 44, 10, 97, 102,
-41, 59, 10, 37, 77, 97, 114, 107, 65, 115, 73, 110, 105, 116, 105, 97, 108, 105,
-122, 101, 100, 73, 110, 116, 108, 79, 98, 106, 101, 99, 116, 79, 102, 84, 121,
-112, 101, 40, 98, 76, 44, 39, 98, 114, 101, 97, 107, 105, 116, 101, 114, 97,
-116, 111, 114, 39, 44, 10, 98, 77, 41, 59, 10, 79, 98, 106, 101, 99, 116, 68,
-101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 98, 76, 44,
-39, 114, 101, 115, 111, 108, 118, 101, 100, 39, 44, 123, 118, 97, 108, 117, 101,
-58, 97, 102, 125, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 98, 76, 59, 10,
-125, 10, 37, 65, 100, 100, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 44,
-39, 118, 56, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 39,
-44, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 118, 97, 114, 32,
-79, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 48, 41, 59, 10,
-118, 97, 114, 32, 80, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115,
-40, 49, 41, 59, 10, 105, 102, 40, 33, 116, 104, 105, 115, 124, 124, 116, 104,
-105, 115, 61, 61, 61, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 110,
-101, 119, 32, 97, 46, 118, 56, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97,
-116, 111, 114, 40, 79, 44, 80, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114,
-110, 32, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 66, 114, 101, 97, 107,
-73, 116, 101, 114, 97, 116, 111, 114, 40, 84, 111, 79, 98, 106, 101, 99, 116,
-40, 116, 104, 105, 115, 41, 44, 79, 44, 80, 41, 59, 10, 125, 44, 10, 50, 10, 41,
-59, 10, 37, 65, 100, 100, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 46,
-118, 56, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 46, 112,
-114, 111, 116, 111, 116, 121, 112, 101, 44, 39, 114, 101, 115, 111, 108, 118,
-101, 100, 79, 112, 116, 105, 111, 110, 115, 39, 44, 102, 117, 110, 99, 116, 105,
-111, 110, 40, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115,
-116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 116, 104, 114,
-111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114,
-40, 67, 41, 59, 10, 125, 10, 105, 102, 40, 33, 37, 73, 115, 73, 110, 105, 116,
-105, 97, 108, 105, 122, 101, 100, 73, 110, 116, 108, 79, 98, 106, 101, 99, 116,
-79, 102, 84, 121, 112, 101, 40, 116, 104, 105, 115, 44, 39, 98, 114, 101, 97,
-107, 105, 116, 101, 114, 97, 116, 111, 114, 39, 41, 41, 123, 10, 116, 104, 114,
-111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114,
-40, 39, 114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116, 105, 111, 110,
-115, 32, 109, 101, 116, 104, 111, 100, 32, 99, 97, 108, 108, 101, 100, 32, 111,
-110, 32, 97, 32, 110, 111, 110, 45, 111, 98, 106, 101, 99, 116, 32, 111, 114,
-32, 39, 43, 10, 39, 111, 110, 32, 97, 32, 111, 98, 106, 101, 99, 116, 32, 116,
-104, 97, 116, 32, 105, 115, 32, 110, 111, 116, 32, 73, 110, 116, 108, 46, 118,
-56, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 46, 39, 41, 59,
-10, 125, 10, 118, 97, 114, 32, 98, 78, 61, 116, 104, 105, 115, 59, 10, 118, 97,
-114, 32, 87, 61, 103, 101, 116, 79, 112, 116, 105, 109, 97, 108, 76, 97, 110,
-103, 117, 97, 103, 101, 84, 97, 103, 40, 98, 78, 46, 114, 101, 115, 111, 108,
-118, 101, 100, 46, 114, 101, 113, 117, 101, 115, 116, 101, 100, 76, 111, 99, 97,
-108, 101, 44, 10, 98, 78, 46, 114, 101, 115, 111, 108, 118, 101, 100, 46, 108,
-111, 99, 97, 108, 101, 41, 59, 10, 114, 101, 116, 117, 114, 110, 123, 10, 108,
-111, 99, 97, 108, 101, 58, 87, 44, 10, 116, 121, 112, 101, 58, 98, 78, 46, 114,
-101, 115, 111, 108, 118, 101, 100, 46, 116, 121, 112, 101, 10, 125, 59, 10, 125,
-44, 10, 50, 10, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101,
-116, 78, 97, 109, 101, 40, 97, 46, 118, 56, 66, 114, 101, 97, 107, 73, 116, 101,
-114, 97, 116, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
-114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116, 105, 111, 110, 115, 44,
-10, 39, 114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116, 105, 111, 110,
-115, 39, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 82, 101, 109,
-111, 118, 101, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 97, 46, 118, 56,
-66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 46, 112, 114, 111,
-116, 111, 116, 121, 112, 101, 46, 114, 101, 115, 111, 108, 118, 101, 100, 79,
-112, 116, 105, 111, 110, 115, 41, 59, 10, 37, 83, 101, 116, 78, 97, 116, 105,
-118, 101, 70, 108, 97, 103, 40, 97, 46, 118, 56, 66, 114, 101, 97, 107, 73, 116,
-101, 114, 97, 116, 111, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
-46, 114, 101, 115, 111, 108, 118, 101, 100, 79, 112, 116, 105, 111, 110, 115,
-41, 59, 10, 37, 65, 100, 100, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 46,
-118, 56, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 44, 39,
-115, 117, 112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79,
-102, 39, 44, 102, 117, 110, 99, 116, 105, 111, 110, 40, 79, 41, 123, 10, 105,
-102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97,
-108, 108, 40, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32,
-36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 67, 41, 59, 10, 125, 10, 114,
-101, 116, 117, 114, 110, 32, 115, 117, 112, 112, 111, 114, 116, 101, 100, 76,
-111, 99, 97, 108, 101, 115, 79, 102, 40, 39, 98, 114, 101, 97, 107, 105, 116,
-101, 114, 97, 116, 111, 114, 39, 44, 79, 44, 37, 95, 65, 114, 103, 117, 109,
-101, 110, 116, 115, 40, 49, 41, 41, 59, 10, 125, 44, 10, 50, 10, 41, 59, 10, 37,
-70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 78, 97, 109, 101, 40, 97,
-46, 118, 56, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 46,
-115, 117, 112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79,
-102, 44, 39, 115, 117, 112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108,
-101, 115, 79, 102, 39, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 82,
-101, 109, 111, 118, 101, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 97, 46,
-118, 56, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 46, 115,
-117, 112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115, 79, 102,
-41, 59, 10, 37, 83, 101, 116, 78, 97, 116, 105, 118, 101, 70, 108, 97, 103, 40,
-97, 46, 118, 56, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114,
-46, 115, 117, 112, 112, 111, 114, 116, 101, 100, 76, 111, 99, 97, 108, 101, 115,
-79, 102, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 100, 111,
-112, 116, 84, 101, 120, 116, 40, 98, 76, 44, 98, 79, 41, 123, 10, 37, 66, 114,
-101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 65, 100, 111, 112, 116, 84,
-101, 120, 116, 40, 37, 71, 101, 116, 73, 109, 112, 108, 70, 114, 111, 109, 73,
-110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73, 110, 116, 108, 79, 98, 106,
-101, 99, 116, 40, 98, 76, 41, 44, 10, 36, 83, 116, 114, 105, 110, 103, 40, 98,
-79, 41, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 102,
-105, 114, 115, 116, 40, 98, 76, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32,
-37, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 70, 105, 114,
-115, 116, 40, 37, 71, 101, 116, 73, 109, 112, 108, 70, 114, 111, 109, 73, 110,
-105, 116, 105, 97, 108, 105, 122, 101, 100, 73, 110, 116, 108, 79, 98, 106, 101,
-99, 116, 40, 98, 76, 41, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111,
-110, 32, 110, 101, 120, 116, 40, 98, 76, 41, 123, 10, 114, 101, 116, 117, 114,
-110, 32, 37, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 78,
-101, 120, 116, 40, 37, 71, 101, 116, 73, 109, 112, 108, 70, 114, 111, 109, 73,
-110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73, 110, 116, 108, 79, 98, 106,
-101, 99, 116, 40, 98, 76, 41, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105,
-111, 110, 32, 99, 117, 114, 114, 101, 110, 116, 40, 98, 76, 41, 123, 10, 114,
-101, 116, 117, 114, 110, 32, 37, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97,
-116, 111, 114, 67, 117, 114, 114, 101, 110, 116, 40, 37, 71, 101, 116, 73, 109,
-112, 108, 70, 114, 111, 109, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101,
-100, 73, 110, 116, 108, 79, 98, 106, 101, 99, 116, 40, 98, 76, 41, 41, 59, 10,
-125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 98, 114, 101, 97, 107, 84,
-121, 112, 101, 40, 98, 76, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37,
-66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 66, 114, 101, 97,
-107, 84, 121, 112, 101, 40, 37, 71, 101, 116, 73, 109, 112, 108, 70, 114, 111,
-109, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 73, 110, 116, 108, 79,
-98, 106, 101, 99, 116, 40, 98, 76, 41, 41, 59, 10, 125, 10, 97, 100, 100, 66,
-111, 117, 110, 100, 77, 101, 116, 104, 111, 100, 40, 97, 46, 118, 56, 66, 114,
-101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114, 44, 39, 97, 100, 111, 112,
-116, 84, 101, 120, 116, 39, 44, 97, 100, 111, 112, 116, 84, 101, 120, 116, 44,
-49, 41, 59, 10, 97, 100, 100, 66, 111, 117, 110, 100, 77, 101, 116, 104, 111,
-100, 40, 97, 46, 118, 56, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116,
-111, 114, 44, 39, 102, 105, 114, 115, 116, 39, 44, 102, 105, 114, 115, 116, 44,
-48, 41, 59, 10, 97, 100, 100, 66, 111, 117, 110, 100, 77, 101, 116, 104, 111,
-100, 40, 97, 46, 118, 56, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116,
-111, 114, 44, 39, 110, 101, 120, 116, 39, 44, 110, 101, 120, 116, 44, 48, 41,
-59, 10, 97, 100, 100, 66, 111, 117, 110, 100, 77, 101, 116, 104, 111, 100, 40,
-97, 46, 118, 56, 66, 114, 101, 97, 107, 73, 116, 101, 114, 97, 116, 111, 114,
-44, 39, 99, 117, 114, 114, 101, 110, 116, 39, 44, 99, 117, 114, 114, 101, 110,
-116, 44, 48, 41, 59, 10, 97, 100, 100, 66, 111, 117, 110, 100, 77, 101, 116,
-104, 111, 100, 40, 97, 46, 118, 56, 66, 114, 101, 97, 107, 73, 116, 101, 114,
-97, 116, 111, 114, 44, 39, 98, 114, 101, 97, 107, 84, 121, 112, 101, 39, 44, 98,
-114, 101, 97, 107, 84, 121, 112, 101, 44, 48, 41, 59, 10, 118, 97, 114, 32, 98,
-80, 61, 123, 10, 39, 99, 111, 108, 108, 97, 116, 111, 114, 39, 58, 97, 46, 67,
-111, 108, 108, 97, 116, 111, 114, 44, 10, 39, 110, 117, 109, 98, 101, 114, 102,
-111, 114, 109, 97, 116, 39, 58, 97, 46, 78, 117, 109, 98, 101, 114, 70, 111,
-114, 109, 97, 116, 44, 10, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97, 116,
-97, 108, 108, 39, 58, 97, 46, 68, 97, 116, 101, 84, 105, 109, 101, 70, 111, 114,
-109, 97, 116, 44, 10, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97, 116, 100,
-97, 116, 101, 39, 58, 97, 46, 68, 97, 116, 101, 84, 105, 109, 101, 70, 111, 114,
-109, 97, 116, 44, 10, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97, 116, 116,
-105, 109, 101, 39, 58, 97, 46, 68, 97, 116, 101, 84, 105, 109, 101, 70, 111,
-114, 109, 97, 116, 10, 125, 59, 10, 118, 97, 114, 32, 98, 81, 61, 123, 10, 39,
-99, 111, 108, 108, 97, 116, 111, 114, 39, 58, 98, 44, 10, 39, 110, 117, 109, 98,
-101, 114, 102, 111, 114, 109, 97, 116, 39, 58, 98, 44, 10, 39, 100, 97, 116,
-101, 102, 111, 114, 109, 97, 116, 97, 108, 108, 39, 58, 98, 44, 10, 39, 100, 97,
-116, 101, 102, 111, 114, 109, 97, 116, 100, 97, 116, 101, 39, 58, 98, 44, 10,
-39, 100, 97, 116, 101, 102, 111, 114, 109, 97, 116, 116, 105, 109, 101, 39, 58,
-98, 44, 10, 125, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 97, 99,
-104, 101, 100, 79, 114, 78, 101, 119, 83, 101, 114, 118, 105, 99, 101, 40, 78,
-44, 79, 44, 80, 44, 98, 66, 41, 123, 10, 118, 97, 114, 32, 98, 82, 61, 40, 98,
-66, 61, 61, 61, 98, 41, 63, 80, 58, 98, 66, 59, 10, 105, 102, 40, 79, 61, 61,
-61, 98, 38, 38, 80, 61, 61, 61, 98, 41, 123, 10, 105, 102, 40, 98, 81, 91, 78,
-93, 61, 61, 61, 98, 41, 123, 10, 98, 81, 91, 78, 93, 61, 110, 101, 119, 32, 98,
-80, 91, 78, 93, 40, 79, 44, 98, 82, 41, 59, 10, 125, 10, 114, 101, 116, 117,
-114, 110, 32, 98, 81, 91, 78, 93, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110,
-32, 110, 101, 119, 32, 98, 80, 91, 78, 93, 40, 79, 44, 98, 82, 41, 59, 10, 125,
-10, 79, 98, 106, 101, 99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111, 112,
-101, 114, 116, 121, 40, 36, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116,
-111, 116, 121, 112, 101, 44, 39, 108, 111, 99, 97, 108, 101, 67, 111, 109, 112,
-97, 114, 101, 39, 44, 123, 10, 118, 97, 108, 117, 101, 58, 102, 117, 110, 99,
-116, 105, 111, 110, 40, 74, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111,
-110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 116,
-104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114,
-111, 114, 40, 67, 41, 59, 10, 125, 10, 105, 102, 40, 40, 116, 104, 105, 115, 61,
-61, 110, 117, 108, 108, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101,
-119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 77, 101, 116,
-104, 111, 100, 32, 105, 110, 118, 111, 107, 101, 100, 32, 111, 110, 32, 117,
-110, 100, 101, 102, 105, 110, 101, 100, 32, 111, 114, 32, 110, 117, 108, 108,
-32, 118, 97, 108, 117, 101, 46, 39, 41, 59, 10, 125, 10, 118, 97, 114, 32, 79,
-61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 118,
-97, 114, 32, 80, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 50,
-41, 59, 10, 118, 97, 114, 32, 97, 90, 61, 99, 97, 99, 104, 101, 100, 79, 114,
-78, 101, 119, 83, 101, 114, 118, 105, 99, 101, 40, 39, 99, 111, 108, 108, 97,
-116, 111, 114, 39, 44, 79, 44, 80, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32,
-99, 111, 109, 112, 97, 114, 101, 40, 97, 90, 44, 116, 104, 105, 115, 44, 74, 41,
-59, 10, 125, 44, 10, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117,
-101, 44, 10, 99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 58, 116,
-114, 117, 101, 44, 10, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 102,
-97, 108, 115, 101, 10, 125, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111,
-110, 83, 101, 116, 78, 97, 109, 101, 40, 36, 83, 116, 114, 105, 110, 103, 46,
-112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 108, 111, 99, 97, 108, 101, 67,
-111, 109, 112, 97, 114, 101, 44, 39, 108, 111, 99, 97, 108, 101, 67, 111, 109,
-112, 97, 114, 101, 39, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 82,
-101, 109, 111, 118, 101, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 36, 83,
-116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
-108, 111, 99, 97, 108, 101, 67, 111, 109, 112, 97, 114, 101, 41, 59, 10, 37, 83,
-101, 116, 78, 97, 116, 105, 118, 101, 70, 108, 97, 103, 40, 36, 83, 116, 114,
-105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 108, 111,
-99, 97, 108, 101, 67, 111, 109, 112, 97, 114, 101, 41, 59, 10, 79, 98, 106, 101,
-99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40,
-36, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112,
-101, 44, 39, 110, 111, 114, 109, 97, 108, 105, 122, 101, 39, 44, 123, 10, 118,
-97, 108, 117, 101, 58, 102, 117, 110, 99, 116, 105, 111, 110, 40, 74, 41, 123,
-10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116,
-67, 97, 108, 108, 40, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101,
-119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 67, 41, 59, 10, 125,
-10, 105, 102, 40, 40, 116, 104, 105, 115, 61, 61, 110, 117, 108, 108, 41, 38,
-38, 33, 40, 37, 95, 73, 115, 85, 110, 100, 101, 116, 101, 99, 116, 97, 98, 108,
-101, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 116, 104,
-114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114,
-40, 39, 99, 97, 108, 108, 101, 100, 95, 111, 110, 95, 110, 117, 108, 108, 95,
-111, 114, 95, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 44, 91, 34, 83,
-116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46,
-110, 111, 114, 109, 97, 108, 105, 122, 101, 34, 93, 41, 59, 10, 118, 97, 114,
-32, 98, 83, 61, 36, 83, 116, 114, 105, 110, 103, 40, 37, 95, 65, 114, 103, 117,
-109, 101, 110, 116, 115, 40, 48, 41, 124, 124, 39, 78, 70, 67, 39, 41, 59, 10,
-118, 97, 114, 32, 98, 84, 61, 100, 46, 105, 110, 100, 101, 120, 79, 102, 40, 98,
-83, 41, 59, 10, 105, 102, 40, 98, 84, 61, 61, 61, 45, 49, 41, 123, 10, 116, 104,
-114, 111, 119, 32, 110, 101, 119, 32, 36, 82, 97, 110, 103, 101, 69, 114, 114,
-111, 114, 40, 39, 84, 104, 101, 32, 110, 111, 114, 109, 97, 108, 105, 122, 97,
-116, 105, 111, 110, 32, 102, 111, 114, 109, 32, 115, 104, 111, 117, 108, 100,
-32, 98, 101, 32, 111, 110, 101, 32, 111, 102, 32, 39, 10, 43, 100, 46, 106, 111,
-105, 110, 40, 39, 44, 32, 39, 41, 43, 39, 46, 39, 41, 59, 10, 125, 10, 114, 101,
-116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 78, 111, 114, 109, 97,
-108, 105, 122, 101, 40, 116, 104, 105, 115, 44, 98, 84, 41, 59, 10, 125, 44, 10,
-119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 99, 111,
-110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10,
-101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 102, 97, 108, 115, 101, 10,
-125, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 78, 97,
-109, 101, 40, 36, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116,
-121, 112, 101, 46, 110, 111, 114, 109, 97, 108, 105, 122, 101, 44, 39, 110, 111,
-114, 109, 97, 108, 105, 122, 101, 39, 41, 59, 10, 37, 70, 117, 110, 99, 116,
-105, 111, 110, 82, 101, 109, 111, 118, 101, 80, 114, 111, 116, 111, 116, 121,
-112, 101, 40, 36, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116,
-121, 112, 101, 46, 110, 111, 114, 109, 97, 108, 105, 122, 101, 41, 59, 10, 37,
-83, 101, 116, 78, 97, 116, 105, 118, 101, 70, 108, 97, 103, 40, 36, 83, 116,
-114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 110,
-111, 114, 109, 97, 108, 105, 122, 101, 41, 59, 10, 79, 98, 106, 101, 99, 116,
-68, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 36, 78,
-117, 109, 98, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 39,
-116, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114, 105, 110, 103, 39, 44, 123,
-10, 118, 97, 108, 117, 101, 58, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41,
-123, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99,
-116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110,
-101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 67, 41, 59, 10,
-125, 10, 105, 102, 40, 33, 40, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97,
-110, 99, 101, 111, 102, 32, 36, 78, 117, 109, 98, 101, 114, 41, 38, 38, 116,
-121, 112, 101, 111, 102, 40, 116, 104, 105, 115, 41, 33, 61, 61, 39, 110, 117,
-109, 98, 101, 114, 39, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119,
-32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 77, 101, 116, 104,
-111, 100, 32, 105, 110, 118, 111, 107, 101, 100, 32, 111, 110, 32, 97, 110, 32,
-111, 98, 106, 101, 99, 116, 32, 116, 104, 97, 116, 32, 105, 115, 32, 110, 111,
-116, 32, 78, 117, 109, 98, 101, 114, 46, 39, 41, 59, 10, 125, 10, 118, 97, 114,
-32, 79, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 48, 41, 59,
-10, 118, 97, 114, 32, 80, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116,
-115, 40, 49, 41, 59, 10, 118, 97, 114, 32, 98, 107, 61, 99, 97, 99, 104, 101,
-100, 79, 114, 78, 101, 119, 83, 101, 114, 118, 105, 99, 101, 40, 39, 110, 117,
-109, 98, 101, 114, 102, 111, 114, 109, 97, 116, 39, 44, 79, 44, 80, 41, 59, 10,
-114, 101, 116, 117, 114, 110, 32, 102, 111, 114, 109, 97, 116, 78, 117, 109, 98,
-101, 114, 40, 98, 107, 44, 116, 104, 105, 115, 41, 59, 10, 125, 44, 10, 119,
-114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 99, 111, 110,
-102, 105, 103, 117, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 101,
-110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 102, 97, 108, 115, 101, 10, 125,
-41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 78, 97, 109,
-101, 40, 36, 78, 117, 109, 98, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121,
-112, 101, 46, 116, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114, 105, 110, 103,
-44, 39, 116, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114, 105, 110, 103, 39,
-41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 82, 101, 109, 111, 118,
-101, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 36, 78, 117, 109, 98, 101,
-114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 76, 111, 99,
-97, 108, 101, 83, 116, 114, 105, 110, 103, 41, 59, 10, 37, 83, 101, 116, 78, 97,
-116, 105, 118, 101, 70, 108, 97, 103, 40, 36, 78, 117, 109, 98, 101, 114, 46,
-112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 76, 111, 99, 97, 108,
-101, 83, 116, 114, 105, 110, 103, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111,
-110, 32, 116, 111, 76, 111, 99, 97, 108, 101, 68, 97, 116, 101, 84, 105, 109,
-101, 40, 98, 85, 44, 79, 44, 80, 44, 98, 65, 44, 98, 66, 44, 78, 41, 123, 10,
-105, 102, 40, 33, 40, 98, 85, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111,
-102, 32, 36, 68, 97, 116, 101, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32,
-110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 77,
-101, 116, 104, 111, 100, 32, 105, 110, 118, 111, 107, 101, 100, 32, 111, 110,
-32, 97, 110, 32, 111, 98, 106, 101, 99, 116, 32, 116, 104, 97, 116, 32, 105,
-115, 32, 110, 111, 116, 32, 68, 97, 116, 101, 46, 39, 41, 59, 10, 125, 10, 105,
-102, 40, 36, 105, 115, 78, 97, 78, 40, 98, 85, 41, 41, 123, 10, 114, 101, 116,
-117, 114, 110, 39, 73, 110, 118, 97, 108, 105, 100, 32, 68, 97, 116, 101, 39,
-59, 10, 125, 10, 118, 97, 114, 32, 98, 97, 61, 116, 111, 68, 97, 116, 101, 84,
-105, 109, 101, 79, 112, 116, 105, 111, 110, 115, 40, 80, 44, 98, 65, 44, 98, 66,
-41, 59, 10, 118, 97, 114, 32, 98, 68, 61, 10, 99, 97, 99, 104, 101, 100, 79,
-114, 78, 101, 119, 83, 101, 114, 118, 105, 99, 101, 40, 78, 44, 79, 44, 80, 44,
-98, 97, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 102, 111, 114, 109, 97,
-116, 68, 97, 116, 101, 40, 98, 68, 44, 98, 85, 41, 59, 10, 125, 10, 79, 98, 106,
-101, 99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116,
-121, 40, 36, 68, 97, 116, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
-44, 39, 116, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114, 105, 110, 103, 39,
-44, 123, 10, 118, 97, 108, 117, 101, 58, 102, 117, 110, 99, 116, 105, 111, 110,
-40, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114,
-117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 116, 104, 114, 111, 119,
-32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 67,
-41, 59, 10, 125, 10, 118, 97, 114, 32, 79, 61, 37, 95, 65, 114, 103, 117, 109,
-101, 110, 116, 115, 40, 48, 41, 59, 10, 118, 97, 114, 32, 80, 61, 37, 95, 65,
-114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 114, 101, 116, 117,
-114, 110, 32, 116, 111, 76, 111, 99, 97, 108, 101, 68, 97, 116, 101, 84, 105,
-109, 101, 40, 10, 116, 104, 105, 115, 44, 79, 44, 80, 44, 39, 97, 110, 121, 39,
-44, 39, 97, 108, 108, 39, 44, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97,
-116, 97, 108, 108, 39, 41, 59, 10, 125, 44, 10, 119, 114, 105, 116, 97, 98, 108,
-101, 58, 116, 114, 117, 101, 44, 10, 99, 111, 110, 102, 105, 103, 117, 114, 97,
-98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 101, 110, 117, 109, 101, 114, 97,
-98, 108, 101, 58, 102, 97, 108, 115, 101, 10, 125, 41, 59, 10, 37, 70, 117, 110,
-99, 116, 105, 111, 110, 83, 101, 116, 78, 97, 109, 101, 40, 36, 68, 97, 116,
-101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 76, 111, 99,
-97, 108, 101, 83, 116, 114, 105, 110, 103, 44, 39, 116, 111, 76, 111, 99, 97,
-108, 101, 83, 116, 114, 105, 110, 103, 39, 41, 59, 10, 37, 70, 117, 110, 99,
-116, 105, 111, 110, 82, 101, 109, 111, 118, 101, 80, 114, 111, 116, 111, 116,
-121, 112, 101, 40, 36, 68, 97, 116, 101, 46, 112, 114, 111, 116, 111, 116, 121,
-112, 101, 46, 116, 111, 76, 111, 99, 97, 108, 101, 83, 116, 114, 105, 110, 103,
-41, 59, 10, 37, 83, 101, 116, 78, 97, 116, 105, 118, 101, 70, 108, 97, 103, 40,
-36, 68, 97, 116, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116,
-111, 76, 111, 99, 97, 108, 101, 83, 116, 114, 105, 110, 103, 41, 59, 10, 79, 98,
-106, 101, 99, 116, 68, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114,
-116, 121, 40, 36, 68, 97, 116, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112,
-101, 44, 39, 116, 111, 76, 111, 99, 97, 108, 101, 68, 97, 116, 101, 83, 116,
-114, 105, 110, 103, 39, 44, 123, 10, 118, 97, 108, 117, 101, 58, 102, 117, 110,
-99, 116, 105, 111, 110, 40, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111,
-110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 116,
-104, 114, 111, 119, 32, 110, 101, 119, 32, 36, 84, 121, 112, 101, 69, 114, 114,
-111, 114, 40, 67, 41, 59, 10, 125, 10, 118, 97, 114, 32, 79, 61, 37, 95, 65,
-114, 103, 117, 109, 101, 110, 116, 115, 40, 48, 41, 59, 10, 118, 97, 114, 32,
-80, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10,
-114, 101, 116, 117, 114, 110, 32, 116, 111, 76, 111, 99, 97, 108, 101, 68, 97,
-116, 101, 84, 105, 109, 101, 40, 10, 116, 104, 105, 115, 44, 79, 44, 80, 44, 39,
-100, 97, 116, 101, 39, 44, 39, 100, 97, 116, 101, 39, 44, 39, 100, 97, 116, 101,
-102, 111, 114, 109, 97, 116, 100, 97, 116, 101, 39, 41, 59, 10, 125, 44, 10,
-119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10, 99, 111,
-110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10,
-101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 102, 97, 108, 115, 101, 10,
-125, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 78, 97,
-109, 101, 40, 36, 68, 97, 116, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112,
-101, 46, 116, 111, 76, 111, 99, 97, 108, 101, 68, 97, 116, 101, 83, 116, 114,
-105, 110, 103, 44, 39, 116, 111, 76, 111, 99, 97, 108, 101, 68, 97, 116, 101,
-83, 116, 114, 105, 110, 103, 39, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105,
-111, 110, 82, 101, 109, 111, 118, 101, 80, 114, 111, 116, 111, 116, 121, 112,
-101, 40, 36, 68, 97, 116, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
-46, 116, 111, 76, 111, 99, 97, 108, 101, 68, 97, 116, 101, 83, 116, 114, 105,
-110, 103, 41, 59, 10, 37, 83, 101, 116, 78, 97, 116, 105, 118, 101, 70, 108, 97,
-103, 40, 36, 68, 97, 116, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
-46, 116, 111, 76, 111, 99, 97, 108, 101, 68, 97, 116, 101, 83, 116, 114, 105,
-110, 103, 41, 59, 10, 79, 98, 106, 101, 99, 116, 68, 101, 102, 105, 110, 101,
-80, 114, 111, 112, 101, 114, 116, 121, 40, 36, 68, 97, 116, 101, 46, 112, 114,
-111, 116, 111, 116, 121, 112, 101, 44, 39, 116, 111, 76, 111, 99, 97, 108, 101,
-84, 105, 109, 101, 83, 116, 114, 105, 110, 103, 39, 44, 123, 10, 118, 97, 108,
-117, 101, 58, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123, 10, 105, 102,
-40, 37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108,
-108, 40, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 36,
-84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 67, 41, 59, 10, 125, 10, 118, 97,
-114, 32, 79, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 48, 41,
-59, 10, 118, 97, 114, 32, 80, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116,
-115, 40, 49, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 116, 111, 76, 111,
-99, 97, 108, 101, 68, 97, 116, 101, 84, 105, 109, 101, 40, 10, 116, 104, 105,
-115, 44, 79, 44, 80, 44, 39, 116, 105, 109, 101, 39, 44, 39, 116, 105, 109, 101,
-39, 44, 39, 100, 97, 116, 101, 102, 111, 114, 109, 97, 116, 116, 105, 109, 101,
-39, 41, 59, 10, 125, 44, 10, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114,
-117, 101, 44, 10, 99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 58,
-116, 114, 117, 101, 44, 10, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58,
-102, 97, 108, 115, 101, 10, 125, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105,
-111, 110, 83, 101, 116, 78, 97, 109, 101, 40, 36, 68, 97, 116, 101, 46, 112,
-114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 76, 111, 99, 97, 108, 101,
-84, 105, 109, 101, 83, 116, 114, 105, 110, 103, 44, 39, 116, 111, 76, 111, 99,
-97, 108, 101, 84, 105, 109, 101, 83, 116, 114, 105, 110, 103, 39, 41, 59, 10,
-37, 70, 117, 110, 99, 116, 105, 111, 110, 82, 101, 109, 111, 118, 101, 80, 114,
-111, 116, 111, 116, 121, 112, 101, 40, 36, 68, 97, 116, 101, 46, 112, 114, 111,
-116, 111, 116, 121, 112, 101, 46, 116, 111, 76, 111, 99, 97, 108, 101, 84, 105,
-109, 101, 83, 116, 114, 105, 110, 103, 41, 59, 10, 37, 83, 101, 116, 78, 97,
-116, 105, 118, 101, 70, 108, 97, 103, 40, 36, 68, 97, 116, 101, 46, 112, 114,
-111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 76, 111, 99, 97, 108, 101, 84,
-105, 109, 101, 83, 116, 114, 105, 110, 103, 41, 59, 10, 114, 101, 116, 117, 114,
-110, 32, 97, 59, 10, 125, 40, 41, 41, 125, 41, 59, 10, 10 };
+98, 115, 101, 114, 118, 101, 40, 41, 59, 10, 10 };
 
   static const char* raw_sources = reinterpret_cast<const char*>(sources);
 
   template <>
   int NativesCollection<CORE>::GetBuiltinsCount() {
-    return 20;
+    return 19;
   }
 
   template <>
@@ -19756,13 +17918,12 @@ namespace internal {
     if (strcmp(name, "weak_collection") == 0) return 16;
     if (strcmp(name, "promise") == 0) return 17;
     if (strcmp(name, "object-observe") == 0) return 18;
-    if (strcmp(name, "i18n") == 0) return 19;
     return -1;
   }
 
   template <>
   int NativesCollection<CORE>::GetRawScriptsSize() {
-    return 343026;
+    return 311045;
   }
 
   template <>
@@ -19786,7 +17947,6 @@ namespace internal {
     if (index == 16) return Vector<const char>(raw_sources + 290651, 3549);
     if (index == 17) return Vector<const char>(raw_sources + 294200, 5414);
     if (index == 18) return Vector<const char>(raw_sources + 299614, 11431);
-    if (index == 19) return Vector<const char>(raw_sources + 311045, 31981);
     return Vector<const char>("", 0);
   }
 
@@ -19811,18 +17971,17 @@ namespace internal {
     if (index == 16) return Vector<const char>("native weak_collection.js", 25);
     if (index == 17) return Vector<const char>("native promise.js", 17);
     if (index == 18) return Vector<const char>("native object-observe.js", 24);
-    if (index == 19) return Vector<const char>("native i18n.js", 14);
     return Vector<const char>("", 0);
   }
 
   template <>
   Vector<const byte> NativesCollection<CORE>::GetScriptsSource() {
-    return Vector<const byte>(sources, 343026);
+    return Vector<const byte>(sources, 311045);
   }
 
   template <>
   void NativesCollection<CORE>::SetRawScriptsSource(Vector<const char> raw_source) {
-    ASSERT(343026 == raw_source.length());
+    ASSERT(311045 == raw_source.length());
     raw_sources = raw_source.start();
   }
 
@@ -5,12 +5,7 @@ TARGET := process
 DEFS_Debug := '-DV8_TARGET_ARCH_X64' \
 	'-DENABLE_GDB_JIT_INTERFACE' \
 	'-DV8_DEPRECATION_WARNINGS' \
-	'-DV8_I18N_SUPPORT' \
 	'-DV8_USE_DEFAULT_PLATFORM' \
-	'-DV8_SHARED' \
-	'-DUSING_V8_SHARED' \
-	'-DU_USING_ICU_NAMESPACE=0' \
-	'-DU_ENABLE_DYLOAD=0' \
 	'-DENABLE_DISASSEMBLER' \
 	'-DV8_ENABLE_CHECKS' \
 	'-DOBJECT_PRINT' \
@@ -21,7 +16,7 @@ DEFS_Debug := '-DV8_TARGET_ARCH_X64' \
 
 # Flags passed to all source files.
 CFLAGS_Debug := -Wall \
-	-Werror \
+	 \
 	-W \
 	-Wno-unused-parameter \
 	-Wno-long-long \
@@ -29,12 +24,10 @@ CFLAGS_Debug := -Wall \
 	-fno-exceptions \
 	-pedantic \
 	-ansi \
-	-fPIC \
 	-m64 \
 	-m64 \
 	-g \
 	-Woverloaded-virtual \
-	 \
 	-Woverloaded-virtual \
 	-fdata-sections \
 	-ffunction-sections \
@@ -48,19 +41,12 @@ CFLAGS_C_Debug :=
 CFLAGS_CC_Debug := -Wnon-virtual-dtor \
 	-fno-rtti
 
-INCS_Debug := -I$(srcdir)/include \
-	-I$(srcdir)/third_party/icu/source/i18n \
-	-I$(srcdir)/third_party/icu/source/common
+INCS_Debug := -I$(srcdir)/include
 
 DEFS_Optdebug := '-DV8_TARGET_ARCH_X64' \
 	'-DENABLE_GDB_JIT_INTERFACE' \
 	'-DV8_DEPRECATION_WARNINGS' \
-	'-DV8_I18N_SUPPORT' \
 	'-DV8_USE_DEFAULT_PLATFORM' \
-	'-DV8_SHARED' \
-	'-DUSING_V8_SHARED' \
-	'-DU_USING_ICU_NAMESPACE=0' \
-	'-DU_ENABLE_DYLOAD=0' \
 	'-DENABLE_DISASSEMBLER' \
 	'-DV8_ENABLE_CHECKS' \
 	'-DOBJECT_PRINT' \
@@ -72,7 +58,7 @@ DEFS_Optdebug := '-DV8_TARGET_ARCH_X64' \
 
 # Flags passed to all source files.
 CFLAGS_Optdebug := -Wall \
-	-Werror \
+	 \
 	-W \
 	-Wno-unused-parameter \
 	-Wno-long-long \
@@ -80,12 +66,10 @@ CFLAGS_Optdebug := -Wall \
 	-fno-exceptions \
 	-pedantic \
 	-ansi \
-	-fPIC \
 	-m64 \
 	-m64 \
 	-g \
 	-Woverloaded-virtual \
-	 \
 	-Woverloaded-virtual \
 	-fdata-sections \
 	-ffunction-sections \
@@ -101,24 +85,17 @@ CFLAGS_C_Optdebug :=
 CFLAGS_CC_Optdebug := -Wnon-virtual-dtor \
 	-fno-rtti
 
-INCS_Optdebug := -I$(srcdir)/include \
-	-I$(srcdir)/third_party/icu/source/i18n \
-	-I$(srcdir)/third_party/icu/source/common
+INCS_Optdebug := -I$(srcdir)/include
 
 DEFS_Release := '-DV8_TARGET_ARCH_X64' \
 	'-DENABLE_GDB_JIT_INTERFACE' \
 	'-DV8_DEPRECATION_WARNINGS' \
-	'-DV8_I18N_SUPPORT' \
 	'-DV8_USE_DEFAULT_PLATFORM' \
-	'-DV8_SHARED' \
-	'-DUSING_V8_SHARED' \
-	'-DU_USING_ICU_NAMESPACE=0' \
-	'-DU_ENABLE_DYLOAD=0' \
 	'-DENABLE_HANDLE_ZAPPING'
 
 # Flags passed to all source files.
 CFLAGS_Release := -Wall \
-	-Werror \
+	 \
 	-W \
 	-Wno-unused-parameter \
 	-Wno-long-long \
@@ -126,12 +103,10 @@ CFLAGS_Release := -Wall \
 	-fno-exceptions \
 	-pedantic \
 	-ansi \
-	-fPIC \
 	-m64 \
 	-m64 \
 	-fdata-sections \
 	-ffunction-sections \
-	 \
 	-O3 \
 	-fdata-sections \
 	-ffunction-sections \
@@ -144,9 +119,7 @@ CFLAGS_C_Release :=
 CFLAGS_CC_Release := -Wnon-virtual-dtor \
 	-fno-rtti
 
-INCS_Release := -I$(srcdir)/include \
-	-I$(srcdir)/third_party/icu/source/i18n \
-	-I$(srcdir)/third_party/icu/source/common
+INCS_Release := -I$(srcdir)/include
 
 OBJS := $(obj).target/$(TARGET)/samples/process.o
 
@@ -154,7 +127,7 @@ OBJS := $(obj).target/$(TARGET)/samples/process.o
 all_deps += $(OBJS)
 
 # Make sure our dependencies are built before any of us.
-$(OBJS): | $(builddir)/lib.target/libv8.so $(builddir)/lib.target/libicui18n.so $(builddir)/lib.target/libicuuc.so $(obj).target/tools/gyp/libv8.so $(obj).target/third_party/icu/libicui18n.so $(obj).target/third_party/icu/libicuuc.so
+$(OBJS): | $(obj).target/tools/gyp/v8.stamp $(obj).target/tools/gyp/libv8_base.a $(obj).target/tools/gyp/libv8_libbase.a $(obj).target/tools/gyp/libv8_snapshot.a $(obj).target/tools/gyp/js2c.stamp $(obj).target/tools/gyp/generate_trig_table.stamp
 
 # CFLAGS et al overrides must be target-local.
 # See "Target-specific Variable Values" in the GNU Make manual.
@@ -181,31 +154,25 @@ LDFLAGS_Debug := -pthread \
 	-m64 \
 	-m64 \
 	-rdynamic \
-	-rdynamic \
-	-Wl,-rpath=\$$ORIGIN/lib.target/ \
-	-Wl,-rpath-link=\$(builddir)/lib.target/
+	-rdynamic
 
 LDFLAGS_Optdebug := -pthread \
 	-m64 \
 	-m64 \
 	-rdynamic \
-	-rdynamic \
-	-Wl,-rpath=\$$ORIGIN/lib.target/ \
-	-Wl,-rpath-link=\$(builddir)/lib.target/
+	-rdynamic
 
 LDFLAGS_Release := -pthread \
 	-m64 \
-	-m64 \
-	-Wl,-rpath=\$$ORIGIN/lib.target/ \
-	-Wl,-rpath-link=\$(builddir)/lib.target/
+	-m64
 
-LIBS := 
+LIBS := -lrt
 
 $(builddir)/process: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
 $(builddir)/process: LIBS := $(LIBS)
-$(builddir)/process: LD_INPUTS := $(OBJS) $(obj).target/tools/gyp/libv8.so $(obj).target/third_party/icu/libicui18n.so $(obj).target/third_party/icu/libicuuc.so
+$(builddir)/process: LD_INPUTS := $(OBJS) $(obj).target/tools/gyp/libv8_base.a $(obj).target/tools/gyp/libv8_libbase.a $(obj).target/tools/gyp/libv8_snapshot.a
 $(builddir)/process: TOOLSET := $(TOOLSET)
-$(builddir)/process: $(OBJS) $(obj).target/tools/gyp/libv8.so $(obj).target/third_party/icu/libicui18n.so $(obj).target/third_party/icu/libicuuc.so FORCE_DO_CMD
+$(builddir)/process: $(OBJS) $(obj).target/tools/gyp/libv8_base.a $(obj).target/tools/gyp/libv8_libbase.a $(obj).target/tools/gyp/libv8_snapshot.a FORCE_DO_CMD
 	$(call do_cmd,link)
 
 all_deps += $(builddir)/process
@@ -32,3 +32,7 @@ all_deps += $(obj).target/src/d8_js2c.stamp
 .PHONY: d8_js2c
 d8_js2c: $(obj).target/src/d8_js2c.stamp
 
+# Add target alias to "all" target.
+.PHONY: all
+all: d8_js2c
+
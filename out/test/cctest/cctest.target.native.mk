@@ -5,10 +5,7 @@ TARGET := cctest
 DEFS_Debug := '-DV8_TARGET_ARCH_X64' \
 	'-DENABLE_GDB_JIT_INTERFACE' \
 	'-DV8_DEPRECATION_WARNINGS' \
-	'-DV8_I18N_SUPPORT' \
 	'-DV8_USE_DEFAULT_PLATFORM' \
-	'-DV8_SHARED' \
-	'-DUSING_V8_SHARED' \
 	'-DENABLE_DISASSEMBLER' \
 	'-DV8_ENABLE_CHECKS' \
 	'-DOBJECT_PRINT' \
@@ -19,7 +16,7 @@ DEFS_Debug := '-DV8_TARGET_ARCH_X64' \
 
 # Flags passed to all source files.
 CFLAGS_Debug := -Wall \
-	-Werror \
+	 \
 	-W \
 	-Wno-unused-parameter \
 	-Wno-long-long \
@@ -27,12 +24,10 @@ CFLAGS_Debug := -Wall \
 	-fno-exceptions \
 	-pedantic \
 	-ansi \
-	-fPIC \
 	-m64 \
 	-m64 \
 	-g \
 	-Woverloaded-virtual \
-	 \
 	-Woverloaded-virtual \
 	-fdata-sections \
 	-ffunction-sections \
@@ -46,15 +41,13 @@ CFLAGS_C_Debug :=
 CFLAGS_CC_Debug := -Wnon-virtual-dtor \
 	-fno-rtti
 
-INCS_Debug := -I$(srcdir)/.
+INCS_Debug := -I$(srcdir)/. \
+	-I$(srcdir)/include
 
 DEFS_Optdebug := '-DV8_TARGET_ARCH_X64' \
 	'-DENABLE_GDB_JIT_INTERFACE' \
 	'-DV8_DEPRECATION_WARNINGS' \
-	'-DV8_I18N_SUPPORT' \
 	'-DV8_USE_DEFAULT_PLATFORM' \
-	'-DV8_SHARED' \
-	'-DUSING_V8_SHARED' \
 	'-DENABLE_DISASSEMBLER' \
 	'-DV8_ENABLE_CHECKS' \
 	'-DOBJECT_PRINT' \
@@ -66,7 +59,7 @@ DEFS_Optdebug := '-DV8_TARGET_ARCH_X64' \
 
 # Flags passed to all source files.
 CFLAGS_Optdebug := -Wall \
-	-Werror \
+	 \
 	-W \
 	-Wno-unused-parameter \
 	-Wno-long-long \
@@ -74,12 +67,10 @@ CFLAGS_Optdebug := -Wall \
 	-fno-exceptions \
 	-pedantic \
 	-ansi \
-	-fPIC \
 	-m64 \
 	-m64 \
 	-g \
 	-Woverloaded-virtual \
-	 \
 	-Woverloaded-virtual \
 	-fdata-sections \
 	-ffunction-sections \
@@ -95,20 +86,18 @@ CFLAGS_C_Optdebug :=
 CFLAGS_CC_Optdebug := -Wnon-virtual-dtor \
 	-fno-rtti
 
-INCS_Optdebug := -I$(srcdir)/.
+INCS_Optdebug := -I$(srcdir)/. \
+	-I$(srcdir)/include
 
 DEFS_Release := '-DV8_TARGET_ARCH_X64' \
 	'-DENABLE_GDB_JIT_INTERFACE' \
 	'-DV8_DEPRECATION_WARNINGS' \
-	'-DV8_I18N_SUPPORT' \
 	'-DV8_USE_DEFAULT_PLATFORM' \
-	'-DV8_SHARED' \
-	'-DUSING_V8_SHARED' \
 	'-DENABLE_HANDLE_ZAPPING'
 
 # Flags passed to all source files.
 CFLAGS_Release := -Wall \
-	-Werror \
+	 \
 	-W \
 	-Wno-unused-parameter \
 	-Wno-long-long \
@@ -116,12 +105,10 @@ CFLAGS_Release := -Wall \
 	-fno-exceptions \
 	-pedantic \
 	-ansi \
-	-fPIC \
 	-m64 \
 	-m64 \
 	-fdata-sections \
 	-ffunction-sections \
-	 \
 	-O3 \
 	-fdata-sections \
 	-ffunction-sections \
@@ -134,7 +121,8 @@ CFLAGS_C_Release :=
 CFLAGS_CC_Release := -Wnon-virtual-dtor \
 	-fno-rtti
 
-INCS_Release := -I$(srcdir)/.
+INCS_Release := -I$(srcdir)/. \
+	-I$(srcdir)/include
 
 OBJS := $(obj).target/$(TARGET)/gen/resources.o \
 	$(obj).target/$(TARGET)/test/cctest/cctest.o \
@@ -230,7 +218,7 @@ OBJS := $(obj).target/$(TARGET)/gen/resources.o \
 all_deps += $(OBJS)
 
 # Make sure our dependencies are built before any of us.
-$(OBJS): | $(obj).target/test/cctest/resources.stamp $(obj).target/tools/gyp/libv8_snapshot.a $(obj).target/tools/gyp/libv8_base.a $(obj).target/tools/gyp/libv8_libbase.a $(builddir)/lib.target/libicui18n.so $(builddir)/lib.target/libicuuc.so $(obj).target/tools/gyp/js2c.stamp $(obj).target/tools/gyp/generate_trig_table.stamp $(obj).target/third_party/icu/libicui18n.so $(obj).target/third_party/icu/libicuuc.so
+$(OBJS): | $(obj).target/test/cctest/resources.stamp $(obj).target/tools/gyp/v8.stamp $(obj).target/tools/gyp/libv8_base.a $(obj).target/tools/gyp/libv8_libbase.a $(obj).target/tools/gyp/libv8_snapshot.a $(obj).target/tools/gyp/js2c.stamp $(obj).target/tools/gyp/generate_trig_table.stamp
 
 # CFLAGS et al overrides must be target-local.
 # See "Target-specific Variable Values" in the GNU Make manual.
@@ -257,31 +245,25 @@ LDFLAGS_Debug := -pthread \
 	-m64 \
 	-m64 \
 	-rdynamic \
-	-rdynamic \
-	-Wl,-rpath=\$$ORIGIN/lib.target/ \
-	-Wl,-rpath-link=\$(builddir)/lib.target/
+	-rdynamic
 
 LDFLAGS_Optdebug := -pthread \
 	-m64 \
 	-m64 \
 	-rdynamic \
-	-rdynamic \
-	-Wl,-rpath=\$$ORIGIN/lib.target/ \
-	-Wl,-rpath-link=\$(builddir)/lib.target/
+	-rdynamic
 
 LDFLAGS_Release := -pthread \
 	-m64 \
-	-m64 \
-	-Wl,-rpath=\$$ORIGIN/lib.target/ \
-	-Wl,-rpath-link=\$(builddir)/lib.target/
+	-m64
 
 LIBS := -lrt
 
 $(builddir)/cctest: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
 $(builddir)/cctest: LIBS := $(LIBS)
-$(builddir)/cctest: LD_INPUTS := $(OBJS) $(obj).target/tools/gyp/libv8_snapshot.a $(obj).target/tools/gyp/libv8_base.a $(obj).target/tools/gyp/libv8_libbase.a $(obj).target/third_party/icu/libicui18n.so $(obj).target/third_party/icu/libicuuc.so
+$(builddir)/cctest: LD_INPUTS := $(OBJS) $(obj).target/tools/gyp/libv8_base.a $(obj).target/tools/gyp/libv8_libbase.a $(obj).target/tools/gyp/libv8_snapshot.a
 $(builddir)/cctest: TOOLSET := $(TOOLSET)
-$(builddir)/cctest: $(OBJS) $(obj).target/tools/gyp/libv8_snapshot.a $(obj).target/tools/gyp/libv8_base.a $(obj).target/tools/gyp/libv8_libbase.a $(obj).target/third_party/icu/libicui18n.so $(obj).target/third_party/icu/libicuuc.so FORCE_DO_CMD
+$(builddir)/cctest: $(OBJS) $(obj).target/tools/gyp/libv8_base.a $(obj).target/tools/gyp/libv8_libbase.a $(obj).target/tools/gyp/libv8_snapshot.a FORCE_DO_CMD
 	$(call do_cmd,link)
 
 all_deps += $(builddir)/cctest
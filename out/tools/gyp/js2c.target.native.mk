@@ -4,12 +4,12 @@ TOOLSET := target
 TARGET := js2c
 ### Rules for action "js2c":
 quiet_cmd_js2c_js2c = ACTION js2c_js2c $@
-cmd_js2c_js2c = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/tools/gyp; mkdir -p $(obj)/gen; python ../../tools/js2c.py "$(obj)/gen/libraries.cc" CORE off ../../src/runtime.js ../../src/v8natives.js ../../src/array.js ../../src/string.js ../../src/uri.js ../../src/math.js ../../src/messages.js ../../src/apinatives.js ../../src/debug-debugger.js ../../src/mirror-debugger.js ../../src/liveedit-debugger.js ../../src/date.js ../../src/json.js ../../src/regexp.js ../../src/arraybuffer.js ../../src/typedarray.js ../../src/weak_collection.js ../../src/promise.js ../../src/object-observe.js ../../src/macros.py ../../src/i18n.js
+cmd_js2c_js2c = LD_LIBRARY_PATH=$(builddir)/lib.host:$(builddir)/lib.target:$$LD_LIBRARY_PATH; export LD_LIBRARY_PATH; cd $(srcdir)/tools/gyp; mkdir -p $(obj)/gen; python ../../tools/js2c.py "$(obj)/gen/libraries.cc" CORE off ../../src/runtime.js ../../src/v8natives.js ../../src/array.js ../../src/string.js ../../src/uri.js ../../src/math.js ../../src/messages.js ../../src/apinatives.js ../../src/debug-debugger.js ../../src/mirror-debugger.js ../../src/liveedit-debugger.js ../../src/date.js ../../src/json.js ../../src/regexp.js ../../src/arraybuffer.js ../../src/typedarray.js ../../src/weak_collection.js ../../src/promise.js ../../src/object-observe.js ../../src/macros.py
 
 $(obj)/gen/libraries.cc: obj := $(abs_obj)
 $(obj)/gen/libraries.cc: builddir := $(abs_builddir)
 $(obj)/gen/libraries.cc: TOOLSET := $(TOOLSET)
-$(obj)/gen/libraries.cc: $(srcdir)/tools/js2c.py $(srcdir)/src/runtime.js $(srcdir)/src/v8natives.js $(srcdir)/src/array.js $(srcdir)/src/string.js $(srcdir)/src/uri.js $(srcdir)/src/math.js $(srcdir)/src/messages.js $(srcdir)/src/apinatives.js $(srcdir)/src/debug-debugger.js $(srcdir)/src/mirror-debugger.js $(srcdir)/src/liveedit-debugger.js $(srcdir)/src/date.js $(srcdir)/src/json.js $(srcdir)/src/regexp.js $(srcdir)/src/arraybuffer.js $(srcdir)/src/typedarray.js $(srcdir)/src/weak_collection.js $(srcdir)/src/promise.js $(srcdir)/src/object-observe.js $(srcdir)/src/macros.py $(srcdir)/src/i18n.js FORCE_DO_CMD
+$(obj)/gen/libraries.cc: $(srcdir)/tools/js2c.py $(srcdir)/src/runtime.js $(srcdir)/src/v8natives.js $(srcdir)/src/array.js $(srcdir)/src/string.js $(srcdir)/src/uri.js $(srcdir)/src/math.js $(srcdir)/src/messages.js $(srcdir)/src/apinatives.js $(srcdir)/src/debug-debugger.js $(srcdir)/src/mirror-debugger.js $(srcdir)/src/liveedit-debugger.js $(srcdir)/src/date.js $(srcdir)/src/json.js $(srcdir)/src/regexp.js $(srcdir)/src/arraybuffer.js $(srcdir)/src/typedarray.js $(srcdir)/src/weak_collection.js $(srcdir)/src/promise.js $(srcdir)/src/object-observe.js $(srcdir)/src/macros.py FORCE_DO_CMD
 	$(call do_cmd,js2c_js2c)
 
 all_deps += $(obj)/gen/libraries.cc
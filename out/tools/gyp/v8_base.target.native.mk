@@ -5,13 +5,8 @@ TARGET := v8_base
 DEFS_Debug := '-DV8_TARGET_ARCH_X64' \
 	'-DENABLE_GDB_JIT_INTERFACE' \
 	'-DV8_DEPRECATION_WARNINGS' \
-	'-DV8_I18N_SUPPORT' \
 	'-DV8_USE_DEFAULT_PLATFORM' \
-	'-DBUILDING_V8_SHARED' \
-	'-DV8_SHARED' \
 	'-DICU_UTIL_DATA_IMPL=ICU_UTIL_DATA_STATIC' \
-	'-DU_USING_ICU_NAMESPACE=0' \
-	'-DU_ENABLE_DYLOAD=0' \
 	'-DENABLE_DISASSEMBLER' \
 	'-DV8_ENABLE_CHECKS' \
 	'-DOBJECT_PRINT' \
@@ -22,7 +17,7 @@ DEFS_Debug := '-DV8_TARGET_ARCH_X64' \
 
 # Flags passed to all source files.
 CFLAGS_Debug := -Wall \
-	-Werror \
+	 \
 	-W \
 	-Wno-unused-parameter \
 	-Wno-long-long \
@@ -30,12 +25,10 @@ CFLAGS_Debug := -Wall \
 	-fno-exceptions \
 	-pedantic \
 	-ansi \
-	-fPIC \
 	-m64 \
 	-m64 \
 	-g \
 	-Woverloaded-virtual \
-	 \
 	-Woverloaded-virtual \
 	-fdata-sections \
 	-ffunction-sections \
@@ -49,20 +42,13 @@ CFLAGS_C_Debug :=
 CFLAGS_CC_Debug := -Wnon-virtual-dtor \
 	-fno-rtti
 
-INCS_Debug := -I$(srcdir)/. \
-	-I$(srcdir)/third_party/icu/source/i18n \
-	-I$(srcdir)/third_party/icu/source/common
+INCS_Debug := -I$(srcdir)/.
 
 DEFS_Optdebug := '-DV8_TARGET_ARCH_X64' \
 	'-DENABLE_GDB_JIT_INTERFACE' \
 	'-DV8_DEPRECATION_WARNINGS' \
-	'-DV8_I18N_SUPPORT' \
 	'-DV8_USE_DEFAULT_PLATFORM' \
-	'-DBUILDING_V8_SHARED' \
-	'-DV8_SHARED' \
 	'-DICU_UTIL_DATA_IMPL=ICU_UTIL_DATA_STATIC' \
-	'-DU_USING_ICU_NAMESPACE=0' \
-	'-DU_ENABLE_DYLOAD=0' \
 	'-DENABLE_DISASSEMBLER' \
 	'-DV8_ENABLE_CHECKS' \
 	'-DOBJECT_PRINT' \
@@ -74,7 +60,7 @@ DEFS_Optdebug := '-DV8_TARGET_ARCH_X64' \
 
 # Flags passed to all source files.
 CFLAGS_Optdebug := -Wall \
-	-Werror \
+	 \
 	-W \
 	-Wno-unused-parameter \
 	-Wno-long-long \
@@ -82,12 +68,10 @@ CFLAGS_Optdebug := -Wall \
 	-fno-exceptions \
 	-pedantic \
 	-ansi \
-	-fPIC \
 	-m64 \
 	-m64 \
 	-g \
 	-Woverloaded-virtual \
-	 \
 	-Woverloaded-virtual \
 	-fdata-sections \
 	-ffunction-sections \
@@ -103,25 +87,18 @@ CFLAGS_C_Optdebug :=
 CFLAGS_CC_Optdebug := -Wnon-virtual-dtor \
 	-fno-rtti
 
-INCS_Optdebug := -I$(srcdir)/. \
-	-I$(srcdir)/third_party/icu/source/i18n \
-	-I$(srcdir)/third_party/icu/source/common
+INCS_Optdebug := -I$(srcdir)/.
 
 DEFS_Release := '-DV8_TARGET_ARCH_X64' \
 	'-DENABLE_GDB_JIT_INTERFACE' \
 	'-DV8_DEPRECATION_WARNINGS' \
-	'-DV8_I18N_SUPPORT' \
 	'-DV8_USE_DEFAULT_PLATFORM' \
-	'-DBUILDING_V8_SHARED' \
-	'-DV8_SHARED' \
 	'-DICU_UTIL_DATA_IMPL=ICU_UTIL_DATA_STATIC' \
-	'-DU_USING_ICU_NAMESPACE=0' \
-	'-DU_ENABLE_DYLOAD=0' \
 	'-DENABLE_HANDLE_ZAPPING'
 
 # Flags passed to all source files.
 CFLAGS_Release := -Wall \
-	-Werror \
+	 \
 	-W \
 	-Wno-unused-parameter \
 	-Wno-long-long \
@@ -129,12 +106,10 @@ CFLAGS_Release := -Wall \
 	-fno-exceptions \
 	-pedantic \
 	-ansi \
-	-fPIC \
 	-m64 \
 	-m64 \
 	-fdata-sections \
 	-ffunction-sections \
-	 \
 	-O3 \
 	-fdata-sections \
 	-ffunction-sections \
@@ -147,9 +122,7 @@ CFLAGS_C_Release :=
 CFLAGS_CC_Release := -Wnon-virtual-dtor \
 	-fno-rtti
 
-INCS_Release := -I$(srcdir)/. \
-	-I$(srcdir)/third_party/icu/source/i18n \
-	-I$(srcdir)/third_party/icu/source/common
+INCS_Release := -I$(srcdir)/.
 
 OBJS := $(obj).target/$(TARGET)/src/accessors.o \
 	$(obj).target/$(TARGET)/src/allocation.o \
@@ -231,7 +204,6 @@ OBJS := $(obj).target/$(TARGET)/src/accessors.o \
 	$(obj).target/$(TARGET)/src/hydrogen-store-elimination.o \
 	$(obj).target/$(TARGET)/src/hydrogen-types.o \
 	$(obj).target/$(TARGET)/src/hydrogen-uint32-analysis.o \
-	$(obj).target/$(TARGET)/src/i18n.o \
 	$(obj).target/$(TARGET)/src/icu_util.o \
 	$(obj).target/$(TARGET)/src/ic.o \
 	$(obj).target/$(TARGET)/src/incremental-marking.o \
@@ -242,6 +214,7 @@ OBJS := $(obj).target/$(TARGET)/src/accessors.o \
 	$(obj).target/$(TARGET)/src/libplatform/default-platform.o \
 	$(obj).target/$(TARGET)/src/libplatform/task-queue.o \
 	$(obj).target/$(TARGET)/src/libplatform/worker-thread.o \
+	$(obj).target/$(TARGET)/src/linear-regexp.o \
 	$(obj).target/$(TARGET)/src/lithium-allocator.o \
 	$(obj).target/$(TARGET)/src/lithium-codegen.o \
 	$(obj).target/$(TARGET)/src/lithium.o \
@@ -280,6 +253,7 @@ OBJS := $(obj).target/$(TARGET)/src/accessors.o \
 	$(obj).target/$(TARGET)/src/snapshot-source-sink.o \
 	$(obj).target/$(TARGET)/src/spaces.o \
 	$(obj).target/$(TARGET)/src/store-buffer.o \
+	$(obj).target/$(TARGET)/src/string-rope.o \
 	$(obj).target/$(TARGET)/src/string-search.o \
 	$(obj).target/$(TARGET)/src/string-stream.o \
 	$(obj).target/$(TARGET)/src/strtod.o \
@@ -318,9 +292,6 @@ OBJS := $(obj).target/$(TARGET)/src/accessors.o \
 # Add to the list of files we specially track dependencies for.
 all_deps += $(OBJS)
 
-# Make sure our dependencies are built before any of us.
-$(OBJS): | $(builddir)/lib.target/libicui18n.so $(builddir)/lib.target/libicuuc.so $(obj).target/third_party/icu/libicui18n.so $(obj).target/third_party/icu/libicuuc.so
-
 # CFLAGS et al overrides must be target-local.
 # See "Target-specific Variable Values" in the GNU Make manual.
 $(OBJS): TOOLSET := $(TOOLSET)
@@ -346,30 +317,24 @@ LDFLAGS_Debug := -pthread \
 	-m64 \
 	-m64 \
 	-rdynamic \
-	-rdynamic \
-	-Wl,-rpath=\$$ORIGIN/lib.target/ \
-	-Wl,-rpath-link=\$(builddir)/lib.target/
+	-rdynamic
 
 LDFLAGS_Optdebug := -pthread \
 	-m64 \
 	-m64 \
 	-rdynamic \
-	-rdynamic \
-	-Wl,-rpath=\$$ORIGIN/lib.target/ \
-	-Wl,-rpath-link=\$(builddir)/lib.target/
+	-rdynamic
 
 LDFLAGS_Release := -pthread \
 	-m64 \
-	-m64 \
-	-Wl,-rpath=\$$ORIGIN/lib.target/ \
-	-Wl,-rpath-link=\$(builddir)/lib.target/
+	-m64
 
 LIBS := 
 
 $(obj).target/tools/gyp/libv8_base.a: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
 $(obj).target/tools/gyp/libv8_base.a: LIBS := $(LIBS)
 $(obj).target/tools/gyp/libv8_base.a: TOOLSET := $(TOOLSET)
-$(obj).target/tools/gyp/libv8_base.a: $(OBJS) $(obj).target/third_party/icu/libicui18n.so $(obj).target/third_party/icu/libicuuc.so FORCE_DO_CMD
+$(obj).target/tools/gyp/libv8_base.a: $(OBJS) FORCE_DO_CMD
 	$(call do_cmd,alink)
 
 all_deps += $(obj).target/tools/gyp/libv8_base.a
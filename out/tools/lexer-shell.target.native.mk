@@ -0,0 +1,189 @@
+# This file is generated by gyp; do not edit.
+
+TOOLSET := target
+TARGET := lexer-shell
+DEFS_Debug := '-DV8_TARGET_ARCH_X64' \
+	'-DENABLE_GDB_JIT_INTERFACE' \
+	'-DV8_DEPRECATION_WARNINGS' \
+	'-DV8_USE_DEFAULT_PLATFORM' \
+	'-DENABLE_DISASSEMBLER' \
+	'-DV8_ENABLE_CHECKS' \
+	'-DOBJECT_PRINT' \
+	'-DVERIFY_HEAP' \
+	'-DDEBUG' \
+	'-DENABLE_EXTRA_CHECKS' \
+	'-DENABLE_HANDLE_ZAPPING'
+
+# Flags passed to all source files.
+CFLAGS_Debug := -Wall \
+	 \
+	-W \
+	-Wno-unused-parameter \
+	-Wno-long-long \
+	-pthread \
+	-fno-exceptions \
+	-pedantic \
+	-ansi \
+	-m64 \
+	-m64 \
+	-g \
+	-Woverloaded-virtual \
+	-Woverloaded-virtual \
+	-fdata-sections \
+	-ffunction-sections \
+	-fdata-sections \
+	-ffunction-sections
+
+# Flags passed to only C files.
+CFLAGS_C_Debug := 
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Debug := -Wnon-virtual-dtor \
+	-fno-rtti
+
+INCS_Debug := -I$(srcdir)/. \
+	-I$(srcdir)/include
+
+DEFS_Optdebug := '-DV8_TARGET_ARCH_X64' \
+	'-DENABLE_GDB_JIT_INTERFACE' \
+	'-DV8_DEPRECATION_WARNINGS' \
+	'-DV8_USE_DEFAULT_PLATFORM' \
+	'-DENABLE_DISASSEMBLER' \
+	'-DV8_ENABLE_CHECKS' \
+	'-DOBJECT_PRINT' \
+	'-DVERIFY_HEAP' \
+	'-DDEBUG' \
+	'-DENABLE_EXTRA_CHECKS' \
+	'-DENABLE_HANDLE_ZAPPING' \
+	'-DOPTIMIZED_DEBUG'
+
+# Flags passed to all source files.
+CFLAGS_Optdebug := -Wall \
+	 \
+	-W \
+	-Wno-unused-parameter \
+	-Wno-long-long \
+	-pthread \
+	-fno-exceptions \
+	-pedantic \
+	-ansi \
+	-m64 \
+	-m64 \
+	-g \
+	-Woverloaded-virtual \
+	-Woverloaded-virtual \
+	-fdata-sections \
+	-ffunction-sections \
+	-O3 \
+	-fdata-sections \
+	-ffunction-sections \
+	-O3
+
+# Flags passed to only C files.
+CFLAGS_C_Optdebug := 
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Optdebug := -Wnon-virtual-dtor \
+	-fno-rtti
+
+INCS_Optdebug := -I$(srcdir)/. \
+	-I$(srcdir)/include
+
+DEFS_Release := '-DV8_TARGET_ARCH_X64' \
+	'-DENABLE_GDB_JIT_INTERFACE' \
+	'-DV8_DEPRECATION_WARNINGS' \
+	'-DV8_USE_DEFAULT_PLATFORM' \
+	'-DENABLE_HANDLE_ZAPPING'
+
+# Flags passed to all source files.
+CFLAGS_Release := -Wall \
+	 \
+	-W \
+	-Wno-unused-parameter \
+	-Wno-long-long \
+	-pthread \
+	-fno-exceptions \
+	-pedantic \
+	-ansi \
+	-m64 \
+	-m64 \
+	-fdata-sections \
+	-ffunction-sections \
+	-O3 \
+	-fdata-sections \
+	-ffunction-sections \
+	-O3
+
+# Flags passed to only C files.
+CFLAGS_C_Release := 
+
+# Flags passed to only C++ files.
+CFLAGS_CC_Release := -Wnon-virtual-dtor \
+	-fno-rtti
+
+INCS_Release := -I$(srcdir)/. \
+	-I$(srcdir)/include
+
+OBJS := $(obj).target/$(TARGET)/tools/lexer-shell.o
+
+# Add to the list of files we specially track dependencies for.
+all_deps += $(OBJS)
+
+# Make sure our dependencies are built before any of us.
+$(OBJS): | $(obj).target/tools/gyp/v8.stamp $(obj).target/tools/gyp/libv8_base.a $(obj).target/tools/gyp/libv8_libbase.a $(obj).target/tools/gyp/libv8_snapshot.a $(obj).target/tools/gyp/js2c.stamp $(obj).target/tools/gyp/generate_trig_table.stamp
+
+# CFLAGS et al overrides must be target-local.
+# See "Target-specific Variable Values" in the GNU Make manual.
+$(OBJS): TOOLSET := $(TOOLSET)
+$(OBJS): GYP_CFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_C_$(BUILDTYPE))
+$(OBJS): GYP_CXXFLAGS := $(DEFS_$(BUILDTYPE)) $(INCS_$(BUILDTYPE))  $(CFLAGS_$(BUILDTYPE)) $(CFLAGS_CC_$(BUILDTYPE))
+
+# Suffix rules, putting all outputs into $(obj).
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(srcdir)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# Try building from generated source, too.
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj).$(TOOLSET)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+$(obj).$(TOOLSET)/$(TARGET)/%.o: $(obj)/%.cc FORCE_DO_CMD
+	@$(call do_cmd,cxx,1)
+
+# End of this set of suffix rules
+### Rules for final target.
+LDFLAGS_Debug := -pthread \
+	-m64 \
+	-m64 \
+	-rdynamic \
+	-rdynamic
+
+LDFLAGS_Optdebug := -pthread \
+	-m64 \
+	-m64 \
+	-rdynamic \
+	-rdynamic
+
+LDFLAGS_Release := -pthread \
+	-m64 \
+	-m64
+
+LIBS := -lrt
+
+$(builddir)/lexer-shell: GYP_LDFLAGS := $(LDFLAGS_$(BUILDTYPE))
+$(builddir)/lexer-shell: LIBS := $(LIBS)
+$(builddir)/lexer-shell: LD_INPUTS := $(OBJS) $(obj).target/tools/gyp/libv8_base.a $(obj).target/tools/gyp/libv8_libbase.a $(obj).target/tools/gyp/libv8_snapshot.a
+$(builddir)/lexer-shell: TOOLSET := $(TOOLSET)
+$(builddir)/lexer-shell: $(OBJS) $(obj).target/tools/gyp/libv8_base.a $(obj).target/tools/gyp/libv8_libbase.a $(obj).target/tools/gyp/libv8_snapshot.a FORCE_DO_CMD
+	$(call do_cmd,link)
+
+all_deps += $(builddir)/lexer-shell
+# Add target alias
+.PHONY: lexer-shell
+lexer-shell: $(builddir)/lexer-shell
+
+# Add executable to "all" target.
+.PHONY: all
+all: $(builddir)/lexer-shell
+
@@ -444,7 +444,9 @@ ResourceConstraints::ResourceConstraints()
       max_executable_size_(0),
       stack_limit_(NULL),
       max_available_threads_(0),
-      code_range_size_(0) { }
+      code_range_size_(0),
+      stub_cache_primary_table_bits_(0),
+      stub_cache_secondary_table_bits_(0) { }
 
 void ResourceConstraints::ConfigureDefaults(uint64_t physical_memory,
                                             uint64_t virtual_memory_limit,
@@ -513,6 +515,16 @@ bool SetResourceConstraints(Isolate* v8_isolate,
     isolate->stack_guard()->SetStackLimit(limit);
   }
 
+  if (constraints->stub_cache_primary_table_bits() != 0 ||
+      constraints->stub_cache_secondary_table_bits() != 0) {
+    // The stub cache is allocated when the isolate is initialized.
+    ASSERT(!isolate->IsInitialized());
+    isolate->set_stub_cache_primary_table_bits(
+        constraints->stub_cache_primary_table_bits());
+    isolate->set_stub_cache_secondary_table_bits(
+        constraints->stub_cache_secondary_table_bits());
+  }
+
   isolate->set_max_available_threads(constraints->max_available_threads());
   return true;
 }
@@ -1617,6 +1629,21 @@ int UnboundScript::GetLineNumber(int code_pos) {
 }
 
 
+int UnboundScript::GetCompiledFunctionPositions(int* positions,
+                                                int capacity) {
+  i::Handle<i::SharedFunctionInfo> obj =
+      i::Handle<i::SharedFunctionInfo>::cast(Utils::OpenHandle(this));
+  i::Isolate* isolate = obj->GetIsolate();
+  ON_BAILOUT(isolate, "v8::UnboundScript::GetCompiledFunctionPositions()",
+             return 0);
+  LOG_API(isolate, "UnboundScript::GetCompiledFunctionPositions");
+  ENTER_V8(isolate);
+  if (!obj->script()->IsScript()) return 0;
+  i::Handle<i::Script> script(i::Script::cast(obj->script()));
+  return i::Compiler::GetCompiledFunctionPositions(script, positions, capacity);
+}
+
+
 Handle<Value> UnboundScript::GetScriptName() {
   i::Handle<i::SharedFunctionInfo> obj =
       i::Handle<i::SharedFunctionInfo>::cast(Utils::OpenHandle(this));
@@ -1741,7 +1768,10 @@ Local<UnboundScript> ScriptCompiler::CompileUnbound(
                                    NULL,
                                    &script_data_impl,
                                    cached_data_mode,
-                                   i::NOT_NATIVES_CODE);
+                                   i::NOT_NATIVES_CODE,
+                                   i::Vector<const int>(
+                                       source->compile_hints,
+                                       source->compile_hint_count));
     has_pending_exception = result.is_null();
     if (has_pending_exception && cached_data_mode == i::CONSUME_CACHED_DATA) {
       // This case won't happen during normal operation; we have compiled
@@ -2282,17 +2312,146 @@ bool StackFrame::IsConstructor() const {
 
 // --- J S O N ---
 
+static i::MaybeHandle<i::Object> ParseJson(i::Handle<i::String> string) {
+  i::Handle<i::String> source = i::String::Flatten(string);
+  // One-byte sources are parsed directly from their characters.
+  return source->IsSeqOneByteString() || source->IsExternalAsciiString()
+      ? i::JsonParser<true>::Parse(source)
+      : i::JsonParser<false>::Parse(source);
+}
+
+
 Local<Value> JSON::Parse(Local<String> json_string) {
   i::Handle<i::String> string = Utils::OpenHandle(*json_string);
   i::Isolate* isolate = string->GetIsolate();
   EnsureInitializedForIsolate(isolate, "v8::JSON::Parse");
   ENTER_V8(isolate);
   i::HandleScope scope(isolate);
-  i::Handle<i::String> source = i::String::Flatten(string);
   EXCEPTION_PREAMBLE(isolate);
-  i::MaybeHandle<i::Object> maybe_result =
-      source->IsSeqOneByteString() ? i::JsonParser<true>::Parse(source)
-                                   : i::JsonParser<false>::Parse(source);
+  i::MaybeHandle<i::Object> maybe_result = ParseJson(string);
+  i::Handle<i::Object> result;
+  has_pending_exception = !maybe_result.ToHandle(&result);
+  EXCEPTION_BAILOUT_CHECK(isolate, Local<Object>());
+  return Utils::ToLocal(
+      i::Handle<i::Object>::cast(scope.CloseAndEscape(result)));
+}
+
+
+Local<Value> JSON::Parse(Isolate* v8_isolate, const char* data, int length) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  EnsureInitializedForIsolate(isolate, "v8::JSON::Parse");
+  ENTER_V8(isolate);
+  i::HandleScope scope(isolate);
+  if (length == -1) length = i::StrLength(data);
+  EXCEPTION_PREAMBLE(isolate);
+  i::MaybeHandle<i::Object> maybe_result;
+  if (i::String::IsAscii(data, length)) {
+    // ASCII text needs no UTF-8 decoding; copy it straight into a sequential
+    // one-byte string, which also keeps the result independent of the
+    // embedder's buffer.
+    i::Handle<i::String> source;
+    if (isolate->factory()->NewStringFromOneByte(
+            i::Vector<const uint8_t>(reinterpret_cast<const uint8_t*>(data),
+                                     length)).ToHandle(&source)) {
+      maybe_result = i::JsonParser<true>::Parse(source);
+    }
+  } else {
+    i::Handle<i::String> source;
+    if (isolate->factory()->NewStringFromUtf8(
+            i::Vector<const char>(data, length)).ToHandle(&source)) {
+      maybe_result = ParseJson(source);
+    }
+  }
+  i::Handle<i::Object> result;
+  has_pending_exception = !maybe_result.ToHandle(&result);
+  EXCEPTION_BAILOUT_CHECK(isolate, Local<Object>());
+  return Utils::ToLocal(
+      i::Handle<i::Object>::cast(scope.CloseAndEscape(result)));
+}
+
+
+JSON::StreamingParser::StreamingParser(Isolate* isolate)
+    : isolate_(isolate), buffer_(NULL), length_(0), capacity_(0) { }
+
+
+JSON::StreamingParser::~StreamingParser() {
+  i::DeleteArray(buffer_);
+}
+
+
+void JSON::StreamingParser::Append(const char* data, int length) {
+  ASSERT(length >= 0);
+  // A negative length marks text that has grown beyond the maximum string
+  // length; Finish reports it.
+  if (length_ < 0) return;
+  if (length > i::String::kMaxLength - length_) {
+    i::DeleteArray(buffer_);
+    buffer_ = NULL;
+    capacity_ = 0;
+    length_ = -1;
+    return;
+  }
+  if (length_ + length > capacity_) {
+    int capacity = i::Max(length_ + length, 2 * capacity_);
+    char* buffer = i::NewArray<char>(capacity);
+    if (length_ > 0) i::MemCopy(buffer, buffer_, length_);
+    i::DeleteArray(buffer_);
+    buffer_ = buffer;
+    capacity_ = capacity;
+  }
+  i::MemCopy(buffer_ + length_, data, length);
+  length_ += length;
+}
+
+
+// External string resource that takes over the buffer of a streaming parser.
+class JsonBufferStringResource : public String::ExternalAsciiStringResource {
+ public:
+  JsonBufferStringResource(char* data, int length)
+      : data_(data), length_(length) { }
+  virtual ~JsonBufferStringResource() { i::DeleteArray(data_); }
+
+  virtual const char* data() const { return data_; }
+  virtual size_t length() const { return length_; }
+
+ private:
+  char* data_;
+  size_t length_;
+};
+
+
+Local<Value> JSON::StreamingParser::Finish() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(isolate_);
+  if (length_ < 0) {
+    length_ = 0;
+    ENTER_V8(isolate);
+    EXCEPTION_PREAMBLE(isolate);
+    isolate->ThrowInvalidStringLength();
+    has_pending_exception = true;
+    EXCEPTION_BAILOUT_CHECK(isolate, Local<Value>());
+  }
+  if (length_ == 0 || !i::String::IsAscii(buffer_, length_)) {
+    // Text beyond ASCII is decoded from UTF-8 into a new string.
+    Local<Value> result = JSON::Parse(isolate_, buffer_, length_);
+    length_ = 0;
+    return result;
+  }
+  EnsureInitializedForIsolate(isolate, "v8::JSON::StreamingParser::Finish");
+  ENTER_V8(isolate);
+  i::HandleScope scope(isolate);
+  // Hand the buffer over to an external string and parse it in place, so
+  // that the text is not copied again.
+  JsonBufferStringResource* resource =
+      new JsonBufferStringResource(buffer_, length_);
+  buffer_ = NULL;
+  length_ = 0;
+  capacity_ = 0;
+  i::Handle<i::String> source =
+      isolate->factory()->NewExternalStringFromAscii(resource)
+          .ToHandleChecked();
+  isolate->heap()->external_string_table()->AddString(*source);
+  EXCEPTION_PREAMBLE(isolate);
+  i::MaybeHandle<i::Object> maybe_result = i::JsonParser<true>::Parse(source);
   i::Handle<i::Object> result;
   has_pending_exception = !maybe_result.ToHandle(&result);
   EXCEPTION_BAILOUT_CHECK(isolate, Local<Object>());
@@ -5523,6 +5682,55 @@ Local<String> v8::String::NewExternal(
 }
 
 
+// External string resource for the contents of a file mapped into memory.
+template <typename Resource, typename Char>
+class MappedFileStringResource : public Resource {
+ public:
+  explicit MappedFileStringResource(base::OS::MemoryMappedFile* file)
+      : file_(file) { }
+  virtual ~MappedFileStringResource() { delete file_; }
+
+  virtual const Char* data() const {
+    return reinterpret_cast<const Char*>(file_->memory());
+  }
+  virtual size_t length() const { return file_->size() / sizeof(Char); }
+
+ private:
+  base::OS::MemoryMappedFile* file_;
+};
+
+
+Local<String> v8::String::NewExternalFromFile(
+    Isolate* isolate,
+    const char* file_name,
+    ExternalFileEncoding encoding) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  EnsureInitializedForIsolate(i_isolate, "v8::String::NewExternalFromFile()");
+  LOG_API(i_isolate, "String::NewExternalFromFile");
+  ENTER_V8(i_isolate);
+  base::OS::MemoryMappedFile* file = base::OS::MemoryMappedFile::open(
+      file_name, base::OS::MemoryMappedFile::kReadOnly);
+  if (file == NULL) return Local<String>();
+  int length = encoding == kOneByteFile ? file->size() : file->size() / 2;
+  if (length == 0 || length > i::String::kMaxLength) {
+    delete file;
+    return Local<String>();
+  }
+  i::Handle<i::String> result;
+  if (encoding == kOneByteFile) {
+    result = NewExternalAsciiStringHandle(
+        i_isolate,
+        new MappedFileStringResource<ExternalAsciiStringResource, char>(file));
+  } else {
+    result = NewExternalStringHandle(
+        i_isolate,
+        new MappedFileStringResource<ExternalStringResource, uint16_t>(file));
+  }
+  i_isolate->heap()->external_string_table()->AddString(*result);
+  return Utils::ToLocal(result);
+}
+
+
 bool v8::String::MakeExternal(
     v8::String::ExternalAsciiStringResource* resource) {
   i::Handle<i::String> obj = Utils::OpenHandle(this);
@@ -6682,6 +6890,12 @@ void Isolate::SetEventLogger(LogEventCallback that) {
 }
 
 
+void Isolate::SetScriptCacheStore(ScriptCompiler::CacheStore* store) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->set_script_cache_store(store);
+}
+
+
 void Isolate::AddCallCompletedCallback(CallCompletedCallback callback) {
   if (callback == NULL) return;
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
@@ -310,6 +310,31 @@ static void GenerateKeyNameCheck(MacroAssembler* masm,
 }
 
 
+// Replaces the non-internalized string in |key| with the equal string from
+// the string table. Jumps to |not_found| with |key| unchanged if there is no
+// such string or the key is an array index. The lookup does not allocate,
+// so it is done in C without entering the runtime. |scratch| is clobbered.
+static void GenerateTryInternalizeKey(MacroAssembler* masm,
+                                      Register key,
+                                      Register scratch,
+                                      Label* not_found) {
+  ASSERT(!key.is(scratch));
+  RegList saved_regs = (kCallerSaved | lr.bit()) & ~scratch.bit();
+  __ stm(db_w, sp, saved_regs);
+  __ PrepareCallCFunction(1, scratch);
+  __ mov(r0, key);
+  {
+    AllowExternalCallThatCantCauseGC scope(masm);
+    __ CallCFunction(
+        ExternalReference::try_internalize_string_function(masm->isolate()), 1);
+  }
+  __ mov(scratch, r0);
+  __ ldm(ia_w, sp, saved_regs);
+  __ JumpIfSmi(scratch, not_found);
+  __ mov(key, scratch);
+}
+
+
 void LoadIC::GenerateMegamorphic(MacroAssembler* masm) {
   // The return address is in lr.
   Register receiver = ReceiverRegister();
@@ -558,7 +583,7 @@ void KeyedLoadIC::GenerateRuntimeGetProperty(MacroAssembler* masm) {
 void KeyedLoadIC::GenerateGeneric(MacroAssembler* masm) {
   // The return address is in lr.
   Label slow, check_name, index_smi, index_name, property_array_property;
-  Label probe_dictionary, check_number_dictionary;
+  Label probe_dictionary, check_number_dictionary, not_unique;
 
   Register key = NameRegister();
   Register receiver = ReceiverRegister();
@@ -605,7 +630,7 @@ void KeyedLoadIC::GenerateGeneric(MacroAssembler* masm) {
   GenerateRuntimeGetProperty(masm);
 
   __ bind(&check_name);
-  GenerateKeyNameCheck(masm, key, r0, r3, &index_name, &slow);
+  GenerateKeyNameCheck(masm, key, r0, r3, &index_name, &not_unique);
 
   GenerateKeyedLoadReceiverCheck(
       masm, receiver, r0, r3, Map::kHasNamedInterceptor, &slow);
@@ -716,6 +741,14 @@ void KeyedLoadIC::GenerateGeneric(MacroAssembler* masm) {
   __ IndexFromHash(r3, key);
   // Now jump to the place where smi keys are handled.
   __ jmp(&index_smi);
+
+  // A string key that is not internalized can still be looked up by the
+  // stub if the string table holds an equal string. r0 holds the key map.
+  __ bind(&not_unique);
+  __ CompareInstanceType(r0, r3, FIRST_NONSTRING_TYPE);
+  __ b(hs, &slow);
+  GenerateTryInternalizeKey(masm, key, r4, &slow);
+  __ jmp(&check_name);
 }
 
 
@@ -1040,6 +1073,7 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   Label slow, fast_object, fast_object_grow;
   Label fast_double, fast_double_grow;
   Label array, extra, check_if_double_array;
+  Label maybe_name_key, unique_name_key, not_unique;
 
   // Register usage.
   Register value = r0;
@@ -1050,8 +1084,6 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   Register elements = r9;  // Elements array of the receiver.
   // r4 and r5 are used as general scratch registers.
 
-  // Check that the key is a smi.
-  __ JumpIfNotSmi(key, &slow);
   // Check that the object isn't a smi.
   __ JumpIfSmi(receiver, &slow);
   // Get the map of the object.
@@ -1061,6 +1093,8 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   __ ldrb(ip, FieldMemOperand(receiver_map, Map::kBitFieldOffset));
   __ tst(ip, Operand(1 << Map::kIsAccessCheckNeeded | 1 << Map::kIsObserved));
   __ b(ne, &slow);
+  // Check that the key is a smi.
+  __ JumpIfNotSmi(key, &maybe_name_key);
   // Check if the object is a JS array or not.
   __ ldrb(r4, FieldMemOperand(receiver_map, Map::kInstanceTypeOffset));
   __ cmp(r4, Operand(JS_ARRAY_TYPE));
@@ -1126,6 +1160,24 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
                                   &slow, kDontCheckMap, kIncrementLength,
                                   value, key, receiver, receiver_map,
                                   elements_map, elements);
+
+  // Name key case: store to an existing writable data property of an object
+  // with dictionary properties without calling the runtime.
+  __ bind(&maybe_name_key);
+  GenerateKeyNameCheck(masm, key, r4, r5, &slow, &not_unique);
+  __ bind(&unique_name_key);
+  GenerateNameDictionaryReceiverCheck(masm, receiver, r3, r4, r5, &slow);
+  GenerateDictionaryStore(masm, &slow, r3, key, value, r4, r5);
+  __ IncrementCounter(masm->isolate()->counters()->keyed_store_generic_dict(),
+                      1, r4, r5);
+  __ Ret();
+
+  // r4: key map
+  __ bind(&not_unique);
+  __ CompareInstanceType(r4, r5, FIRST_NONSTRING_TYPE);
+  __ b(hs, &slow);
+  GenerateTryInternalizeKey(masm, key, r4, &slow);
+  __ jmp(&unique_name_key);
 }
 
 
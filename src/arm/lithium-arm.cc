@@ -676,6 +676,26 @@ LInstruction* LChunkBuilder::DoDeoptimize(HDeoptimize* instr) {
 }
 
 
+LInstruction* LChunkBuilder::DoEnterTry(HEnterTry* instr) {
+  LOperand* context = UseFixed(instr->context(), cp);
+  LOperand* temp1 = FixedTemp(r5);
+  LOperand* temp2 = FixedTemp(r6);
+  LEnterTry* result = new(zone()) LEnterTry(context, temp1, temp2);
+  LOperand* exception =
+      LRegister::Create(Register::ToAllocationIndex(r0), zone());
+  result->set_catch_environment(
+      CreateCatchEnvironment(current_block_->last_environment(),
+                             instr->handler_id(), chunk(), exception));
+  return result;
+}
+
+
+LInstruction* LChunkBuilder::DoLeaveTry(HLeaveTry* instr) {
+  LOperand* temp = FixedTemp(r1);
+  return new(zone()) LLeaveTry(temp);
+}
+
+
 LInstruction* LChunkBuilder::DoShift(Token::Value op,
                                      HBitwiseBinaryOperation* instr) {
   if (instr->representation().IsSmiOrInteger32()) {
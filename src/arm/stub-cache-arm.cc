@@ -90,6 +90,9 @@ static void ProbeTable(Isolate* isolate,
     }
 #endif
 
+  __ IncrementCounter(isolate->stub_cache()->hit_counter(flags, table), 1,
+                      flags_reg, offset_scratch);
+
   // Jump to the first instruction in the code stub.
   __ add(pc, code, Operand(Code::kHeaderSize - kHeapObjectTag));
 
@@ -195,19 +198,25 @@ void StubCache::GenerateProbe(MacroAssembler* masm,
   // Check that the receiver isn't a smi.
   __ JumpIfSmi(receiver, &miss);
 
+  // The table sizes are only known at runtime, so the masks are loaded. They
+  // are scaled by the heap object tag size, like the x86 offsets.
+  ExternalReference primary_mask(mask_reference(kPrimary));
+  ExternalReference secondary_mask(mask_reference(kSecondary));
+
   // Get the map of the receiver and compute the hash.
   __ ldr(scratch, FieldMemOperand(name, Name::kHashFieldOffset));
   __ ldr(ip, FieldMemOperand(receiver, HeapObject::kMapOffset));
   __ add(scratch, scratch, Operand(ip));
-  uint32_t mask = kPrimaryTableSize - 1;
   // We shift out the last two bits because they are not part of the hash and
   // they are always 01 for maps.
   __ mov(scratch, Operand(scratch, LSR, kHeapObjectTagSize));
-  // Mask down the eor argument to the minimum to keep the immediate
-  // ARM-encodable.
-  __ eor(scratch, scratch, Operand((flags >> kHeapObjectTagSize) & mask));
-  // Prefer and_ to ubfx here because ubfx takes 2 cycles.
-  __ and_(scratch, scratch, Operand(mask));
+  // Mask down the eor argument to keep the immediate ARM-encodable. The
+  // table mask applied below is never wider.
+  uint32_t max_mask = (1 << kMaxTableBits) - 1;
+  __ eor(scratch, scratch, Operand((flags >> kHeapObjectTagSize) & max_mask));
+  __ mov(extra, Operand(primary_mask));
+  __ ldr(extra, MemOperand(extra));
+  __ and_(scratch, scratch, Operand(extra, LSR, kHeapObjectTagSize));
 
   // Probe the primary table.
   ProbeTable(isolate,
@@ -223,9 +232,10 @@ void StubCache::GenerateProbe(MacroAssembler* masm,
 
   // Primary miss: Compute hash for secondary probe.
   __ sub(scratch, scratch, Operand(name, LSR, kHeapObjectTagSize));
-  uint32_t mask2 = kSecondaryTableSize - 1;
-  __ add(scratch, scratch, Operand((flags >> kHeapObjectTagSize) & mask2));
-  __ and_(scratch, scratch, Operand(mask2));
+  __ add(scratch, scratch, Operand((flags >> kHeapObjectTagSize) & max_mask));
+  __ mov(extra, Operand(secondary_mask));
+  __ ldr(extra, MemOperand(extra));
+  __ and_(scratch, scratch, Operand(extra, LSR, kHeapObjectTagSize));
 
   // Probe the secondary table.
   ProbeTable(isolate,
@@ -244,6 +254,7 @@ void StubCache::GenerateProbe(MacroAssembler* masm,
   __ bind(&miss);
   __ IncrementCounter(counters->megamorphic_stub_cache_misses(), 1,
                       extra2, extra3);
+  __ IncrementCounter(miss_counter(flags), 1, extra2, extra3);
 }
 
 
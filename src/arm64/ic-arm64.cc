@@ -316,6 +316,33 @@ static void GenerateKeyNameCheck(MacroAssembler* masm,
 }
 
 
+// Replaces the non-internalized string in |key| with the equal string from
+// the string table. Jumps to |not_found| with |key| unchanged if there is no
+// such string or the key is an array index. The lookup does not allocate,
+// so it is done in C without entering the runtime. |scratch| is clobbered.
+static void GenerateTryInternalizeKey(MacroAssembler* masm,
+                                      Register key,
+                                      Register scratch,
+                                      Label* not_found) {
+  ASSERT(!AreAliased(key, scratch));
+  CPURegList saved_regs = kCallerSaved;
+  saved_regs.Remove(MacroAssembler::DefaultTmpList());
+  saved_regs.Remove(scratch);
+  __ PushCPURegList(saved_regs);
+  __ Mov(x0, key);
+  {
+    AllowExternalCallThatCantCauseGC scope(masm);
+    __ CallCFunction(
+        ExternalReference::try_internalize_string_function(masm->isolate()),
+        1, 0);
+  }
+  __ Mov(scratch, x0);
+  __ PopCPURegList(saved_regs);
+  __ JumpIfSmi(scratch, not_found);
+  __ Mov(key, scratch);
+}
+
+
 // Neither 'object' nor 'key' are modified by this function.
 //
 // If the 'unmapped_case' or 'slow_case' exit is taken, the 'map' register is
@@ -744,7 +771,7 @@ static void GenerateKeyedLoadWithNameKey(MacroAssembler* masm,
 
 void KeyedLoadIC::GenerateGeneric(MacroAssembler* masm) {
   // The return address is in lr.
-  Label slow, check_name, index_smi, index_name;
+  Label slow, check_name, index_smi, index_name, not_unique;
 
   Register key = NameRegister();
   Register receiver = ReceiverRegister();
@@ -764,7 +791,7 @@ void KeyedLoadIC::GenerateGeneric(MacroAssembler* masm) {
   GenerateRuntimeGetProperty(masm);
 
   __ Bind(&check_name);
-  GenerateKeyNameCheck(masm, key, x0, x3, &index_name, &slow);
+  GenerateKeyNameCheck(masm, key, x0, x3, &index_name, &not_unique);
 
   GenerateKeyedLoadWithNameKey(masm, key, receiver, x7, x3, x4, x5, x6, &slow);
 
@@ -772,6 +799,14 @@ void KeyedLoadIC::GenerateGeneric(MacroAssembler* masm) {
   __ IndexFromHash(x3, key);
   // Now jump to the place where smi keys are handled.
   __ B(&index_smi);
+
+  // A string key that is not internalized can still be looked up by the
+  // stub if the string table holds an equal string. x0 holds the key map.
+  __ Bind(&not_unique);
+  __ CompareInstanceType(x0, x3, FIRST_NONSTRING_TYPE);
+  __ B(hs, &slow);
+  GenerateTryInternalizeKey(masm, key, x3, &slow);
+  __ B(&check_name);
 }
 
 
@@ -1080,6 +1115,9 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   Label fast_object_grow;
   Label fast_double_grow;
   Label fast_double;
+  Label maybe_name_key;
+  Label unique_name_key;
+  Label not_unique;
 
   Register value = x0;
   Register key = x1;
@@ -1088,7 +1126,6 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   Register elements = x4;
   Register elements_map = x5;
 
-  __ JumpIfNotSmi(key, &slow);
   __ JumpIfSmi(receiver, &slow);
   __ Ldr(receiver_map, FieldMemOperand(receiver, HeapObject::kMapOffset));
 
@@ -1097,6 +1134,7 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   __ Ldrb(x10, FieldMemOperand(receiver_map, Map::kBitFieldOffset));
   __ TestAndBranchIfAnySet(
       x10, (1 << Map::kIsAccessCheckNeeded) | (1 << Map::kIsObserved), &slow);
+  __ JumpIfNotSmi(key, &maybe_name_key);
 
   // Check if the object is a JS array or not.
   Register instance_type = x10;
@@ -1164,6 +1202,27 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
                                   &slow, kDontCheckMap, kIncrementLength,
                                   value, key, receiver, receiver_map,
                                   elements_map, elements);
+
+
+  __ Bind(&maybe_name_key);
+  // Name key case: store to an existing writable data property of an object
+  // with dictionary properties without calling the runtime.
+  GenerateKeyNameCheck(masm, key, x4, x5, &slow, &not_unique);
+  __ Bind(&unique_name_key);
+  Register dictionary = x3;
+  GenerateNameDictionaryReceiverCheck(
+      masm, receiver, dictionary, x4, x5, &slow);
+  GenerateDictionaryStore(masm, &slow, dictionary, key, value, x4, x5);
+  __ IncrementCounter(
+      masm->isolate()->counters()->keyed_store_generic_dict(), 1, x4, x5);
+  __ Ret();
+
+  __ Bind(&not_unique);
+  // x4: key map
+  __ CompareInstanceType(x4, x5, FIRST_NONSTRING_TYPE);
+  __ B(hs, &slow);
+  GenerateTryInternalizeKey(masm, key, x4, &slow);
+  __ B(&unique_name_key);
 }
 
 
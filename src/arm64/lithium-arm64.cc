@@ -549,6 +549,13 @@ LOperand* LPlatformChunk::GetNextSpillSlot(RegisterKind kind) {
 }
 
 
+LOperand* LChunkBuilder::FixedTemp(Register reg) {
+  LUnallocated* operand = ToUnallocated(reg);
+  ASSERT(operand->HasFixedPolicy());
+  return operand;
+}
+
+
 LOperand* LChunkBuilder::FixedTemp(DoubleRegister reg) {
   LUnallocated* operand = ToUnallocated(reg);
   ASSERT(operand->HasFixedPolicy());
@@ -2174,6 +2181,27 @@ LInstruction* LChunkBuilder::DoShiftedBinaryOp(
 }
 
 
+LInstruction* LChunkBuilder::DoEnterTry(HEnterTry* instr) {
+  LOperand* context = UseFixed(instr->context(), cp);
+  LOperand* temp1 = FixedTemp(x10);
+  LOperand* temp2 = FixedTemp(x11);
+  LEnterTry* result = new(zone()) LEnterTry(context, temp1, temp2);
+  LOperand* exception =
+      LRegister::Create(Register::ToAllocationIndex(x0), zone());
+  result->set_catch_environment(
+      CreateCatchEnvironment(current_block_->last_environment(),
+                             instr->handler_id(), chunk_, exception));
+  return result;
+}
+
+
+LInstruction* LChunkBuilder::DoLeaveTry(HLeaveTry* instr) {
+  LOperand* temp1 = FixedTemp(x10);
+  LOperand* temp2 = FixedTemp(x11);
+  return new(zone()) LLeaveTry(temp1, temp2);
+}
+
+
 LInstruction* LChunkBuilder::DoShift(Token::Value op,
                                      HBitwiseBinaryOperation* instr) {
   if (instr->representation().IsTagged()) {
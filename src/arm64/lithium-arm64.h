@@ -76,6 +76,7 @@ class LCodeGen;
   V(Drop)                                       \
   V(Dummy)                                      \
   V(DummyUse)                                   \
+  V(EnterTry)                                   \
   V(FlooringDivByConstI)                        \
   V(FlooringDivByPowerOf2I)                     \
   V(FlooringDivI)                               \
@@ -99,6 +100,7 @@ class LCodeGen;
   V(IsUndetectableAndBranch)                    \
   V(Label)                                      \
   V(LazyBailout)                                \
+  V(LeaveTry)                                   \
   V(LoadContextSlot)                            \
   V(LoadFieldByIndex)                           \
   V(LoadFunctionPrototype)                      \
@@ -494,6 +496,45 @@ class LLazyBailout V8_FINAL : public LTemplateInstruction<0, 0, 0> {
 };
 
 
+class LEnterTry V8_FINAL : public LTemplateInstruction<0, 1, 2> {
+ public:
+  LEnterTry(LOperand* context, LOperand* temp1, LOperand* temp2)
+      : catch_environment_(NULL) {
+    inputs_[0] = context;
+    temps_[0] = temp1;
+    temps_[1] = temp2;
+  }
+
+  LOperand* context() { return inputs_[0]; }
+  LOperand* temp1() { return temps_[0]; }
+  LOperand* temp2() { return temps_[1]; }
+
+  // The environment used to deoptimize at the entry of the catch handler.
+  LEnvironment* catch_environment() const { return catch_environment_; }
+  void set_catch_environment(LEnvironment* env) { catch_environment_ = env; }
+
+  DECLARE_CONCRETE_INSTRUCTION(EnterTry, "enter-try")
+  DECLARE_HYDROGEN_ACCESSOR(EnterTry)
+
+ private:
+  LEnvironment* catch_environment_;
+};
+
+
+class LLeaveTry V8_FINAL : public LTemplateInstruction<0, 0, 2> {
+ public:
+  LLeaveTry(LOperand* temp1, LOperand* temp2) {
+    temps_[0] = temp1;
+    temps_[1] = temp2;
+  }
+
+  LOperand* temp1() { return temps_[0]; }
+  LOperand* temp2() { return temps_[1]; }
+
+  DECLARE_CONCRETE_INSTRUCTION(LeaveTry, "leave-try")
+};
+
+
 class LLabel V8_FINAL : public LGap {
  public:
   explicit LLabel(HBasicBlock* block)
@@ -3156,6 +3197,9 @@ class LChunkBuilder V8_FINAL : public LChunkBuilderBase {
   // Temporary operand that must be in a double register.
   MUST_USE_RESULT LUnallocated* TempDoubleRegister();
 
+  // Temporary operand that must be in a fixed register.
+  MUST_USE_RESULT LOperand* FixedTemp(Register reg);
+
   // Temporary operand that must be in a fixed double register.
   MUST_USE_RESULT LOperand* FixedTemp(DoubleRegister reg);
 
@@ -2842,6 +2842,41 @@ void LCodeGen::DoDrop(LDrop* instr) {
 }
 
 
+void LCodeGen::DoEnterTry(LEnterTry* instr) {
+  class DeferredCatchHandler: public LDeferredCode {
+   public:
+    DeferredCatchHandler(LCodeGen* codegen, LEnterTry* instr)
+        : LDeferredCode(codegen), instr_(instr) { }
+    virtual void Generate() { codegen()->DoDeferredCatchHandler(instr_); }
+    virtual LInstruction* instr() { return instr_; }
+   private:
+    LEnterTry* instr_;
+  };
+
+  ASSERT(ToRegister(instr->context()).is(cp));
+  DeferredCatchHandler* deferred =
+      new(zone()) DeferredCatchHandler(this, instr);
+  __ PushTryHandler(StackHandler::CATCH, instr->hydrogen()->handler_index());
+  __ bind(deferred->exit());
+}
+
+
+void LCodeGen::DoDeferredCatchHandler(LEnterTry* instr) {
+  // The exception is in x0 and the handler has been unlinked. The optimized
+  // code stays valid, so the frame is replaced lazily by the unoptimized
+  // code's catch handler entry.
+  RecordCatchHandler(instr->hydrogen()->handler_index());
+  Comment(";;; catch handler");
+  Deoptimizer::BailoutType type = Deoptimizer::LAZY;
+  Deoptimize(instr->catch_environment(), &type);
+}
+
+
+void LCodeGen::DoLeaveTry(LLeaveTry* instr) {
+  __ PopTryHandler();
+}
+
+
 void LCodeGen::DoDummy(LDummy* instr) {
   // Nothing to see here, move on!
 }
@@ -133,6 +133,9 @@ static void ProbeTable(Isolate* isolate,
   }
 #endif
 
+  __ IncrementCounter(isolate->stub_cache()->hit_counter(flags, table), 1,
+                      scratch2, scratch3);
+
   // Jump to the first instruction in the code stub.
   __ Add(scratch, scratch, Code::kHeaderSize - kHeapObjectTag);
   __ Br(scratch);
@@ -171,14 +174,21 @@ void StubCache::GenerateProbe(MacroAssembler* masm,
   // Check that the receiver isn't a smi.
   __ JumpIfSmi(receiver, &miss);
 
+  // The table sizes are only known at runtime, so the masks are loaded. They
+  // are scaled by the heap object tag size, like the x86 offsets.
+  ExternalReference primary_mask(mask_reference(kPrimary));
+  ExternalReference secondary_mask(mask_reference(kSecondary));
+
   // Compute the hash for primary table.
   __ Ldr(scratch, FieldMemOperand(name, Name::kHashFieldOffset));
   __ Ldr(extra, FieldMemOperand(receiver, HeapObject::kMapOffset));
   __ Add(scratch, scratch, extra);
   __ Eor(scratch, scratch, flags);
+  __ Mov(extra, primary_mask);
+  __ Ldr(extra, MemOperand(extra));
+  __ And(scratch, scratch, extra);
   // We shift out the last two bits because they are not part of the hash.
-  __ Ubfx(scratch, scratch, kHeapObjectTagSize,
-          CountTrailingZeros(kPrimaryTableSize, 64));
+  __ Lsr(scratch, scratch, kHeapObjectTagSize);
 
   // Probe the primary table.
   ProbeTable(isolate, masm, flags, kPrimary, receiver, name,
@@ -187,7 +197,9 @@ void StubCache::GenerateProbe(MacroAssembler* masm,
   // Primary miss: Compute hash for secondary table.
   __ Sub(scratch, scratch, Operand(name, LSR, kHeapObjectTagSize));
   __ Add(scratch, scratch, flags >> kHeapObjectTagSize);
-  __ And(scratch, scratch, kSecondaryTableSize - 1);
+  __ Mov(extra, secondary_mask);
+  __ Ldr(extra, MemOperand(extra));
+  __ And(scratch, scratch, Operand(extra, LSR, kHeapObjectTagSize));
 
   // Probe the secondary table.
   ProbeTable(isolate, masm, flags, kSecondary, receiver, name,
@@ -198,6 +210,7 @@ void StubCache::GenerateProbe(MacroAssembler* masm,
   __ Bind(&miss);
   __ IncrementCounter(counters->megamorphic_stub_cache_misses(), 1,
                       extra2, extra3);
+  __ IncrementCounter(miss_counter(flags), 1, extra2, extra3);
 }
 
 
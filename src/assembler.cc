@@ -1050,6 +1050,13 @@ ExternalReference ExternalReference::get_date_field_function(
 }
 
 
+ExternalReference ExternalReference::try_internalize_string_function(
+    Isolate* isolate) {
+  return ExternalReference(Redirect(
+      isolate, FUNCTION_ADDR(StringTable::LookupStringIfExistsNoAllocate)));
+}
+
+
 ExternalReference ExternalReference::get_make_code_young_function(
     Isolate* isolate) {
   return ExternalReference(Redirect(
@@ -818,6 +818,7 @@ class ExternalReference BASE_EMBEDDED {
   static ExternalReference delete_handle_scope_extensions(Isolate* isolate);
 
   static ExternalReference get_date_field_function(Isolate* isolate);
+  static ExternalReference try_internalize_string_function(Isolate* isolate);
   static ExternalReference date_cache_stamp(Isolate* isolate);
 
   static ExternalReference get_make_code_young_function(Isolate* isolate);
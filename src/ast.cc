@@ -1093,7 +1093,6 @@ DONT_OPTIMIZE_NODE(ModuleUrl)
 DONT_OPTIMIZE_NODE(ModuleStatement)
 DONT_OPTIMIZE_NODE(Yield)
 DONT_OPTIMIZE_NODE(WithStatement)
-DONT_OPTIMIZE_NODE(TryCatchStatement)
 DONT_OPTIMIZE_NODE(TryFinallyStatement)
 DONT_OPTIMIZE_NODE(DebuggerStatement)
 DONT_OPTIMIZE_NODE(NativeFunctionLiteral)
@@ -1107,6 +1106,16 @@ DONT_SELFOPTIMIZE_NODE(ForOfStatement)
 DONT_CACHE_NODE(ModuleLiteral)
 
 
+void AstConstructionVisitor::VisitTryCatchStatement(TryCatchStatement* node) {
+  increase_node_count();
+  // Optimized code can only catch exceptions in the outermost function of an
+  // optimized frame, so functions containing try/catch are never inlined.
+  if (!FLAG_optimize_try_catch) set_dont_optimize_reason(kTryCatchStatement);
+  add_flag(kDontSelfOptimize);
+  add_flag(kDontInline);
+}
+
+
 void AstConstructionVisitor::VisitCallRuntime(CallRuntime* node) {
   increase_node_count();
   if (node->is_jsruntime()) {
@@ -151,6 +151,7 @@ typedef ZoneList<Handle<Object> > ZoneObjectList;
 enum AstPropertiesFlag {
   kDontSelfOptimize,
   kDontSoftInline,
+  kDontInline,
   kDontCache
 };
 
@@ -367,20 +368,19 @@ class Expression : public AstNode {
  protected:
   Expression(Zone* zone, int pos)
       : AstNode(pos),
-        zone_(zone),
-        bounds_(Bounds::Unbounded(zone)),
         id_(GetNextId(zone)),
+        bounds_(Bounds::Unbounded(zone)),
         test_id_(GetNextId(zone)) {}
   void set_to_boolean_types(byte types) { to_boolean_types_ = types; }
 
-  Zone* zone_;
-
  private:
-  Bounds bounds_;
-  byte to_boolean_types_;
-
+  // Expressions are the most common nodes, so their fields are ordered to
+  // leave no padding. The id fills the padding after the position of AstNode
+  // on 64-bit hosts.
   const BailoutId id_;
+  Bounds bounds_;
   const TypeFeedbackId test_id_;
+  byte to_boolean_types_;
 };
 
 
@@ -440,6 +440,9 @@ class Block V8_FINAL : public BreakableStatement {
   void AddStatement(Statement* statement, Zone* zone) {
     statements_.Add(statement, zone);
   }
+  void AddStatements(Vector<Statement*> statements, Zone* zone) {
+    statements_.AddAll(statements, zone);
+  }
 
   ZoneList<Statement*>* statements() { return &statements_; }
   bool is_initializer_block() const { return is_initializer_block_; }
@@ -1281,6 +1284,13 @@ class TryCatchStatement V8_FINAL : public TryStatement {
   Variable* variable() { return variable_; }
   Block* catch_block() const { return catch_block_; }
 
+  // Bailout points for optimized code: after the handler has been pushed,
+  // at the handler entry with the exception in the result register, and
+  // after the statement.
+  BailoutId TryId() const { return try_id_; }
+  BailoutId HandlerId() const { return handler_id_; }
+  BailoutId ExitId() const { return exit_id_; }
+
  protected:
   TryCatchStatement(Zone* zone,
                     int index,
@@ -1292,13 +1302,19 @@ class TryCatchStatement V8_FINAL : public TryStatement {
       : TryStatement(zone, index, try_block, pos),
         scope_(scope),
         variable_(variable),
-        catch_block_(catch_block) {
+        catch_block_(catch_block),
+        try_id_(GetNextId(zone)),
+        handler_id_(GetNextId(zone)),
+        exit_id_(GetNextId(zone)) {
   }
 
  private:
   Scope* scope_;
   Variable* variable_;
   Block* catch_block_;
+  const BailoutId try_id_;
+  const BailoutId handler_id_;
+  const BailoutId exit_id_;
 };
 
 
@@ -1710,12 +1726,12 @@ class Property V8_FINAL : public Expression {
   Expression* obj_;
   Expression* key_;
   const BailoutId load_id_;
-
-  SmallMapList receiver_types_;
   bool is_for_call_ : 1;
   bool is_uninitialized_ : 1;
   bool is_string_access_ : 1;
   bool is_function_prototype_ : 1;
+
+  SmallMapList receiver_types_;
 };
 
 
@@ -1985,14 +2001,17 @@ class BinaryOperation V8_FINAL : public Expression {
                   int pos)
       : Expression(zone, pos),
         op_(op),
+        right_id_(GetNextId(zone)),
         left_(left),
-        right_(right),
-        right_id_(GetNextId(zone)) {
+        right_(right) {
     ASSERT(Token::IsBinaryOp(op));
   }
 
  private:
   Token::Value op_;
+  // The short-circuit logical operations need an AST ID for their
+  // right-hand subexpression.
+  const BailoutId right_id_;
   Expression* left_;
   Expression* right_;
   Handle<AllocationSite> allocation_site_;
@@ -2000,10 +2019,6 @@ class BinaryOperation V8_FINAL : public Expression {
   // TODO(rossberg): the fixed arg should probably be represented as a Constant
   // type for the RHS.
   Maybe<int> fixed_right_arg_;
-
-  // The short-circuit logical operations need an AST ID for their
-  // right-hand subexpression.
-  const BailoutId right_id_;
 };
 
 
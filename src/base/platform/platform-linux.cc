@@ -139,20 +139,26 @@ class PosixMemoryMappedFile : public OS::MemoryMappedFile {
 };
 
 
-OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name) {
-  FILE* file = fopen(name, "r+");
+OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name,
+                                                FileMode mode) {
+  FILE* file = fopen(name, mode == kReadOnly ? "r" : "r+");
   if (file == NULL) return NULL;
 
   fseek(file, 0, SEEK_END);
   int size = ftell(file);
+  int protection = mode == kReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
 
   void* memory =
       mmap(OS::GetRandomMmapAddr(),
            size,
-           PROT_READ | PROT_WRITE,
+           protection,
            MAP_SHARED,
            fileno(file),
            0);
+  if (memory == MAP_FAILED) {
+    fclose(file);
+    return NULL;
+  }
   return new PosixMemoryMappedFile(file, memory, size);
 }
 
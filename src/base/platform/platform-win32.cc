@@ -863,9 +863,12 @@ class Win32MemoryMappedFile : public OS::MemoryMappedFile {
 };
 
 
-OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name) {
+OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name,
+                                                FileMode mode) {
+  bool read_only = mode == kReadOnly;
   // Open a physical file
-  HANDLE file = CreateFileA(name, GENERIC_READ | GENERIC_WRITE,
+  HANDLE file = CreateFileA(name,
+      read_only ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE,
       FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, 0, NULL);
   if (file == INVALID_HANDLE_VALUE) return NULL;
 
@@ -873,11 +876,13 @@ OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name) {
 
   // Create a file mapping for the physical file
   HANDLE file_mapping = CreateFileMapping(file, NULL,
-      PAGE_READWRITE, 0, static_cast<DWORD>(size), NULL);
+      read_only ? PAGE_READONLY : PAGE_READWRITE, 0, static_cast<DWORD>(size),
+      NULL);
   if (file_mapping == NULL) return NULL;
 
   // Map a view of the file into memory
-  void* memory = MapViewOfFile(file_mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+  void* memory = MapViewOfFile(file_mapping,
+      read_only ? FILE_MAP_READ : FILE_MAP_ALL_ACCESS, 0, 0, size);
   return new Win32MemoryMappedFile(file, file_mapping, memory, size);
 }
 
@@ -246,7 +246,9 @@ class OS {
 
   class MemoryMappedFile {
    public:
-    static MemoryMappedFile* open(const char* name);
+    enum FileMode { kReadOnly, kReadWrite };
+    static MemoryMappedFile* open(const char* name,
+                                  FileMode mode = kReadWrite);
     static MemoryMappedFile* create(const char* name, int size, void* initial);
     virtual ~MemoryMappedFile() { }
     virtual void* memory() = 0;
@@ -6,7 +6,10 @@
 
 #include "src/assembler.h"
 #include "src/compilation-cache.h"
+#include "src/parser.h"
 #include "src/serialize.h"
+#include "src/smart-pointers.h"
+#include "src/version.h"
 
 namespace v8 {
 namespace internal {
@@ -427,4 +430,233 @@ void CompilationCache::Disable() {
 }
 
 
+template <typename Char>
+static uint64_t HashSourceChars(Vector<const Char> chars) {
+  // 64-bit FNV-1a, so that different sources practically never collide.
+  uint64_t hash = V8_2PART_UINT64_C(0xcbf29ce4, 84222325);
+  for (int i = 0; i < chars.length(); i++) {
+    hash ^= chars[i];
+    hash *= V8_2PART_UINT64_C(0x00000100, 000001b3);
+  }
+  return hash;
+}
+
+
+void PersistentScriptCache::ComputeKey(Handle<String> source,
+                                       Vector<char> buffer) {
+  ASSERT(buffer.length() >= kMaxKeyLength);
+  source = String::Flatten(source);
+  uint64_t hash;
+  {
+    DisallowHeapAllocation no_gc;
+    String::FlatContent content = source->GetFlatContent();
+    hash = content.IsAscii() ? HashSourceChars(content.ToOneByteVector())
+                             : HashSourceChars(content.ToUC16Vector());
+  }
+  SNPrintF(buffer, "%d.%d.%d.%d%s-%08x-%d-%08x%08x",
+           Version::GetMajor(), Version::GetMinor(), Version::GetBuild(),
+           Version::GetPatch(), Version::IsCandidate() ? "c" : "",
+           FlagList::Hash(), source->length(),
+           static_cast<uint32_t>(hash >> 32), static_cast<uint32_t>(hash));
+}
+
+
+uint32_t PersistentScriptCache::Checksum(const unsigned* data, int length) {
+  uint32_t hash = 2166136261u;
+  for (int i = 0; i < length; i++) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+
+ScriptData* PersistentScriptCache::Lookup(Isolate* isolate,
+                                          Handle<String> source) {
+  v8::ScriptCompiler::CacheStore* store = isolate->script_cache_store();
+  if (store == NULL && !FLAG_shared_script_cache) return NULL;
+  char key[kMaxKeyLength];
+  ComputeKey(source, Vector<char>(key, kMaxKeyLength));
+  if (FLAG_shared_script_cache) {
+    ScriptData* data = SharedScriptCache::Lookup(key);
+    if (data != NULL) {
+      isolate->counters()->shared_script_cache_hits()->Increment();
+      return data;
+    }
+    isolate->counters()->shared_script_cache_misses()->Increment();
+  }
+  if (store == NULL) return NULL;
+  ScriptData* data = LookupInStore(store, key);
+  if (data != NULL && FLAG_shared_script_cache) {
+    SharedScriptCache::Insert(key, data);
+    isolate->counters()->shared_script_cache_size()->Set(
+        static_cast<int>(SharedScriptCache::size()));
+  }
+  return data;
+}
+
+
+ScriptData* PersistentScriptCache::LookupInStore(
+    v8::ScriptCompiler::CacheStore* store, const char* key) {
+  SmartPointer<v8::ScriptCompiler::CachedData> cached(store->Lookup(key));
+  if (cached.is_empty()) return NULL;
+
+  // The stored bytes need not be aligned, so they are copied.
+  int length = cached->length;
+  if (length < static_cast<int>(kHeaderSize * sizeof(unsigned)) ||
+      length % sizeof(unsigned) != 0) {
+    return NULL;
+  }
+  unsigned header[kHeaderSize];
+  MemCopy(header, cached->data, sizeof(header));
+  int payload_length = length / sizeof(unsigned) - kHeaderSize;
+  if (header[kMagicOffset] != kMagicNumber ||
+      header[kLengthOffset] != static_cast<unsigned>(payload_length)) {
+    return NULL;
+  }
+  Vector<unsigned> payload = Vector<unsigned>::New(payload_length);
+  MemCopy(payload.start(),
+          cached->data + sizeof(header),
+          payload_length * sizeof(unsigned));
+  if (Checksum(payload.start(), payload_length) != header[kChecksumOffset]) {
+    payload.Dispose();
+    return NULL;
+  }
+  ScriptData* data = new ScriptData(payload);
+  if (!data->SanityCheck() || data->has_error()) {
+    delete data;
+    return NULL;
+  }
+  return data;
+}
+
+
+void PersistentScriptCache::Store(Isolate* isolate,
+                                  Handle<String> source,
+                                  ScriptData* data) {
+  v8::ScriptCompiler::CacheStore* store = isolate->script_cache_store();
+  if (store == NULL && !FLAG_shared_script_cache) return;
+  char key[kMaxKeyLength];
+  ComputeKey(source, Vector<char>(key, kMaxKeyLength));
+  if (FLAG_shared_script_cache) {
+    SharedScriptCache::Insert(key, data);
+    isolate->counters()->shared_script_cache_size()->Set(
+        static_cast<int>(SharedScriptCache::size()));
+  }
+  if (store == NULL) return;
+
+  int payload_length = data->Length() / sizeof(unsigned);
+  const unsigned* payload = reinterpret_cast<const unsigned*>(data->Data());
+  Vector<unsigned> buffer = Vector<unsigned>::New(kHeaderSize + payload_length);
+  buffer[kMagicOffset] = kMagicNumber;
+  buffer[kLengthOffset] = payload_length;
+  buffer[kChecksumOffset] = Checksum(payload, payload_length);
+  MemCopy(buffer.start() + kHeaderSize,
+          payload,
+          payload_length * sizeof(unsigned));
+  store->Store(key,
+               reinterpret_cast<const uint8_t*>(buffer.start()),
+               buffer.length() * sizeof(unsigned));
+  buffer.Dispose();
+}
+
+
+// The memory held by an entry of the shared script cache.
+struct SharedScriptCache::Entry {
+  char* key;
+  Vector<unsigned> data;
+
+  size_t size() const {
+    return sizeof(Entry) + strlen(key) + 1 + data.length() * sizeof(unsigned);
+  }
+};
+
+
+List<SharedScriptCache::Entry*>* SharedScriptCache::entries_ = NULL;
+size_t SharedScriptCache::size_ = 0;
+static base::LazyMutex shared_script_cache_mutex = LAZY_MUTEX_INITIALIZER;
+
+
+ScriptData* SharedScriptCache::Lookup(const char* key) {
+  base::LockGuard<base::Mutex> lock_guard(shared_script_cache_mutex.Pointer());
+  if (entries_ == NULL) return NULL;
+  for (int i = entries_->length() - 1; i >= 0; i--) {
+    Entry* entry = entries_->at(i);
+    if (strcmp(entry->key, key) != 0) continue;
+    // Keep the entries ordered from least to most recently used.
+    entries_->Remove(i);
+    entries_->Add(entry);
+    Vector<unsigned> copy = Vector<unsigned>::New(entry->data.length());
+    MemCopy(copy.start(),
+            entry->data.start(),
+            copy.length() * sizeof(unsigned));
+    return new ScriptData(copy);
+  }
+  return NULL;
+}
+
+
+void SharedScriptCache::Insert(const char* key, ScriptData* data) {
+  base::LockGuard<base::Mutex> lock_guard(shared_script_cache_mutex.Pointer());
+  if (entries_ == NULL) entries_ = new List<Entry*>(16);
+  for (int i = 0; i < entries_->length(); i++) {
+    // Another isolate inserted the data in the meantime.
+    if (strcmp(entries_->at(i)->key, key) == 0) return;
+  }
+
+  Entry* entry = new Entry;
+  entry->key = StrDup(key);
+  entry->data = Vector<unsigned>::New(data->Length() / sizeof(unsigned));
+  MemCopy(entry->data.start(), data->Data(), data->Length());
+  entries_->Add(entry);
+  size_ += entry->size();
+  if (FLAG_trace_shared_script_cache) {
+    PrintF("[shared script cache: added %s (%d bytes), "
+           "%d entries (%d bytes)]\n",
+           key, static_cast<int>(entry->size()), entries_->length(),
+           static_cast<int>(size_));
+  }
+
+  size_t max_size = static_cast<size_t>(FLAG_shared_script_cache_size) * MB;
+  while (size_ > max_size) {
+    Entry* oldest = entries_->Remove(0);
+    size_ -= oldest->size();
+    if (FLAG_trace_shared_script_cache) {
+      PrintF("[shared script cache: evicted %s (%d bytes)]\n",
+             oldest->key, static_cast<int>(oldest->size()));
+    }
+    Delete(oldest);
+  }
+}
+
+
+void SharedScriptCache::Delete(Entry* entry) {
+  DeleteArray(entry->key);
+  entry->data.Dispose();
+  delete entry;
+}
+
+
+void SharedScriptCache::TearDown() {
+  base::LockGuard<base::Mutex> lock_guard(shared_script_cache_mutex.Pointer());
+  if (entries_ == NULL) return;
+  for (int i = 0; i < entries_->length(); i++) Delete(entries_->at(i));
+  delete entries_;
+  entries_ = NULL;
+  size_ = 0;
+}
+
+
+size_t SharedScriptCache::size() {
+  base::LockGuard<base::Mutex> lock_guard(shared_script_cache_mutex.Pointer());
+  return size_;
+}
+
+
+int SharedScriptCache::length() {
+  base::LockGuard<base::Mutex> lock_guard(shared_script_cache_mutex.Pointer());
+  return entries_ == NULL ? 0 : entries_->length();
+}
+
+
 } }  // namespace v8::internal
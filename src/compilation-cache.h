@@ -238,6 +238,74 @@ class CompilationCache {
 };
 
 
+class ScriptData;
+
+// Keeps the preparse data of scripts in the SharedScriptCache, and in the
+// store the embedder installed with Isolate::SetScriptCacheStore, so that it
+// outlives the isolate and the process. Entries are keyed by the V8 version,
+// the flags and a hash of the source. Stored entries carry a checksum;
+// entries that fail any check are ignored.
+class PersistentScriptCache : public AllStatic {
+ public:
+  // Returns the data stored for the source, or NULL. The caller takes
+  // ownership of the returned data.
+  static ScriptData* Lookup(Isolate* isolate, Handle<String> source);
+
+  // Stores the data produced while compiling the source.
+  static void Store(Isolate* isolate, Handle<String> source, ScriptData* data);
+
+  // Entries are prefixed by a header of kHeaderSize words.
+  static const uint32_t kMagicNumber = 0xCA5C0DE5;
+  static const int kMagicOffset = 0;
+  static const int kLengthOffset = 1;
+  static const int kChecksumOffset = 2;
+  static const int kHeaderSize = 3;
+
+ private:
+  // Writes the key for the source to the buffer, which must be at least
+  // kMaxKeyLength characters long.
+  static void ComputeKey(Handle<String> source, Vector<char> buffer);
+  static ScriptData* LookupInStore(v8::ScriptCompiler::CacheStore* store,
+                                   const char* key);
+  static uint32_t Checksum(const unsigned* data, int length);
+
+  static const int kMaxKeyLength = 96;
+};
+
+
+// A process-wide cache of the preparse data of scripts, so that isolates
+// loading the same scripts only parse them once. The least recently used
+// entries are evicted once the entries take more than
+// --shared-script-cache-size megabytes. All functions are thread-safe.
+class SharedScriptCache : public AllStatic {
+ public:
+  // Returns a copy of the data stored under the key, or NULL. The caller
+  // takes ownership of the returned data.
+  static ScriptData* Lookup(const char* key);
+
+  // Stores a copy of the data under the key, unless there is an entry for
+  // the key already.
+  static void Insert(const char* key, ScriptData* data);
+
+  // Deletes all entries.
+  static void TearDown();
+
+  // The memory held by the entries, in bytes.
+  static size_t size();
+  // The number of entries.
+  static int length();
+
+ private:
+  struct Entry;
+
+  static void Delete(Entry* entry);
+
+  // Least recently used first.
+  static List<Entry*>* entries_;
+  static size_t size_;
+};
+
+
 } }  // namespace v8::internal
 
 #endif  // V8_COMPILATION_CACHE_H_
@@ -102,6 +102,7 @@ void CompilationInfo::Initialize(Isolate* isolate,
   extension_ = NULL;
   cached_data_ = NULL;
   cached_data_mode_ = NO_CACHED_DATA;
+  compile_hints_ = Vector<const int>();
   zone_ = zone;
   deferred_handles_ = NULL;
   code_stub_ = NULL;
@@ -928,7 +929,8 @@ Handle<SharedFunctionInfo> Compiler::CompileScript(
     v8::Extension* extension,
     ScriptData** cached_data,
     CachedDataMode cached_data_mode,
-    NativesFlag natives) {
+    NativesFlag natives,
+    Vector<const int> compile_hints) {
   if (cached_data_mode == NO_CACHED_DATA) {
     cached_data = NULL;
   } else if (cached_data_mode == PRODUCE_CACHED_DATA) {
@@ -968,17 +970,46 @@ Handle<SharedFunctionInfo> Compiler::CompileScript(
     }
     script->set_is_shared_cross_origin(is_shared_cross_origin);
 
+    // Unless the embedder passed its own data, use the preparse data in the
+    // shared or persistent cache, or produce it for them.
+    ScriptData* persistent_data = NULL;
+    bool use_persistent_cache =
+        (FLAG_shared_script_cache || isolate->script_cache_store() != NULL) &&
+        extension == NULL &&
+        natives == NOT_NATIVES_CODE &&
+        cached_data_mode == NO_CACHED_DATA &&
+        compile_hints.is_empty() &&
+        source_length > FLAG_min_preparse_length;
+    if (use_persistent_cache) {
+      persistent_data = PersistentScriptCache::Lookup(isolate, source);
+      cached_data = &persistent_data;
+      cached_data_mode = persistent_data != NULL ? CONSUME_CACHED_DATA
+                                                 : PRODUCE_CACHED_DATA;
+    }
+
     // Compile the function and add it to the cache.
     CompilationInfoWithZone info(script);
     info.MarkAsGlobal();
     info.SetExtension(extension);
     info.SetCachedData(cached_data, cached_data_mode);
+    if (cached_data_mode == NO_CACHED_DATA) {
+      // The preparse data has to describe the same lazy functions whether
+      // it is produced or consumed, so it does not go with compile hints.
+      info.SetCompileHints(compile_hints);
+    }
     info.SetContext(context);
     if (FLAG_use_strict) info.SetStrictMode(STRICT);
     result = CompileToplevel(&info);
     if (extension == NULL && !result.is_null() && !result->dont_cache()) {
       compilation_cache->PutScript(source, context, result);
     }
+    if (use_persistent_cache) {
+      if (cached_data_mode == PRODUCE_CACHED_DATA && !result.is_null() &&
+          persistent_data != NULL) {
+        PersistentScriptCache::Store(isolate, source, persistent_data);
+      }
+      delete persistent_data;
+    }
     if (result.is_null()) isolate->ReportPendingMessages();
   } else if (result->ic_age() != isolate->heap()->global_ic_age()) {
       result->ResetForNewContext(isolate->heap()->global_ic_age());
@@ -987,6 +1018,30 @@ Handle<SharedFunctionInfo> Compiler::CompileScript(
 }
 
 
+int Compiler::GetCompiledFunctionPositions(Handle<Script> script,
+                                          int* positions,
+                                          int capacity) {
+  Heap* heap = script->GetHeap();
+  List<int> found;
+  HeapIterator iterator(heap);
+  DisallowHeapAllocation no_gc;
+  for (HeapObject* obj = iterator.next(); obj != NULL; obj = iterator.next()) {
+    if (!obj->IsSharedFunctionInfo()) continue;
+    SharedFunctionInfo* shared = SharedFunctionInfo::cast(obj);
+    if (shared->script() == *script &&
+        shared->is_function() &&
+        shared->is_compiled()) {
+      found.Add(shared->start_position());
+    }
+  }
+  found.Sort();
+  for (int i = 0; i < found.length() && i < capacity; i++) {
+    positions[i] = found[i];
+  }
+  return found.length();
+}
+
+
 Handle<SharedFunctionInfo> Compiler::BuildFunctionInfo(FunctionLiteral* literal,
                                                        Handle<Script> script) {
   // Precondition: code has been parsed and scopes have been analyzed.
@@ -1287,18 +1342,20 @@ void Compiler::RecordFunctionCompilation(Logger::LogEventsAndTags tag,
 
 
 CompilationPhase::CompilationPhase(const char* name, CompilationInfo* info)
-    : name_(name), info_(info), zone_(info->isolate()) {
-  if (FLAG_hydrogen_stats) {
-    info_zone_start_allocation_size_ = info->zone()->allocation_size();
-    timer_.Start();
-  }
+    : name_(name),
+      info_(info),
+      zone_(info->isolate()),
+      info_zone_start_allocation_size_(info->zone()->allocation_size()) {
+  if (FLAG_hydrogen_stats) timer_.Start();
 }
 
 
 CompilationPhase::~CompilationPhase() {
+  unsigned size = zone()->allocation_size();
+  size += info_->zone()->allocation_size() - info_zone_start_allocation_size_;
+  isolate()->counters()->zone_bytes_optimize()->Increment(
+      static_cast<int>(size));
   if (FLAG_hydrogen_stats) {
-    unsigned size = zone()->allocation_size();
-    size += info_->zone()->allocation_size() - info_zone_start_allocation_size_;
     isolate()->GetHStatistics()->SaveTiming(name_, timer_.Elapsed(), size);
   }
 }
@@ -64,6 +64,7 @@ class CompilationInfo {
   CachedDataMode cached_data_mode() const {
     return cached_data_mode_;
   }
+  Vector<const int> compile_hints() const { return compile_hints_; }
   Handle<Context> context() const { return context_; }
   BailoutId osr_ast_id() const { return osr_ast_id_; }
   Handle<Code> unoptimized_code() const { return unoptimized_code_; }
@@ -194,6 +195,10 @@ class CompilationInfo {
       cached_data_ = cached_data;
     }
   }
+  void SetCompileHints(Vector<const int> compile_hints) {
+    ASSERT(!is_lazy());
+    compile_hints_ = compile_hints;
+  }
   void SetContext(Handle<Context> context) {
     context_ = context;
   }
@@ -418,6 +423,8 @@ class CompilationInfo {
   v8::Extension* extension_;
   ScriptData** cached_data_;
   CachedDataMode cached_data_mode_;
+  // Start positions of the functions to compile eagerly, in increasing order.
+  Vector<const int> compile_hints_;
 
   // The context of the caller for eval code, and the global context for a
   // global script. Will be a null handle otherwise.
@@ -657,7 +664,14 @@ class Compiler : public AllStatic {
       v8::Extension* extension,
       ScriptData** cached_data,
       CachedDataMode cached_data_mode,
-      NativesFlag is_natives_code);
+      NativesFlag is_natives_code,
+      Vector<const int> compile_hints = Vector<const int>());
+
+  // Returns the number of compiled functions of the script, and writes up to
+  // capacity of their start positions, in increasing order, to positions.
+  static int GetCompiledFunctionPositions(Handle<Script> script,
+                                          int* positions,
+                                          int capacity);
 
   // Create a shared function info object (the code may be lazily compiled).
   static Handle<SharedFunctionInfo> BuildFunctionInfo(FunctionLiteral* node,
@@ -385,6 +385,11 @@ class HistogramTimerScope BASE_EMBEDDED {
   SC(arguments_adaptors, V8.ArgumentsAdaptors)                        \
   SC(compilation_cache_hits, V8.CompilationCacheHits)                 \
   SC(compilation_cache_misses, V8.CompilationCacheMisses)             \
+  SC(shared_script_cache_hits, V8.SharedScriptCacheHits)              \
+  SC(shared_script_cache_misses, V8.SharedScriptCacheMisses)          \
+  SC(shared_script_cache_size, V8.SharedScriptCacheSize)              \
+  SC(internalization_cache_hits, V8.InternalizationCacheHits)         \
+  SC(internalization_cache_misses, V8.InternalizationCacheMisses)     \
   SC(string_ctor_calls, V8.StringConstructorCalls)                    \
   SC(string_ctor_conversions, V8.StringConstructorConversions)        \
   SC(string_ctor_cached_number, V8.StringConstructorCachedNumber)     \
@@ -447,6 +452,7 @@ class HistogramTimerScope BASE_EMBEDDED {
   SC(named_load_global_stub, V8.NamedLoadGlobalStub)                  \
   SC(named_store_global_inline, V8.NamedStoreGlobalInline)            \
   SC(named_store_global_inline_miss, V8.NamedStoreGlobalInlineMiss)   \
+  SC(keyed_store_generic_dict, V8.KeyedStoreGenericDict)              \
   SC(keyed_store_polymorphic_stubs, V8.KeyedStorePolymorphicStubs)    \
   SC(keyed_store_external_array_slow, V8.KeyedStoreExternalArraySlow) \
   SC(store_normal_miss, V8.StoreNormalMiss)                           \
@@ -471,12 +477,32 @@ class HistogramTimerScope BASE_EMBEDDED {
   SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes)    \
   SC(megamorphic_stub_cache_misses, V8.MegamorphicStubCacheMisses)    \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)  \
+  SC(stub_cache_load_primary_hits, V8.StubCacheLoadPrimaryHits)      \
+  SC(stub_cache_load_secondary_hits, V8.StubCacheLoadSecondaryHits)  \
+  SC(stub_cache_load_misses, V8.StubCacheLoadMisses)                  \
+  SC(stub_cache_load_primary_collisions,                              \
+     V8.StubCacheLoadPrimaryCollisions)                               \
+  SC(stub_cache_load_secondary_collisions,                            \
+     V8.StubCacheLoadSecondaryCollisions)                             \
+  SC(stub_cache_store_primary_hits, V8.StubCacheStorePrimaryHits)    \
+  SC(stub_cache_store_secondary_hits, V8.StubCacheStoreSecondaryHits) \
+  SC(stub_cache_store_misses, V8.StubCacheStoreMisses)                \
+  SC(stub_cache_store_primary_collisions,                             \
+     V8.StubCacheStorePrimaryCollisions)                              \
+  SC(stub_cache_store_secondary_collisions,                           \
+     V8.StubCacheStoreSecondaryCollisions)                            \
   SC(array_function_runtime, V8.ArrayFunctionRuntime)                 \
   SC(array_function_native, V8.ArrayFunctionNative)                   \
   SC(for_in, V8.ForIn)                                                \
   SC(enum_cache_hits, V8.EnumCacheHits)                               \
   SC(enum_cache_misses, V8.EnumCacheMisses)                           \
   SC(zone_segment_bytes, V8.ZoneSegmentBytes)                         \
+  SC(zone_segments_allocated, V8.ZoneSegmentsAllocated)               \
+  SC(zone_segments_reused, V8.ZoneSegmentsReused)                     \
+  /* Zone memory used by the phases of compilation. */                \
+  SC(zone_bytes_parse, V8.ZoneBytesParse)                             \
+  SC(zone_bytes_full_codegen, V8.ZoneBytesFullCodegen)                \
+  SC(zone_bytes_optimize, V8.ZoneBytesOptimize)                       \
   SC(fast_new_closure_total, V8.FastNewClosureTotal)                  \
   SC(fast_new_closure_try_optimized, V8.FastNewClosureTryOptimized)   \
   SC(fast_new_closure_install_optimized, V8.FastNewClosureInstallOptimized) \
@@ -21,6 +21,9 @@
 #include <assert.h>
 #endif  // V8_SHARED
 
+#include <string>
+#include <vector>
+
 #ifndef V8_SHARED
 #include <algorithm>
 #endif  // !V8_SHARED
@@ -1054,6 +1057,30 @@ static char* ReadChars(Isolate* isolate, const char* name, int* size_out) {
 }
 
 
+// Maps a large ASCII file into memory as an external string, which saves
+// copying it into a buffer and then into the heap. Returns an empty handle
+// for small files and for files that need UTF-8 decoding.
+static Handle<String> MapFile(Isolate* isolate, const char* name) {
+  static const int kMinMappedFileSize = 64 * 1024;
+  FILE* file = FOpen(name, "rb");
+  if (file == NULL) return Handle<String>();
+  fseek(file, 0, SEEK_END);
+  int size = ftell(file);
+  fclose(file);
+  if (size < kMinMappedFileSize) return Handle<String>();
+
+  Handle<String> result = String::NewExternalFromFile(isolate, name);
+  if (result.IsEmpty()) return result;
+  const String::ExternalAsciiStringResource* resource =
+      result->GetExternalAsciiStringResource();
+  const char* chars = resource->data();
+  for (size_t i = 0; i < resource->length(); i++) {
+    if (chars[i] & 0x80) return Handle<String>();
+  }
+  return result;
+}
+
+
 struct DataAndPersistent {
   uint8_t* data;
   Persistent<ArrayBuffer> handle;
@@ -1103,6 +1130,8 @@ void Shell::ReadBuffer(const v8::FunctionCallbackInfo<v8::Value>& args) {
 
 // Reads a file into a v8 string.
 Handle<String> Shell::ReadFile(Isolate* isolate, const char* name) {
+  Handle<String> mapped = MapFile(isolate, name);
+  if (!mapped.IsEmpty()) return mapped;
   int size = 0;
   char* chars = ReadChars(isolate, name, &size);
   if (chars == NULL) return Handle<String>();
@@ -1179,6 +1208,8 @@ void SourceGroup::Execute(Isolate* isolate) {
 
 
 Handle<String> SourceGroup::ReadFile(Isolate* isolate, const char* name) {
+  Handle<String> mapped = MapFile(isolate, name);
+  if (!mapped.IsEmpty()) return mapped;
   int size;
   char* chars = ReadChars(isolate, name, &size);
   if (chars == NULL) return Handle<String>();
@@ -1319,6 +1350,9 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--icu-data-file=", 16) == 0) {
       options.icu_data_file = argv[i] + 16;
       argv[i] = NULL;
+    } else if (strncmp(argv[i], "--cache-dir=", 12) == 0) {
+      options.cache_dir = argv[i] + 12;
+      argv[i] = NULL;
 #ifdef V8_SHARED
     } else if (strcmp(argv[i], "--dump-counters") == 0) {
       printf("D8 with shared library does not include counters\n");
@@ -1493,6 +1527,116 @@ class MockArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
 };
 
 
+// Keeps compilation data in files in a directory, one file per key. The
+// files are listed in an index, least recently used first, and the least
+// recently used ones are deleted when the total size exceeds a limit.
+class DirectoryCacheStore : public ScriptCompiler::CacheStore {
+ public:
+  explicit DirectoryCacheStore(const char* directory)
+      : directory_(directory), total_size_(0) {
+    ReadIndex();
+  }
+
+  virtual ~DirectoryCacheStore() { WriteIndex(); }
+
+  virtual ScriptCompiler::CachedData* Lookup(const char* key) V8_OVERRIDE {
+    int index = Find(key);
+    if (index == -1) return NULL;
+    int size = 0;
+    char* chars = ReadChars(NULL, PathOf(key).c_str(), &size);
+    if (chars == NULL || size != entries_[index].size) {
+      delete[] chars;
+      Remove(index);
+      return NULL;
+    }
+    // Move the entry to the back of the index.
+    Entry entry = entries_[index];
+    entries_.erase(entries_.begin() + index);
+    entries_.push_back(entry);
+    return new ScriptCompiler::CachedData(
+        reinterpret_cast<uint8_t*>(chars), size,
+        ScriptCompiler::CachedData::BufferOwned);
+  }
+
+  virtual void Store(const char* key,
+                     const uint8_t* data,
+                     int length) V8_OVERRIDE {
+    int index = Find(key);
+    if (index != -1) Remove(index);
+    FILE* file = FOpen(PathOf(key).c_str(), "wb");
+    if (file == NULL) return;
+    bool written = fwrite(data, 1, length, file) == static_cast<size_t>(length);
+    fclose(file);
+    if (!written) {
+      remove(PathOf(key).c_str());
+      return;
+    }
+    Entry entry = { key, length };
+    entries_.push_back(entry);
+    total_size_ += length;
+    while (total_size_ > kMaxTotalSize && entries_.size() > 1) Remove(0);
+    WriteIndex();
+  }
+
+ private:
+  struct Entry {
+    std::string key;
+    int size;
+  };
+
+  static const int kMaxTotalSize = 64 * 1024 * 1024;
+
+  std::string PathOf(const std::string& name) {
+    return directory_ + "/" + name;
+  }
+
+  int Find(const char* key) {
+    for (size_t i = 0; i < entries_.size(); i++) {
+      if (entries_[i].key == key) return static_cast<int>(i);
+    }
+    return -1;
+  }
+
+  void Remove(int index) {
+    remove(PathOf(entries_[index].key).c_str());
+    total_size_ -= entries_[index].size;
+    entries_.erase(entries_.begin() + index);
+  }
+
+  // The index has a line "<key> <size>" per file.
+  void ReadIndex() {
+    FILE* file = FOpen(PathOf("index").c_str(), "r");
+    if (file == NULL) return;
+    char key[128];
+    int size;
+    while (fscanf(file, "%127s %d", key, &size) == 2) {
+      if (size < 0 || Find(key) != -1) continue;
+      Entry entry = { key, size };
+      entries_.push_back(entry);
+      total_size_ += size;
+    }
+    fclose(file);
+  }
+
+  void WriteIndex() {
+    FILE* file = FOpen(PathOf("index").c_str(), "w");
+    if (file == NULL) return;
+    for (size_t i = 0; i < entries_.size(); i++) {
+      fprintf(file, "%s %d\n", entries_[i].key.c_str(), entries_[i].size);
+    }
+    fclose(file);
+  }
+
+  std::string directory_;
+  std::vector<Entry> entries_;
+  int total_size_;
+
+  // Disallow copy & assign.
+  DirectoryCacheStore(const DirectoryCacheStore& other);
+  void operator=(const DirectoryCacheStore& other);
+};
+
+
 #ifdef V8_USE_EXTERNAL_STARTUP_DATA
 class StartupDataHandler {
  public:
@@ -1571,6 +1715,12 @@ int Shell::Main(int argc, char* argv[]) {
   v8::SetResourceConstraints(isolate, &constraints);
 #endif
   DumbLineEditor dumb_line_editor(isolate);
+  // The store is only used by the main isolate, as it is not thread-safe.
+  DirectoryCacheStore* cache_store = NULL;
+  if (options.cache_dir != NULL) {
+    cache_store = new DirectoryCacheStore(options.cache_dir);
+    isolate->SetScriptCacheStore(cache_store);
+  }
   {
     Isolate::Scope scope(isolate);
     Initialize(isolate);
@@ -1625,6 +1775,7 @@ int Shell::Main(int argc, char* argv[]) {
     }
   }
   isolate->Dispose();
+  delete cache_store;
   V8::Dispose();
 
   OnExit();
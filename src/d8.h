@@ -210,7 +210,8 @@ class ShellOptions {
      isolate_sources(NULL),
      icu_data_file(NULL),
      natives_blob(NULL),
-     snapshot_blob(NULL) { }
+     snapshot_blob(NULL),
+     cache_dir(NULL) { }
 
   ~ShellOptions() {
     delete[] isolate_sources;
@@ -236,6 +237,7 @@ class ShellOptions {
   const char* icu_data_file;
   const char* natives_blob;
   const char* snapshot_blob;
+  const char* cache_dir;
 };
 
 #ifdef V8_SHARED
@@ -57,6 +57,160 @@ void DeoptimizerData::Iterate(ObjectVisitor* v) {
 }
 
 
+int DeoptimizationStatistics::Site::total_count() const {
+  int total = 0;
+  for (int i = 0; i < Deoptimizer::kBailoutTypesWithCodeEntry; ++i) {
+    total += counts[i];
+  }
+  return total;
+}
+
+
+DeoptimizationStatistics::DeoptimizationStatistics()
+    : sites_(SitesMatch) {
+}
+
+
+DeoptimizationStatistics::~DeoptimizationStatistics() {
+  for (HashMap::Entry* p = sites_.Start(); p != NULL; p = sites_.Next(p)) {
+    Site* site = reinterpret_cast<Site*>(p->value);
+    DeleteArray(site->function_name);
+    DeleteArray(site->reason);
+    delete site;
+  }
+}
+
+
+void DeoptimizationStatistics::InitializeKey(Site* site,
+                                             SharedFunctionInfo* shared,
+                                             BailoutId ast_id) {
+  site->script_id = shared->script()->IsScript()
+      ? Script::cast(shared->script())->id()->value()
+      : -1;
+  site->start_position = shared->start_position();
+  site->ast_id = ast_id.ToInt();
+}
+
+
+uint32_t DeoptimizationStatistics::Hash(Site* site) {
+  uint32_t hash = ComputeIntegerHash(site->script_id, 0);
+  hash = ComputeIntegerHash(site->start_position, hash);
+  return ComputeIntegerHash(site->ast_id, hash);
+}
+
+
+bool DeoptimizationStatistics::SitesMatch(void* key1, void* key2) {
+  Site* site1 = reinterpret_cast<Site*>(key1);
+  Site* site2 = reinterpret_cast<Site*>(key2);
+  return site1->script_id == site2->script_id &&
+         site1->start_position == site2->start_position &&
+         site1->ast_id == site2->ast_id;
+}
+
+
+DeoptimizationStatistics::Site* DeoptimizationStatistics::Lookup(
+    SharedFunctionInfo* shared, BailoutId ast_id) {
+  Site key;
+  InitializeKey(&key, shared, ast_id);
+  HashMap::Entry* entry = sites_.Lookup(&key, Hash(&key), false);
+  return entry == NULL ? NULL : reinterpret_cast<Site*>(entry->value);
+}
+
+
+DeoptimizationStatistics::Site* DeoptimizationStatistics::Record(
+    SharedFunctionInfo* shared,
+    BailoutId ast_id,
+    Deoptimizer::BailoutType type) {
+  ASSERT(type < Deoptimizer::kBailoutTypesWithCodeEntry);
+  Site key;
+  InitializeKey(&key, shared, ast_id);
+  HashMap::Entry* entry = sites_.Lookup(&key, Hash(&key), true);
+  Site* site = reinterpret_cast<Site*>(entry->value);
+  if (site == NULL) {
+    site = new Site(key);
+    for (int i = 0; i < Deoptimizer::kBailoutTypesWithCodeEntry; ++i) {
+      site->counts[i] = 0;
+    }
+    site->feedback = -1;
+    site->function_name = NULL;
+    site->reason = NULL;
+    // The key must stay alive as long as the entry does.
+    entry->key = site;
+    entry->value = site;
+  }
+  site->counts[type]++;
+  site->last_type = type;
+  return site;
+}
+
+
+void DeoptimizationStatistics::Describe(Site* site,
+                                        SharedFunctionInfo* shared,
+                                        const char* reason) {
+  if (site->function_name == NULL) {
+    site->function_name = shared->DebugName()->ToCString(
+        DISALLOW_NULLS, ROBUST_STRING_TRAVERSAL).Detach();
+  }
+  if (reason != NULL) {
+    DeleteArray(site->reason);
+    site->reason = StrDup(reason);
+  }
+}
+
+
+bool DeoptimizationStatistics::IsDeoptLoop(SharedFunctionInfo* shared,
+                                           BailoutId ast_id,
+                                           int feedback) {
+  if (FLAG_deopt_loop_threshold <= 0) return false;
+  Site* site = Lookup(shared, ast_id);
+  if (site == NULL ||
+      site->counts[Deoptimizer::EAGER] < FLAG_deopt_loop_threshold) {
+    return false;
+  }
+  if (site->feedback == -1) {
+    site->feedback = feedback;
+  } else if (site->feedback != feedback) {
+    // The site has seen new receivers since it went generic; give the
+    // specialized access another chance.
+    site->counts[Deoptimizer::EAGER] = 0;
+    site->feedback = -1;
+    return false;
+  }
+  return true;
+}
+
+
+static int CompareSitesByCount(DeoptimizationStatistics::Site* const* a,
+                               DeoptimizationStatistics::Site* const* b) {
+  return (*b)->total_count() - (*a)->total_count();
+}
+
+
+void DeoptimizationStatistics::Print(FILE* out) {
+  List<Site*> sites(sites_.occupancy());
+  for (HashMap::Entry* p = sites_.Start(); p != NULL; p = sites_.Next(p)) {
+    sites.Add(reinterpret_cast<Site*>(p->value));
+  }
+  sites.Sort(CompareSitesByCount);
+  PrintF(out, "=== Deoptimization sites: %d\n", sites.length());
+  for (int i = 0; i < sites.length(); ++i) {
+    Site* site = sites[i];
+    PrintF(out, "%6d  %s (script %d, pos %d) @ node %d"
+           " [eager %d, lazy %d, soft %d]",
+           site->total_count(),
+           site->function_name != NULL ? site->function_name : "<unknown>",
+           site->script_id,
+           site->start_position,
+           site->ast_id,
+           site->counts[Deoptimizer::EAGER],
+           site->counts[Deoptimizer::LAZY],
+           site->counts[Deoptimizer::SOFT]);
+    if (site->reason != NULL) PrintF(out, " %s", site->reason);
+    PrintF(out, "\n");
+  }
+}
+
+
 Code* Deoptimizer::FindDeoptimizingCode(Address addr) {
   if (function_->IsHeapObject()) {
     // Search all deoptimizing code in the native context of the function.
@@ -546,6 +700,7 @@ Deoptimizer::Deoptimizer(Isolate* isolate,
       output_count_(0),
       jsframe_count_(0),
       output_(NULL),
+      catch_handler_(NULL),
       deferred_objects_tagged_values_(0),
       deferred_objects_double_values_(0),
       deferred_objects_(0),
@@ -790,6 +945,13 @@ void Deoptimizer::DoComputeOutputFrames() {
       input_->GetRegister(fp_reg.code()) +
           has_alignment_padding_ * kPointerSize);
 
+  // A catch handler below the frame pointer was pushed by the optimized
+  // code itself, see LCodeGen::DoEnterTry.
+  if (bailout_type_ != DEBUGGER) {
+    Address handler = Isolate::handler(isolate_->thread_local_top());
+    if (handler != NULL && handler < stack_fp_) catch_handler_ = handler;
+  }
+
   // Translate each output frame.
   for (int i = 0; i < count; ++i) {
     // Read the ast node id, function, and frame height for this output frame.
@@ -832,6 +994,11 @@ void Deoptimizer::DoComputeOutputFrames() {
     }
   }
 
+  if (bailout_type_ != DEBUGGER &&
+      compiled_code_->kind() == Code::OPTIMIZED_FUNCTION) {
+    RecordDeoptimizationSite(node_id);
+  }
+
   // Print some helpful diagnostic information.
   if (trace_scope_ != NULL) {
     double ms = timer.Elapsed().InMillisecondsF();
@@ -857,6 +1024,45 @@ void Deoptimizer::DoComputeOutputFrames() {
 }
 
 
+void Deoptimizer::RecordDeoptimizationSite(BailoutId node_id) {
+  // Without tracing or logging only eager deopts are counted, for deopt loop
+  // detection.
+  bool describe = trace_scope_ != NULL || FLAG_log_deopt ||
+                  FLAG_print_deopt_sites;
+  if (!describe &&
+      (FLAG_deopt_loop_threshold <= 0 || bailout_type_ != EAGER)) {
+    return;
+  }
+
+  // The AST id belongs to the topmost frame, which may be an inlined function.
+  JSFunction* function = output_[output_count_ - 1]->GetFunction();
+  SharedFunctionInfo* shared = function->shared();
+  DeoptimizationStatistics* statistics =
+      isolate_->deoptimizer_data()->statistics();
+  DeoptimizationStatistics::Site* site =
+      statistics->Record(shared, node_id, bailout_type_);
+  if (describe) {
+    const char* reason = compiled_code_->GetDeoptLocationComment(bailout_id_);
+    statistics->Describe(site, shared, reason);
+    LOG(isolate_, DeoptSiteEvent(shared, node_id.ToInt(),
+                                 MessageFor(bailout_type_),
+                                 site->total_count(), reason));
+  }
+
+  // A site that keeps deoptimizing eagerly is stuck in a deopt loop; the next
+  // optimization uses a generic property access there instead of the
+  // specialized checks that keep failing.
+  if (trace_scope_ != NULL &&
+      FLAG_deopt_loop_threshold > 0 &&
+      bailout_type_ == EAGER &&
+      site->counts[EAGER] == FLAG_deopt_loop_threshold) {
+    PrintF(trace_scope_->file(), "[deopt loop detected in ");
+    function->PrintName(trace_scope_->file());
+    PrintF(trace_scope_->file(), " @ node %d]\n", node_id.ToInt());
+  }
+}
+
+
 void Deoptimizer::DoComputeJSFrame(TranslationIterator* iterator,
                                    int frame_index) {
   BailoutId node_id = BailoutId(iterator->Next());
@@ -878,6 +1084,18 @@ void Deoptimizer::DoComputeJSFrame(TranslationIterator* iterator,
            " => node=%d, height=%d\n", node_id.ToInt(), height_in_bytes);
   }
 
+  // Inside the try block of a try/catch statement the unoptimized code
+  // expects the catch handler between the stack locals and the expression
+  // stack. The optimized code only compiles try/catch statements in the
+  // outermost function when the expression stack is empty at the try.
+  bool has_catch_handler = frame_index == 0 && catch_handler_ != NULL;
+  unsigned local_count = 0;
+  if (has_catch_handler) {
+    local_count = function->shared()->scope_info()->StackSlotCount();
+    CHECK_LE(local_count, height);
+    height_in_bytes += StackHandlerConstants::kSize;
+  }
+
   // The 'fixed' part of the frame consists of the incoming parameters and
   // the part described by JavaScriptFrameConstants.
   unsigned fixed_frame_size = ComputeFixedSize(function);
@@ -1031,8 +1249,17 @@ void Deoptimizer::DoComputeJSFrame(TranslationIterator* iterator,
            top_address + output_offset, output_offset, value);
   }
 
-  // Translate the rest of the frame.
-  for (unsigned i = 0; i < height; ++i) {
+  // Translate the rest of the frame. The catch handler, if there is one, is
+  // pushed on top of the stack locals.
+  for (unsigned i = 0; i < local_count; ++i) {
+    output_offset -= kPointerSize;
+    DoTranslateCommand(iterator, frame_index, output_offset);
+  }
+  if (has_catch_handler) {
+    output_offset -= StackHandlerConstants::kSize;
+    DoComputeCatchHandler(output_frame, output_offset, fp_value);
+  }
+  for (unsigned i = local_count; i < height; ++i) {
     output_offset -= kPointerSize;
     DoTranslateCommand(iterator, frame_index, output_offset);
   }
@@ -1081,6 +1308,51 @@ void Deoptimizer::DoComputeJSFrame(TranslationIterator* iterator,
 }
 
 
+void Deoptimizer::DoComputeCatchHandler(FrameDescription* output_frame,
+                                        unsigned output_offset,
+                                        intptr_t fp_value) {
+  // The handler is the same as the one pushed by the optimized code, except
+  // that it refers to the unoptimized code and frame. The input frame has
+  // already been unwound from the stack, so the handler is read from its
+  // copy in the input frame description.
+  Code* non_optimized_code = output_frame->GetFunction()->shared()->code();
+  Register fp_reg = JavaScriptFrame::fp_register();
+  intptr_t input_sp = input_->GetRegister(fp_reg.code()) - fp_to_sp_delta_;
+  unsigned input_offset = static_cast<unsigned>(
+      reinterpret_cast<intptr_t>(catch_handler_) - input_sp);
+  ASSERT(input_offset + StackHandlerConstants::kSize <=
+         input_->GetFrameSize());
+  intptr_t next = input_->GetFrameSlot(
+      input_offset + StackHandlerConstants::kNextOffset);
+  intptr_t state = input_->GetFrameSlot(
+      input_offset + StackHandlerConstants::kStateOffset);
+  intptr_t context = input_->GetFrameSlot(
+      input_offset + StackHandlerConstants::kContextOffset);
+  output_frame->SetFrameSlot(
+      output_offset + StackHandlerConstants::kNextOffset, next);
+  output_frame->SetFrameSlot(
+      output_offset + StackHandlerConstants::kCodeOffset,
+      reinterpret_cast<intptr_t>(non_optimized_code));
+  output_frame->SetFrameSlot(
+      output_offset + StackHandlerConstants::kStateOffset, state);
+  output_frame->SetFrameSlot(
+      output_offset + StackHandlerConstants::kContextOffset, context);
+  output_frame->SetFrameSlot(
+      output_offset + StackHandlerConstants::kFPOffset, fp_value);
+
+  // The output frames replace the input frame before anything walks the
+  // stack again, so the handler chain can be relinked now.
+  intptr_t handler = output_frame->GetTop() + output_offset;
+  *isolate_->handler_address() = reinterpret_cast<Address>(handler);
+  if (trace_scope_ != NULL) {
+    PrintF(trace_scope_->file(),
+           "    0x%08" V8PRIxPTR ": [top + %d] <- 0x%08" V8PRIxPTR
+           " ; catch handler, next\n",
+           handler, output_offset, next);
+  }
+}
+
+
 void Deoptimizer::DoComputeArgumentsAdaptorFrame(TranslationIterator* iterator,
                                                  int frame_index) {
   JSFunction* function = JSFunction::cast(ComputeLiteral(iterator->Next()));
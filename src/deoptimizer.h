@@ -8,6 +8,7 @@
 #include "src/v8.h"
 
 #include "src/allocation.h"
+#include "src/hashmap.h"
 #include "src/macro-assembler.h"
 #include "src/zone-inl.h"
 
@@ -291,8 +292,15 @@ class Deoptimizer : public Malloced {
   void PrintFunctionName();
   void DeleteFrameDescriptions();
 
+  // Updates the per-site statistics for the deoptimization of the topmost
+  // output frame's function at the given AST id.
+  void RecordDeoptimizationSite(BailoutId node_id);
+
   void DoComputeOutputFrames();
   void DoComputeJSFrame(TranslationIterator* iterator, int frame_index);
+  void DoComputeCatchHandler(FrameDescription* output_frame,
+                             unsigned output_offset,
+                             intptr_t fp_value);
   void DoComputeArgumentsAdaptorFrame(TranslationIterator* iterator,
                                       int frame_index);
   void DoComputeConstructStubFrame(TranslationIterator* iterator,
@@ -405,6 +413,10 @@ class Deoptimizer : public Malloced {
   // Array of output frame descriptions.
   FrameDescription** output_;
 
+  // Catch handler pushed by the optimized frame for the try block of a
+  // try/catch statement, or NULL.
+  Address catch_handler_;
+
   // Deferred values to be materialized.
   List<Object*> deferred_objects_tagged_values_;
   List<HeapNumberMaterializationDescriptor<int> >
@@ -616,6 +628,71 @@ class FrameDescription {
 };
 
 
+// Per-isolate counts of deoptimizations by deoptimization site. A site is
+// identified by the script and start position of the function containing it
+// together with the AST id of the deoptimization point, so counts survive
+// both recompilation and moving GCs.
+class DeoptimizationStatistics {
+ public:
+  struct Site {
+    int script_id;
+    int start_position;
+    int ast_id;
+    int counts[Deoptimizer::kBailoutTypesWithCodeEntry];
+    Deoptimizer::BailoutType last_type;
+    // Number of receiver maps in the type feedback when the site was first
+    // compiled generically, or -1 if it has not been.
+    int feedback;
+    // Only collected under --trace-deopt, --log-deopt or --print-deopt-sites.
+    char* function_name;
+    // Code comment of the last deoptimization at this site, if available.
+    char* reason;
+
+    int total_count() const;
+  };
+
+  DeoptimizationStatistics();
+  ~DeoptimizationStatistics();
+
+  // Records a deoptimization of the given type at the given site and returns
+  // the updated site.
+  Site* Record(SharedFunctionInfo* shared,
+               BailoutId ast_id,
+               Deoptimizer::BailoutType type);
+
+  // Attaches the function name and the deoptimization reason to a site.
+  void Describe(Site* site, SharedFunctionInfo* shared, const char* reason);
+
+  // Returns true if the given site has deoptimized eagerly at least
+  // --deopt-loop-threshold times and should be compiled generically. The
+  // receiver map count of the first generic compilation is remembered; when
+  // the site's feedback changes later the site starts over.
+  bool IsDeoptLoop(SharedFunctionInfo* shared,
+                   BailoutId ast_id,
+                   int feedback);
+
+  // Returns the site for the given function and AST id, or NULL if there has
+  // been no deoptimization there.
+  Site* Lookup(SharedFunctionInfo* shared, BailoutId ast_id);
+
+  int site_count() const { return sites_.occupancy(); }
+
+  // Prints all sites, most frequently deoptimizing first.
+  void Print(FILE* out);
+
+ private:
+  static void InitializeKey(Site* site,
+                            SharedFunctionInfo* shared,
+                            BailoutId ast_id);
+  static uint32_t Hash(Site* site);
+  static bool SitesMatch(void* key1, void* key2);
+
+  HashMap sites_;
+
+  DISALLOW_COPY_AND_ASSIGN(DeoptimizationStatistics);
+};
+
+
 class DeoptimizerData {
  public:
   explicit DeoptimizerData(MemoryAllocator* allocator);
@@ -623,6 +700,8 @@ class DeoptimizerData {
 
   void Iterate(ObjectVisitor* v);
 
+  DeoptimizationStatistics* statistics() { return &statistics_; }
+
  private:
   MemoryAllocator* allocator_;
   int deopt_entry_code_entries_[Deoptimizer::kBailoutTypesWithCodeEntry];
@@ -632,6 +711,8 @@ class DeoptimizerData {
 
   Deoptimizer* current_;
 
+  DeoptimizationStatistics statistics_;
+
   friend class Deoptimizer;
 
   DISALLOW_COPY_AND_ASSIGN(DeoptimizerData);
@@ -843,6 +843,7 @@ Handle<Script> Factory::NewScript(Handle<String> source) {
   script->set_eval_from_shared(heap->undefined_value());
   script->set_eval_from_instructions_offset(Smi::FromInt(0));
   script->set_flags(Smi::FromInt(0));
+  script->set_preparse_data(heap->undefined_value());
 
   return script;
 }
@@ -2340,6 +2341,11 @@ void Factory::SetRegExpIrregexpData(Handle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpMaxRegisterCountIndex, Smi::FromInt(0));
   store->set(JSRegExp::kIrregexpCaptureCountIndex,
              Smi::FromInt(capture_count));
+  store->set(JSRegExp::kIrregexpASCIIBytecodeIndex, uninitialized);
+  store->set(JSRegExp::kIrregexpUC16BytecodeIndex, uninitialized);
+  int ticks = FLAG_regexp_tier_up ? Max(FLAG_regexp_tier_up_ticks, 0) : 0;
+  store->set(JSRegExp::kIrregexpTicksUntilTierUpIndex, Smi::FromInt(ticks));
+  store->set(JSRegExp::kIrregexpLinearProgramIndex, uninitialized);
   regexp->set_data(*store);
 }
 
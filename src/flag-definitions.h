@@ -318,6 +318,9 @@ DEFINE_int(escape_analysis_iterations, 2,
 
 DEFINE_bool(optimize_for_in, true,
             "optimize functions containing for-in loops")
+DEFINE_bool(optimize_try_catch, false,
+            "optimize functions containing try/catch statements, "
+            "deoptimizing when an exception is caught")
 DEFINE_bool(opt_safe_uint32_operations, true,
             "allow uint32 values on optimize frames if they are used only in "
             "safe operations")
@@ -429,6 +432,11 @@ DEFINE_bool(prepare_always_opt, false, "prepare for turning on always opt")
 DEFINE_bool(trace_deopt, false, "trace optimize function deoptimization")
 DEFINE_bool(trace_stub_failures, false,
             "trace deoptimization of generated code stubs")
+DEFINE_int(deopt_loop_threshold, 3,
+           "number of eager deopts at the same site after which the function "
+           "is reoptimized with generic property accesses (0 to disable)")
+DEFINE_bool(print_deopt_sites, false,
+            "print per-site deoptimization counts on exit")
 
 // compiler.cc
 DEFINE_int(min_preparse_length, 1024,
@@ -440,9 +448,20 @@ DEFINE_int(max_opt_count, 10,
 
 // compilation-cache.cc
 DEFINE_bool(compilation_cache, true, "enable compilation cache")
+DEFINE_bool(shared_script_cache, false,
+            "share the preparse data of scripts between isolates")
+DEFINE_int(shared_script_cache_size, 16,
+           "maximum size of the shared script cache (in MBytes)")
+DEFINE_bool(trace_shared_script_cache, false, "trace the shared script cache")
 
 DEFINE_bool(cache_prototype_transitions, true, "cache prototype transitions")
 
+// stub-cache.cc
+DEFINE_int(stub_cache_primary_table_bits, 11,
+           "log2 of the number of entries in the primary stub cache table")
+DEFINE_int(stub_cache_secondary_table_bits, 9,
+           "log2 of the number of entries in the secondary stub cache table")
+
 // cpu-profiler.cc
 DEFINE_int(cpu_profiler_sampling_interval, 1000,
            "CPU profiler sampling interval in microseconds")
@@ -517,6 +536,12 @@ DEFINE_bool(trace_code_flushing, false, "trace code flushing progress")
 DEFINE_bool(age_code, true,
             "track un-executed functions to age code and flush only "
             "old code (required for code flushing)")
+DEFINE_bool(adaptive_code_flushing, true,
+            "flush code of functions that were recompiled after flushing "
+            "only under memory pressure")
+DEFINE_int(code_flushing_pressure_percent, 75,
+           "flush code aggressively when the old generation exceeds this "
+           "percentage of its maximum size")
 DEFINE_bool(incremental_marking, true, "use incremental marking")
 DEFINE_bool(incremental_marking_steps, true, "do incremental marking steps")
 DEFINE_bool(trace_incremental_marking, false,
@@ -574,6 +599,10 @@ DEFINE_bool(use_verbose_printer, true, "allows verbose printing")
 // parser.cc
 DEFINE_bool(allow_natives_syntax, false, "allow natives syntax")
 DEFINE_bool(trace_parse, false, "trace parsing and preparsing")
+DEFINE_bool(preparse_side_table, false,
+            "remember the lazy functions of a script to skip them when it is "
+            "parsed again (costs 20 bytes per lazy top-level function for as "
+            "long as the script lives)")
 
 // simulator-arm.cc, simulator-arm64.cc and simulator-mips.cc
 DEFINE_bool(trace_sim, false, "Trace simulator execution")
@@ -612,12 +641,31 @@ DEFINE_int(hash_seed, 0,
            "Fixed seed to use to hash property keys (0 means random)"
            "(with snapshots this option cannot override the baked-in seed)")
 
+// zone.cc
+DEFINE_int(zone_segment_pool_size, 8,
+           "maximum size of the free zone segments kept for reuse (in MBytes)")
+
 // snapshot-common.cc
 DEFINE_bool(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 
 // Regexp
 DEFINE_bool(regexp_optimization, true, "generate optimized regexp code")
+DEFINE_bool(regexp_tier_up, false,
+            "run regexps on bytecode first and compile them to native code "
+            "only once they have been executed often enough")
+DEFINE_int(regexp_tier_up_ticks, 10,
+           "number of executions on bytecode before a regexp is compiled "
+           "to native code")
+DEFINE_bool(regexp_linear_engine, false,
+            "run regexps on the linear-time engine whenever they can be")
+DEFINE_int(regexp_backtracks_before_fallback, 0,
+           "number of backtracks of a regexp on bytecode before it switches "
+           "to the linear-time engine (0 means never); native regexp code "
+           "does not count backtracks and never switches")
+DEFINE_int(regexp_results_cache_size, 64,
+           "number of entries in each of the caches for the results of "
+           "global regexps and string splits (rounded up to a power of two)")
 
 // Testing flags test/cctest/test-{flags,api,serialization}.cc
 DEFINE_bool(testing_bool_flag, true, "testing_bool_flag")
@@ -781,6 +829,7 @@ DEFINE_bool(prof, false,
 DEFINE_bool(prof_browser_mode, true,
             "Used with --prof, turns on browser-compatible mode for profiling.")
 DEFINE_bool(log_regexp, false, "Log regular expression execution.")
+DEFINE_bool(log_deopt, false, "Log deoptimizations with their deopt site.")
 DEFINE_string(logfile, "v8.log", "Specify the name of the log file.")
 DEFINE_bool(logfile_per_isolate, true, "Separate log files for each isolate.")
 DEFINE_bool(ll_prof, false, "Enable low-level linux profiler.")
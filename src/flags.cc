@@ -550,4 +550,27 @@ void FlagList::EnforceFlagImplications() {
 #undef FLAG_MODE_DEFINE_IMPLICATIONS
 }
 
+
+// static
+uint32_t FlagList::Hash() {
+  uint32_t hash = 0;
+  for (size_t i = 0; i < num_flags; ++i) {
+    Flag* f = &flags[i];
+    if (f->IsDefault()) continue;
+    SmartArrayPointer<const char> value = ToString(f);
+    const char* parts[] = { f->name(), value.get() };
+    for (int j = 0; j < 2; j++) {
+      for (const char* p = parts[j]; *p != '\0'; p++) {
+        hash += static_cast<uint8_t>(*p);
+        hash += hash << 10;
+        hash ^= hash >> 6;
+      }
+      // Separate the name from the value.
+      hash += hash << 3;
+      hash ^= hash >> 11;
+    }
+  }
+  return hash;
+}
+
 } }  // namespace v8::internal
@@ -57,6 +57,10 @@ class FlagList {
 
   // Set flags as consequence of being implied by another flag.
   static void EnforceFlagImplications();
+
+  // Returns a hash of the flags with a value different from the default
+  // and their values, which identifies the flags code was compiled with.
+  static uint32_t Hash();
 };
 
 } }  // namespace v8::internal
@@ -660,7 +660,18 @@ void StandardFrame::IterateCompiledFrame(ObjectVisitor* v) const {
   uint8_t* safepoint_bits = safepoint_entry.bits();
   safepoint_bits += kNumSafepointRegisters >> kBitsPerByteLog2;
 
-  // Visit the rest of the parameters.
+  // Visit the rest of the parameters, skipping over the catch handler that
+  // optimized code pushes for a try/catch statement.
+  for (StackHandlerIterator it(this, top_handler()); !it.done(); it.Advance()) {
+    StackHandler* handler = it.handler();
+    Object** handler_base = reinterpret_cast<Object**>(handler->address());
+    ASSERT(parameters_base <= handler_base &&
+           handler_base < parameters_limit);
+    v->VisitPointers(parameters_base, handler_base);
+    parameters_base = reinterpret_cast<Object**>(
+        handler->address() + StackHandlerConstants::kSize);
+    handler->Iterate(v, code);
+  }
   v->VisitPointers(parameters_base, parameters_limit);
 
   // Visit pointer spill slots and locals.
@@ -307,8 +307,11 @@ bool FullCodeGenerator::MakeCode(CompilationInfo* info) {
   LOG_CODE_EVENT(isolate,
                  CodeStartLinePosInfoRecordEvent(masm.positions_recorder()));
 
+  unsigned zone_start = info->zone()->allocation_size();
   FullCodeGenerator cgen(&masm, info);
   cgen.Generate();
+  isolate->counters()->zone_bytes_full_codegen()->Increment(
+      static_cast<int>(info->zone()->allocation_size() - zone_start));
   if (cgen.HasStackOverflow()) {
     ASSERT(!isolate->has_pending_exception());
     return false;
@@ -1370,6 +1373,8 @@ void FullCodeGenerator::VisitTryCatchStatement(TryCatchStatement* stmt) {
   __ jmp(&try_entry);
   __ bind(&handler_entry);
   handler_table()->set(stmt->index(), Smi::FromInt(handler_entry.pos()));
+  // Optimized code catches an exception by deoptimizing to this point.
+  PrepareForBailoutForId(stmt->HandlerId(), TOS_REG);
   // Exception handler code, the exception is in the result register.
   // Extend the context before executing the catch block.
   { Comment cmnt(masm_, "[ Extend catch context");
@@ -1396,11 +1401,13 @@ void FullCodeGenerator::VisitTryCatchStatement(TryCatchStatement* stmt) {
   // Try block code. Sets up the exception handler chain.
   __ bind(&try_entry);
   __ PushTryHandler(StackHandler::CATCH, stmt->index());
+  PrepareForBailoutForId(stmt->TryId(), NO_REGISTERS);
   { TryCatch try_body(this);
     Visit(stmt->try_block());
   }
   __ PopTryHandler();
   __ bind(&exit);
+  PrepareForBailoutForId(stmt->ExitId(), NO_REGISTERS);
 }
 
 
@@ -55,7 +55,7 @@ function StringStartsWith(searchString /* position */) {  // length == 1
     return false;
   }
 
-  return %StringIndexOf(s, ss, start) === start;
+  return %StringMatchesAt(s, ss, start);
 }
 
 
@@ -87,7 +87,7 @@ function StringEndsWith(searchString /* position */) {  // length == 1
     return false;
   }
 
-  return %StringLastIndexOf(s, ss, start) === start;
+  return %StringMatchesAt(s, ss, start);
 }
 
 
@@ -1454,6 +1454,10 @@ void V8HeapExplorer::ExtractScriptReferences(int entry, Script* script) {
   SetInternalReference(obj, entry,
                        "line_ends", script->line_ends(),
                        Script::kLineEndsOffset);
+  TagObject(script->preparse_data(), "(script preparse data)");
+  SetInternalReference(obj, entry,
+                       "preparse_data", script->preparse_data(),
+                       Script::kPreparseDataOffset);
 }
 
 
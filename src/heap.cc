@@ -1227,8 +1227,10 @@ void Heap::MarkCompactPrologue() {
   isolate_->keyed_lookup_cache()->Clear();
   isolate_->context_slot_cache()->Clear();
   isolate_->descriptor_lookup_cache()->Clear();
+  isolate_->internalization_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
+  RegExpResultsCache::Clear(regexp_replace_cache());
 
   isolate_->compilation_cache()->MarkCompactPrologue();
 
@@ -1455,6 +1457,9 @@ void Heap::Scavenge() {
   // Clear descriptor cache.
   isolate_->descriptor_lookup_cache()->Clear();
 
+  // Clear internalization cache.
+  isolate_->internalization_cache()->Clear();
+
   // Used for updating survived_since_last_expansion_ at function end.
   intptr_t survived_watermark = PromotedSpaceSizeOfObjects();
 
@@ -2906,11 +2911,13 @@ void Heap::CreateInitialObjects() {
   set_single_character_string_cache(*factory->NewFixedArray(
       String::kMaxOneByteCharCode + 1, TENURED));
 
-  // Allocate cache for string split and regexp-multiple.
+  // Allocate cache for string split, regexp-multiple and regexp-replace.
   set_string_split_cache(*factory->NewFixedArray(
       RegExpResultsCache::kRegExpResultsCacheSize, TENURED));
   set_regexp_multiple_cache(*factory->NewFixedArray(
       RegExpResultsCache::kRegExpResultsCacheSize, TENURED));
+  set_regexp_replace_cache(*factory->NewFixedArray(
+      RegExpResultsCache::kRegExpResultsCacheSize, TENURED));
 
   // Allocate cache for external strings pointing to native source code.
   set_natives_source_cache(*factory->NewFixedArray(
@@ -2959,6 +2966,9 @@ void Heap::CreateInitialObjects() {
   // Initialize descriptor cache.
   isolate_->descriptor_lookup_cache()->Clear();
 
+  // Initialize internalization cache.
+  isolate_->internalization_cache()->Clear();
+
   // Initialize compilation cache.
   isolate_->compilation_cache()->Clear();
 }
@@ -2969,6 +2979,9 @@ bool Heap::RootCanBeWrittenAfterInitialization(Heap::RootListIndex root_index) {
     kStoreBufferTopRootIndex,
     kStackLimitRootIndex,
     kNumberStringCacheRootIndex,
+    kStringSplitCacheRootIndex,
+    kRegExpMultipleCacheRootIndex,
+    kRegExpReplaceCacheRootIndex,
     kInstanceofCacheFunctionRootIndex,
     kInstanceofCacheMapRootIndex,
     kInstanceofCacheAnswerRootIndex,
@@ -2999,34 +3012,69 @@ bool Heap::RootCanBeTreatedAsConstant(RootListIndex root_index) {
 }
 
 
-Object* RegExpResultsCache::Lookup(Heap* heap,
-                                   String* key_string,
-                                   Object* key_pattern,
-                                   ResultsCacheType type) {
-  FixedArray* cache;
-  if (!key_string->IsInternalizedString()) return Smi::FromInt(0);
-  if (type == STRING_SPLIT_SUBSTRINGS) {
-    ASSERT(key_pattern->IsString());
-    if (!key_pattern->IsInternalizedString()) return Smi::FromInt(0);
-    cache = heap->string_split_cache();
-  } else {
-    ASSERT(type == REGEXP_MULTIPLE_INDICES);
-    ASSERT(key_pattern->IsFixedArray());
-    cache = heap->regexp_multiple_cache();
+FixedArray* RegExpResultsCache::GetCache(Heap* heap, ResultsCacheType type) {
+  switch (type) {
+    case REGEXP_MULTIPLE_INDICES:
+      return heap->regexp_multiple_cache();
+    case STRING_SPLIT_SUBSTRINGS:
+      return heap->string_split_cache();
+    case REGEXP_REPLACE_STRING:
+      return heap->regexp_replace_cache();
   }
+  UNREACHABLE();
+  return NULL;
+}
+
+
+int RegExpResultsCache::CacheLength() {
+  uint32_t entries = Max(FLAG_regexp_results_cache_size, 2);
+  return RoundUpToPowerOf2(entries) * kArrayEntriesPerCacheEntry;
+}
+
 
+uint32_t RegExpResultsCache::CacheIndex(FixedArray* cache,
+                                        String* key_string,
+                                        Object* key_pattern,
+                                        String* key_replacement) {
+  // Different patterns applied to the same subject get different entries.
+  String* pattern_source = key_pattern->IsString()
+      ? String::cast(key_pattern)
+      : String::cast(FixedArray::cast(key_pattern)->get(JSRegExp::kSourceIndex));
   uint32_t hash = key_string->Hash();
-  uint32_t index = ((hash & (kRegExpResultsCacheSize - 1)) &
-      ~(kArrayEntriesPerCacheEntry - 1));
-  if (cache->get(index + kStringOffset) == key_string &&
-      cache->get(index + kPatternOffset) == key_pattern) {
-    return cache->get(index + kArrayOffset);
-  }
-  index =
-      ((index + kArrayEntriesPerCacheEntry) & (kRegExpResultsCacheSize - 1));
-  if (cache->get(index + kStringOffset) == key_string &&
-      cache->get(index + kPatternOffset) == key_pattern) {
-    return cache->get(index + kArrayOffset);
+  hash ^= ComputeIntegerHash(pattern_source->Hash(), 0);
+  if (key_replacement != NULL) {
+    hash ^= ComputeIntegerHash(key_replacement->Hash(), 1);
+  }
+  return (hash & (cache->length() - 1)) & ~(kArrayEntriesPerCacheEntry - 1);
+}
+
+
+bool RegExpResultsCache::KeyMatches(Object* entry, Object* key) {
+  if (entry == key) return true;
+  if (!entry->IsString() || !key->IsString()) return false;
+  return String::cast(entry)->Equals(String::cast(key));
+}
+
+
+Object* RegExpResultsCache::Lookup(Heap* heap,
+                                   String* key_string,
+                                   Object* key_pattern,
+                                   ResultsCacheType type,
+                                   String* key_replacement) {
+  ASSERT(type == STRING_SPLIT_SUBSTRINGS ? key_pattern->IsString()
+                                         : key_pattern->IsFixedArray());
+  ASSERT((type == REGEXP_REPLACE_STRING) == (key_replacement != NULL));
+  if (!IsCacheableSubject(key_string)) return Smi::FromInt(0);
+  FixedArray* cache = GetCache(heap, type);
+  uint32_t index = CacheIndex(cache, key_string, key_pattern, key_replacement);
+  for (int i = 0; i < 2; i++) {
+    if (KeyMatches(cache->get(index + kStringOffset), key_string) &&
+        KeyMatches(cache->get(index + kPatternOffset), key_pattern) &&
+        (key_replacement == NULL ||
+         KeyMatches(cache->get(index + kReplacementOffset), key_replacement))) {
+      return cache->get(index + kArrayOffset);
+    }
+    index = (index + kArrayEntriesPerCacheEntry) & (cache->length() - 1);
   }
   return Smi::FromInt(0);
 }
@@ -3036,46 +3084,59 @@ void RegExpResultsCache::Enter(Isolate* isolate,
                                Handle<String> key_string,
                                Handle<Object> key_pattern,
                                Handle<FixedArray> value_array,
-                               ResultsCacheType type) {
+                               ResultsCacheType type,
+                               Handle<String> key_replacement) {
+  ASSERT(type == STRING_SPLIT_SUBSTRINGS ? key_pattern->IsString()
+                                         : key_pattern->IsFixedArray());
+  ASSERT((type == REGEXP_REPLACE_STRING) == !key_replacement.is_null());
+  if (!IsCacheableSubject(*key_string)) return;
   Factory* factory = isolate->factory();
-  Handle<FixedArray> cache;
-  if (!key_string->IsInternalizedString()) return;
-  if (type == STRING_SPLIT_SUBSTRINGS) {
-    ASSERT(key_pattern->IsString());
-    if (!key_pattern->IsInternalizedString()) return;
-    cache = factory->string_split_cache();
-  } else {
-    ASSERT(type == REGEXP_MULTIPLE_INDICES);
-    ASSERT(key_pattern->IsFixedArray());
-    cache = factory->regexp_multiple_cache();
+  Heap* heap = isolate->heap();
+  Handle<FixedArray> cache(GetCache(heap, type), isolate);
+  if (cache->length() != CacheLength()) {
+    // Like the number string cache, the caches in the snapshot are kept
+    // small and only grow to their configured size when used.
+    cache = factory->NewFixedArray(CacheLength(), TENURED);
+    Clear(*cache);
+    switch (type) {
+      case REGEXP_MULTIPLE_INDICES:
+        heap->set_regexp_multiple_cache(*cache);
+        break;
+      case STRING_SPLIT_SUBSTRINGS:
+        heap->set_string_split_cache(*cache);
+        break;
+      case REGEXP_REPLACE_STRING:
+        heap->set_regexp_replace_cache(*cache);
+        break;
+    }
   }
 
-  uint32_t hash = key_string->Hash();
-  uint32_t index = ((hash & (kRegExpResultsCacheSize - 1)) &
-      ~(kArrayEntriesPerCacheEntry - 1));
-  if (cache->get(index + kStringOffset) == Smi::FromInt(0)) {
-    cache->set(index + kStringOffset, *key_string);
-    cache->set(index + kPatternOffset, *key_pattern);
-    cache->set(index + kArrayOffset, *value_array);
-  } else {
+  Object* replacement = key_replacement.is_null()
+      ? static_cast<Object*>(Smi::FromInt(0))
+      : static_cast<Object*>(*key_replacement);
+  uint32_t index = CacheIndex(*cache, *key_string, *key_pattern,
+                              key_replacement.is_null() ? NULL
+                                                        : *key_replacement);
+  if (cache->get(index + kStringOffset) != Smi::FromInt(0)) {
     uint32_t index2 =
-        ((index + kArrayEntriesPerCacheEntry) & (kRegExpResultsCacheSize - 1));
+        ((index + kArrayEntriesPerCacheEntry) & (cache->length() - 1));
     if (cache->get(index2 + kStringOffset) == Smi::FromInt(0)) {
-      cache->set(index2 + kStringOffset, *key_string);
-      cache->set(index2 + kPatternOffset, *key_pattern);
-      cache->set(index2 + kArrayOffset, *value_array);
+      index = index2;
     } else {
-      cache->set(index2 + kStringOffset, Smi::FromInt(0));
-      cache->set(index2 + kPatternOffset, Smi::FromInt(0));
-      cache->set(index2 + kArrayOffset, Smi::FromInt(0));
-      cache->set(index + kStringOffset, *key_string);
-      cache->set(index + kPatternOffset, *key_pattern);
-      cache->set(index + kArrayOffset, *value_array);
+      for (int i = 0; i < kArrayEntriesPerCacheEntry; i++) {
+        cache->set(index2 + i, Smi::FromInt(0));
+      }
     }
   }
-  // If the array is a reasonably short list of substrings, convert it into a
-  // list of internalized strings.
-  if (type == STRING_SPLIT_SUBSTRINGS && value_array->length() < 100) {
+  cache->set(index + kStringOffset, *key_string);
+  cache->set(index + kPatternOffset, *key_pattern);
+  cache->set(index + kArrayOffset, *value_array);
+  cache->set(index + kReplacementOffset, replacement);
+  // If the array is a reasonably short list of substrings of an internalized
+  // string, convert it into a list of internalized strings.
+  if (type == STRING_SPLIT_SUBSTRINGS &&
+      key_string->IsInternalizedString() &&
+      value_array->length() < 100) {
     for (int i = 0; i < value_array->length(); i++) {
       Handle<String> str(String::cast(value_array->get(i)), isolate);
       Handle<String> internalized_str = factory->InternalizeString(str);
@@ -3088,7 +3149,7 @@ void RegExpResultsCache::Enter(Isolate* isolate,
 
 
 void RegExpResultsCache::Clear(FixedArray* cache) {
-  for (int i = 0; i < kRegExpResultsCacheSize; i++) {
+  for (int i = 0; i < cache->length(); i++) {
     cache->set(i, Smi::FromInt(0));
   }
 }
@@ -6279,6 +6340,11 @@ void DescriptorLookupCache::Clear() {
 }
 
 
+void InternalizationCache::Clear() {
+  for (int index = 0; index < kLength; index++) strings_[index] = NULL;
+}
+
+
 void ExternalStringTable::CleanUp() {
   int last = 0;
   for (int i = 0; i < new_space_strings_.length(); ++i) {
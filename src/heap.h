@@ -68,6 +68,7 @@ namespace internal {
   V(FixedArray, single_character_string_cache, SingleCharacterStringCache)     \
   V(FixedArray, string_split_cache, StringSplitCache)                          \
   V(FixedArray, regexp_multiple_cache, RegExpMultipleCache)                    \
+  V(FixedArray, regexp_replace_cache, RegExpReplaceCache)                      \
   V(Oddball, termination_exception, TerminationException)                      \
   V(Smi, hash_seed, HashSeed)                                                  \
   V(Map, symbol_map, SymbolMap)                                                \
@@ -2179,6 +2180,7 @@ class Heap {
   friend class NoWeakObjectVerificationScope;
 #endif
   friend class Page;
+  friend class RegExpResultsCache;
 
   DISALLOW_COPY_AND_ASSIGN(Heap);
 };
@@ -2510,6 +2512,57 @@ class DescriptorLookupCache {
 };
 
 
+// Cache for strings recently looked up in the string table. Internalizing
+// the same strings over and over, e.g. the property names of parsed JSON,
+// hits this small cache instead of probing the large string table.
+class InternalizationCache {
+ public:
+  // Returns the internalized string matching the key, or NULL.
+  String* Lookup(HashTableKey* key, uint32_t hash) {
+    int index = hash & (kLength - 1);
+    String* string = strings_[index];
+    if (string != NULL && hashes_[index] == hash && key->IsMatch(string)) {
+      return string;
+    }
+    return NULL;
+  }
+
+  // Returns the internalized string with the given one-byte characters and
+  // hash, or NULL.
+  String* Lookup(Vector<const uint8_t> chars, uint32_t hash) {
+    int index = hash & (kLength - 1);
+    String* string = strings_[index];
+    if (string != NULL && hashes_[index] == hash &&
+        string->IsOneByteEqualTo(chars)) {
+      return string;
+    }
+    return NULL;
+  }
+
+  // Update an element in the cache.
+  void Update(uint32_t hash, String* string) {
+    ASSERT(string->IsInternalizedString());
+    int index = hash & (kLength - 1);
+    hashes_[index] = hash;
+    strings_[index] = string;
+  }
+
+  // Clear the cache.
+  void Clear();
+
+ private:
+  InternalizationCache() { Clear(); }
+
+  static const int kLength = 256;
+
+  uint32_t hashes_[kLength];
+  String* strings_[kLength];
+
+  friend class Isolate;
+  DISALLOW_COPY_AND_ASSIGN(InternalizationCache);
+};
+
+
 // GCTracer collects and prints ONE line after each garbage collector
 // invocation IFF --trace_gc is used.
 
@@ -2648,29 +2701,58 @@ class GCTracer BASE_EMBEDDED {
 
 class RegExpResultsCache {
  public:
-  enum ResultsCacheType { REGEXP_MULTIPLE_INDICES, STRING_SPLIT_SUBSTRINGS };
+  // Results of String.prototype.replace with a global regexp and a string
+  // replacement are keyed by the replacement too. Their value holds the
+  // result string followed by the capture registers of the last match, if
+  // there was one.
+  enum ResultsCacheType {
+    REGEXP_MULTIPLE_INDICES,
+    STRING_SPLIT_SUBSTRINGS,
+    REGEXP_REPLACE_STRING
+  };
 
   // Attempt to retrieve a cached result.  On failure, 0 is returned as a Smi.
   // On success, the returned result is guaranteed to be a COW-array.
+  // Internalized strings are matched by identity, other strings by content.
+  // Non-internalized subjects shorter than kMinUninternalizedSubjectLength
+  // are not cached, since hashing them would cost more than the work saved.
   static Object* Lookup(Heap* heap,
                         String* key_string,
                         Object* key_pattern,
-                        ResultsCacheType type);
+                        ResultsCacheType type,
+                        String* key_replacement = NULL);
   // Attempt to add value_array to the cache specified by type.  On success,
   // value_array is turned into a COW-array.
   static void Enter(Isolate* isolate,
                     Handle<String> key_string,
                     Handle<Object> key_pattern,
                     Handle<FixedArray> value_array,
-                    ResultsCacheType type);
+                    ResultsCacheType type,
+                    Handle<String> key_replacement = Handle<String>::null());
   static void Clear(FixedArray* cache);
+  // Length of the caches in the snapshot. They are resized to
+  // --regexp-results-cache-size entries when first entered.
   static const int kRegExpResultsCacheSize = 0x100;
+  static const int kMinUninternalizedSubjectLength = 1024;
 
  private:
+  static bool IsCacheableSubject(String* key_string) {
+    return key_string->IsInternalizedString() ||
+        key_string->length() >= kMinUninternalizedSubjectLength;
+  }
+  static FixedArray* GetCache(Heap* heap, ResultsCacheType type);
+  static int CacheLength();
+  static uint32_t CacheIndex(FixedArray* cache,
+                             String* key_string,
+                             Object* key_pattern,
+                             String* key_replacement);
+  static bool KeyMatches(Object* entry, Object* key);
+
   static const int kArrayEntriesPerCacheEntry = 4;
   static const int kStringOffset = 0;
   static const int kPatternOffset = 1;
   static const int kArrayOffset = 2;
+  static const int kReplacementOffset = 3;
 };
 
 
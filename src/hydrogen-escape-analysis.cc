@@ -11,6 +11,14 @@ namespace internal {
 bool HEscapeAnalysisPhase::HasNoEscapingUses(HValue* value, int size) {
   for (HUseIterator it(value->uses()); !it.Done(); it.Advance()) {
     HValue* use = it.value();
+    if (use->IsPhi()) {
+      // Phis merging captured values are captured along with them.
+      if (!IsGroupMember(use)) {
+        group_->Add(use, zone());
+        group_members_->Add(use->id());
+      }
+      continue;
+    }
     if (use->HasEscapingOperandAt(it.index())) {
       if (FLAG_trace_escape_analysis) {
         PrintF("#%d (%s) escapes through #%d (%s) @%d\n", value->id(),
@@ -38,8 +46,170 @@ bool HEscapeAnalysisPhase::HasNoEscapingUses(HValue* value, int size) {
 }
 
 
+// Collects the group of values that is captured together with the given
+// allocation, i.e. the allocation, the phis it flows into, and the other
+// allocations flowing into those phis. Returns false if any of them escapes.
+bool HEscapeAnalysisPhase::CollectGroup(HAllocate* allocate) {
+  int size_in_bytes = allocate->size()->GetInteger32Constant();
+  group_ = new(zone()) ZoneList<HValue*>(1, zone());
+  group_members_ =
+      new(zone()) BitVector(graph()->GetMaximumValueID(), zone());
+  group_->Add(allocate, zone());
+  group_members_->Add(allocate->id());
+
+  // The group grows while its members are visited.
+  for (int i = 0; i < group_->length(); i++) {
+    HValue* member = group_->at(i);
+    if (member->IsPhi()) {
+      for (int j = 0; j < member->OperandCount(); j++) {
+        HValue* input = member->OperandAt(j)->ActualValue();
+        if (IsGroupMember(input)) continue;
+        if (!input->IsPhi() &&
+            (!input->IsAllocate() ||
+             !HAllocate::cast(input)->size()->IsInteger32Constant() ||
+             HAllocate::cast(input)->size()->GetInteger32Constant() !=
+                 size_in_bytes)) {
+          if (FLAG_trace_escape_analysis) {
+            PrintF("#%d (%s) merges #%d (%s) @%d\n", member->id(),
+                   member->Mnemonic(), input->id(), input->Mnemonic(), j);
+          }
+          return false;
+        }
+        group_->Add(input, zone());
+        group_members_->Add(input->id());
+      }
+    }
+    if (!HasNoEscapingUses(member, size_in_bytes)) return false;
+  }
+  return group_->length() == 1 || HasDisjointLiveRanges();
+}
+
+
+// Computes the group member that is live at entry to the given block from the
+// members live at the end of its visited predecessors. Fails if more than one
+// phi of the group is in the block.
+bool HEscapeAnalysisPhase::ComputeMemberAtEntry(HBasicBlock* block,
+                                                BitVector* visited,
+                                                HValue** member) {
+  HPhi* group_phi = NULL;
+  for (int i = 0; i < block->phis()->length(); i++) {
+    HPhi* phi = block->phis()->at(i);
+    if (!IsGroupMember(phi)) continue;
+    if (group_phi != NULL) return false;
+    group_phi = phi;
+  }
+
+  // Back edges that have not been visited yet do not constrain the result.
+  bool phi_matches = group_phi != NULL;
+  bool all_equal = true;
+  bool first = true;
+  HValue* incoming = NULL;
+  for (int i = 0; i < block->predecessors()->length(); i++) {
+    HBasicBlock* predecessor = block->predecessors()->at(i);
+    if (!visited->Contains(predecessor->block_id())) continue;
+    HValue* predecessor_member = block_members_.at(predecessor->block_id());
+    if (first) {
+      incoming = predecessor_member;
+      first = false;
+    } else if (incoming != predecessor_member) {
+      all_equal = false;
+    }
+    if (phi_matches &&
+        group_phi->OperandAt(i)->ActualValue() != predecessor_member) {
+      phi_matches = false;
+    }
+  }
+
+  if (phi_matches) {
+    *member = group_phi;
+  } else if (all_equal) {
+    *member = incoming;
+  } else {
+    *member = NULL;
+  }
+  return true;
+}
+
+
+// The group is replaced by a single state flowing through the graph, which
+// is only correct if at every use of a member that member is the one defined
+// last on all paths reaching the use. This computes the member live at the
+// end of each block by a fixed point iteration and checks all uses.
+bool HEscapeAnalysisPhase::HasDisjointLiveRanges() {
+  int block_count = graph()->blocks()->length();
+  int start = block_count;
+  for (int i = 0; i < group_->length(); i++) {
+    start = Min(start, group_->at(i)->block()->block_id());
+  }
+  block_members_.Rewind(0);
+  block_members_.AddBlock(NULL, block_count, zone());
+  BitVector visited(block_count, zone());
+  for (int i = 0; i < start; i++) visited.Add(i);
+
+  static const int kMaxIterations = 8;
+  bool changed = true;
+  for (int iteration = 0; changed; iteration++) {
+    if (iteration == kMaxIterations) return false;
+    changed = false;
+    for (int i = start; i < block_count; i++) {
+      HBasicBlock* block = graph()->blocks()->at(i);
+      HValue* member;
+      if (!ComputeMemberAtEntry(block, &visited, &member)) return false;
+      for (HInstructionIterator it(block); !it.Done(); it.Advance()) {
+        if (IsGroupMember(it.Current())) member = it.Current();
+      }
+      if (!visited.Contains(i) || block_members_.at(i) != member) {
+        visited.Add(i);
+        block_members_.Set(i, member);
+        changed = true;
+      }
+    }
+  }
+
+  for (int i = start; i < block_count; i++) {
+    HBasicBlock* block = graph()->blocks()->at(i);
+    HValue* member;
+    ComputeMemberAtEntry(block, &visited, &member);
+
+    // Phis bound in the environment are used at block entry. The captured
+    // state is bound in their place after the last simulate of the first
+    // predecessor, see BindPhiState.
+    for (int j = 0; j < block->phis()->length(); j++) {
+      HPhi* phi = block->phis()->at(j);
+      if (!IsGroupMember(phi) || !phi->HasMergedIndex()) continue;
+      if (member != phi || LastSimulate(block->predecessors()->at(0)) == NULL) {
+        if (FLAG_trace_escape_analysis) {
+          PrintF("#%d (%s) is not live at entry of B%d\n", phi->id(),
+                 phi->Mnemonic(), block->block_id());
+        }
+        return false;
+      }
+    }
+
+    for (HInstructionIterator it(block); !it.Done(); it.Advance()) {
+      HInstruction* instr = it.Current();
+      for (int j = 0; j < instr->OperandCount(); j++) {
+        HValue* operand = instr->OperandAt(j)->ActualValue();
+        if (!IsGroupMember(operand) || operand == member) continue;
+        if (FLAG_trace_escape_analysis) {
+          PrintF("#%d (%s) overlaps with #%d (%s) at #%d (%s)\n",
+                 operand->id(), operand->Mnemonic(),
+                 member == NULL ? -1 : member->id(),
+                 member == NULL ? "none" : member->Mnemonic(),
+                 instr->id(), instr->Mnemonic());
+        }
+        return false;
+      }
+      if (IsGroupMember(instr)) member = instr;
+    }
+  }
+  return true;
+}
+
+
 void HEscapeAnalysisPhase::CollectCapturedValues() {
   int block_count = graph()->blocks()->length();
+  BitVector visited(graph()->GetMaximumValueID(), zone());
   for (int i = 0; i < block_count; ++i) {
     HBasicBlock* block = graph()->blocks()->at(i);
     for (HInstructionIterator it(block); !it.Done(); it.Advance()) {
@@ -47,13 +217,22 @@ void HEscapeAnalysisPhase::CollectCapturedValues() {
       if (!instr->IsAllocate()) continue;
       HAllocate* allocate = HAllocate::cast(instr);
       if (!allocate->size()->IsInteger32Constant()) continue;
-      int size_in_bytes = allocate->size()->GetInteger32Constant();
-      if (HasNoEscapingUses(instr, size_in_bytes)) {
+      if (visited.Contains(instr->id())) continue;
+      bool captured = CollectGroup(allocate);
+      for (int j = 0; j < group_->length(); j++) {
+        visited.Add(group_->at(j)->id());
+      }
+      if (captured) {
         if (FLAG_trace_escape_analysis) {
-          PrintF("#%d (%s) is being captured\n", instr->id(),
+          PrintF("#%d (%s) is being captured", instr->id(),
                  instr->Mnemonic());
+          for (int j = 1; j < group_->length(); j++) {
+            PrintF("%s #%d (%s)", j == 1 ? " with" : ",",
+                   group_->at(j)->id(), group_->at(j)->Mnemonic());
+          }
+          PrintF("\n");
         }
-        captured_.Add(instr, zone());
+        captured_.Add(group_, zone());
       }
     }
   }
@@ -155,40 +334,77 @@ HValue* HEscapeAnalysisPhase::NewLoadReplacement(
 }
 
 
+// Returns the simulate ending the given block, if it has an AST id.
+HSimulate* HEscapeAnalysisPhase::LastSimulate(HBasicBlock* block) {
+  HInstruction* last = block->end()->previous();
+  if (last == NULL || !last->IsSimulate()) return NULL;
+  HSimulate* simulate = HSimulate::cast(last);
+  return simulate->HasAstId() ? simulate : NULL;
+}
+
+
+// Environments refer to phis by their merged index. Once a phi of the group is
+// removed, the captured state has to be bound to that index at block entry.
+void HEscapeAnalysisPhase::BindPhiState(HPhi* phi, HCapturedObject* state) {
+  HBasicBlock* block = phi->block();
+  HSimulate* last = LastSimulate(block->predecessors()->at(0));
+  HSimulate* simulate = new(graph()->zone()) HSimulate(
+      last->ast_id(), 0, graph()->zone(), FIXED_SIMULATE);
+  simulate->AddAssignedValue(phi->merged_index(), state);
+  simulate->InsertAfter(state);
+  block->RecordDeletedPhi(phi->merged_index());
+}
+
+
 // Performs a forward data-flow analysis of all loads and stores on the
-// given captured allocation. This uses a reverse post-order iteration
+// captured group. This uses a reverse post-order iteration
 // over affected basic blocks. All non-escaping instructions are handled
 // and replaced during the analysis.
-void HEscapeAnalysisPhase::AnalyzeDataFlow(HInstruction* allocate) {
-  HBasicBlock* allocate_block = allocate->block();
-  block_states_.AddBlock(NULL, graph()->blocks()->length(), zone());
-
-  // Iterate all blocks starting with the allocation block, since the
-  // allocation cannot dominate blocks that come before.
-  int start = allocate_block->block_id();
-  for (int i = start; i < graph()->blocks()->length(); i++) {
+void HEscapeAnalysisPhase::AnalyzeDataFlow() {
+  int block_count = graph()->blocks()->length();
+  block_states_.AddBlock(NULL, block_count, zone());
+
+  // Iterate all blocks starting with the first allocation block, since the
+  // allocations cannot dominate blocks that come before.
+  int start = block_count;
+  BitVector allocation_blocks(block_count, zone());
+  for (int i = 0; i < group_->length(); i++) {
+    HValue* member = group_->at(i);
+    if (!member->IsAllocate()) continue;
+    start = Min(start, member->block()->block_id());
+    allocation_blocks.Add(member->block()->block_id());
+  }
+  for (int i = start; i < block_count; i++) {
     HBasicBlock* block = graph()->blocks()->at(i);
     HCapturedObject* state = StateAt(block);
 
-    // Skip blocks that are not dominated by the captured allocation.
-    if (!allocate_block->Dominates(block) && allocate_block != block) continue;
+    // Skip blocks that are not reached by any member of the group.
+    if (state == NULL && !allocation_blocks.Contains(i)) continue;
     if (FLAG_trace_escape_analysis) {
       PrintF("Analyzing data-flow in B%d\n", block->block_id());
     }
 
+    // Phis of the group are replaced by the merged state.
+    for (int j = 0; j < block->phis()->length(); j++) {
+      HPhi* phi = block->phis()->at(j);
+      if (IsGroupMember(phi) && phi->HasMergedIndex()) {
+        BindPhiState(phi, state);
+      }
+    }
+
     // Go through all instructions of the current block.
     for (HInstructionIterator it(block); !it.Done(); it.Advance()) {
       HInstruction* instr = it.Current();
       switch (instr->opcode()) {
         case HValue::kAllocate: {
-          if (instr != allocate) continue;
-          state = NewStateForAllocation(allocate);
+          if (!IsGroupMember(instr)) continue;
+          state = NewStateForAllocation(instr);
           break;
         }
         case HValue::kLoadNamedField: {
           HLoadNamedField* load = HLoadNamedField::cast(instr);
           int index = load->access().offset() / kPointerSize;
-          if (load->object() != allocate) continue;
+          if (!IsGroupMember(load->object())) continue;
           ASSERT(load->access().IsInobject());
           HValue* replacement =
             NewLoadReplacement(load, state->OperandAt(index));
@@ -202,7 +418,7 @@ void HEscapeAnalysisPhase::AnalyzeDataFlow(HInstruction* allocate) {
         case HValue::kStoreNamedField: {
           HStoreNamedField* store = HStoreNamedField::cast(instr);
           int index = store->access().offset() / kPointerSize;
-          if (store->object() != allocate) continue;
+          if (!IsGroupMember(store->object())) continue;
           ASSERT(store->access().IsInobject());
           state = NewStateCopy(store->previous(), state);
           state->SetOperandAt(index, store->value());
@@ -223,20 +439,20 @@ void HEscapeAnalysisPhase::AnalyzeDataFlow(HInstruction* allocate) {
         case HValue::kCapturedObject:
         case HValue::kSimulate: {
           for (int i = 0; i < instr->OperandCount(); i++) {
-            if (instr->OperandAt(i) != allocate) continue;
+            if (!IsGroupMember(instr->OperandAt(i))) continue;
             instr->SetOperandAt(i, state);
           }
           break;
         }
         case HValue::kCheckHeapObject: {
           HCheckHeapObject* check = HCheckHeapObject::cast(instr);
-          if (check->value() != allocate) continue;
+          if (!IsGroupMember(check->value())) continue;
           check->DeleteAndReplaceWith(check->ActualValue());
           break;
         }
         case HValue::kCheckMaps: {
           HCheckMaps* mapcheck = HCheckMaps::cast(instr);
-          if (mapcheck->value() != allocate) continue;
+          if (!IsGroupMember(mapcheck->value())) continue;
           NewMapCheckAndInsert(state, mapcheck);
           mapcheck->DeleteAndReplaceWith(mapcheck->ActualValue());
           break;
@@ -247,10 +463,15 @@ void HEscapeAnalysisPhase::AnalyzeDataFlow(HInstruction* allocate) {
       }
     }
 
-    // Propagate the block state forward to all successor blocks.
+    // Propagate the block state forward to all successor blocks. Blocks that
+    // have already been visited without state do not need one.
+    if (state == NULL) continue;
     for (int i = 0; i < block->end()->SuccessorCount(); i++) {
       HBasicBlock* succ = block->end()->SuccessorAt(i);
-      if (!allocate_block->Dominates(succ)) continue;
+      if (succ->block_id() < start) continue;
+      if (succ->block_id() <= block->block_id() && StateAt(succ) == NULL) {
+        continue;
+      }
       if (succ->predecessors()->length() == 1) {
         // Case 1: This is the only predecessor, just reuse state.
         SetStateAt(succ, state);
@@ -285,27 +506,52 @@ void HEscapeAnalysisPhase::AnalyzeDataFlow(HInstruction* allocate) {
     }
   }
 
+  RemoveGroup();
+}
+
+
+void HEscapeAnalysisPhase::RemoveGroup() {
+  // Disconnect the phis of the group first, other phis of the group are
+  // their only remaining uses.
+  HConstant* undefined = graph()->GetConstantUndefined();
+  for (int i = 0; i < group_->length(); i++) {
+    HValue* member = group_->at(i);
+    if (!member->IsPhi()) continue;
+    for (int j = 0; j < member->OperandCount(); j++) {
+      member->SetOperandAt(j, undefined);
+    }
+  }
+
   // All uses have been handled.
-  ASSERT(allocate->HasNoUses());
-  allocate->DeleteAndReplaceWith(NULL);
+  for (int i = 0; i < group_->length(); i++) {
+    HValue* member = group_->at(i);
+    ASSERT(member->HasNoUses());
+    member->DeleteAndReplaceWith(NULL);
+  }
 }
 
 
 void HEscapeAnalysisPhase::PerformScalarReplacement() {
   for (int i = 0; i < captured_.length(); i++) {
-    HAllocate* allocate = HAllocate::cast(captured_.at(i));
+    group_ = captured_.at(i);
+    HAllocate* allocate = HAllocate::cast(group_->at(0));
 
-    // Compute number of scalar values and start with clean slate.
+    // Compute number of scalar values and start with clean slate. The value
+    // IDs of the group have to be recomputed, the graph changed since.
     int size_in_bytes = allocate->size()->GetInteger32Constant();
     number_of_values_ = size_in_bytes / kPointerSize;
     number_of_objects_++;
     block_states_.Rewind(0);
+    group_members_ =
+        new(zone()) BitVector(graph()->GetMaximumValueID(), zone());
+    for (int j = 0; j < group_->length(); j++) {
+      group_members_->Add(group_->at(j)->id());
+    }
 
     // Perform actual analysis step.
-    AnalyzeDataFlow(allocate);
+    AnalyzeDataFlow();
 
     cumulative_values_ += number_of_values_;
-    ASSERT(allocate->HasNoUses());
     ASSERT(!allocate->IsLinked());
   }
 }
@@ -17,18 +17,30 @@ class HEscapeAnalysisPhase : public HPhase {
   explicit HEscapeAnalysisPhase(HGraph* graph)
       : HPhase("H_Escape analysis", graph),
         captured_(0, zone()),
+        group_(NULL),
+        group_members_(NULL),
         number_of_objects_(0),
         number_of_values_(0),
         cumulative_values_(0),
-        block_states_(graph->blocks()->length(), zone()) { }
+        block_states_(graph->blocks()->length(), zone()),
+        block_members_(graph->blocks()->length(), zone()) { }
 
   void Run();
 
  private:
   void CollectCapturedValues();
+  bool CollectGroup(HAllocate* allocate);
   bool HasNoEscapingUses(HValue* value, int size);
+  bool HasDisjointLiveRanges();
+  bool ComputeMemberAtEntry(HBasicBlock* block,
+                            BitVector* visited,
+                            HValue** member);
   void PerformScalarReplacement();
-  void AnalyzeDataFlow(HInstruction* instr);
+  void AnalyzeDataFlow();
+  void RemoveGroup();
+
+  HSimulate* LastSimulate(HBasicBlock* block);
+  void BindPhiState(HPhi* phi, HCapturedObject* state);
 
   HCapturedObject* NewState(HInstruction* prev);
   HCapturedObject* NewStateForAllocation(HInstruction* prev);
@@ -41,6 +53,11 @@ class HEscapeAnalysisPhase : public HPhase {
 
   HValue* NewLoadReplacement(HLoadNamedField* load, HValue* load_value);
 
+  bool IsGroupMember(HValue* value) {
+    return value->id() < group_members_->length() &&
+        group_members_->Contains(value->id());
+  }
+
   HCapturedObject* StateAt(HBasicBlock* block) {
     return block_states_.at(block->block_id());
   }
@@ -49,8 +66,14 @@ class HEscapeAnalysisPhase : public HPhase {
     block_states_.Set(block->block_id(), state);
   }
 
-  // List of allocations captured during collection phase.
-  ZoneList<HInstruction*> captured_;
+  // List of groups captured during collection phase. A group consists of
+  // allocations of the same size and the phis merging them, and is replaced
+  // as a single object. No two members of a group are live at the same time.
+  ZoneList<ZoneList<HValue*>*> captured_;
+
+  // The group currently being collected or replaced, and its value IDs.
+  ZoneList<HValue*>* group_;
+  BitVector* group_members_;
 
   // Number of captured objects on which scalar replacement was done.
   int number_of_objects_;
@@ -62,6 +85,10 @@ class HEscapeAnalysisPhase : public HPhase {
   // Map of block IDs to the data-flow state at block entry during the
   // scalar replacement phase.
   ZoneList<HCapturedObject*> block_states_;
+
+  // Map of block IDs to the group member live at block entry, used to check
+  // that the live ranges of group members are disjoint.
+  ZoneList<HValue*> block_members_;
 };
 
 
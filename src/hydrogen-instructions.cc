@@ -819,6 +819,7 @@ bool HInstruction::CanDeoptimize() {
     case HValue::kDoubleBits:
     case HValue::kDummyUse:
     case HValue::kEnterInlined:
+    case HValue::kEnterTry:
     case HValue::kEnvironmentMarker:
     case HValue::kForceRepresentation:
     case HValue::kGetCachedArrayIndex:
@@ -834,6 +835,7 @@ bool HInstruction::CanDeoptimize() {
     case HValue::kIsStringAndBranch:
     case HValue::kIsUndetectableAndBranch:
     case HValue::kLeaveInlined:
+    case HValue::kLeaveTry:
     case HValue::kLoadFieldByIndex:
     case HValue::kLoadGlobalGeneric:
     case HValue::kLoadNamedField:
@@ -924,6 +926,11 @@ void HDummyUse::PrintDataTo(StringStream* stream) {
 }
 
 
+void HEnterTry::PrintDataTo(StringStream* stream) {
+  stream->Add("handler %d", handler_index());
+}
+
+
 void HEnvironmentMarker::PrintDataTo(StringStream* stream) {
   stream->Add("%s var[%d]", kind() == BIND ? "bind" : "lookup", index());
 }
@@ -91,6 +91,7 @@ class LChunkBuilder;
   V(DoubleBits)                                \
   V(DummyUse)                                  \
   V(EnterInlined)                              \
+  V(EnterTry)                                  \
   V(EnvironmentMarker)                         \
   V(ForceRepresentation)                       \
   V(ForInCacheArray)                           \
@@ -110,6 +111,7 @@ class LChunkBuilder;
   V(IsSmiAndBranch)                            \
   V(IsUndetectableAndBranch)                   \
   V(LeaveInlined)                              \
+  V(LeaveTry)                                  \
   V(LoadContextSlot)                           \
   V(LoadFieldByIndex)                          \
   V(LoadFunctionPrototype)                     \
@@ -2065,6 +2067,60 @@ class HLeaveInlined V8_FINAL : public HTemplateInstruction<0> {
 };
 
 
+// Pushes the catch handler of a try/catch statement. The handler entry in the
+// optimized code deoptimizes to the catch block of the unoptimized code.
+class HEnterTry V8_FINAL : public HUnaryOperation {
+ public:
+  DECLARE_INSTRUCTION_WITH_CONTEXT_FACTORY_P2(HEnterTry, int, BailoutId);
+
+  HValue* context() { return OperandAt(0); }
+  int handler_index() const { return handler_index_; }
+  BailoutId handler_id() const { return handler_id_; }
+
+  virtual Representation RequiredInputRepresentation(int index) V8_OVERRIDE {
+    return Representation::Tagged();
+  }
+
+  // The handler occupies the stack like pushed arguments do.
+  virtual int argument_delta() const V8_OVERRIDE {
+    return StackHandlerConstants::kSize / kPointerSize;
+  }
+
+  virtual void PrintDataTo(StringStream* stream) V8_OVERRIDE;
+
+  DECLARE_CONCRETE_INSTRUCTION(EnterTry)
+
+ private:
+  HEnterTry(HValue* context, int handler_index, BailoutId handler_id)
+      : HUnaryOperation(context),
+        handler_index_(handler_index),
+        handler_id_(handler_id) { }
+
+  int handler_index_;
+  BailoutId handler_id_;
+};
+
+
+// Pops the catch handler pushed by HEnterTry.
+class HLeaveTry V8_FINAL : public HTemplateInstruction<0> {
+ public:
+  DECLARE_INSTRUCTION_FACTORY_P0(HLeaveTry);
+
+  virtual Representation RequiredInputRepresentation(int index) V8_OVERRIDE {
+    return Representation::None();
+  }
+
+  virtual int argument_delta() const V8_OVERRIDE {
+    return -StackHandlerConstants::kSize / kPointerSize;
+  }
+
+  DECLARE_CONCRETE_INSTRUCTION(LeaveTry)
+
+ private:
+  HLeaveTry() { }
+};
+
+
 class HPushArguments V8_FINAL : public HInstruction {
  public:
   static HPushArguments* New(Zone* zone, HValue* context) {
@@ -3258,7 +3258,9 @@ HOptimizedGraphBuilder::HOptimizedGraphBuilder(CompilationInfo* info)
       inlined_count_(0),
       globals_(10, info->zone()),
       inline_bailout_(false),
-      osr_(new(info->zone()) HOsrBuilder(this)) {
+      osr_(new(info->zone()) HOsrBuilder(this)),
+      try_catch_(NULL),
+      try_catch_break_scope_(NULL) {
   // This is not initialized in the initializer list because the
   // constructor for the initial state relies on function_state_ == NULL
   // to know it's the initial state.
@@ -3326,6 +3328,11 @@ HBasicBlock* HOptimizedGraphBuilder::BuildLoopEntry() {
 
 HBasicBlock* HOptimizedGraphBuilder::BuildLoopEntry(
     IterationStatement* statement) {
+  // The unoptimized frame has the catch handler pushed inside a try block,
+  // entering optimized code there is not supported.
+  if (try_catch_ != NULL && osr()->HasOsrEntryAt(statement)) {
+    Bailout(kTryCatchStatement);
+  }
   HBasicBlock* loop_entry = osr()->HasOsrEntryAt(statement)
       ? osr()->BuildOsrLoopEntry(statement)
       : BuildLoopEntry();
@@ -4607,6 +4614,19 @@ HBasicBlock* HOptimizedGraphBuilder::BreakAndContinueScope::Get(
 }
 
 
+bool HOptimizedGraphBuilder::LeavesTryCatch(BreakableStatement* target) {
+  if (try_catch_ == NULL) return false;
+  for (BreakAndContinueScope* current = break_scope();
+       current != NULL;
+       current = current->next()) {
+    if (current == try_catch_break_scope_) return true;
+    if (current->info()->target() == target) return false;
+  }
+  UNREACHABLE();
+  return false;
+}
+
+
 void HOptimizedGraphBuilder::VisitContinueStatement(
     ContinueStatement* stmt) {
   ASSERT(!HasStackOverflow());
@@ -4620,6 +4640,7 @@ void HOptimizedGraphBuilder::VisitContinueStatement(
       &outer_scope, &drop_extra);
   HValue* context = environment()->context();
   Drop(drop_extra);
+  if (LeavesTryCatch(stmt->target())) Add<HLeaveTry>();
   int context_pop_count = inner_scope->ContextChainLength(outer_scope);
   if (context_pop_count > 0) {
     while (context_pop_count-- > 0) {
@@ -4652,6 +4673,7 @@ void HOptimizedGraphBuilder::VisitBreakStatement(BreakStatement* stmt) {
       &outer_scope, &drop_extra);
   HValue* context = environment()->context();
   Drop(drop_extra);
+  if (LeavesTryCatch(stmt->target())) Add<HLeaveTry>();
   int context_pop_count = inner_scope->ContextChainLength(outer_scope);
   if (context_pop_count > 0) {
     while (context_pop_count-- > 0) {
@@ -4681,6 +4703,7 @@ void HOptimizedGraphBuilder::VisitReturnStatement(ReturnStatement* stmt) {
     // Not an inlined return, so an actual one.
     CHECK_ALIVE(VisitForValue(stmt->expression()));
     HValue* result = environment()->Pop();
+    if (try_catch_ != NULL) Add<HLeaveTry>();
     Add<HReturn>(result);
   } else if (state->inlining_kind() == CONSTRUCT_CALL_RETURN) {
     // Return from an inlined construct call. In a test context the return value
@@ -5132,7 +5155,31 @@ void HOptimizedGraphBuilder::VisitTryCatchStatement(TryCatchStatement* stmt) {
   ASSERT(!HasStackOverflow());
   ASSERT(current_block() != NULL);
   ASSERT(current_block()->HasPredecessor());
-  return Bailout(kTryCatchStatement);
+  // Only the try block is compiled. The catch handler pushed for it
+  // deoptimizes to the catch block of the unoptimized code, which expects
+  // the handler at the bottom of an otherwise empty expression stack and all
+  // variables that are still live in the context (see
+  // Scope::ResolveVariable).
+  if (!FLAG_optimize_try_catch ||
+      try_catch_ != NULL ||
+      !environment()->ExpressionStackIsEmpty()) {
+    return Bailout(kTryCatchStatement);
+  }
+  ASSERT(function_state()->outer() == NULL);
+
+  Add<HEnterTry>(stmt->index(), stmt->HandlerId());
+  Add<HSimulate>(stmt->TryId());
+  try_catch_ = stmt;
+  try_catch_break_scope_ = break_scope();
+  Visit(stmt->try_block());
+  try_catch_ = NULL;
+  try_catch_break_scope_ = NULL;
+  if (HasStackOverflow()) return;
+
+  if (current_block() != NULL) {
+    Add<HLeaveTry>();
+    Add<HSimulate>(stmt->ExitId());
+  }
 }
 
 
@@ -7014,7 +7061,11 @@ HValue* HOptimizedGraphBuilder::HandleKeyedElementAccess(
     }
   }
 
-  if (monomorphic) {
+  if (IsDeoptLoopSite(types)) {
+    // Sites stuck in a deopt loop use generic accesses, which never fail a
+    // map check.
+    instr = AddInstruction(BuildKeyedGeneric(access_type, obj, key, val));
+  } else if (monomorphic) {
     Handle<Map> map = types->first();
     if (map->has_slow_elements_kind() || !map->IsJSObjectMap()) {
       instr = AddInstruction(BuildKeyedGeneric(access_type, obj, key, val));
@@ -7124,6 +7175,23 @@ bool HOptimizedGraphBuilder::TryArgumentsAccess(Property* expr) {
 }
 
 
+bool HOptimizedGraphBuilder::IsDeoptLoopSite(SmallMapList* types) {
+  if (FLAG_deopt_loop_threshold <= 0) return false;
+  // An instruction deoptimizes to the AST id of the last simulate before it.
+  BailoutId ast_id = BailoutId::None();
+  for (HInstruction* instr = current_block()->last();
+       instr != NULL && ast_id.IsNone();
+       instr = instr->previous()) {
+    if (instr->IsSimulate()) ast_id = HSimulate::cast(instr)->ast_id();
+  }
+  if (ast_id.IsNone()) ast_id = environment()->ast_id();
+  if (ast_id.IsNone()) return false;
+  int feedback = types == NULL ? 0 : types->length();
+  return isolate()->deoptimizer_data()->statistics()->IsDeoptLoop(
+      *current_info()->shared_info(), ast_id, feedback);
+}
+
+
 HInstruction* HOptimizedGraphBuilder::BuildNamedAccess(
     PropertyAccessType access,
     BailoutId ast_id,
@@ -7137,6 +7205,12 @@ HInstruction* HOptimizedGraphBuilder::BuildNamedAccess(
   ComputeReceiverTypes(expr, object, &types, zone());
   ASSERT(types != NULL);
 
+  // Sites stuck in a deopt loop use generic accesses, which never fail a map
+  // check.
+  if (IsDeoptLoopSite(types)) {
+    return BuildNamedGeneric(access, object, name, value, false);
+  }
+
   if (types->length() > 0) {
     PropertyAccessInfo info(this, access, ToType(types->first()), name);
     if (!info.CanAccessAsMonomorphic(types)) {
@@ -7668,6 +7742,10 @@ bool HOptimizedGraphBuilder::TryInline(Handle<JSFunction> target,
     TraceInline(target, caller, "target contains unsupported syntax [late]");
     return false;
   }
+  if (function->flags()->Contains(kDontInline)) {
+    TraceInline(target, caller, "target contains try/catch");
+    return false;
+  }
 
   // If the function uses the arguments object check that inlining of functions
   // with arguments object is enabled and the arguments-variable is
@@ -2133,6 +2133,10 @@ class HOptimizedGraphBuilder : public HGraphBuilder, public AstVisitor {
 
   void VisitDeclarations(ZoneList<Declaration*>* declarations);
 
+  // Whether a break or continue to the given target leaves the try block
+  // whose catch handler is currently pushed.
+  bool LeavesTryCatch(BreakableStatement* target);
+
   void* operator new(size_t size, Zone* zone) {
     return zone->New(static_cast<int>(size));
   }
@@ -2547,6 +2551,10 @@ class HOptimizedGraphBuilder : public HGraphBuilder, public AstVisitor {
                                        BailoutId return_id,
                                        bool can_inline_accessor = true);
 
+  // Returns true if the deoptimization point of an access built now has been
+  // recorded as a deopt loop by the deoptimizer.
+  bool IsDeoptLoopSite(SmallMapList* types);
+
   HInstruction* BuildNamedAccess(PropertyAccessType access,
                                  BailoutId ast_id,
                                  BailoutId reutrn_id,
@@ -2730,6 +2738,11 @@ class HOptimizedGraphBuilder : public HGraphBuilder, public AstVisitor {
 
   HOsrBuilder* osr_;
 
+  // The try/catch statement whose try block is being built, and the break
+  // scope it was entered in. Try/catch statements are not nested.
+  TryCatchStatement* try_catch_;
+  BreakAndContinueScope* try_catch_break_scope_;
+
   friend class FunctionState;  // Pushes and pops the state stack.
   friend class AstContext;  // Pushes and pops the AST context stack.
   friend class KeyedLoadFastElementStub;
@@ -717,6 +717,23 @@ LInstruction* LChunkBuilder::DoDeoptimize(HDeoptimize* instr) {
 }
 
 
+LInstruction* LChunkBuilder::DoEnterTry(HEnterTry* instr) {
+  LOperand* context = UseFixed(instr->context(), esi);
+  LEnterTry* result = new(zone()) LEnterTry(context);
+  LOperand* exception =
+      LRegister::Create(Register::ToAllocationIndex(eax), zone());
+  result->set_catch_environment(
+      CreateCatchEnvironment(current_block_->last_environment(),
+                             instr->handler_id(), chunk(), exception));
+  return result;
+}
+
+
+LInstruction* LChunkBuilder::DoLeaveTry(HLeaveTry* instr) {
+  return new(zone()) LLeaveTry;
+}
+
+
 LInstruction* LChunkBuilder::DoShift(Token::Value op,
                                      HBitwiseBinaryOperation* instr) {
   if (instr->representation().IsSmiOrInteger32()) {
@@ -73,6 +73,7 @@ class LCodeGen;
   V(Drop)                                       \
   V(Dummy)                                      \
   V(DummyUse)                                   \
+  V(EnterTry)                                   \
   V(FlooringDivByConstI)                        \
   V(FlooringDivByPowerOf2I)                     \
   V(FlooringDivI)                               \
@@ -96,6 +97,7 @@ class LCodeGen;
   V(IsUndetectableAndBranch)                    \
   V(Label)                                      \
   V(LazyBailout)                                \
+  V(LeaveTry)                                   \
   V(LoadContextSlot)                            \
   V(LoadFieldByIndex)                           \
   V(LoadFunctionPrototype)                      \
@@ -422,6 +424,33 @@ class LDeoptimize V8_FINAL : public LTemplateInstruction<0, 0, 0> {
 };
 
 
+class LEnterTry V8_FINAL : public LTemplateInstruction<0, 1, 0> {
+ public:
+  explicit LEnterTry(LOperand* context)
+      : catch_environment_(NULL) {
+    inputs_[0] = context;
+  }
+
+  LOperand* context() { return inputs_[0]; }
+
+  // The environment used to deoptimize at the entry of the catch handler.
+  LEnvironment* catch_environment() const { return catch_environment_; }
+  void set_catch_environment(LEnvironment* env) { catch_environment_ = env; }
+
+  DECLARE_CONCRETE_INSTRUCTION(EnterTry, "enter-try")
+  DECLARE_HYDROGEN_ACCESSOR(EnterTry)
+
+ private:
+  LEnvironment* catch_environment_;
+};
+
+
+class LLeaveTry V8_FINAL : public LTemplateInstruction<0, 0, 0> {
+ public:
+  DECLARE_CONCRETE_INSTRUCTION(LeaveTry, "leave-try")
+};
+
+
 class LLabel V8_FINAL : public LGap {
  public:
   explicit LLabel(HBasicBlock* block)
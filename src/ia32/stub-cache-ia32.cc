@@ -61,6 +61,8 @@ static void ProbeTable(Isolate* isolate,
     }
 #endif
 
+    __ IncrementCounter(isolate->stub_cache()->hit_counter(flags, table), 1);
+
     // Jump to the first instruction in the code stub.
     __ add(extra, Immediate(Code::kHeaderSize - kHeapObjectTag));
     __ jmp(extra);
@@ -99,6 +101,8 @@ static void ProbeTable(Isolate* isolate,
     }
 #endif
 
+    __ IncrementCounter(isolate->stub_cache()->hit_counter(flags, table), 1);
+
     // Restore offset and re-load code entry from cache.
     __ pop(offset);
     __ mov(offset, Operand::StaticArray(offset, times_1, value_offset));
@@ -199,13 +203,17 @@ void StubCache::GenerateProbe(MacroAssembler* masm,
   // Check that the receiver isn't a smi.
   __ JumpIfSmi(receiver, &miss);
 
+  // The table sizes are only known at runtime, so the masks are loaded.
+  ExternalReference primary_mask(mask_reference(kPrimary));
+  ExternalReference secondary_mask(mask_reference(kSecondary));
+
   // Get the map of the receiver and compute the hash.
   __ mov(offset, FieldOperand(name, Name::kHashFieldOffset));
   __ add(offset, FieldOperand(receiver, HeapObject::kMapOffset));
   __ xor_(offset, flags);
   // We mask out the last two bits because they are not part of the hash and
   // they are always 01 for maps.  Also in the two 'and' instructions below.
-  __ and_(offset, (kPrimaryTableSize - 1) << kHeapObjectTagSize);
+  __ and_(offset, Operand::StaticVariable(primary_mask));
   // ProbeTable expects the offset to be pointer scaled, which it is, because
   // the heap object tag size is 2 and the pointer size log 2 is also 2.
   ASSERT(kHeapObjectTagSize == kPointerSizeLog2);
@@ -217,10 +225,10 @@ void StubCache::GenerateProbe(MacroAssembler* masm,
   __ mov(offset, FieldOperand(name, Name::kHashFieldOffset));
   __ add(offset, FieldOperand(receiver, HeapObject::kMapOffset));
   __ xor_(offset, flags);
-  __ and_(offset, (kPrimaryTableSize - 1) << kHeapObjectTagSize);
+  __ and_(offset, Operand::StaticVariable(primary_mask));
   __ sub(offset, name);
   __ add(offset, Immediate(flags));
-  __ and_(offset, (kSecondaryTableSize - 1) << kHeapObjectTagSize);
+  __ and_(offset, Operand::StaticVariable(secondary_mask));
 
   // Probe the secondary table.
   ProbeTable(
@@ -230,6 +238,7 @@ void StubCache::GenerateProbe(MacroAssembler* masm,
   // entering the runtime system.
   __ bind(&miss);
   __ IncrementCounter(counters->megamorphic_stub_cache_misses(), 1);
+  __ IncrementCounter(miss_counter(flags), 1);
 }
 
 
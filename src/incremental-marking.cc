@@ -560,6 +560,8 @@ void IncrementalMarking::StartMarking(CompactionFlag flag) {
 
   state_ = MARKING;
 
+  heap_->mark_compact_collector()->UpdateCodeFlushingPressure();
+
   RecordWriteStub::Mode mode = is_compacting_ ?
       RecordWriteStub::INCREMENTAL_COMPACTION : RecordWriteStub::INCREMENTAL;
 
@@ -163,8 +163,10 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
                                            Vector<const Char> subject,
                                            int* registers,
                                            int current,
-                                           uint32_t current_char) {
+                                           uint32_t current_char,
+                                           int backtrack_limit) {
   const byte* pc = code_base;
+  int backtracks = 0;
   // BacktrackStack ensures that the memory allocated for the backtracking stack
   // is returned to the system or cached if there is no stack being cached at
   // the moment.
@@ -238,6 +240,9 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         pc += BC_POP_CP_LENGTH;
         break;
       BYTECODE(POP_BT)
+        if (backtrack_limit > 0 && ++backtracks > backtrack_limit) {
+          return RegExpImpl::RE_FALLBACK_TO_LINEAR;
+        }
         backtrack_stack_space++;
         --backtrack_sp;
         pc = code_base + *backtrack_sp;
@@ -579,7 +584,8 @@ RegExpImpl::IrregexpResult IrregexpInterpreter::Match(
     Handle<ByteArray> code_array,
     Handle<String> subject,
     int* registers,
-    int start_position) {
+    int start_position,
+    int backtrack_limit) {
   ASSERT(subject->IsFlat());
 
   DisallowHeapAllocation no_gc;
@@ -594,7 +600,8 @@ RegExpImpl::IrregexpResult IrregexpInterpreter::Match(
                     subject_vector,
                     registers,
                     start_position,
-                    previous_char);
+                    previous_char,
+                    backtrack_limit);
   } else {
     ASSERT(subject_content.IsTwoByte());
     Vector<const uc16> subject_vector = subject_content.ToUC16Vector();
@@ -604,7 +611,8 @@ RegExpImpl::IrregexpResult IrregexpInterpreter::Match(
                     subject_vector,
                     registers,
                     start_position,
-                    previous_char);
+                    previous_char,
+                    backtrack_limit);
   }
 }
 
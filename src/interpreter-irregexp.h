@@ -13,11 +13,14 @@ namespace internal {
 
 class IrregexpInterpreter {
  public:
+  // Returns RE_FALLBACK_TO_LINEAR once more than backtrack_limit backtracks
+  // have been taken, unless the limit is zero.
   static RegExpImpl::IrregexpResult Match(Isolate* isolate,
                                           Handle<ByteArray> code,
                                           Handle<String> subject,
                                           int* captures,
-                                          int start_position);
+                                          int start_position,
+                                          int backtrack_limit);
 };
 
 
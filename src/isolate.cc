@@ -1448,6 +1448,7 @@ Isolate::Isolate()
       keyed_lookup_cache_(NULL),
       context_slot_cache_(NULL),
       descriptor_lookup_cache_(NULL),
+      internalization_cache_(NULL),
       handle_scope_implementer_(NULL),
       unicode_cache_(NULL),
       runtime_zone_(this),
@@ -1579,6 +1580,10 @@ void Isolate::Deinit() {
       PrintF(stdout, "=== Stress deopt counter: %u\n", stress_deopt_count_);
     }
 
+    if (FLAG_print_deopt_sites && deoptimizer_data_ != NULL) {
+      deoptimizer_data_->statistics()->Print(stdout);
+    }
+
     // We must stop the logger before we tear down other components.
     Sampler* sampler = logger_->sampler();
     if (sampler && sampler->IsActive()) sampler->Stop();
@@ -1663,6 +1668,8 @@ Isolate::~Isolate() {
   delete regexp_stack_;
   regexp_stack_ = NULL;
 
+  delete internalization_cache_;
+  internalization_cache_ = NULL;
   delete descriptor_lookup_cache_;
   descriptor_lookup_cache_ = NULL;
   delete context_slot_cache_;
@@ -1822,6 +1829,7 @@ bool Isolate::Init(Deserializer* des) {
   keyed_lookup_cache_ = new KeyedLookupCache();
   context_slot_cache_ = new ContextSlotCache();
   descriptor_lookup_cache_ = new DescriptorLookupCache();
+  internalization_cache_ = new InternalizationCache();
   unicode_cache_ = new UnicodeCache();
   inner_pointer_to_code_cache_ = new InnerPointerToCodeCache(this);
   write_iterator_ = new ConsStringIteratorOp();
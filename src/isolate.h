@@ -326,6 +326,9 @@ class ThreadLocalTop BASE_EMBEDDED {
   V(int, good_suffix_shift_table, (kBMMaxShift + 1))                           \
   V(int, suffix_table, (kBMMaxShift + 1))                                      \
   V(uint32_t, private_random_seed, 2)                                          \
+  /* The cons strings recently read by charCodeAt, and how often. */           \
+  V(Address, recent_rope_reads, kRecentRopeReadsSize)                          \
+  V(int, recent_rope_read_counts, kRecentRopeReadsSize)                        \
   ISOLATE_INIT_DEBUG_ARRAY_LIST(V)
 
 typedef List<HeapObject*> DebugObjectCache;
@@ -340,6 +343,7 @@ typedef List<HeapObject*> DebugObjectCache;
   V(byte*, assembler_spare_buffer, NULL)                                       \
   V(FatalErrorCallback, exception_behavior, NULL)                              \
   V(LogEventCallback, event_logger, NULL)                                      \
+  V(v8::ScriptCompiler::CacheStore*, script_cache_store, NULL)                 \
   V(AllowCodeGenerationFromStringsCallback, allow_code_gen_callback, NULL)     \
   /* To distinguish the function templates, so that we can find them in the */ \
   /* function cache of the native context. */                                  \
@@ -363,7 +367,12 @@ typedef List<HeapObject*> DebugObjectCache;
   V(CodeTracer*, code_tracer, NULL)                                            \
   V(bool, fp_stubs_generated, false)                                           \
   V(int, max_available_threads, 0)                                             \
+  /* Stub cache table sizes in bits, zero for the flag defaults. */           \
+  V(int, stub_cache_primary_table_bits, 0)                                     \
+  V(int, stub_cache_secondary_table_bits, 0)                                   \
   V(uint32_t, per_isolate_assert_data, 0xFFFFFFFFu)                            \
+  /* Length of the last JSON.stringify result, used to size the output. */     \
+  V(int, json_stringify_size_hint, 0)                                          \
   V(InterruptCallback, api_interrupt_callback, NULL)                           \
   V(void*, api_interrupt_callback_data, NULL)                                  \
   ISOLATE_INIT_SIMULATOR_LIST(V)
@@ -791,6 +800,7 @@ class Isolate {
 
   static const int kUC16AlphabetSize = 256;  // See StringSearchBase.
   static const int kBMMaxShift = 250;        // See StringSearchBase.
+  static const int kRecentRopeReadsSize = 4;  // See StringRope::CharCodeAt.
 
   // Accessors.
 #define GLOBAL_ACCESSOR(type, name, initialvalue)                       \
@@ -866,6 +876,10 @@ class Isolate {
     return descriptor_lookup_cache_;
   }
 
+  InternalizationCache* internalization_cache() {
+    return internalization_cache_;
+  }
+
   HandleScopeData* handle_scope_data() { return &handle_scope_data_; }
 
   HandleScopeImplementer* handle_scope_implementer() {
@@ -1224,6 +1238,7 @@ class Isolate {
   KeyedLookupCache* keyed_lookup_cache_;
   ContextSlotCache* context_slot_cache_;
   DescriptorLookupCache* descriptor_lookup_cache_;
+  InternalizationCache* internalization_cache_;
   HandleScopeData handle_scope_data_;
   HandleScopeImplementer* handle_scope_implementer_;
   UnicodeCache* unicode_cache_;
@@ -16,7 +16,8 @@
 namespace v8 {
 namespace internal {
 
-// A simple json parser.
+// A simple json parser. The seq_ascii variant parses flat one-byte sources,
+// sequential or external, directly from their characters.
 template <bool seq_ascii>
 class JsonParser BASE_EMBEDDED {
  public:
@@ -35,16 +36,30 @@ class JsonParser BASE_EMBEDDED {
         zone_(isolate_),
         object_constructor_(isolate_->native_context()->object_function(),
                             isolate_),
+        external_chars_(NULL),
         position_(-1) {
     source_ = String::Flatten(source_);
     pretenure_ = (source_length_ >= kPretenureTreshold) ? TENURED : NOT_TENURED;
 
     // Optimized fast case where we only have ASCII characters.
     if (seq_ascii) {
-      seq_source_ = Handle<SeqOneByteString>::cast(source_);
+      if (source_->IsExternalString()) {
+        external_chars_ = reinterpret_cast<const uint8_t*>(
+            ExternalAsciiString::cast(*source_)->GetChars());
+      } else {
+        seq_source_ = Handle<SeqOneByteString>::cast(source_);
+      }
     }
   }
 
+  // The characters of a one-byte source. Sequential sources may move during
+  // allocation, so the result must not be held across allocations.
+  inline const uint8_t* OneByteChars() {
+    ASSERT(seq_ascii);
+    if (external_chars_ != NULL) return external_chars_;
+    return seq_source_->GetChars();
+  }
+
   // Parse a string containing a single JSON value.
   MaybeHandle<Object> ParseJson();
 
@@ -53,7 +68,7 @@ class JsonParser BASE_EMBEDDED {
     if (position_ >= source_length_) {
       c0_ = kEndOfString;
     } else if (seq_ascii) {
-      c0_ = seq_source_->SeqOneByteStringGet(position_);
+      c0_ = OneByteChars()[position_];
     } else {
       c0_ = source_->Get(position_);
     }
@@ -105,7 +120,7 @@ class JsonParser BASE_EMBEDDED {
       String::FlatContent content = expected->GetFlatContent();
       if (content.IsAscii()) {
         ASSERT_EQ('"', c0_);
-        const uint8_t* input_chars = seq_source_->GetChars() + position_ + 1;
+        const uint8_t* input_chars = OneByteChars() + position_ + 1;
         const uint8_t* expected_chars = content.ToOneByteVector().start();
         for (int i = 0; i < length; i++) {
           uint8_t c0 = input_chars[i];
@@ -130,6 +145,10 @@ class JsonParser BASE_EMBEDDED {
 
   template <bool is_internalized>
   Handle<String> ScanJsonString();
+  // Returns the position of the first '"', '\' or control character at or
+  // after the given position in the sequential one-byte source, or the length
+  // of the source if there is none. Scans a word at a time where possible.
+  int SkipPlainStringCharacters(int position);
   // Creates a new string and copies prefix[start..end] into the beginning
   // of it. Then scans the rest of the string, adding characters after the
   // prefix. Called by ScanJsonString when reaching a '\' or non-ASCII char.
@@ -171,6 +190,18 @@ class JsonParser BASE_EMBEDDED {
     return Handle<Object>::null();
   }
 
+  // Objects of the same shape follow the same map transitions. The transition
+  // cache remembers the transition last taken from a map during this parse,
+  // so the next object can expect its key even where the map has more than
+  // one transition.
+  bool FollowCachedTransition(Handle<Map> map,
+                              Handle<String>* key,
+                              Handle<Map>* target);
+  void CacheTransition(Handle<Map> map,
+                       Handle<String> key,
+                       Handle<Map> target);
+  static int TransitionCacheIndex(Map* map);
+
   inline Isolate* isolate() { return isolate_; }
   inline Factory* factory() { return factory_; }
   inline Handle<JSFunction> object_constructor() { return object_constructor_; }
@@ -178,6 +209,16 @@ class JsonParser BASE_EMBEDDED {
   static const int kInitialSpecialStringLength = 1024;
   static const int kPretenureTreshold = 100 * 1024;
 
+  // The transition cache has kTransitionCacheSize entries, each consisting of
+  // the map, the key and the target map. It is only used for sources of at
+  // least kTransitionCacheTreshold characters.
+  static const int kTransitionCacheSize = 64;
+  static const int kTransitionCacheMapOffset = 0;
+  static const int kTransitionCacheKeyOffset = 1;
+  static const int kTransitionCacheTargetOffset = 2;
+  static const int kTransitionCacheEntrySize = 3;
+  static const int kTransitionCacheTreshold = 1024;
+
 
  private:
   Zone* zone() { return &zone_; }
@@ -191,12 +232,20 @@ class JsonParser BASE_EMBEDDED {
   Factory* factory_;
   Zone zone_;
   Handle<JSFunction> object_constructor_;
+  const uint8_t* external_chars_;
+  Handle<FixedArray> transition_cache_;
   uc32 c0_;
   int position_;
 };
 
 template <bool seq_ascii>
 MaybeHandle<Object> JsonParser<seq_ascii>::ParseJson() {
+  // Allocated here, outside of the handle scopes of nested objects.
+  if (seq_ascii && source_length_ >= kTransitionCacheTreshold) {
+    transition_cache_ = factory()->NewFixedArray(
+        kTransitionCacheSize * kTransitionCacheEntrySize);
+  }
+
   // Advance to the first character (possibly EOS)
   AdvanceSkipWhitespace();
   Handle<Object> result = ParseJsonValue();
@@ -360,19 +409,22 @@ Handle<Object> JsonParser<seq_ascii>::ParseJsonObject() {
         if (seq_ascii) {
           key = Map::ExpectedTransitionKey(map);
           follow_expected = !key.is_null() && ParseJsonString(key);
+          if (follow_expected) {
+            target = Map::ExpectedTransitionTarget(map);
+          } else {
+            follow_expected = FollowCachedTransition(map, &key, &target);
+          }
         }
-        // If the expected transition hits, follow it.
-        if (follow_expected) {
-          target = Map::ExpectedTransitionTarget(map);
-        } else {
-          // If the expected transition failed, parse an internalized string and
-          // try to find a matching transition.
+        // If the expected transition failed, parse an internalized string and
+        // try to find a matching transition.
+        if (!follow_expected) {
           key = ParseJsonInternalizedString();
           if (key.is_null()) return ReportUnexpectedCharacter();
 
           target = Map::FindTransitionToField(map, key);
           // If a transition was found, follow it and continue.
           transitioning = !target.is_null();
+          if (transitioning) CacheTransition(map, key, target);
         }
         if (c0_ != ':') return ReportUnexpectedCharacter();
 
@@ -522,7 +574,7 @@ Handle<Object> JsonParser<seq_ascii>::ParseJsonNumber() {
   int length = position_ - beg_pos;
   double number;
   if (seq_ascii) {
-    Vector<const uint8_t> chars(seq_source_->GetChars() +  beg_pos, length);
+    Vector<const uint8_t> chars(OneByteChars() +  beg_pos, length);
     number = StringToDouble(isolate()->unicode_cache(),
                             chars,
                             NO_FLAGS,  // Hex, octal or trailing junk.
@@ -715,13 +767,24 @@ Handle<String> JsonParser<seq_ascii>::ScanJsonString() {
       }
       position++;
       if (position >= source_length_) return Handle<String>::null();
-      c0 = seq_source_->SeqOneByteStringGet(position);
+      c0 = OneByteChars()[position];
     } while (c0 != '"');
     int length = position - position_;
     uint32_t hash = (length <= String::kMaxHashCalcLength)
         ? StringHasher::GetHashCore(running_hash) : length;
     Vector<const uint8_t> string_vector(
-        seq_source_->GetChars() + position_, length);
+        OneByteChars() + position_, length);
+    // Object keys repeat, so try the recently internalized strings first.
+    InternalizationCache* cache = isolate()->internalization_cache();
+    String* cached = cache->Lookup(string_vector, hash);
+    if (cached != NULL) {
+      isolate()->counters()->internalization_cache_hits()->Increment();
+      position_ = position;
+      // Advance past the last '"'.
+      AdvanceSkipWhitespace();
+      return Handle<String>(cached, isolate());
+    }
+    isolate()->counters()->internalization_cache_misses()->Increment();
     StringTable* string_table = isolate()->heap()->string_table();
     uint32_t capacity = string_table->Capacity();
     uint32_t entry = StringTable::FirstProbe(hash, capacity);
@@ -731,8 +794,10 @@ Handle<String> JsonParser<seq_ascii>::ScanJsonString() {
       Object* element = string_table->KeyAt(entry);
       if (element == isolate()->heap()->undefined_value()) {
         // Lookup failure.
-        result = factory()->InternalizeOneByteString(
-            seq_source_, position_, length);
+        result = external_chars_ != NULL
+            ? factory()->InternalizeOneByteString(string_vector)
+            : factory()->InternalizeOneByteString(seq_source_, position_,
+                                                  length);
         break;
       }
       if (element != isolate()->heap()->the_hole_value() &&
@@ -748,6 +813,7 @@ Handle<String> JsonParser<seq_ascii>::ScanJsonString() {
       }
       entry = StringTable::NextProbe(entry, count++, capacity);
     }
+    cache->Update(hash, *result);
     position_ = position;
     // Advance past the last '"'.
     AdvanceSkipWhitespace();
@@ -755,8 +821,12 @@ Handle<String> JsonParser<seq_ascii>::ScanJsonString() {
   }
 
   int beg_pos = position_;
+  if (seq_ascii) {
+    position_ = SkipPlainStringCharacters(position_) - 1;
+    Advance();
+  }
   // Fast case for ASCII only without escape characters.
-  do {
+  while (c0_ != '"') {
     // Check for control character (0x00-0x1f) or unterminated string (<0).
     if (c0_ < 0x20) return Handle<String>::null();
     if (c0_ != '\\') {
@@ -772,7 +842,7 @@ Handle<String> JsonParser<seq_ascii>::ScanJsonString() {
                                                            beg_pos,
                                                            position_);
     }
-  } while (c0_ != '"');
+  }
   int length = position_ - beg_pos;
   Handle<String> result =
       factory()->NewRawOneByteString(length, pretenure_).ToHandleChecked();
@@ -785,6 +855,85 @@ Handle<String> JsonParser<seq_ascii>::ScanJsonString() {
   return result;
 }
 
+
+template <bool seq_ascii>
+int JsonParser<seq_ascii>::SkipPlainStringCharacters(int position) {
+  ASSERT(seq_ascii);
+  DisallowHeapAllocation no_gc;
+  const uint8_t* start = OneByteChars();
+  const uint8_t* chars = start + position;
+  const uint8_t* limit = start + source_length_;
+#ifdef V8_HOST_CAN_READ_UNALIGNED
+  // A word contains a '"', '\' or control character iff one of its bytes
+  // is zero after xor-ing with '"' or '\', or is below 0x20. The tests for
+  // a zero or small byte are exact for the word as a whole.
+  const uintptr_t ones = kUintptrAllBitsSet / 0xFF;
+  const uintptr_t high_bits = ones * 0x80;
+  while (chars + sizeof(uintptr_t) <= limit) {
+    uintptr_t word = *reinterpret_cast<const uintptr_t*>(chars);
+    uintptr_t quotes = word ^ (ones * '"');
+    uintptr_t backslashes = word ^ (ones * '\\');
+    uintptr_t special = ((quotes - ones) & ~quotes) |
+                        ((backslashes - ones) & ~backslashes) |
+                        ((word - ones * 0x20) & ~word);
+    if ((special & high_bits) != 0) break;
+    chars += sizeof(uintptr_t);
+  }
+#endif
+  while (chars < limit) {
+    uint8_t c = *chars;
+    if (c == '"' || c == '\\' || c < 0x20) break;
+    ++chars;
+  }
+  return static_cast<int>(chars - start);
+}
+
+
+template <bool seq_ascii>
+int JsonParser<seq_ascii>::TransitionCacheIndex(Map* map) {
+  int descriptors = map->NumberOfOwnDescriptors();
+  uint32_t hash = descriptors;
+  if (descriptors > 0) {
+    hash += map->instance_descriptors()->GetKey(descriptors - 1)->Hash();
+  }
+  return (hash & (kTransitionCacheSize - 1)) * kTransitionCacheEntrySize;
+}
+
+
+template <bool seq_ascii>
+bool JsonParser<seq_ascii>::FollowCachedTransition(Handle<Map> map,
+                                                   Handle<String>* key,
+                                                   Handle<Map>* target) {
+  if (transition_cache_.is_null()) return false;
+  int index = TransitionCacheIndex(*map);
+  if (transition_cache_->get(index + kTransitionCacheMapOffset) != *map) {
+    return false;
+  }
+  Handle<Map> cached_target(
+      Map::cast(transition_cache_->get(index + kTransitionCacheTargetOffset)),
+      isolate());
+  if (cached_target->is_deprecated()) return false;
+  Handle<String> cached_key(
+      String::cast(transition_cache_->get(index + kTransitionCacheKeyOffset)),
+      isolate());
+  if (!ParseJsonString(cached_key)) return false;
+  *key = cached_key;
+  *target = cached_target;
+  return true;
+}
+
+
+template <bool seq_ascii>
+void JsonParser<seq_ascii>::CacheTransition(Handle<Map> map,
+                                            Handle<String> key,
+                                            Handle<Map> target) {
+  if (transition_cache_.is_null()) return;
+  int index = TransitionCacheIndex(*map);
+  transition_cache_->set(index + kTransitionCacheMapOffset, *map);
+  transition_cache_->set(index + kTransitionCacheKeyOffset, *key);
+  transition_cache_->set(index + kTransitionCacheTargetOffset, *target);
+}
+
 } }  // namespace v8::internal
 
 #endif  // V8_JSON_PARSER_H_
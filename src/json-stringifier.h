@@ -27,6 +27,19 @@ class BasicJsonStringifier BASE_EMBEDDED {
   static const int kInitialPartLength = 32;
   static const int kMaxPartLength = 16 * 1024;
   static const int kPartLengthGrowthFactor = 2;
+  // Parts may grow beyond kMaxPartLength up to the length of the previous
+  // result, at most kMaxPredictedPartLength. Until the output reaches that
+  // length, the first part is grown by copying, so that outputs of similar
+  // size end up in a single sequential string.
+  static const int kMaxPredictedPartLength = 128 * KB;
+
+  // Serialized property keys ("key":) are cached by key, so that objects of
+  // the same shape don't escape their keys over and over again. The cache is
+  // allocated for the first object with at least kMinKeysForKeyCache keys.
+  static const int kMinKeysForKeyCache = 4;
+  static const int kKeyCacheSize = 64;
+  static const int kKeyCacheEntrySize = 2;
+  static const int kMaxCachedKeyLength = 64;
 
   enum Result { UNCHANGED, SUCCESS, EXCEPTION };
 
@@ -104,10 +117,17 @@ class BasicJsonStringifier BASE_EMBEDDED {
 
   void SerializeDeferredKey(bool deferred_comma, Handle<Object> deferred_key) {
     if (deferred_comma) Append(',');
-    SerializeString(Handle<String>::cast(deferred_key));
-    Append(':');
+    SerializeKey(Handle<String>::cast(deferred_key));
   }
 
+  // Serializes the key followed by ':'.
+  void SerializeKey(Handle<String> key);
+
+  void EnsureKeyCache();
+
+  // Appends the characters of a sequential one-byte string.
+  void AppendSeqOneByteString(Handle<String> string);
+
   Result SerializeSmi(Smi* object);
 
   Result SerializeDouble(double number);
@@ -157,8 +177,12 @@ class BasicJsonStringifier BASE_EMBEDDED {
   Handle<String> current_part_;
   Handle<String> tojson_string_;
   Handle<JSArray> stack_;
+  // Likewise for the key cache, which EnsureKeyCache allocates from inner
+  // handle scopes. Holds undefined until then.
+  Handle<FixedArray> key_cache_store_;
   int current_index_;
   int part_length_;
+  int max_part_length_;
   bool is_ascii_;
   bool overflowed_;
 
@@ -245,9 +269,13 @@ BasicJsonStringifier::BasicJsonStringifier(Isolate* isolate)
   accumulator_store_ = Handle<JSValue>::cast(
       Object::ToObject(isolate, factory_->empty_string()).ToHandleChecked());
   part_length_ = kInitialPartLength;
+  max_part_length_ = Max(kMaxPartLength,
+                         Min(isolate_->json_stringify_size_hint(),
+                             kMaxPredictedPartLength));
   current_part_ = factory_->NewRawOneByteString(part_length_).ToHandleChecked();
   tojson_string_ = factory_->toJSON_string();
   stack_ = factory_->NewJSArray(8);
+  key_cache_store_ = factory_->NewFixedArray(1);
 }
 
 
@@ -261,6 +289,7 @@ MaybeHandle<Object> BasicJsonStringifier::Stringify(Handle<Object> object) {
       return isolate_->Throw<Object>(
           isolate_->factory()->NewInvalidStringLengthError());
     }
+    isolate_->set_json_stringify_size_hint(accumulator()->length());
     return accumulator();
   }
   ASSERT(result == EXCEPTION);
@@ -477,8 +506,16 @@ BasicJsonStringifier::Result BasicJsonStringifier::SerializeGeneric(
   // Shrink current part, attach it to the accumulator, also attach the result
   // string to the accumulator, and allocate a new part.
   ShrinkCurrentPart();  // Shrink.
+  Accumulate();         // Attach current part.
   part_length_ = kInitialPartLength;  // Allocate conservatively.
-  Extend();             // Attach current part and allocate new part.
+  if (is_ascii_) {
+    current_part_ =
+        factory_->NewRawOneByteString(part_length_).ToHandleChecked();
+  } else {
+    current_part_ =
+        factory_->NewRawTwoByteString(part_length_).ToHandleChecked();
+  }
+  current_index_ = 0;
   // Attach result string to the accumulator.
   Handle<String> cons;
   ASSIGN_RETURN_ON_EXCEPTION_VALUE(
@@ -644,6 +681,9 @@ BasicJsonStringifier::Result BasicJsonStringifier::SerializeJSObject(
       !object->HasNamedInterceptor() &&
       object->elements()->length() == 0) {
     Handle<Map> map(object->map());
+    if (map->NumberOfOwnDescriptors() >= kMinKeysForKeyCache) {
+      EnsureKeyCache();
+    }
     for (int i = 0; i < map->NumberOfOwnDescriptors(); i++) {
       Handle<Name> name(map->instance_descriptors()->GetKey(i), isolate_);
       // TODO(rossberg): Should this throw?
@@ -728,10 +768,15 @@ void BasicJsonStringifier::Accumulate() {
 
 
 void BasicJsonStringifier::Extend() {
-  Accumulate();
-  if (part_length_ <= kMaxPartLength / kPartLengthGrowthFactor) {
+  // Until the output outgrows the part length cap, the first part is copied
+  // into a larger one instead of being attached to the accumulator.
+  bool grow = accumulator()->length() == 0 &&
+              part_length_ <= max_part_length_ / kPartLengthGrowthFactor;
+  if (!grow) Accumulate();
+  if (part_length_ <= max_part_length_ / kPartLengthGrowthFactor) {
     part_length_ *= kPartLengthGrowthFactor;
   }
+  Handle<String> previous_part = current_part_;
   if (is_ascii_) {
     current_part_ =
         factory_->NewRawOneByteString(part_length_).ToHandleChecked();
@@ -740,7 +785,20 @@ void BasicJsonStringifier::Extend() {
         factory_->NewRawTwoByteString(part_length_).ToHandleChecked();
   }
   ASSERT(!current_part_.is_null());
-  current_index_ = 0;
+  if (grow) {
+    DisallowHeapAllocation no_gc;
+    if (is_ascii_) {
+      String::WriteToFlat(*previous_part,
+                          SeqOneByteString::cast(*current_part_)->GetChars(),
+                          0, current_index_);
+    } else {
+      String::WriteToFlat(*previous_part,
+                          SeqTwoByteString::cast(*current_part_)->GetChars(),
+                          0, current_index_);
+    }
+  } else {
+    current_index_ = 0;
+  }
 }
 
 
@@ -857,6 +915,75 @@ Vector<const uc16> BasicJsonStringifier::GetCharVector(Handle<String> string) {
 }
 
 
+void BasicJsonStringifier::EnsureKeyCache() {
+  if (!key_cache_store_->get(0)->IsUndefined()) return;
+  Handle<FixedArray> key_cache =
+      factory_->NewFixedArray(kKeyCacheSize * kKeyCacheEntrySize);
+  key_cache_store_->set(0, *key_cache);
+}
+
+
+void BasicJsonStringifier::SerializeKey(Handle<String> key) {
+  Handle<Object> cache(key_cache_store_->get(0), isolate_);
+  if (cache->IsUndefined() ||
+      !key->IsInternalizedString() || key->length() > kMaxCachedKeyLength ||
+      !key->IsSeqOneByteString()) {
+    SerializeString(key);
+    Append(':');
+    return;
+  }
+  Handle<FixedArray> key_cache = Handle<FixedArray>::cast(cache);
+  int index = (key->Hash() & (kKeyCacheSize - 1)) * kKeyCacheEntrySize;
+  if (key_cache->get(index) != *key) {
+    static const int kJsonQuoteWorstCaseBlowup = 6;
+    static const int kSpaceForQuotesAndColon = 3;
+    int length = key->length();
+    Handle<String> serialized = factory_->NewRawOneByteString(
+        length * kJsonQuoteWorstCaseBlowup + kSpaceForQuotesAndColon)
+        .ToHandleChecked();
+    {
+      DisallowHeapAllocation no_gc;
+      uint8_t* dest = SeqOneByteString::cast(*serialized)->GetChars();
+      int serialized_length = 0;
+      dest[serialized_length++] = '"';
+      serialized_length += SerializeStringUnchecked_(
+          SeqOneByteString::cast(*key)->GetChars(), dest + 1, length);
+      dest[serialized_length++] = '"';
+      dest[serialized_length++] = ':';
+      serialized = SeqString::Truncate(Handle<SeqString>::cast(serialized),
+                                       serialized_length);
+    }
+    key_cache->set(index, *key);
+    key_cache->set(index + 1, *serialized);
+  }
+  AppendSeqOneByteString(
+      Handle<String>(String::cast(key_cache->get(index + 1)), isolate_));
+}
+
+
+void BasicJsonStringifier::AppendSeqOneByteString(Handle<String> string) {
+  int length = string->length();
+  if (part_length_ - current_index_ > length) {
+    DisallowHeapAllocation no_gc;
+    const uint8_t* chars = SeqOneByteString::cast(*string)->GetChars();
+    if (is_ascii_) {
+      CopyChars(SeqOneByteString::cast(*current_part_)->GetChars() +
+                    current_index_,
+                chars, length);
+    } else {
+      CopyChars(SeqTwoByteString::cast(*current_part_)->GetChars() +
+                    current_index_,
+                chars, length);
+    }
+    current_index_ += length;
+  } else {
+    for (int i = 0; i < length; i++) {
+      Append(SeqOneByteString::cast(*string)->SeqOneByteStringGet(i));
+    }
+  }
+}
+
+
 void BasicJsonStringifier::SerializeString(Handle<String> object) {
   object = String::Flatten(object);
   if (is_ascii_) {
@@ -57,6 +57,10 @@ int32_t* RegExpImpl::GlobalCache::FetchNext() {
                                                  last_end_index,
                                                  register_array_,
                                                  register_array_size_);
+      // With --regexp-tier-up the regexp may have been compiled to native
+      // code since this cache was set up for bytecode. Native code returns
+      // as many matches as fit, but only the first is where it is expected.
+      num_matches_ = Min(num_matches_, max_matches_);
     }
 
     if (num_matches_ <= 0) return NULL;
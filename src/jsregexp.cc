@@ -12,6 +12,7 @@
 #include "src/factory.h"
 #include "src/jsregexp-inl.h"
 #include "src/jsregexp.h"
+#include "src/linear-regexp.h"
 #include "src/parser.h"
 #include "src/regexp-macro-assembler.h"
 #include "src/regexp-macro-assembler-irregexp.h"
@@ -204,6 +205,7 @@ MaybeHandle<Object> RegExpImpl::Compile(Handle<JSRegExp> re,
   }
   if (!has_been_compiled) {
     IrregexpInitialize(re, pattern, flags, parse_result.capture_count);
+    if (FLAG_regexp_linear_engine) CompileLinear(re, &parse_result, &zone);
   }
   ASSERT(re->data()->IsFixedArray());
   // Compilation succeeded so the data is set on the regexp
@@ -366,7 +368,18 @@ bool RegExpImpl::EnsureCompiledIrregexp(
     ASSERT(compiled_code->IsSmi());
     return true;
   }
-  return CompileIrregexp(re, sample_subject, is_ascii);
+#ifndef V8_INTERPRETED_REGEXP
+  // With --regexp-tier-up the regexp runs on bytecode until it has been
+  // executed often enough to be worth compiling to native code.
+  if (IrregexpTicksUntilTierUp(FixedArray::cast(re->data())) > 0) {
+    if (re->DataAt(JSRegExp::bytecode_index(is_ascii))->IsByteArray()) {
+      return true;
+    }
+    return CompileIrregexp(re, sample_subject, is_ascii, true);
+  }
+#endif  // V8_INTERPRETED_REGEXP
+  return CompileIrregexp(re, sample_subject, is_ascii,
+                         !UsesNativeRegExp());
 }
 
 
@@ -388,7 +401,8 @@ static bool CreateRegExpErrorObjectAndThrow(Handle<JSRegExp> re,
 
 bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
                                  Handle<String> sample_subject,
-                                 bool is_ascii) {
+                                 bool is_ascii,
+                                 bool interpreted) {
   // Compile the RegExp.
   Isolate* isolate = re->GetIsolate();
   Zone zone(isolate);
@@ -441,6 +455,7 @@ bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
                             pattern,
                             sample_subject,
                             is_ascii,
+                            interpreted,
                             &zone);
   if (result.error_message != NULL) {
     // Unable to compile regexp.
@@ -451,7 +466,11 @@ bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
   }
 
   Handle<FixedArray> data = Handle<FixedArray>(FixedArray::cast(re->data()));
-  data->set(JSRegExp::code_index(is_ascii), result.code);
+  if (interpreted && UsesNativeRegExp()) {
+    data->set(JSRegExp::bytecode_index(is_ascii), result.code);
+  } else {
+    data->set(JSRegExp::code_index(is_ascii), result.code);
+  }
   int register_max = IrregexpMaxRegisterCount(*data);
   if (result.num_registers > register_max) {
     SetIrregexpMaxRegisterCount(*data, result.num_registers);
@@ -483,7 +502,11 @@ int RegExpImpl::IrregexpNumberOfRegisters(FixedArray* re) {
 
 
 ByteArray* RegExpImpl::IrregexpByteCode(FixedArray* re, bool is_ascii) {
+#ifdef V8_INTERPRETED_REGEXP
   return ByteArray::cast(re->get(JSRegExp::code_index(is_ascii)));
+#else  // V8_INTERPRETED_REGEXP
+  return ByteArray::cast(re->get(JSRegExp::bytecode_index(is_ascii)));
+#endif  // V8_INTERPRETED_REGEXP
 }
 
 
@@ -492,6 +515,71 @@ Code* RegExpImpl::IrregexpNativeCode(FixedArray* re, bool is_ascii) {
 }
 
 
+bool RegExpImpl::IrregexpInterpreted(FixedArray* re, bool is_ascii) {
+#ifdef V8_INTERPRETED_REGEXP
+  return true;
+#else  // V8_INTERPRETED_REGEXP
+  return !re->get(JSRegExp::code_index(is_ascii))->IsCode();
+#endif  // V8_INTERPRETED_REGEXP
+}
+
+
+int RegExpImpl::IrregexpTicksUntilTierUp(FixedArray* re) {
+  return Smi::cast(re->get(JSRegExp::kIrregexpTicksUntilTierUpIndex))->value();
+}
+
+
+bool RegExpImpl::IrregexpUsesLinearEngine(FixedArray* re) {
+  return re->get(JSRegExp::kIrregexpLinearProgramIndex)->IsByteArray();
+}
+
+
+// Compiles the parsed regexp for the linear-time engine. Regexps that cannot
+// run on it are marked so that they are not tried again.
+bool RegExpImpl::CompileLinear(Handle<JSRegExp> re,
+                               RegExpCompileData* data,
+                               Zone* zone) {
+  Handle<ByteArray> program;
+  if (!LinearRegExp::Compile(re->GetIsolate(), data,
+                             re->GetFlags().is_ignore_case(),
+                             zone).ToHandle(&program)) {
+    re->SetDataAt(JSRegExp::kIrregexpLinearProgramIndex,
+                  Smi::FromInt(JSRegExp::kCompilationErrorValue));
+    return false;
+  }
+  re->SetDataAt(JSRegExp::kIrregexpLinearProgramIndex, *program);
+  return true;
+}
+
+
+// Moves a regexp that backtracked too much on bytecode to the linear-time
+// engine, if it can run on it.
+bool RegExpImpl::SwitchToLinearEngine(Handle<JSRegExp> re) {
+  Isolate* isolate = re->GetIsolate();
+  Zone zone(isolate);
+  PostponeInterruptsScope postpone(isolate);
+  Handle<String> pattern(re->Pattern());
+  pattern = String::Flatten(pattern);
+  RegExpCompileData compile_data;
+  FlatStringReader reader(isolate, pattern);
+  if (!RegExpParser::ParseRegExp(&reader, re->GetFlags().is_multiline(),
+                                 &compile_data, &zone) ||
+      !CompileLinear(re, &compile_data, &zone)) {
+    return false;
+  }
+  // Drop the Irregexp code so that the exec stub calls into the runtime,
+  // which runs the linear engine.
+  Smi* uninitialized = Smi::FromInt(JSRegExp::kUninitializedValue);
+  for (int i = 0; i < 2; i++) {
+    bool is_ascii = i == 0;
+    re->SetDataAt(JSRegExp::code_index(is_ascii), uninitialized);
+    re->SetDataAt(JSRegExp::saved_code_index(is_ascii), uninitialized);
+    re->SetDataAt(JSRegExp::bytecode_index(is_ascii), uninitialized);
+  }
+  return true;
+}
+
+
 void RegExpImpl::IrregexpInitialize(Handle<JSRegExp> re,
                                     Handle<String> pattern,
                                     JSRegExp::Flags flags,
@@ -509,22 +597,36 @@ int RegExpImpl::IrregexpPrepare(Handle<JSRegExp> regexp,
                                 Handle<String> subject) {
   subject = String::Flatten(subject);
 
+  // The linear engine only needs room to output captures.
+  FixedArray* linear_data = FixedArray::cast(regexp->data());
+  if (IrregexpUsesLinearEngine(linear_data)) {
+    return (IrregexpNumberOfCaptures(linear_data) + 1) * 2;
+  }
+
   // Check the asciiness of the underlying storage.
   bool is_ascii = subject->IsOneByteRepresentationUnderneath();
   if (!EnsureCompiledIrregexp(regexp, subject, is_ascii)) return -1;
 
-#ifdef V8_INTERPRETED_REGEXP
-  // Byte-code regexp needs space allocated for all its registers.
-  // The result captures are copied to the start of the registers array
-  // if the match succeeds.  This way those registers are not clobbered
-  // when we set the last match info from last successful match.
-  return IrregexpNumberOfRegisters(FixedArray::cast(regexp->data())) +
-         (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) * 2;
-#else  // V8_INTERPRETED_REGEXP
+  FixedArray* data = FixedArray::cast(regexp->data());
+  if (IrregexpInterpreted(data, is_ascii)) {
+#ifndef V8_INTERPRETED_REGEXP
+    // Count the execution towards tiering up to native code.
+    int ticks = IrregexpTicksUntilTierUp(data);
+    if (ticks > 0) {
+      data->set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
+                Smi::FromInt(ticks - 1));
+    }
+#endif  // V8_INTERPRETED_REGEXP
+    // Byte-code regexp needs space allocated for all its registers.
+    // The result captures are copied to the start of the registers array
+    // if the match succeeds.  This way those registers are not clobbered
+    // when we set the last match info from last successful match.
+    return IrregexpNumberOfRegisters(data) +
+           (IrregexpNumberOfCaptures(data) + 1) * 2;
+  }
   // Native regexp only needs room to output captures. Registers are handled
   // internally.
-  return (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) * 2;
-#endif  // V8_INTERPRETED_REGEXP
+  return (IrregexpNumberOfCaptures(data) + 1) * 2;
 }
 
 
@@ -541,12 +643,32 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
   ASSERT(index <= subject->length());
   ASSERT(subject->IsFlat());
 
+  if (IrregexpUsesLinearEngine(*irregexp)) {
+    Handle<ByteArray> program(ByteArray::cast(
+        irregexp->get(JSRegExp::kIrregexpLinearProgramIndex)), isolate);
+    return LinearRegExp::Match(program, subject, index, output, output_size);
+  }
+
   bool is_ascii = subject->IsOneByteRepresentationUnderneath();
 
 #ifndef V8_INTERPRETED_REGEXP
   ASSERT(output_size >= (IrregexpNumberOfCaptures(*irregexp) + 1) * 2);
   do {
-    EnsureCompiledIrregexp(regexp, subject, is_ascii);
+    if (!EnsureCompiledIrregexp(regexp, subject, is_ascii)) {
+      return RE_EXCEPTION;
+    }
+    if (IrregexpInterpreted(*irregexp, is_ascii)) {
+      // Run the bytecode below if there is room for its registers. There
+      // may not be if the subject changed representation since
+      // IrregexpPrepare, in which case native code is compiled right away.
+      if (output_size >= IrregexpNumberOfRegisters(*irregexp) +
+                         (IrregexpNumberOfCaptures(*irregexp) + 1) * 2) {
+        break;
+      }
+      if (!CompileIrregexp(regexp, subject, is_ascii, false)) {
+        return RE_EXCEPTION;
+      }
+    }
     Handle<Code> code(IrregexpNativeCode(*irregexp, is_ascii), isolate);
     // The stack is used to allocate registers for the compiled regexp code.
     // This means that in case of failure, the output registers array is left
@@ -576,12 +698,9 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
     // the, potentially, different subject (the string can switch between
     // being internal and external, and even between being ASCII and UC16,
     // but the characters are always the same).
-    IrregexpPrepare(regexp, subject);
     is_ascii = subject->IsOneByteRepresentationUnderneath();
   } while (true);
-  UNREACHABLE();
-  return RE_EXCEPTION;
-#else  // V8_INTERPRETED_REGEXP
+#endif  // V8_INTERPRETED_REGEXP
 
   ASSERT(output_size >= IrregexpNumberOfRegisters(*irregexp));
   // We must have done EnsureCompiledIrregexp, so we can get the number of
@@ -589,19 +708,35 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
   int number_of_capture_registers =
       (IrregexpNumberOfCaptures(*irregexp) + 1) * 2;
   int32_t* raw_output = &output[number_of_capture_registers];
-  // We do not touch the actual capture result registers until we know there
-  // has been a match so that we can use those capture results to set the
-  // last match info.
-  for (int i = number_of_capture_registers - 1; i >= 0; i--) {
-    raw_output[i] = -1;
-  }
   Handle<ByteArray> byte_codes(IrregexpByteCode(*irregexp, is_ascii), isolate);
+  // Regexps that may run on the linear engine switch to it once they
+  // backtrack too much.
+  int backtrack_limit = 0;
+  if (Smi::FromInt(JSRegExp::kUninitializedValue) ==
+      irregexp->get(JSRegExp::kIrregexpLinearProgramIndex)) {
+    backtrack_limit = FLAG_regexp_backtracks_before_fallback;
+  }
 
-  IrregexpResult result = IrregexpInterpreter::Match(isolate,
-                                                     byte_codes,
-                                                     subject,
-                                                     raw_output,
-                                                     index);
+  IrregexpResult result;
+  do {
+    // We do not touch the actual capture result registers until we know
+    // there has been a match so that we can use those capture results to set
+    // the last match info.
+    for (int i = number_of_capture_registers - 1; i >= 0; i--) {
+      raw_output[i] = -1;
+    }
+    result = IrregexpInterpreter::Match(isolate,
+                                        byte_codes,
+                                        subject,
+                                        raw_output,
+                                        index,
+                                        backtrack_limit);
+    if (result != RE_FALLBACK_TO_LINEAR) break;
+    if (SwitchToLinearEngine(regexp)) {
+      return IrregexpExecRaw(regexp, subject, index, output, output_size);
+    }
+    backtrack_limit = 0;
+  } while (true);
   if (result == RE_SUCCESS) {
     // Copy capture results to the start of the registers array.
     MemCopy(output, raw_output, number_of_capture_registers * sizeof(int32_t));
@@ -611,7 +746,6 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
     isolate->StackOverflow();
   }
   return result;
-#endif  // V8_INTERPRETED_REGEXP
 }
 
 
@@ -623,7 +757,7 @@ MaybeHandle<Object> RegExpImpl::IrregexpExec(Handle<JSRegExp> regexp,
   ASSERT_EQ(regexp->TypeTag(), JSRegExp::IRREGEXP);
 
   // Prepare space for the return values.
-#if defined(V8_INTERPRETED_REGEXP) && defined(DEBUG)
+#ifdef DEBUG
   if (FLAG_trace_regexp_bytecodes) {
     String* pattern = regexp->Pattern();
     PrintF("\n\nRegexp match:   /%s/\n\n", pattern->ToCString().get());
@@ -694,11 +828,7 @@ RegExpImpl::GlobalCache::GlobalCache(Handle<JSRegExp> regexp,
     register_array_size_(0),
     regexp_(regexp),
     subject_(subject) {
-#ifdef V8_INTERPRETED_REGEXP
-  bool interpreted = true;
-#else
   bool interpreted = false;
-#endif  // V8_INTERPRETED_REGEXP
 
   if (regexp_->TypeTag() == JSRegExp::ATOM) {
     static const int kAtomRegistersPerMatch = 2;
@@ -711,6 +841,9 @@ RegExpImpl::GlobalCache::GlobalCache(Handle<JSRegExp> regexp,
       num_matches_ = -1;  // Signal exception.
       return;
     }
+    interpreted = RegExpImpl::IrregexpInterpreted(
+        FixedArray::cast(regexp_->data()),
+        subject_->IsOneByteRepresentationUnderneath());
   }
 
   if (is_global && !interpreted) {
@@ -5985,6 +6118,7 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
     Handle<String> pattern,
     Handle<String> sample_subject,
     bool is_ascii,
+    bool interpreted,
     Zone* zone) {
   if ((data->capture_count + 1) * 2 - 1 > RegExpMacroAssembler::kMaxRegister) {
     return IrregexpRegExpTooBig(zone->isolate());
@@ -6055,58 +6189,64 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
   }
 
   // Create the correct assembler for the architecture.
+  EmbeddedVector<byte, 1024> codes;
+  SmartPointer<RegExpMacroAssembler> macro_assembler;
 #ifndef V8_INTERPRETED_REGEXP
-  // Native regexp implementation.
+  if (!interpreted) {
+    // Native regexp implementation.
 
-  NativeRegExpMacroAssembler::Mode mode =
-      is_ascii ? NativeRegExpMacroAssembler::ASCII
-               : NativeRegExpMacroAssembler::UC16;
+    NativeRegExpMacroAssembler::Mode mode =
+        is_ascii ? NativeRegExpMacroAssembler::ASCII
+                 : NativeRegExpMacroAssembler::UC16;
+    int output_registers = (data->capture_count + 1) * 2;
 
 #if V8_TARGET_ARCH_IA32
-  RegExpMacroAssemblerIA32 macro_assembler(mode, (data->capture_count + 1) * 2,
-                                           zone);
+    macro_assembler = SmartPointer<RegExpMacroAssembler>(
+        new RegExpMacroAssemblerIA32(mode, output_registers, zone));
 #elif V8_TARGET_ARCH_X64
-  RegExpMacroAssemblerX64 macro_assembler(mode, (data->capture_count + 1) * 2,
-                                          zone);
+    macro_assembler = SmartPointer<RegExpMacroAssembler>(
+        new RegExpMacroAssemblerX64(mode, output_registers, zone));
 #elif V8_TARGET_ARCH_ARM
-  RegExpMacroAssemblerARM macro_assembler(mode, (data->capture_count + 1) * 2,
-                                          zone);
+    macro_assembler = SmartPointer<RegExpMacroAssembler>(
+        new RegExpMacroAssemblerARM(mode, output_registers, zone));
 #elif V8_TARGET_ARCH_ARM64
-  RegExpMacroAssemblerARM64 macro_assembler(mode, (data->capture_count + 1) * 2,
-                                            zone);
+    macro_assembler = SmartPointer<RegExpMacroAssembler>(
+        new RegExpMacroAssemblerARM64(mode, output_registers, zone));
 #elif V8_TARGET_ARCH_MIPS
-  RegExpMacroAssemblerMIPS macro_assembler(mode, (data->capture_count + 1) * 2,
-                                           zone);
+    macro_assembler = SmartPointer<RegExpMacroAssembler>(
+        new RegExpMacroAssemblerMIPS(mode, output_registers, zone));
 #elif V8_TARGET_ARCH_X87
-  RegExpMacroAssemblerX87 macro_assembler(mode, (data->capture_count + 1) * 2,
-                                          zone);
+    macro_assembler = SmartPointer<RegExpMacroAssembler>(
+        new RegExpMacroAssemblerX87(mode, output_registers, zone));
 #else
 #error "Unsupported architecture"
 #endif
-
-#else  // V8_INTERPRETED_REGEXP
-  // Interpreted regexp implementation.
-  EmbeddedVector<byte, 1024> codes;
-  RegExpMacroAssemblerIrregexp macro_assembler(codes, zone);
+  }
 #endif  // V8_INTERPRETED_REGEXP
 
+  if (macro_assembler.is_empty()) {
+    // Interpreted regexp implementation.
+    macro_assembler = SmartPointer<RegExpMacroAssembler>(
+        new RegExpMacroAssemblerIrregexp(codes, zone));
+  }
+
   // Inserted here, instead of in Assembler, because it depends on information
   // in the AST that isn't replicated in the Node structure.
   static const int kMaxBacksearchLimit = 1024;
   if (is_end_anchored &&
       !is_start_anchored &&
       max_length < kMaxBacksearchLimit) {
-    macro_assembler.SetCurrentPositionFromEnd(max_length);
+    macro_assembler->SetCurrentPositionFromEnd(max_length);
   }
 
   if (is_global) {
-    macro_assembler.set_global_mode(
+    macro_assembler->set_global_mode(
         (data->tree->min_match() > 0)
             ? RegExpMacroAssembler::GLOBAL_NO_ZERO_LENGTH_CHECK
             : RegExpMacroAssembler::GLOBAL);
   }
 
-  return compiler.Assemble(&macro_assembler,
+  return compiler.Assemble(macro_assembler.get(),
                            node,
                            data->capture_count,
                            pattern);
@@ -18,6 +18,7 @@ class RegExpMacroAssembler;
 class RegExpNode;
 class RegExpTree;
 class BoyerMooreLookahead;
+struct RegExpCompileData;
 
 class RegExpImpl {
  public:
@@ -84,7 +85,14 @@ class RegExpImpl {
                                  int index,
                                  Handle<JSArray> lastMatchInfo);
 
-  enum IrregexpResult { RE_FAILURE = 0, RE_SUCCESS = 1, RE_EXCEPTION = -1 };
+  // RE_FALLBACK_TO_LINEAR is only returned by the bytecode interpreter, when
+  // a regexp backtracks too much and should switch to the linear engine.
+  enum IrregexpResult {
+    RE_FAILURE = 0,
+    RE_SUCCESS = 1,
+    RE_EXCEPTION = -1,
+    RE_FALLBACK_TO_LINEAR = -2
+  };
 
   // Prepare a RegExp for being executed one or more times (using
   // IrregexpExecOnce) on the subject.
@@ -206,6 +214,11 @@ class RegExpImpl {
   static int IrregexpNumberOfRegisters(FixedArray* re);
   static ByteArray* IrregexpByteCode(FixedArray* re, bool is_ascii);
   static Code* IrregexpNativeCode(FixedArray* re, bool is_ascii);
+  // Whether a compiled regexp runs on bytecode for the given encoding.
+  static bool IrregexpInterpreted(FixedArray* re, bool is_ascii);
+  static int IrregexpTicksUntilTierUp(FixedArray* re);
+  // Whether a regexp runs on the linear-time engine instead of Irregexp.
+  static bool IrregexpUsesLinearEngine(FixedArray* re);
 
   // Limit the space regexps take up on the heap.  In order to limit this we
   // would like to keep track of the amount of regexp code on the heap.  This
@@ -217,9 +230,14 @@ class RegExpImpl {
 
  private:
   static bool CompileIrregexp(
-      Handle<JSRegExp> re, Handle<String> sample_subject, bool is_ascii);
+      Handle<JSRegExp> re, Handle<String> sample_subject, bool is_ascii,
+      bool interpreted);
   static inline bool EnsureCompiledIrregexp(
       Handle<JSRegExp> re, Handle<String> sample_subject, bool is_ascii);
+  static bool CompileLinear(Handle<JSRegExp> re,
+                            RegExpCompileData* data,
+                            Zone* zone);
+  static bool SwitchToLinearEngine(Handle<JSRegExp> re);
 };
 
 
@@ -1614,7 +1632,8 @@ class RegExpEngine: public AllStatic {
                                    bool multiline,
                                    Handle<String> pattern,
                                    Handle<String> sample_subject,
-                                   bool is_ascii, Zone* zone);
+                                   bool is_ascii, bool interpreted,
+                                   Zone* zone);
 
   static void DotPrint(const char* label, RegExpNode* node, bool ignore_case);
 };
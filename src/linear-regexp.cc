@@ -0,0 +1,511 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/v8.h"
+
+#include "src/ast.h"
+#include "src/char-predicates-inl.h"
+#include "src/linear-regexp.h"
+#include "src/list-inl.h"
+
+namespace v8 {
+namespace internal {
+
+// A program is a sequence of int32 words: a header, the instructions and the
+// character ranges consumed by CONSUME instructions.
+enum LinearOpcode {
+  CONSUME,         // Consume a character in the ranges [a, a + b).
+  SPLIT,           // Continue at a, and with lower priority at b.
+  JMP,             // Continue at a.
+  SAVE,            // Store the current position in register a.
+  CLEAR,           // Reset registers a to b (inclusive) to -1.
+  ASSERTION,       // Check the RegExpAssertion::AssertionType a.
+  CHECK_PROGRESS,  // Fail unless register a differs from the position.
+  MATCH
+};
+
+static const int kProgramInstructionCount = 0;
+static const int kProgramRegisterCount = 1;
+static const int kProgramCaptureRegisterCount = 2;
+static const int kProgramHeaderSize = 3;
+static const int kInstructionSize = 3;
+
+// Bounds the size of the thread lists, which hold a set of registers for
+// every instruction.
+static const int kMaxThreadStateSize = 1 << 20;
+
+
+class LinearRegExpCompiler {
+ public:
+  LinearRegExpCompiler(int capture_count, bool ignore_case, Zone* zone)
+      : code_(64, zone),
+        ranges_(16, zone),
+        capture_register_count_((capture_count + 1) * 2),
+        register_count_(capture_register_count_),
+        ignore_case_(ignore_case),
+        zone_(zone) { }
+
+  bool Compile(RegExpTree* tree) {
+    Emit(SAVE, 0);
+    if (!Visit(tree)) return false;
+    Emit(SAVE, 1);
+    Emit(MATCH);
+    return !TooLarge();
+  }
+
+  MaybeHandle<ByteArray> Assemble(Isolate* isolate) {
+    int instructions = pc();
+    int words = kProgramHeaderSize + code_.length() + ranges_.length();
+    Handle<ByteArray> program =
+        isolate->factory()->NewByteArray(words * sizeof(int32_t), TENURED);
+    int32_t* data = reinterpret_cast<int32_t*>(program->GetDataStartAddress());
+    data[kProgramInstructionCount] = instructions;
+    data[kProgramRegisterCount] = register_count_;
+    data[kProgramCaptureRegisterCount] = capture_register_count_;
+    int32_t* code = data + kProgramHeaderSize;
+    int range_base = instructions;
+    for (int i = 0; i < code_.length(); i++) code[i] = code_[i];
+    // Ranges are addressed relative to the first instruction.
+    for (int i = 0; i < instructions; i++) {
+      if (code[i * kInstructionSize] == CONSUME) {
+        code[i * kInstructionSize + 1] += range_base * kInstructionSize;
+      }
+    }
+    int32_t* ranges = code + code_.length();
+    for (int i = 0; i < ranges_.length(); i++) ranges[i] = ranges_[i];
+    return program;
+  }
+
+ private:
+  int pc() { return code_.length() / kInstructionSize; }
+
+  bool TooLarge() {
+    return pc() > LinearRegExp::kMaxInstructions ||
+           pc() * register_count_ > kMaxThreadStateSize;
+  }
+
+  int Emit(LinearOpcode opcode, int a = 0, int b = 0) {
+    int pc = this->pc();
+    code_.Add(opcode, zone_);
+    code_.Add(a, zone_);
+    code_.Add(b, zone_);
+    return pc;
+  }
+
+  void PatchA(int pc, int a) { code_[pc * kInstructionSize + 1] = a; }
+  void PatchB(int pc, int b) { code_[pc * kInstructionSize + 2] = b; }
+
+  void EmitConsume(ZoneList<CharacterRange>* ranges) {
+    int start = ranges_.length();
+    for (int i = 0; i < ranges->length(); i++) {
+      ranges_.Add(ranges->at(i).from(), zone_);
+      ranges_.Add(ranges->at(i).to(), zone_);
+    }
+    Emit(CONSUME, start, ranges->length());
+  }
+
+  void EmitCharacter(uc16 c) {
+    ZoneList<CharacterRange> ranges(2, zone_);
+    ranges.Add(CharacterRange::Singleton(c), zone_);
+    if (ignore_case_) {
+      CharacterRange::Singleton(c).AddCaseEquivalents(&ranges, false, zone_);
+      CharacterRange::Canonicalize(&ranges);
+    }
+    EmitConsume(&ranges);
+  }
+
+  void EmitCharacterClass(RegExpCharacterClass* cc) {
+    // Case equivalents are added to a copy to leave the parsed class intact.
+    ZoneList<CharacterRange>* class_ranges = cc->ranges(zone_);
+    ZoneList<CharacterRange> ranges(class_ranges->length() + 1, zone_);
+    ranges.AddAll(*class_ranges, zone_);
+    if (ignore_case_ && !cc->is_standard(zone_)) {
+      for (int i = 0; i < class_ranges->length(); i++) {
+        class_ranges->at(i).AddCaseEquivalents(&ranges, false, zone_);
+      }
+    }
+    CharacterRange::Canonicalize(&ranges);
+    if (!cc->is_negated()) {
+      EmitConsume(&ranges);
+    } else if (ranges.is_empty()) {
+      ZoneList<CharacterRange> everything(1, zone_);
+      everything.Add(CharacterRange::Everything(), zone_);
+      EmitConsume(&everything);
+    } else {
+      ZoneList<CharacterRange> negated(ranges.length() + 1, zone_);
+      CharacterRange::Negate(&ranges, &negated, zone_);
+      EmitConsume(&negated);
+    }
+  }
+
+  bool Visit(RegExpTree* tree) {
+    if (TooLarge()) return false;
+    if (tree->IsDisjunction()) return VisitDisjunction(tree->AsDisjunction());
+    if (tree->IsAlternative()) {
+      ZoneList<RegExpTree*>* nodes = tree->AsAlternative()->nodes();
+      for (int i = 0; i < nodes->length(); i++) {
+        if (!Visit(nodes->at(i))) return false;
+      }
+      return true;
+    }
+    if (tree->IsAssertion()) {
+      Emit(ASSERTION, tree->AsAssertion()->assertion_type());
+      return true;
+    }
+    if (tree->IsCharacterClass()) {
+      EmitCharacterClass(tree->AsCharacterClass());
+      return true;
+    }
+    if (tree->IsAtom()) {
+      Vector<const uc16> data = tree->AsAtom()->data();
+      for (int i = 0; i < data.length(); i++) EmitCharacter(data[i]);
+      return true;
+    }
+    if (tree->IsText()) {
+      ZoneList<TextElement>* elements = tree->AsText()->elements();
+      for (int i = 0; i < elements->length(); i++) {
+        if (!Visit(elements->at(i).tree())) return false;
+      }
+      return true;
+    }
+    if (tree->IsQuantifier()) return VisitQuantifier(tree->AsQuantifier());
+    if (tree->IsCapture()) {
+      RegExpCapture* capture = tree->AsCapture();
+      Emit(SAVE, RegExpCapture::StartRegister(capture->index()));
+      if (!Visit(capture->body())) return false;
+      Emit(SAVE, RegExpCapture::EndRegister(capture->index()));
+      return true;
+    }
+    if (tree->IsEmpty()) return true;
+    // Back references and lookaheads need backtracking.
+    ASSERT(tree->IsBackReference() || tree->IsLookahead());
+    return false;
+  }
+
+  bool VisitDisjunction(RegExpDisjunction* disjunction) {
+    ZoneList<RegExpTree*>* alternatives = disjunction->alternatives();
+    ZoneList<int> jumps(alternatives->length(), zone_);
+    for (int i = 0; i < alternatives->length() - 1; i++) {
+      int split = Emit(SPLIT, pc() + 1);
+      if (!Visit(alternatives->at(i))) return false;
+      jumps.Add(Emit(JMP), zone_);
+      PatchB(split, pc());
+    }
+    if (!Visit(alternatives->last())) return false;
+    for (int i = 0; i < jumps.length(); i++) PatchA(jumps[i], pc());
+    return true;
+  }
+
+  // Emits one iteration of the quantifier body. Optional iterations that
+  // match the empty string fail, as they do in Irregexp.
+  bool VisitIteration(RegExpQuantifier* quantifier, bool optional) {
+    int progress_register = -1;
+    if (optional && quantifier->body()->min_match() == 0) {
+      progress_register = register_count_++;
+      Emit(SAVE, progress_register);
+    }
+    Interval captures = quantifier->body()->CaptureRegisters();
+    if (!captures.is_empty()) Emit(CLEAR, captures.from(), captures.to());
+    if (!Visit(quantifier->body())) return false;
+    if (progress_register >= 0) Emit(CHECK_PROGRESS, progress_register);
+    return true;
+  }
+
+  // Emits a split that prefers the next instruction if the quantifier is
+  // greedy. The other target is patched in later.
+  int EmitQuantifierSplit(RegExpQuantifier* quantifier) {
+    if (quantifier->is_greedy()) return Emit(SPLIT, pc() + 1);
+    return Emit(SPLIT, 0, pc() + 1);
+  }
+
+  void PatchQuantifierSplit(RegExpQuantifier* quantifier, int split, int to) {
+    if (quantifier->is_greedy()) {
+      PatchB(split, to);
+    } else {
+      PatchA(split, to);
+    }
+  }
+
+  bool VisitQuantifier(RegExpQuantifier* quantifier) {
+    if (quantifier->is_possessive()) return false;
+    int min = quantifier->min();
+    int max = quantifier->max();
+    if (min > LinearRegExp::kMaxInstructions) return false;
+    for (int i = 0; i < min; i++) {
+      if (!VisitIteration(quantifier, false)) return false;
+    }
+    if (max == RegExpTree::kInfinity) {
+      int loop = EmitQuantifierSplit(quantifier);
+      if (!VisitIteration(quantifier, true)) return false;
+      Emit(JMP, loop);
+      PatchQuantifierSplit(quantifier, loop, pc());
+      return true;
+    }
+    if (max - min > LinearRegExp::kMaxInstructions) return false;
+    ZoneList<int> splits(max - min, zone_);
+    for (int i = min; i < max; i++) {
+      splits.Add(EmitQuantifierSplit(quantifier), zone_);
+      if (!VisitIteration(quantifier, true)) return false;
+    }
+    for (int i = 0; i < splits.length(); i++) {
+      PatchQuantifierSplit(quantifier, splits[i], pc());
+    }
+    return true;
+  }
+
+  ZoneList<int> code_;
+  ZoneList<int> ranges_;
+  int capture_register_count_;
+  int register_count_;
+  bool ignore_case_;
+  Zone* zone_;
+};
+
+
+MaybeHandle<ByteArray> LinearRegExp::Compile(Isolate* isolate,
+                                             RegExpCompileData* data,
+                                             bool ignore_case,
+                                             Zone* zone) {
+  LinearRegExpCompiler compiler(data->capture_count, ignore_case, zone);
+  if (!compiler.Compile(data->tree)) return MaybeHandle<ByteArray>();
+  return compiler.Assemble(isolate);
+}
+
+
+// Runs all threads of a program in lock step over the subject. A thread is
+// an instruction waiting to consume a character, together with its
+// registers. Threads are kept in priority order, so the first thread to
+// reach MATCH is the match a backtracking engine would have found.
+template <typename Char>
+class LinearMatcher {
+ public:
+  LinearMatcher(const int32_t* program, Vector<const Char> subject)
+      : code_(program + kProgramHeaderSize),
+        instruction_count_(program[kProgramInstructionCount]),
+        register_count_(program[kProgramRegisterCount]),
+        capture_register_count_(program[kProgramCaptureRegisterCount]),
+        subject_(subject),
+        visited_(instruction_count_),
+        current_pcs_(instruction_count_),
+        current_registers_(instruction_count_ * register_count_),
+        next_pcs_(instruction_count_),
+        next_registers_(instruction_count_ * register_count_),
+        start_registers_(register_count_),
+        stack_(16) { }
+
+  bool Match(int index, int32_t* output, int output_size) {
+    for (int i = 0; i < instruction_count_; i++) visited_[i] = -1;
+    for (int i = 0; i < register_count_; i++) start_registers_[i] = -1;
+    ThreadList current = { current_pcs_.start(),
+                           current_registers_.start(), 0 };
+    ThreadList next = { next_pcs_.start(), next_registers_.start(), 0 };
+    bool matched = false;
+    for (int position = index; ; position++) {
+      // Searching from this position has lower priority than all threads
+      // that started earlier.
+      if (!matched) AddThread(&current, 0, position, start_registers_.start());
+      if (current.count == 0) {
+        if (matched || position >= subject_.length()) break;
+        continue;
+      }
+      next.count = 0;
+      for (int i = 0; i < current.count; i++) {
+        const int32_t* instruction = code_ + current.pcs[i] * kInstructionSize;
+        int* registers = current.registers + i * register_count_;
+        if (instruction[0] == MATCH) {
+          int count = Min(output_size, capture_register_count_);
+          for (int j = 0; j < count; j++) output[j] = registers[j];
+          matched = true;
+          // Threads of lower priority can no longer produce the match.
+          break;
+        }
+        ASSERT(instruction[0] == CONSUME);
+        if (position < subject_.length() &&
+            InRanges(subject_[position], instruction[1], instruction[2])) {
+          AddThread(&next, current.pcs[i] + 1, position + 1, registers);
+        }
+      }
+      ThreadList swap = current;
+      current = next;
+      next = swap;
+      if (position >= subject_.length()) break;
+    }
+    return matched;
+  }
+
+ private:
+  struct ThreadList {
+    int* pcs;
+    int* registers;
+    int count;
+  };
+
+  // Entries of the stack used to follow the instructions that don't consume
+  // characters.
+  static const int kExplore = 0;
+  static const int kRestore = 1;
+
+  bool InRanges(Char c, int start, int count) {
+    const int32_t* ranges = code_ + start;
+    int low = 0;
+    int high = count - 1;
+    while (low <= high) {
+      int mid = (low + high) >> 1;
+      if (c < ranges[mid * 2]) {
+        high = mid - 1;
+      } else if (c > ranges[mid * 2 + 1]) {
+        low = mid + 1;
+      } else {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static bool IsLineTerminator(uc16 c) {
+    return !IsRegExpNewline(c);
+  }
+
+  bool IsWordAt(int position) {
+    return position >= 0 && position < subject_.length() &&
+           IsRegExpWord(static_cast<uc16>(subject_[position]));
+  }
+
+  bool CheckAssertion(int type, int position) {
+    switch (static_cast<RegExpAssertion::AssertionType>(type)) {
+      case RegExpAssertion::START_OF_INPUT:
+        return position == 0;
+      case RegExpAssertion::END_OF_INPUT:
+        return position == subject_.length();
+      case RegExpAssertion::START_OF_LINE:
+        return position == 0 || IsLineTerminator(subject_[position - 1]);
+      case RegExpAssertion::END_OF_LINE:
+        return position == subject_.length() ||
+               IsLineTerminator(subject_[position]);
+      case RegExpAssertion::BOUNDARY:
+        return IsWordAt(position - 1) != IsWordAt(position);
+      case RegExpAssertion::NON_BOUNDARY:
+        return IsWordAt(position - 1) == IsWordAt(position);
+    }
+    UNREACHABLE();
+    return false;
+  }
+
+  void Push(int kind, int a, int b) {
+    stack_.Add(kind);
+    stack_.Add(a);
+    stack_.Add(b);
+  }
+
+  // Follows all instructions that don't consume characters from pc, and
+  // adds the threads reached to the list. Every instruction is visited at
+  // most once per position, which bounds the work per character. The
+  // registers are modified while following instructions, and restored
+  // before returning.
+  void AddThread(ThreadList* list, int start_pc, int position,
+                 int* registers) {
+    ASSERT(stack_.is_empty());
+    Push(kExplore, start_pc, 0);
+    while (!stack_.is_empty()) {
+      int b = stack_.RemoveLast();
+      int a = stack_.RemoveLast();
+      if (stack_.RemoveLast() == kRestore) {
+        registers[a] = b;
+        continue;
+      }
+      int pc = a;
+      while (true) {
+        const int32_t* instruction = code_ + pc * kInstructionSize;
+        // Whether a progress check fails depends on the thread, so it must
+        // not prevent other threads from passing it.
+        if (instruction[0] != CHECK_PROGRESS) {
+          if (visited_[pc] == position) break;
+          visited_[pc] = position;
+        }
+        switch (instruction[0]) {
+          case JMP:
+            pc = instruction[1];
+            continue;
+          case SPLIT:
+            Push(kExplore, instruction[2], 0);
+            pc = instruction[1];
+            continue;
+          case SAVE:
+            Push(kRestore, instruction[1], registers[instruction[1]]);
+            registers[instruction[1]] = position;
+            pc++;
+            continue;
+          case CLEAR:
+            for (int i = instruction[1]; i <= instruction[2]; i++) {
+              if (registers[i] == -1) continue;
+              Push(kRestore, i, registers[i]);
+              registers[i] = -1;
+            }
+            pc++;
+            continue;
+          case ASSERTION:
+            if (!CheckAssertion(instruction[1], position)) break;
+            pc++;
+            continue;
+          case CHECK_PROGRESS:
+            if (registers[instruction[1]] == position) break;
+            pc++;
+            continue;
+          case CONSUME:
+          case MATCH: {
+            int* thread_registers =
+                list->registers + list->count * register_count_;
+            for (int i = 0; i < register_count_; i++) {
+              thread_registers[i] = registers[i];
+            }
+            list->pcs[list->count++] = pc;
+            break;
+          }
+          default:
+            UNREACHABLE();
+        }
+        break;
+      }
+    }
+  }
+
+  const int32_t* code_;
+  int instruction_count_;
+  int register_count_;
+  int capture_register_count_;
+  Vector<const Char> subject_;
+  // The last position at which each instruction was visited.
+  ScopedVector<int> visited_;
+  ScopedVector<int> current_pcs_;
+  ScopedVector<int> current_registers_;
+  ScopedVector<int> next_pcs_;
+  ScopedVector<int> next_registers_;
+  ScopedVector<int> start_registers_;
+  List<int> stack_;
+};
+
+
+RegExpImpl::IrregexpResult LinearRegExp::Match(Handle<ByteArray> program,
+                                               Handle<String> subject,
+                                               int index,
+                                               int32_t* output,
+                                               int output_size) {
+  ASSERT(subject->IsFlat());
+  ASSERT(index >= 0 && index <= subject->length());
+  DisallowHeapAllocation no_gc;
+  const int32_t* code =
+      reinterpret_cast<const int32_t*>(program->GetDataStartAddress());
+  String::FlatContent content = subject->GetFlatContent();
+  bool matched;
+  if (content.IsAscii()) {
+    LinearMatcher<uint8_t> matcher(code, content.ToOneByteVector());
+    matched = matcher.Match(index, output, output_size);
+  } else {
+    LinearMatcher<uc16> matcher(code, content.ToUC16Vector());
+    matched = matcher.Match(index, output, output_size);
+  }
+  return matched ? RegExpImpl::RE_SUCCESS : RegExpImpl::RE_FAILURE;
+}
+
+} }  // namespace v8::internal
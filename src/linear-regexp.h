@@ -0,0 +1,45 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A regexp engine whose matching time is linear in the length of the subject.
+
+#ifndef V8_LINEAR_REGEXP_H_
+#define V8_LINEAR_REGEXP_H_
+
+#include "src/jsregexp.h"
+
+namespace v8 {
+namespace internal {
+
+// Runs regexps as a Pike VM: the regexp is compiled to a nondeterministic
+// automaton, and all of its threads advance through the subject in lock
+// step, so no position is ever examined twice by the same state. Regexps
+// containing back references or lookaheads cannot be expressed this way,
+// and neither can regexps whose automaton would be too large (e.g. because
+// of nested counted repetitions).
+class LinearRegExp : public AllStatic {
+ public:
+  // Compiles the parsed regexp to a program for Match. Returns an empty
+  // handle if the regexp cannot run on the linear engine.
+  static MaybeHandle<ByteArray> Compile(Isolate* isolate,
+                                        RegExpCompileData* data,
+                                        bool ignore_case,
+                                        Zone* zone);
+
+  // Searches the subject for a match starting at or after index. On success
+  // the capture registers are written to output, which must have room for
+  // (capture count + 1) * 2 registers.
+  static RegExpImpl::IrregexpResult Match(Handle<ByteArray> program,
+                                          Handle<String> subject,
+                                          int index,
+                                          int32_t* output,
+                                          int output_size);
+
+  // The automaton of larger regexps is too expensive to run.
+  static const int kMaxInstructions = 10000;
+};
+
+} }  // namespace v8::internal
+
+#endif  // V8_LINEAR_REGEXP_H_
@@ -213,6 +213,21 @@ void LCodeGenBase::RegisterWeakObjectsInOptimizedCode(Handle<Code> code) {
 }
 
 
+void LCodeGenBase::RecordCatchHandler(int index) {
+  if (handler_table_.is_null()) {
+    handler_table_ = factory()->NewFixedArray(
+        info()->function()->handler_count(), TENURED);
+  }
+  handler_table_->set(index, Smi::FromInt(masm()->pc_offset()));
+}
+
+
+void LCodeGenBase::PopulateHandlerTable(Handle<Code> code) {
+  if (handler_table_.is_null()) return;
+  code->set_handler_table(*handler_table_);
+}
+
+
 void LCodeGenBase::Abort(BailoutReason reason) {
   info()->set_bailout_reason(reason);
   status_ = ABORTED;
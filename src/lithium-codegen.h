@@ -45,6 +45,11 @@ class LCodeGenBase BASE_EMBEDDED {
 
   void RegisterWeakObjectsInOptimizedCode(Handle<Code> code);
 
+  // Catch handlers of try/catch statements in optimized code. The handler
+  // table maps the handler index of the statement to the code offset.
+  void RecordCatchHandler(int index);
+  void PopulateHandlerTable(Handle<Code> code);
+
   // Check that an environment assigned via AssignEnvironment is actually being
   // used. Redundant assignments keep things alive longer than necessary, and
   // consequently lead to worse code, so it's important to minimize this.
@@ -67,6 +72,7 @@ class LCodeGenBase BASE_EMBEDDED {
   int current_instruction_;
   const ZoneList<LInstruction*>* instructions_;
   int last_lazy_deopt_pc_;
+  Handle<FixedArray> handler_table_;
 
   bool is_unused() const { return status_ == UNUSED; }
   bool is_generating() const { return status_ == GENERATING; }
@@ -446,6 +446,7 @@ Handle<Code> LChunk::Codegen() {
     Handle<Code> code =
         CodeGenerator::MakeCodeEpilogue(&assembler, flags, info());
     generator.FinishCode(code);
+    generator.PopulateHandlerTable(code);
     CommitDependencies(code);
     code->set_is_crankshafted(true);
     void* jit_handler_data =
@@ -542,6 +543,45 @@ LEnvironment* LChunkBuilderBase::CreateEnvironment(
 }
 
 
+LEnvironment* LChunkBuilderBase::CreateCatchEnvironment(
+    HEnvironment* hydrogen_env,
+    BailoutId handler_id,
+    LChunk* chunk,
+    LOperand* exception) {
+  // The exception handler is entered from anywhere in the try block with the
+  // exception in a register, so the parameters are taken from their incoming
+  // stack slots. Variables that are live in the catch block or after it live
+  // in the context; the remaining stack locals are dead and get undefined.
+  ASSERT(hydrogen_env->outer() == NULL);
+  int parameter_count = hydrogen_env->parameter_count();
+  int local_count = hydrogen_env->local_count();
+  LEnvironment* result =
+      new(zone()) LEnvironment(hydrogen_env->closure(),
+                               JS_FUNCTION,
+                               handler_id,
+                               parameter_count,
+                               0,
+                               parameter_count + local_count + 1,
+                               NULL,
+                               NULL,
+                               zone());
+  for (int i = 0; i < parameter_count; ++i) {
+    LOperand* op =
+        LStackSlot::Create(chunk->GetParameterStackSlot(i), zone());
+    result->AddValue(op, Representation::Tagged(), false);
+  }
+  if (local_count > 0) {
+    LOperand* undefined =
+        chunk->DefineConstantOperand(chunk->graph()->GetConstantUndefined());
+    for (int i = 0; i < local_count; ++i) {
+      result->AddValue(undefined, Representation::Tagged(), false);
+    }
+  }
+  result->AddValue(exception, Representation::Tagged(), false);
+  return result;
+}
+
+
 // Add an object to the supplied environment and object materialization list.
 //
 // Notes:
@@ -304,8 +304,8 @@ template<LOperand::Kind kOperandKind, int kNumCachedOperands>
 class LSubKindOperand V8_FINAL : public LOperand {
  public:
   static LSubKindOperand* Create(int index, Zone* zone) {
-    ASSERT(index >= 0);
-    if (index < kNumCachedOperands) return &cache[index];
+    // Stack slots of incoming parameters have negative indices.
+    if (index >= 0 && index < kNumCachedOperands) return &cache[index];
     return new(zone) LSubKindOperand(index);
   }
 
@@ -715,6 +715,12 @@ class LChunkBuilderBase BASE_EMBEDDED {
   void AddObjectToMaterialize(HValue* value,
                               ZoneList<HValue*>* objects_to_materialize,
                               LEnvironment* result);
+  // The environment at the entry of a catch handler consists of the
+  // parameters and the exception in |exception|, see LCodeGen::DoEnterTry.
+  LEnvironment* CreateCatchEnvironment(HEnvironment* hydrogen_env,
+                                       BailoutId handler_id,
+                                       LChunk* chunk,
+                                       LOperand* exception);
 
   Zone* zone() const { return zone_; }
 
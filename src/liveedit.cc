@@ -1486,6 +1486,8 @@ Handle<Object> LiveEdit::ChangeScriptSource(Handle<Script> original_script,
 
   // Drop line ends so that they will be recalculated.
   original_script->set_line_ends(isolate->heap()->undefined_value());
+  // The function boundaries of the old source are no longer valid.
+  original_script->set_preparse_data(isolate->heap()->undefined_value());
 
   return old_script_object;
 }
@@ -1483,6 +1483,27 @@ void Logger::CodeDisableOptEvent(Code* code,
 }
 
 
+void Logger::DeoptSiteEvent(SharedFunctionInfo* shared,
+                            int ast_id,
+                            const char* bailout_type,
+                            int count,
+                            const char* reason) {
+  if (!FLAG_log_deopt || !log_->IsEnabled()) return;
+  Log::MessageBuilder msg(log_);
+  SmartArrayPointer<char> name =
+      shared->DebugName()->ToCString(DISALLOW_NULLS, ROBUST_STRING_TRAVERSAL);
+  int script_id = shared->script()->IsScript()
+      ? Script::cast(shared->script())->id()->value()
+      : -1;
+  msg.Append("deopt-site,\"%s\",%d,%d,%d,%s,%d,",
+             name.get(), script_id, shared->start_position(), ast_id,
+             bailout_type, count);
+  msg.AppendDoubleQuotedString(reason != NULL ? reason : "");
+  msg.Append('\n');
+  msg.WriteToLogFile();
+}
+
+
 void Logger::CodeMovingGCEvent() {
   PROFILER_LOG(CodeMovingGCEvent());
 
@@ -246,6 +246,13 @@ class Logger {
   void CodeCreateEvent(LogEventsAndTags tag, Code* code, int args_count);
   // Emits a code deoptimization event.
   void CodeDisableOptEvent(Code* code, SharedFunctionInfo* shared);
+  // Emits an event for a deoptimization at the given site, logged by
+  // --log-deopt.
+  void DeoptSiteEvent(SharedFunctionInfo* shared,
+                      int ast_id,
+                      const char* bailout_type,
+                      int count,
+                      const char* reason);
   void CodeMovingGCEvent();
   // Emits a code create event for a RegExp.
   void RegExpCodeCreateEvent(Code* code, String* source);
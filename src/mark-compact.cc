@@ -42,6 +42,7 @@ MarkCompactCollector::MarkCompactCollector(Heap* heap) :  // NOLINT
       sweep_precisely_(false),
       reduce_memory_footprint_(false),
       abort_incremental_marking_(false),
+      flush_code_aggressively_(false),
       marking_parity_(ODD_MARKING_PARITY),
       compacting_(false),
       was_marked_incrementally_(false),
@@ -977,6 +978,10 @@ void MarkCompactCollector::Prepare(GCTracer* tracer) {
     StartCompaction(NON_INCREMENTAL_COMPACTION);
   }
 
+  // Functions visited by incremental marking were judged by the pressure at
+  // the start of marking, the rest is judged by the current pressure.
+  UpdateCodeFlushingPressure();
+
   PagedSpaces spaces(heap());
   for (PagedSpace* space = spaces.next();
        space != NULL;
@@ -1058,8 +1063,10 @@ void CodeFlusher::ProcessJSFunctionCandidates() {
       if (FLAG_trace_code_flushing && shared->is_compiled()) {
         PrintF("[code-flushing clears: ");
         shared->ShortPrint();
-        PrintF(" - age: %d]\n", code->GetAge());
+        PrintF(" - age: %d, flushed before: %d]\n",
+               code->GetAge(), shared->flush_count());
       }
+      shared->increment_flush_count();
       shared->set_code(lazy_compile);
       candidate->set_code(lazy_compile);
     } else {
@@ -1101,8 +1108,10 @@ void CodeFlusher::ProcessSharedFunctionInfoCandidates() {
       if (FLAG_trace_code_flushing && candidate->is_compiled()) {
         PrintF("[code-flushing clears: ");
         candidate->ShortPrint();
-        PrintF(" - age: %d]\n", code->GetAge());
+        PrintF(" - age: %d, flushed before: %d]\n",
+               code->GetAge(), candidate->flush_count());
       }
+      candidate->increment_flush_count();
       candidate->set_code(lazy_compile);
     }
 
@@ -4272,6 +4281,14 @@ void MarkCompactCollector::ParallelSweepSpacesComplete() {
 }
 
 
+void MarkCompactCollector::UpdateCodeFlushingPressure() {
+  intptr_t limit = heap()->MaxOldGenerationSize() / 100 *
+      FLAG_code_flushing_pressure_percent;
+  flush_code_aggressively_ =
+      reduce_memory_footprint_ || heap()->PromotedTotalSize() >= limit;
+}
+
+
 void MarkCompactCollector::EnableCodeFlushing(bool enable) {
   if (isolate()->debug()->is_loaded() ||
       isolate()->debug()->has_break_points()) {
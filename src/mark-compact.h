@@ -569,6 +569,12 @@ class MarkCompactCollector {
   inline bool is_code_flushing_enabled() const { return code_flusher_ != NULL; }
   void EnableCodeFlushing(bool enable);
 
+  // Whether code flushing reclaims memory aggressively in the current
+  // marking cycle, because the embedder signalled low memory or the old
+  // generation is close to its maximum size.
+  bool flush_code_aggressively() const { return flush_code_aggressively_; }
+  void UpdateCodeFlushingPressure();
+
   enum SweeperType {
     CONSERVATIVE,
     PARALLEL_CONSERVATIVE,
@@ -724,6 +730,8 @@ class MarkCompactCollector {
 
   bool abort_incremental_marking_;
 
+  bool flush_code_aggressively_;
+
   MarkingParity marking_parity_;
 
   // True if we are collecting slots to perform evacuation from evacuation
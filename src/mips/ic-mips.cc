@@ -316,6 +316,31 @@ static void GenerateKeyNameCheck(MacroAssembler* masm,
 }
 
 
+// Replaces the non-internalized string in |key| with the equal string from
+// the string table. Jumps to |not_found| with |key| unchanged if there is no
+// such string or the key is an array index. The lookup does not allocate,
+// so it is done in C without entering the runtime. |scratch| is clobbered.
+static void GenerateTryInternalizeKey(MacroAssembler* masm,
+                                      Register key,
+                                      Register scratch,
+                                      Label* not_found) {
+  ASSERT(!key.is(scratch));
+  RegList saved_regs = (kJSCallerSaved | ra.bit()) & ~scratch.bit();
+  __ MultiPush(saved_regs);
+  __ PrepareCallCFunction(1, scratch);
+  __ mov(a0, key);
+  {
+    AllowExternalCallThatCantCauseGC scope(masm);
+    __ CallCFunction(
+        ExternalReference::try_internalize_string_function(masm->isolate()), 1);
+  }
+  __ mov(scratch, v0);
+  __ MultiPop(saved_regs);
+  __ JumpIfSmi(scratch, not_found);
+  __ mov(key, scratch);
+}
+
+
 void LoadIC::GenerateMegamorphic(MacroAssembler* masm) {
   // The return address is in lr.
   Register receiver = ReceiverRegister();
@@ -574,7 +599,7 @@ void KeyedLoadIC::GenerateRuntimeGetProperty(MacroAssembler* masm) {
 void KeyedLoadIC::GenerateGeneric(MacroAssembler* masm) {
   // The return address is in ra.
   Label slow, check_name, index_smi, index_name, property_array_property;
-  Label probe_dictionary, check_number_dictionary;
+  Label probe_dictionary, check_number_dictionary, not_unique;
 
   Register key = NameRegister();
   Register receiver = ReceiverRegister();
@@ -622,7 +647,7 @@ void KeyedLoadIC::GenerateGeneric(MacroAssembler* masm) {
   GenerateRuntimeGetProperty(masm);
 
   __ bind(&check_name);
-  GenerateKeyNameCheck(masm, key, a0, a3, &index_name, &slow);
+  GenerateKeyNameCheck(masm, key, a0, a3, &index_name, &not_unique);
 
   GenerateKeyedLoadReceiverCheck(
        masm, receiver, a0, a3, Map::kHasNamedInterceptor, &slow);
@@ -738,6 +763,14 @@ void KeyedLoadIC::GenerateGeneric(MacroAssembler* masm) {
   __ IndexFromHash(a3, key);
   // Now jump to the place where smi keys are handled.
   __ Branch(&index_smi);
+
+  // A string key that is not internalized can still be looked up by the
+  // stub if the string table holds an equal string. a3 holds the key
+  // instance type.
+  __ bind(&not_unique);
+  __ Branch(&slow, hs, a3, Operand(FIRST_NONSTRING_TYPE));
+  GenerateTryInternalizeKey(masm, key, t0, &slow);
+  __ Branch(&check_name);
 }
 
 
@@ -972,6 +1005,7 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   Label slow, fast_object, fast_object_grow;
   Label fast_double, fast_double_grow;
   Label array, extra, check_if_double_array;
+  Label maybe_name_key, unique_name_key, not_unique;
 
   // Register usage.
   Register value = a0;
@@ -982,8 +1016,6 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   Register elements = t3;  // Elements array of the receiver.
   // t0 and t1 are used as general scratch registers.
 
-  // Check that the key is a smi.
-  __ JumpIfNotSmi(key, &slow);
   // Check that the object isn't a smi.
   __ JumpIfSmi(receiver, &slow);
   // Get the map of the object.
@@ -994,6 +1026,8 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   __ And(t0, t0, Operand(1 << Map::kIsAccessCheckNeeded |
                          1 << Map::kIsObserved));
   __ Branch(&slow, ne, t0, Operand(zero_reg));
+  // Check that the key is a smi.
+  __ JumpIfNotSmi(key, &maybe_name_key);
   // Check if the object is a JS array or not.
   __ lbu(t0, FieldMemOperand(receiver_map, Map::kInstanceTypeOffset));
   __ Branch(&array, eq, t0, Operand(JS_ARRAY_TYPE));
@@ -1053,6 +1087,23 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
                                   &slow, kDontCheckMap, kIncrementLength,
                                   value, key, receiver, receiver_map,
                                   elements_map, elements);
+
+  // Name key case: store to an existing writable data property of an object
+  // with dictionary properties without calling the runtime.
+  __ bind(&maybe_name_key);
+  GenerateKeyNameCheck(masm, key, t0, t1, &slow, &not_unique);
+  __ bind(&unique_name_key);
+  GenerateNameDictionaryReceiverCheck(masm, receiver, a3, t0, t1, &slow);
+  GenerateDictionaryStore(masm, &slow, a3, key, value, t0, t1);
+  __ IncrementCounter(masm->isolate()->counters()->keyed_store_generic_dict(),
+                      1, t0, t1);
+  __ Ret();
+
+  // t1: key instance type
+  __ bind(&not_unique);
+  __ Branch(&slow, hs, t1, Operand(FIRST_NONSTRING_TYPE));
+  GenerateTryInternalizeKey(masm, key, t0, &slow);
+  __ Branch(&unique_name_key);
 }
 
 
@@ -5650,6 +5650,42 @@ void LCodeGen::DoDeoptimize(LDeoptimize* instr) {
 }
 
 
+void LCodeGen::DoEnterTry(LEnterTry* instr) {
+  class DeferredCatchHandler V8_FINAL : public LDeferredCode {
+   public:
+    DeferredCatchHandler(LCodeGen* codegen, LEnterTry* instr)
+        : LDeferredCode(codegen), instr_(instr) { }
+    virtual void Generate() V8_OVERRIDE {
+      codegen()->DoDeferredCatchHandler(instr_);
+    }
+    virtual LInstruction* instr() V8_OVERRIDE { return instr_; }
+   private:
+    LEnterTry* instr_;
+  };
+
+  ASSERT(ToRegister(instr->context()).is(cp));
+  DeferredCatchHandler* deferred =
+      new(zone()) DeferredCatchHandler(this, instr);
+  __ PushTryHandler(StackHandler::CATCH, instr->hydrogen()->handler_index());
+  __ bind(deferred->exit());
+}
+
+
+void LCodeGen::DoDeferredCatchHandler(LEnterTry* instr) {
+  // The exception is in v0 and the handler has been unlinked. The optimized
+  // code stays valid, so the frame is replaced lazily by the unoptimized
+  // code's catch handler entry.
+  RecordCatchHandler(instr->hydrogen()->handler_index());
+  Comment(";;; catch handler");
+  DeoptimizeIf(al, instr->catch_environment(), Deoptimizer::LAZY);
+}
+
+
+void LCodeGen::DoLeaveTry(LLeaveTry* instr) {
+  __ PopTryHandler();
+}
+
+
 void LCodeGen::DoDummy(LDummy* instr) {
   // Nothing to see here, move on!
 }
@@ -85,6 +85,9 @@ static void ProbeTable(Isolate* isolate,
     }
 #endif
 
+  __ IncrementCounter(isolate->stub_cache()->hit_counter(flags, table), 1,
+                      flags_reg, offset_scratch);
+
   // Jump to the first instruction in the code stub.
   __ Addu(at, code, Operand(Code::kHeaderSize - kHeapObjectTag));
   __ Jump(at);
@@ -189,16 +192,25 @@ void StubCache::GenerateProbe(MacroAssembler* masm,
   // Check that the receiver isn't a smi.
   __ JumpIfSmi(receiver, &miss);
 
+  // The table sizes are only known at runtime, so the masks are loaded. They
+  // are scaled by the heap object tag size, like the x86 offsets.
+  ExternalReference primary_mask(mask_reference(kPrimary));
+  ExternalReference secondary_mask(mask_reference(kSecondary));
+
   // Get the map of the receiver and compute the hash.
   __ lw(scratch, FieldMemOperand(name, Name::kHashFieldOffset));
   __ lw(at, FieldMemOperand(receiver, HeapObject::kMapOffset));
   __ Addu(scratch, scratch, at);
-  uint32_t mask = kPrimaryTableSize - 1;
+  // The table masks applied below are never wider than this.
+  uint32_t max_mask = (1 << kMaxTableBits) - 1;
   // We shift out the last two bits because they are not part of the hash and
   // they are always 01 for maps.
   __ srl(scratch, scratch, kHeapObjectTagSize);
-  __ Xor(scratch, scratch, Operand((flags >> kHeapObjectTagSize) & mask));
-  __ And(scratch, scratch, Operand(mask));
+  __ Xor(scratch, scratch, Operand((flags >> kHeapObjectTagSize) & max_mask));
+  __ li(extra, Operand(primary_mask));
+  __ lw(extra, MemOperand(extra));
+  __ srl(extra, extra, kHeapObjectTagSize);
+  __ And(scratch, scratch, Operand(extra));
 
   // Probe the primary table.
   ProbeTable(isolate,
@@ -215,9 +227,11 @@ void StubCache::GenerateProbe(MacroAssembler* masm,
   // Primary miss: Compute hash for secondary probe.
   __ srl(at, name, kHeapObjectTagSize);
   __ Subu(scratch, scratch, at);
-  uint32_t mask2 = kSecondaryTableSize - 1;
-  __ Addu(scratch, scratch, Operand((flags >> kHeapObjectTagSize) & mask2));
-  __ And(scratch, scratch, Operand(mask2));
+  __ Addu(scratch, scratch, Operand((flags >> kHeapObjectTagSize) & max_mask));
+  __ li(extra, Operand(secondary_mask));
+  __ lw(extra, MemOperand(extra));
+  __ srl(extra, extra, kHeapObjectTagSize);
+  __ And(scratch, scratch, Operand(extra));
 
   // Probe the secondary table.
   ProbeTable(isolate,
@@ -236,6 +250,7 @@ void StubCache::GenerateProbe(MacroAssembler* masm,
   __ bind(&miss);
   __ IncrementCounter(counters->megamorphic_stub_cache_misses(), 1,
                       extra2, extra3);
+  __ IncrementCounter(miss_counter(flags), 1, extra2, extra3);
 }
 
 
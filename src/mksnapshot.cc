@@ -315,6 +315,45 @@ void DumpException(Handle<Message> message) {
 }
 
 
+void RunFile(Isolate* isolate, const char* name) {
+  FILE* file = base::OS::FOpen(name, "rb");
+  if (file == NULL) {
+    fprintf(stderr, "Failed to open '%s': errno %d\n", name, errno);
+    exit(1);
+  }
+
+  fseek(file, 0, SEEK_END);
+  int size = ftell(file);
+  rewind(file);
+
+  char* chars = new char[size + 1];
+  chars[size] = '\0';
+  for (int i = 0; i < size;) {
+    int read = static_cast<int>(fread(&chars[i], 1, size - i, file));
+    if (read < 0) {
+      fprintf(stderr, "Failed to read '%s': errno %d\n", name, errno);
+      exit(1);
+    }
+    i += read;
+  }
+  fclose(file);
+  Local<String> source = String::NewFromUtf8(isolate, chars);
+  TryCatch try_catch;
+  Local<Script> script = Script::Compile(source);
+  if (try_catch.HasCaught()) {
+    fprintf(stderr, "Failure compiling '%s'\n", name);
+    DumpException(try_catch.Message());
+    exit(1);
+  }
+  script->Run();
+  if (try_catch.HasCaught()) {
+    fprintf(stderr, "Failure running '%s'\n", name);
+    DumpException(try_catch.Message());
+    exit(1);
+  }
+}
+
+
 int main(int argc, char** argv) {
   V8::InitializeICU();
   i::Isolate::SetCrashIfDefaultIsolateInitialized();
@@ -340,6 +379,12 @@ int main(int argc, char** argv) {
   }
 #endif
   i::FLAG_logfile_per_isolate = false;
+  // Heap numbers are shared by all contexts created from the snapshot, so
+  // the objects created by the extra code must not keep doubles in mutable
+  // heap numbers (see NoTrackDoubleFieldsForSerializerScope).
+  if (i::FLAG_extra_code != NULL) {
+    i::FLAG_track_double_fields = false;
+  }
 
   Isolate* isolate = v8::Isolate::New();
   { Isolate::Scope isolate_scope(isolate);
@@ -362,42 +407,10 @@ int main(int argc, char** argv) {
       V8::SetCaptureStackTraceForUncaughtExceptions(true, 100);
       HandleScope scope(isolate);
       v8::Context::Scope cscope(v8::Local<v8::Context>::New(isolate, context));
-      const char* name = i::FLAG_extra_code;
-      FILE* file = base::OS::FOpen(name, "rb");
-      if (file == NULL) {
-        fprintf(stderr, "Failed to open '%s': errno %d\n", name, errno);
-        exit(1);
-      }
-
-      fseek(file, 0, SEEK_END);
-      int size = ftell(file);
-      rewind(file);
-
-      char* chars = new char[size + 1];
-      chars[size] = '\0';
-      for (int i = 0; i < size;) {
-        int read = static_cast<int>(fread(&chars[i], 1, size - i, file));
-        if (read < 0) {
-          fprintf(stderr, "Failed to read '%s': errno %d\n", name, errno);
-          exit(1);
-        }
-        i += read;
-      }
-      fclose(file);
-      Local<String> source = String::NewFromUtf8(isolate, chars);
-      TryCatch try_catch;
-      Local<Script> script = Script::Compile(source);
-      if (try_catch.HasCaught()) {
-        fprintf(stderr, "Failure compiling '%s'\n", name);
-        DumpException(try_catch.Message());
-        exit(1);
-      }
-      script->Run();
-      if (try_catch.HasCaught()) {
-        fprintf(stderr, "Failure running '%s'\n", name);
-        DumpException(try_catch.Message());
-        exit(1);
-      }
+      // The functions run by the extra code are compiled now and their code
+      // is serialized with them, instead of being compiled lazily in every
+      // isolate created from the snapshot.
+      RunFile(isolate, i::FLAG_extra_code);
     }
     // Make sure all builtin scripts are cached.
     { HandleScope scope(isolate);
@@ -767,6 +767,14 @@ void JSRegExp::JSRegExpVerify() {
 
       CHECK(arr->get(JSRegExp::kIrregexpCaptureCountIndex)->IsSmi());
       CHECK(arr->get(JSRegExp::kIrregexpMaxRegisterCountIndex)->IsSmi());
+
+      Object* ascii_bytecode = arr->get(JSRegExp::kIrregexpASCIIBytecodeIndex);
+      CHECK(ascii_bytecode->IsSmi() || ascii_bytecode->IsByteArray());
+      Object* uc16_bytecode = arr->get(JSRegExp::kIrregexpUC16BytecodeIndex);
+      CHECK(uc16_bytecode->IsSmi() || uc16_bytecode->IsByteArray());
+      CHECK(arr->get(JSRegExp::kIrregexpTicksUntilTierUpIndex)->IsSmi());
+      Object* linear_program = arr->get(JSRegExp::kIrregexpLinearProgramIndex);
+      CHECK(linear_program->IsSmi() || linear_program->IsByteArray());
       break;
     }
     default:
@@ -973,6 +981,7 @@ void Script::ScriptVerify() {
   type()->SmiVerify();
   VerifyPointer(line_ends());
   VerifyPointer(id());
+  VerifyPointer(preparse_data());
 }
 
 
@@ -499,6 +499,7 @@ class SequentialStringKey : public HashTableKey {
       : string_(string), hash_field_(0), seed_(seed) { }
 
   virtual uint32_t Hash() V8_OVERRIDE {
+    if (hash_field_ != 0) return hash_field_ >> String::kHashShift;
     hash_field_ = StringHasher::HashSequentialString<Char>(string_.start(),
                                                            string_.length(),
                                                            seed_);
@@ -536,7 +537,7 @@ template<class Char>
 class SubStringKey : public HashTableKey {
  public:
   SubStringKey(Handle<String> string, int from, int length)
-      : string_(string), from_(from), length_(length) {
+      : string_(string), from_(from), length_(length), hash_field_(0) {
     if (string_->IsSlicedString()) {
       string_ = Handle<String>(Unslice(*string_, &from_));
     }
@@ -544,6 +545,7 @@ class SubStringKey : public HashTableKey {
   }
 
   virtual uint32_t Hash() V8_OVERRIDE {
+    if (hash_field_ != 0) return hash_field_ >> String::kHashShift;
     ASSERT(length_ >= 0);
     ASSERT(from_ + length_ <= string_->length());
     const Char* chars = GetChars() + from_;
@@ -5258,6 +5260,7 @@ ACCESSORS(Script, context_data, Object, kContextOffset)
 ACCESSORS(Script, wrapper, Foreign, kWrapperOffset)
 ACCESSORS_TO_SMI(Script, type, kTypeOffset)
 ACCESSORS(Script, line_ends, Object, kLineEndsOffset)
+ACCESSORS(Script, preparse_data, Object, kPreparseDataOffset)
 ACCESSORS(Script, eval_from_shared, Object, kEvalFromSharedOffset)
 ACCESSORS_TO_SMI(Script, eval_from_instructions_offset,
                  kEvalFrominstructionsOffsetOffset)
@@ -5612,6 +5615,19 @@ void SharedFunctionInfo::set_opt_reenable_tries(int tries) {
 }
 
 
+int SharedFunctionInfo::flush_count() {
+  return FlushCountBits::decode(counters());
+}
+
+
+void SharedFunctionInfo::increment_flush_count() {
+  int value = counters();
+  int flush_count = FlushCountBits::decode(value);
+  if (flush_count == FlushCountBits::kMax) return;
+  set_counters(FlushCountBits::update(value, flush_count + 1));
+}
+
+
 int SharedFunctionInfo::opt_count() {
   return OptCountBits::decode(opt_count_and_bailout_reason());
 }
@@ -6432,10 +6448,21 @@ inline void StringHasher::AddCharacters(const Char* chars, int length) {
       }
     }
   }
+  ASSERT(i == length || !is_array_index_);
+  // Keep the running hash in a local, since the compiler cannot tell that
+  // one-byte character loads do not alias the field. Four characters are
+  // added per iteration to cut the loop overhead.
+  uint32_t running_hash = raw_running_hash_;
+  for (; i + 4 <= length; i += 4) {
+    running_hash = AddCharacterCore(running_hash, chars[i]);
+    running_hash = AddCharacterCore(running_hash, chars[i + 1]);
+    running_hash = AddCharacterCore(running_hash, chars[i + 2]);
+    running_hash = AddCharacterCore(running_hash, chars[i + 3]);
+  }
   for (; i < length; i++) {
-    ASSERT(!is_array_index_);
-    AddCharacter(chars[i]);
+    running_hash = AddCharacterCore(running_hash, chars[i]);
   }
+  raw_running_hash_ = running_hash;
 }
 
 
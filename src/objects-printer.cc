@@ -1194,6 +1194,8 @@ void Script::ScriptPrint(FILE* out) {
   eval_from_shared()->ShortPrint(out);
   PrintF(out, "\n - eval from instructions offset: ");
   eval_from_instructions_offset()->ShortPrint(out);
+  PrintF(out, "\n - preparse data: ");
+  preparse_data()->ShortPrint(out);
   PrintF(out, "\n");
 }
 
@@ -755,7 +755,8 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(
   }
 
   // Check age of optimized code.
-  if (FLAG_age_code && !function->code()->IsOld()) {
+  if (FLAG_age_code &&
+      !IsOldEnoughToFlush(heap, shared_info, function->code())) {
     return false;
   }
 
@@ -813,7 +814,8 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(
   }
 
   // Check age of code. If code aging is disabled we never flush.
-  if (!FLAG_age_code || !shared_info->code()->IsOld()) {
+  if (!FLAG_age_code ||
+      !IsOldEnoughToFlush(heap, shared_info, shared_info->code())) {
     return false;
   }
 
@@ -821,6 +823,23 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(
 }
 
 
+template<typename StaticVisitor>
+bool StaticMarkingVisitor<StaticVisitor>::IsOldEnoughToFlush(
+    Heap* heap, SharedFunctionInfo* shared_info, Code* code) {
+  if (!FLAG_adaptive_code_flushing) return code->IsOld();
+
+  // A function whose code was flushed before was needed again and had to be
+  // recompiled, so flushing it again likely trades memory for another
+  // recompilation. Only do that when memory is tight, and then require the
+  // code to be the longer unused the more often it was flushed before.
+  int flush_count = shared_info->flush_count();
+  if (!heap->mark_compact_collector()->flush_code_aggressively()) {
+    return flush_count == 0 && code->IsOld();
+  }
+  return code->GetAge() > Code::kNoAgeCodeAge + flush_count;
+}
+
+
 template<typename StaticVisitor>
 void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfoStrongCode(
     Heap* heap, HeapObject* object) {
@@ -419,6 +419,9 @@ class StaticMarkingVisitor : public StaticVisitorBase {
   // Code flushing support.
   INLINE(static bool IsFlushable(Heap* heap, JSFunction* function));
   INLINE(static bool IsFlushable(Heap* heap, SharedFunctionInfo* shared_info));
+  INLINE(static bool IsOldEnoughToFlush(Heap* heap,
+                                        SharedFunctionInfo* shared_info,
+                                        Code* code));
 
   // Helpers used by code flushing support that visit pointer fields and treat
   // references to code objects either strongly or weakly.
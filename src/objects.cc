@@ -11164,6 +11164,12 @@ Code* Code::GetCodeAgeStub(Isolate* isolate, Age age, MarkingParity parity) {
 
 
 void Code::PrintDeoptLocation(FILE* out, int bailout_id) {
+  const char* comment = GetDeoptLocationComment(bailout_id);
+  if (comment != NULL) PrintF(out, "            %s\n", comment);
+}
+
+
+const char* Code::GetDeoptLocationComment(int bailout_id) {
   const char* last_comment = NULL;
   int mask = RelocInfo::ModeMask(RelocInfo::COMMENT)
       | RelocInfo::ModeMask(RelocInfo::RUNTIME_ENTRY);
@@ -11177,11 +11183,11 @@ void Code::PrintDeoptLocation(FILE* out, int bailout_id) {
           (bailout_id == Deoptimizer::GetDeoptimizationId(
               GetIsolate(), info->target_address(), Deoptimizer::SOFT))) {
         CHECK(RelocInfo::IsRuntimeEntry(info->rmode()));
-        PrintF(out, "            %s\n", last_comment);
-        return;
+        return last_comment;
       }
     }
   }
+  return NULL;
 }
 
 
@@ -15276,6 +15282,24 @@ MaybeHandle<String> StringTable::LookupStringIfExists(
 }
 
 
+Object* StringTable::LookupStringIfExistsNoAllocate(String* string) {
+  DisallowHeapAllocation no_gc;
+  Isolate* isolate = string->GetIsolate();
+  // Array indices are not stored in property dictionaries.
+  string->Hash();
+  if ((string->hash_field() & Name::kIsNotArrayIndexMask) == 0) {
+    return Smi::FromInt(0);
+  }
+  HandleScope scope(isolate);
+  Handle<String> result;
+  if (!LookupStringIfExists(isolate, handle(string, isolate)).ToHandle(
+          &result)) {
+    return Smi::FromInt(0);
+  }
+  return *result;
+}
+
+
 MaybeHandle<String> StringTable::LookupTwoCharsStringIfExists(
     Isolate* isolate,
     uint16_t c1,
@@ -15301,12 +15325,23 @@ Handle<String> StringTable::LookupString(Isolate* isolate,
 
 
 Handle<String> StringTable::LookupKey(Isolate* isolate, HashTableKey* key) {
+  InternalizationCache* cache = isolate->internalization_cache();
+  uint32_t hash = key->Hash();
+  String* cached = cache->Lookup(key, hash);
+  if (cached != NULL) {
+    isolate->counters()->internalization_cache_hits()->Increment();
+    return handle(cached, isolate);
+  }
+  isolate->counters()->internalization_cache_misses()->Increment();
+
   Handle<StringTable> table = isolate->factory()->string_table();
   int entry = table->FindEntry(key);
 
   // String already in table.
   if (entry != kNotFound) {
-    return handle(String::cast(table->KeyAt(entry)), isolate);
+    String* result = String::cast(table->KeyAt(entry));
+    cache->Update(hash, result);
+    return handle(result, isolate);
   }
 
   // Adding new string. Grow table if needed.
@@ -15319,11 +15354,12 @@ Handle<String> StringTable::LookupKey(Isolate* isolate, HashTableKey* key) {
   CHECK(!string.is_null());
 
   // Add the new string and return it along with the string table.
-  entry = table->FindInsertionEntry(key->Hash());
+  entry = table->FindInsertionEntry(hash);
   table->set(EntryToIndex(entry), *string);
   table->ElementAdded();
 
   isolate->factory()->set_string_table(table);
+  cache->Update(hash, String::cast(*string));
   return Handle<String>::cast(string);
 }
 
@@ -3926,6 +3926,11 @@ class StringTable: public HashTable<StringTable,
       uint16_t c1,
       uint16_t c2);
 
+  // Looks up a string that is equal to the given string without allocating.
+  // Returns the internalized string, or Smi zero if there is none or the
+  // string is an array index. Called from the generic keyed IC stubs.
+  static Object* LookupStringIfExistsNoAllocate(String* string);
+
   DECLARE_CAST(StringTable)
 
  private:
@@ -5792,6 +5797,9 @@ class Code: public HeapObject {
   }
 
   void PrintDeoptLocation(FILE* out, int bailout_id);
+  // Returns the code comment preceding the given deoptimization point, or
+  // NULL if the code was generated without comments.
+  const char* GetDeoptLocationComment(int bailout_id);
   bool CanDeoptAt(Address pc);
 
 #ifdef VERIFY_HEAP
@@ -6910,6 +6918,10 @@ class Script: public Struct {
   // [flags]: Holds an exciting bitfield.
   DECL_ACCESSORS(flags, Smi)
 
+  // [preparse_data]: ByteArray of the FunctionEntry records of the lazy
+  // functions whose bodies the parser skipped, sorted by start position.
+  DECL_ACCESSORS(preparse_data, Object)
+
   // [compilation_type]: how the the script was compiled. Encoded in the
   // 'flags' field.
   inline CompilationType compilation_type();
@@ -6966,7 +6978,8 @@ class Script: public Struct {
       kEvalFromSharedOffset + kPointerSize;
   static const int kFlagsOffset =
       kEvalFrominstructionsOffsetOffset + kPointerSize;
-  static const int kSize = kFlagsOffset + kPointerSize;
+  static const int kPreparseDataOffset = kFlagsOffset + kPointerSize;
+  static const int kSize = kPreparseDataOffset + kPointerSize;
 
  private:
   int GetLineNumberWithArray(int code_pos);
@@ -7289,7 +7302,15 @@ class SharedFunctionInfo: public HeapObject {
 
   inline void TryReenableOptimization();
 
-  // Stores deopt_count, opt_reenable_tries and ic_age as bit-fields.
+  // Number of times the code of the function was flushed, saturating at
+  // FlushCountBits::kMax. Code is only flushed once the function is compiled,
+  // so this also counts how often the function was recompiled after its code
+  // was flushed.
+  inline int flush_count();
+  inline void increment_flush_count();
+
+  // Stores deopt_count, opt_reenable_tries, flush_count and ic_age as
+  // bit-fields.
   inline void set_counters(int value);
   inline int counters() const;
 
@@ -7452,7 +7473,8 @@ class SharedFunctionInfo: public HeapObject {
   };
 
   class DeoptCountBits: public BitField<int, 0, 4> {};
-  class OptReenableTriesBits: public BitField<int, 4, 18> {};
+  class OptReenableTriesBits: public BitField<int, 4, 16> {};
+  class FlushCountBits: public BitField<int, 20, 2> {};
   class ICAgeBits: public BitField<int, 22, 8> {};
 
   class OptCountBits: public BitField<int, 0, 22> {};
@@ -8174,6 +8196,14 @@ class JSRegExp: public JSObject {
     }
   }
 
+  static int bytecode_index(bool is_ascii) {
+    if (is_ascii) {
+      return kIrregexpASCIIBytecodeIndex;
+    } else {
+      return kIrregexpUC16BytecodeIndex;
+    }
+  }
+
   DECLARE_CAST(JSRegExp)
 
   // Dispatched behavior.
@@ -8215,8 +8245,17 @@ class JSRegExp: public JSObject {
   static const int kIrregexpMaxRegisterCountIndex = kDataIndex + 4;
   // Number of captures in the compiled regexp.
   static const int kIrregexpCaptureCountIndex = kDataIndex + 5;
-
-  static const int kIrregexpDataSize = kIrregexpCaptureCountIndex + 1;
+  // Irregexp bytecode for ASCII and UC16 used by --regexp-tier-up in builds
+  // with native regexps, until the regexp has been compiled to native code.
+  static const int kIrregexpASCIIBytecodeIndex = kDataIndex + 6;
+  static const int kIrregexpUC16BytecodeIndex = kDataIndex + 7;
+  // Number of executions left on bytecode before compiling native code.
+  static const int kIrregexpTicksUntilTierUpIndex = kDataIndex + 8;
+  // Program for the linear-time engine, if the regexp runs on it. Holds
+  // kCompilationErrorValue if the regexp cannot be expressed as one.
+  static const int kIrregexpLinearProgramIndex = kDataIndex + 9;
+
+  static const int kIrregexpDataSize = kIrregexpLinearProgramIndex + 1;
 
   // Offsets directly into the data fixed array.
   static const int kDataTagOffset =
@@ -769,6 +769,8 @@ Parser::Parser(CompilationInfo* info)
       cached_data_(NULL),
       cached_data_mode_(NO_CACHED_DATA),
       ast_value_factory_(NULL),
+      skipped_functions_(0, info->zone()),
+      has_preparsed_functions_(false),
       info_(info),
       has_pending_error_(false),
       pending_error_message_(NULL),
@@ -790,6 +792,17 @@ Parser::Parser(CompilationInfo* info)
 }
 
 
+// Prints the zone memory taken by a parse, which is mostly the AST, for
+// --trace-parse.
+static void PrintZoneUsage(unsigned zone_size, int source_length) {
+  PrintF(", %u bytes of zone", zone_size);
+  if (source_length >= KB) {
+    PrintF(" (%0.0f per KB of source)",
+           zone_size / (static_cast<double>(source_length) / KB));
+  }
+}
+
+
 FunctionLiteral* Parser::ParseProgram() {
   // TODO(bmeurer): We temporarily need to pass allow_nesting = true here,
   // see comment for HistogramTimerScope class.
@@ -797,6 +810,7 @@ FunctionLiteral* Parser::ParseProgram() {
   Handle<String> source(String::cast(script_->source()));
   isolate()->counters()->total_parse_size()->Increment(source->length());
   base::ElapsedTimer timer;
+  unsigned zone_start = zone()->allocation_size();
   if (FLAG_trace_parse) {
     timer.Start();
   }
@@ -837,7 +851,9 @@ FunctionLiteral* Parser::ParseProgram() {
     } else {
       PrintF("[parsing script");
     }
-    PrintF(" - took %0.3f ms]\n", ms);
+    PrintF(" - took %0.3f ms", ms);
+    PrintZoneUsage(zone()->allocation_size() - zone_start, source->length());
+    PrintF("]\n");
   }
   if (cached_data_mode_ == PRODUCE_CACHED_DATA) {
     if (result != NULL) {
@@ -846,6 +862,7 @@ FunctionLiteral* Parser::ParseProgram() {
     }
     log_ = NULL;
   }
+  if (result != NULL && has_preparsed_functions_) StoreSkippedFunctions();
   return result;
 }
 
@@ -952,6 +969,7 @@ FunctionLiteral* Parser::ParseLazy() {
   Handle<String> source(String::cast(script_->source()));
   isolate()->counters()->total_parse_size()->Increment(source->length());
   base::ElapsedTimer timer;
+  unsigned zone_start = zone()->allocation_size();
   if (FLAG_trace_parse) {
     timer.Start();
   }
@@ -976,7 +994,10 @@ FunctionLiteral* Parser::ParseLazy() {
   if (FLAG_trace_parse && result != NULL) {
     double ms = timer.Elapsed().InMillisecondsF();
     SmartArrayPointer<char> name_chars = result->debug_name()->ToCString();
-    PrintF("[parsing function: %s - took %0.3f ms]\n", name_chars.get(), ms);
+    PrintF("[parsing function: %s - took %0.3f ms", name_chars.get(), ms);
+    PrintZoneUsage(zone()->allocation_size() - zone_start,
+                   shared_info->end_position() - shared_info->start_position());
+    PrintF("]\n");
   }
   return result;
 }
@@ -1910,6 +1931,26 @@ Statement* Parser::ParseFunctionDeclaration(
 }
 
 
+// The statements of a block, collected on top of those of the enclosing
+// blocks in a buffer they all share. Lists that grow in the zone leave their
+// old backing stores behind, so blocks are allocated at their final size.
+class BlockStatements BASE_EMBEDDED {
+ public:
+  explicit BlockStatements(List<Statement*>* buffer)
+      : buffer_(buffer), start_(buffer->length()) {}
+  ~BlockStatements() { buffer_->Rewind(start_); }
+
+  void Add(Statement* statement) { buffer_->Add(statement); }
+  Vector<Statement*> ToVector() {
+    return buffer_->ToVector().SubVector(start_, buffer_->length());
+  }
+
+ private:
+  List<Statement*>* buffer_;
+  int start_;
+};
+
+
 Block* Parser::ParseBlock(ZoneList<const AstRawString*>* labels, bool* ok) {
   if (allow_harmony_scoping() && strict_mode() == STRICT) {
     return ParseScopedBlock(labels, ok);
@@ -1921,18 +1962,21 @@ Block* Parser::ParseBlock(ZoneList<const AstRawString*>* labels, bool* ok) {
   // Note that a Block does not introduce a new execution scope!
   // (ECMA-262, 3rd, 12.2)
   //
-  // Construct block expecting 16 statements.
+  // The statements are collected first, so that the block is allocated with
+  // room for exactly as many statements as it has.
   Block* result =
-      factory()->NewBlock(labels, 16, false, RelocInfo::kNoPosition);
+      factory()->NewBlock(labels, 0, false, RelocInfo::kNoPosition);
   Target target(&this->target_stack_, result);
   Expect(Token::LBRACE, CHECK_OK);
+  BlockStatements statements(&block_statements_);
   while (peek() != Token::RBRACE) {
     Statement* stat = ParseStatement(NULL, CHECK_OK);
     if (stat && !stat->IsEmpty()) {
-      result->AddStatement(stat, zone());
+      statements.Add(stat);
     }
   }
   Expect(Token::RBRACE, CHECK_OK);
+  result->AddStatements(statements.ToVector(), zone());
   return result;
 }
 
@@ -1944,9 +1988,9 @@ Block* Parser::ParseScopedBlock(ZoneList<const AstRawString*>* labels,
   // Block ::
   //   '{' BlockElement* '}'
 
-  // Construct block expecting 16 statements.
+  // The statements are collected first, as in ParseBlock.
   Block* body =
-      factory()->NewBlock(labels, 16, false, RelocInfo::kNoPosition);
+      factory()->NewBlock(labels, 0, false, RelocInfo::kNoPosition);
   Scope* block_scope = NewScope(scope_, BLOCK_SCOPE);
 
   // Parse the statements and collect escaping labels.
@@ -1956,13 +2000,15 @@ Block* Parser::ParseScopedBlock(ZoneList<const AstRawString*>* labels,
     TargetCollector collector(zone());
     Target target(&this->target_stack_, &collector);
     Target target_body(&this->target_stack_, body);
+    BlockStatements statements(&block_statements_);
 
     while (peek() != Token::RBRACE) {
       Statement* stat = ParseBlockElement(NULL, CHECK_OK);
       if (stat && !stat->IsEmpty()) {
-        body->AddStatement(stat, zone());
+        statements.Add(stat);
       }
     }
+    body->AddStatements(statements.ToVector(), zone());
   }
   Expect(Token::RBRACE, CHECK_OK);
   block_scope->set_end_position(scanner()->location().end_pos);
@@ -2693,6 +2739,15 @@ TryStatement* Parser::ParseTryStatement(bool* ok) {
 
     catch_scope->set_end_position(scanner()->location().end_pos);
     tok = peek();
+
+    // After the exception has been caught, execution continues in the catch
+    // block and may come back around any loop enclosing the statement.
+    int resume_position = pos;
+    for (Target* t = target_stack_; t != NULL; t = t->previous()) {
+      IterationStatement* loop = t->node()->AsIterationStatement();
+      if (loop != NULL) resume_position = Min(resume_position, loop->position());
+    }
+    scope_->DeclarationScope()->RecordTryCatchStatement(resume_position);
   }
 
   Block* finally_block = NULL;
@@ -3522,6 +3577,13 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
 
     // To make this additional case work, both Parser and PreParser implement a
     // logic where only top-level functions will be parsed lazily.
+
+    // Functions in the compile hints of the script are expected to be called
+    // soon, like parenthesized ones, and are parsed and compiled eagerly too.
+    if (IsCompileHint(scope->start_position())) {
+      parenthesized = FunctionLiteral::kIsParenthesized;
+      parenthesized_function_ = true;
+    }
     bool is_lazily_parsed = (mode() == PARSE_LAZILY &&
                              scope_->AllowsLazyCompilation() &&
                              !parenthesized_function_);
@@ -3623,38 +3685,61 @@ void Parser::SkipLazyFunctionBody(const AstRawString* function_name,
       return;
     }
   } else {
-    // With no cached data, we partially parse the function, without building an
-    // AST. This gathers the data needed to build a lazy function.
-    SingletonLogger logger;
-    PreParser::PreParseResult result =
-        ParseLazyFunctionBodyWithPreParser(&logger);
-    if (result == PreParser::kPreParseStackOverflow) {
-      // Propagate stack overflow.
-      set_stack_overflow();
-      *ok = false;
-      return;
-    }
-    if (logger.has_error()) {
-      ParserTraits::ReportMessageAt(
-          Scanner::Location(logger.start(), logger.end()),
-          logger.message(), logger.argument_opt(), logger.is_reference_error());
-      *ok = false;
-      return;
-    }
-    scope_->set_end_position(logger.end());
-    Expect(Token::RBRACE, ok);
-    if (!*ok) {
-      return;
+    unsigned buffer[FunctionEntry::kSize];
+    FunctionEntry entry = LookupSkippedFunction(function_block_pos, buffer);
+    if (entry.is_valid()) {
+      // An earlier parse of the script skipped this function already, so we
+      // know where it ends without preparsing it again.
+      scanner()->SeekForward(entry.end_pos() - 1);
+      scope_->set_end_position(entry.end_pos());
+      Expect(Token::RBRACE, ok);
+      if (!*ok) {
+        return;
+      }
+      *materialized_literal_count = entry.literal_count();
+      *expected_property_count = entry.property_count();
+      scope_->SetStrictMode(entry.strict_mode());
+    } else {
+      // With no cached data, we partially parse the function, without
+      // building an AST. This gathers the data needed to build a lazy
+      // function.
+      SingletonLogger logger;
+      PreParser::PreParseResult result =
+          ParseLazyFunctionBodyWithPreParser(&logger);
+      if (result == PreParser::kPreParseStackOverflow) {
+        // Propagate stack overflow.
+        set_stack_overflow();
+        *ok = false;
+        return;
+      }
+      if (logger.has_error()) {
+        ParserTraits::ReportMessageAt(
+            Scanner::Location(logger.start(), logger.end()),
+            logger.message(), logger.argument_opt(),
+            logger.is_reference_error());
+        *ok = false;
+        return;
+      }
+      scope_->set_end_position(logger.end());
+      Expect(Token::RBRACE, ok);
+      if (!*ok) {
+        return;
+      }
+      *materialized_literal_count = logger.literals();
+      *expected_property_count = logger.properties();
+      scope_->SetStrictMode(logger.strict_mode());
+      has_preparsed_functions_ = true;
     }
     isolate()->counters()->total_preparse_skipped()->Increment(
         scope_->end_position() - function_block_pos);
-    *materialized_literal_count = logger.literals();
-    *expected_property_count = logger.properties();
-    scope_->SetStrictMode(logger.strict_mode());
+    // Position right after terminal '}'.
+    int body_end = scanner()->location().end_pos;
+    RecordSkippedFunction(function_block_pos, body_end,
+                          *materialized_literal_count,
+                          *expected_property_count,
+                          scope_->strict_mode());
     if (cached_data_mode_ == PRODUCE_CACHED_DATA) {
       ASSERT(log_);
-      // Position right after terminal '}'.
-      int body_end = scanner()->location().end_pos;
       log_->LogFunction(function_block_pos, body_end,
                         *materialized_literal_count,
                         *expected_property_count,
@@ -3748,6 +3833,85 @@ PreParser::PreParseResult Parser::ParseLazyFunctionBodyWithPreParser(
 }
 
 
+bool Parser::IsCompileHint(int position) {
+  Vector<const int> hints = info()->compile_hints();
+  int low = 0;
+  int high = hints.length();
+  while (low < high) {
+    int middle = low + (high - low) / 2;
+    if (hints[middle] < position) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low < hints.length() && hints[low] == position;
+}
+
+
+FunctionEntry Parser::LookupSkippedFunction(int start, unsigned* buffer) {
+  if (!FLAG_preparse_side_table) return FunctionEntry();
+  Object* data = script_->preparse_data();
+  if (!data->IsByteArray()) return FunctionEntry();
+  ByteArray* table = ByteArray::cast(data);
+  int count = table->length() / (FunctionEntry::kSize * kIntSize);
+  int low = 0;
+  int high = count;
+  while (low < high) {
+    int middle = low + (high - low) / 2;
+    int index = middle * FunctionEntry::kSize;
+    if (table->get_int(index + FunctionEntry::kStartPositionIndex) < start) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  int index = low * FunctionEntry::kSize;
+  if (low == count ||
+      table->get_int(index + FunctionEntry::kStartPositionIndex) != start) {
+    return FunctionEntry();
+  }
+  for (int i = 0; i < FunctionEntry::kSize; i++) {
+    buffer[i] = table->get_int(index + i);
+  }
+  FunctionEntry entry(Vector<unsigned>(buffer, FunctionEntry::kSize));
+  ASSERT(entry.end_pos() > start);
+  return entry;
+}
+
+
+void Parser::RecordSkippedFunction(int start,
+                                   int end,
+                                   int literals,
+                                   int properties,
+                                   StrictMode strict_mode) {
+  if (!FLAG_preparse_side_table) return;
+  // Only functions on the top level are skipped, so they come in source
+  // order and the recorded entries are sorted by start position.
+  skipped_functions_.Add(start, zone());
+  skipped_functions_.Add(end, zone());
+  skipped_functions_.Add(literals, zone());
+  skipped_functions_.Add(properties, zone());
+  skipped_functions_.Add(strict_mode, zone());
+}
+
+
+void Parser::StoreSkippedFunctions() {
+  if (!FLAG_preparse_side_table) return;
+  // Eval code, including code from the Function constructor, is rarely
+  // reparsed, so don't keep the table alive on its script.
+  if (info()->is_eval()) return;
+  if (skipped_functions_.is_empty()) return;
+  int length = skipped_functions_.length() * kIntSize;
+  Handle<ByteArray> table =
+      isolate()->factory()->NewByteArray(length, TENURED);
+  MemCopy(table->GetDataStartAddress(),
+          skipped_functions_.ToConstVector().start(),
+          length);
+  script_->set_preparse_data(*table);
+}
+
+
 Expression* Parser::ParseV8Intrinsic(bool* ok) {
   // CallRuntime ::
   //   '%' Identifier Arguments
@@ -4820,6 +4984,7 @@ bool RegExpParser::ParseRegExp(FlatStringReader* input,
 bool Parser::Parse() {
   ASSERT(info()->function() == NULL);
   FunctionLiteral* result = NULL;
+  unsigned zone_start = zone()->allocation_size();
   ast_value_factory_ = info()->ast_value_factory();
   if (ast_value_factory_ == NULL) {
     ast_value_factory_ =
@@ -4857,6 +5022,8 @@ bool Parser::Parse() {
     }
   }
   info()->SetFunction(result);
+  isolate()->counters()->zone_bytes_parse()->Increment(
+      static_cast<int>(zone()->allocation_size() - zone_start));
   ASSERT(ast_value_factory_->IsInternalized());
   // info takes ownership of ast_value_factory_.
   if (info()->ast_value_factory() == NULL) {
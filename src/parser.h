@@ -791,6 +791,19 @@ class Parser : public ParserBase<ParserTraits> {
   PreParser::PreParseResult ParseLazyFunctionBodyWithPreParser(
       SingletonLogger* logger);
 
+  // Whether the function starting at the given position is in the compile
+  // hints passed by the embedder.
+  bool IsCompileHint(int position);
+
+  // The bodies of lazy functions skipped by a parse of a script are recorded
+  // on the script, so that parsing it again does not preparse them again.
+  // Returns the entry of the function whose body starts at the given
+  // position, using buffer as its backing store, or an invalid entry.
+  FunctionEntry LookupSkippedFunction(int start, unsigned* buffer);
+  void RecordSkippedFunction(int start, int end, int literals, int properties,
+                             StrictMode strict_mode);
+  void StoreSkippedFunctions();
+
   // Consumes the ending }.
   ZoneList<Statement*>* ParseEagerFunctionBody(
       const AstRawString* function_name, int pos, Variable* fvar,
@@ -810,6 +823,13 @@ class Parser : public ParserBase<ParserTraits> {
   ScriptData** cached_data_;
   CachedDataMode cached_data_mode_;
   AstValueFactory* ast_value_factory_;
+  // The statements of the blocks being parsed, innermost last (see
+  // Parser::ParseBlock).
+  List<Statement*> block_statements_;
+  // FunctionEntry records of the skipped function bodies, in source order.
+  ZoneList<unsigned> skipped_functions_;
+  // Whether a skipped function body was not found on the script.
+  bool has_preparsed_functions_;
 
   CompilationInfo* info_;
 
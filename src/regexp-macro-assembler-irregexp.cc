@@ -14,8 +14,6 @@
 namespace v8 {
 namespace internal {
 
-#ifdef V8_INTERPRETED_REGEXP
-
 RegExpMacroAssemblerIrregexp::RegExpMacroAssemblerIrregexp(Vector<byte> buffer,
                                                            Zone* zone)
     : RegExpMacroAssembler(zone),
@@ -450,6 +448,4 @@ void RegExpMacroAssemblerIrregexp::Expand() {
   }
 }
 
-#endif  // V8_INTERPRETED_REGEXP
-
 } }  // namespace v8::internal
@@ -38,6 +38,7 @@
 #include "src/runtime-profiler.h"
 #include "src/scopeinfo.h"
 #include "src/smart-pointers.h"
+#include "src/string-rope.h"
 #include "src/string-search.h"
 #include "src/stub-cache.h"
 #include "src/uri.h"
@@ -3151,16 +3152,12 @@ RUNTIME_FUNCTION(Runtime_StringCharCodeAtRT) {
   CONVERT_ARG_HANDLE_CHECKED(String, subject, 0);
   CONVERT_NUMBER_CHECKED(uint32_t, i, Uint32, args[1]);
 
-  // Flatten the string.  If someone wants to get a char at an index
-  // in a cons string, it is likely that more indices will be
-  // accessed.
-  subject = String::Flatten(subject);
-
   if (i >= static_cast<uint32_t>(subject->length())) {
     return isolate->heap()->nan_value();
   }
 
-  return Smi::FromInt(subject->Get(i));
+  // Long cons strings are only flattened once they are read repeatedly.
+  return Smi::FromInt(StringRope::CharCodeAt(subject, i));
 }
 
 
@@ -4116,21 +4113,67 @@ RUNTIME_FUNCTION(Runtime_StringReplaceGlobalRegExpWithString) {
   RUNTIME_ASSERT(last_match_info->HasFastObjectElements());
 
   subject = String::Flatten(subject);
+  replacement = String::Flatten(replacement);
+
+  // Caching results for short subjects costs more than it saves.
+  static const int kMinLengthToCache = 0x40;
+  bool use_cache = subject->length() >= kMinLengthToCache;
+  if (use_cache) {
+    Object* cached = RegExpResultsCache::Lookup(
+        isolate->heap(), *subject, regexp->data(),
+        RegExpResultsCache::REGEXP_REPLACE_STRING, *replacement);
+    if (cached != Smi::FromInt(0)) {
+      Handle<FixedArray> entry(FixedArray::cast(cached), isolate);
+      // The entry holds the capture registers of the last match, if any.
+      int register_count = entry->length() - 1;
+      if (register_count > 0) {
+        ScopedVector<int32_t> registers(register_count);
+        for (int i = 0; i < register_count; i++) {
+          registers[i] = Smi::cast(entry->get(i + 1))->value();
+        }
+        RegExpImpl::SetLastMatchInfo(last_match_info, subject,
+                                     regexp->CaptureCount(),
+                                     registers.start());
+      }
+      return entry->get(0);
+    }
+  }
 
+  Object* result;
   if (replacement->length() == 0) {
     if (subject->HasOnlyOneByteChars()) {
-      return StringReplaceGlobalRegExpWithEmptyString<SeqOneByteString>(
+      result = StringReplaceGlobalRegExpWithEmptyString<SeqOneByteString>(
           isolate, subject, regexp, last_match_info);
     } else {
-      return StringReplaceGlobalRegExpWithEmptyString<SeqTwoByteString>(
+      result = StringReplaceGlobalRegExpWithEmptyString<SeqTwoByteString>(
           isolate, subject, regexp, last_match_info);
     }
+  } else {
+    result = StringReplaceGlobalRegExpWithString(
+        isolate, subject, regexp, replacement, last_match_info);
   }
+  if (!use_cache || result->IsException()) return result;
 
-  replacement = String::Flatten(replacement);
-
-  return StringReplaceGlobalRegExpWithString(
-      isolate, subject, regexp, replacement, last_match_info);
+  Handle<String> result_string(String::cast(result), isolate);
+  // The subject itself is returned if there was no match, in which case the
+  // last match info is left alone.
+  int register_count = 0;
+  if (*result_string != *subject) {
+    register_count = RegExpImpl::GetLastCaptureCount(
+        FixedArray::cast(last_match_info->elements()));
+  }
+  Handle<FixedArray> entry =
+      isolate->factory()->NewFixedArray(register_count + 1);
+  entry->set(0, *result_string);
+  FixedArray* match_info = FixedArray::cast(last_match_info->elements());
+  for (int i = 0; i < register_count; i++) {
+    entry->set(i + 1,
+               Smi::FromInt(RegExpImpl::GetCapture(match_info, i)));
+  }
+  RegExpResultsCache::Enter(isolate, subject, handle(regexp->data(), isolate),
+                            entry, RegExpResultsCache::REGEXP_REPLACE_STRING,
+                            replacement);
+  return *result_string;
 }
 
 
@@ -4229,6 +4272,11 @@ int Runtime::StringMatch(Isolate* isolate,
   int subject_length = sub->length();
   if (start_index + pattern_length > subject_length) return -1;
 
+  if (StringRope::ShouldWalk(*sub) &&
+      pattern_length <= StringRope::kMaxPatternLength) {
+    return StringRope::IndexOf(isolate, sub, pat, start_index);
+  }
+
   sub = String::Flatten(sub);
   pat = String::Flatten(pat);
 
@@ -4282,6 +4330,21 @@ RUNTIME_FUNCTION(Runtime_StringIndexOf) {
 }
 
 
+RUNTIME_FUNCTION(Runtime_StringMatchesAt) {
+  SealHandleScope shs(isolate);
+  ASSERT(args.length() == 3);
+
+  CONVERT_ARG_CHECKED(String, sub, 0);
+  CONVERT_ARG_CHECKED(String, pat, 1);
+  CONVERT_SMI_ARG_CHECKED(position, 2);
+
+  if (position < 0 || position + pat->length() > sub->length()) {
+    return isolate->heap()->false_value();
+  }
+  return isolate->heap()->ToBoolean(StringRope::MatchesAt(sub, pat, position));
+}
+
+
 template <typename schar, typename pchar>
 static int StringMatchBackwards(Vector<const schar> subject,
                                 Vector<const pchar> pattern,
@@ -7623,6 +7686,13 @@ RUNTIME_FUNCTION(Runtime_StringCompare) {
   if (d < 0) return Smi::FromInt(LESS);
   else if (d > 0) return Smi::FromInt(GREATER);
 
+  if (StringRope::ShouldWalk(*x) || StringRope::ShouldWalk(*y)) {
+    int r = StringRope::Compare(*x, *y);
+    if (r < 0) return Smi::FromInt(LESS);
+    if (r > 0) return Smi::FromInt(GREATER);
+    return Smi::FromInt(EQUAL);
+  }
+
   // Slow case.
   x = String::Flatten(x);
   y = String::Flatten(y);
@@ -9704,12 +9774,13 @@ RUNTIME_FUNCTION(Runtime_ParseJson) {
   CONVERT_ARG_HANDLE_CHECKED(String, source, 0);
 
   source = String::Flatten(source);
-  // Optimized fast case where we only have ASCII characters.
+  // Optimized fast case where we only have one-byte characters.
   Handle<Object> result;
   ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
       isolate, result,
-      source->IsSeqOneByteString() ? JsonParser<true>::Parse(source)
-                                   : JsonParser<false>::Parse(source));
+      source->IsSeqOneByteString() || source->IsExternalAsciiString()
+          ? JsonParser<true>::Parse(source)
+          : JsonParser<false>::Parse(source));
   return *result;
 }
 
@@ -158,6 +158,7 @@ namespace internal {
   /* Strings */ \
   F(StringIndexOf, 3, 1) \
   F(StringLastIndexOf, 3, 1) \
+  F(StringMatchesAt, 3, 1) \
   F(StringLocaleCompare, 2, 1) \
   F(StringReplaceGlobalRegExpWithString, 4, 1) \
   F(StringReplaceOneCharWithString, 3, 1) \
@@ -821,110 +821,122 @@ uc32 Scanner::ScanIdentifierUnicodeEscape() {
 // ----------------------------------------------------------------------------
 // Keyword Matcher
 
-#define KEYWORDS(KEYWORD_GROUP, KEYWORD)                            \
-  KEYWORD_GROUP('b')                                                \
+// 'export', 'import' and 'let' are only keywords if the corresponding harmony
+// feature is enabled, see KeywordOrIdentifierToken.
+#define KEYWORDS(KEYWORD)                                           \
   KEYWORD("break", Token::BREAK)                                    \
-  KEYWORD_GROUP('c')                                                \
   KEYWORD("case", Token::CASE)                                      \
   KEYWORD("catch", Token::CATCH)                                    \
   KEYWORD("class", Token::FUTURE_RESERVED_WORD)                     \
   KEYWORD("const", Token::CONST)                                    \
   KEYWORD("continue", Token::CONTINUE)                              \
-  KEYWORD_GROUP('d')                                                \
   KEYWORD("debugger", Token::DEBUGGER)                              \
   KEYWORD("default", Token::DEFAULT)                                \
   KEYWORD("delete", Token::DELETE)                                  \
   KEYWORD("do", Token::DO)                                          \
-  KEYWORD_GROUP('e')                                                \
   KEYWORD("else", Token::ELSE)                                      \
   KEYWORD("enum", Token::FUTURE_RESERVED_WORD)                      \
-  KEYWORD("export", harmony_modules                                 \
-                    ? Token::EXPORT : Token::FUTURE_RESERVED_WORD)  \
+  KEYWORD("export", Token::EXPORT)                                  \
   KEYWORD("extends", Token::FUTURE_RESERVED_WORD)                   \
-  KEYWORD_GROUP('f')                                                \
   KEYWORD("false", Token::FALSE_LITERAL)                            \
   KEYWORD("finally", Token::FINALLY)                                \
   KEYWORD("for", Token::FOR)                                        \
   KEYWORD("function", Token::FUNCTION)                              \
-  KEYWORD_GROUP('i')                                                \
   KEYWORD("if", Token::IF)                                          \
   KEYWORD("implements", Token::FUTURE_STRICT_RESERVED_WORD)         \
-  KEYWORD("import", harmony_modules                                 \
-                    ? Token::IMPORT : Token::FUTURE_RESERVED_WORD)  \
+  KEYWORD("import", Token::IMPORT)                                  \
   KEYWORD("in", Token::IN)                                          \
   KEYWORD("instanceof", Token::INSTANCEOF)                          \
   KEYWORD("interface", Token::FUTURE_STRICT_RESERVED_WORD)          \
-  KEYWORD_GROUP('l')                                                \
-  KEYWORD("let", harmony_scoping                                    \
-                 ? Token::LET : Token::FUTURE_STRICT_RESERVED_WORD) \
-  KEYWORD_GROUP('n')                                                \
+  KEYWORD("let", Token::LET)                                        \
   KEYWORD("new", Token::NEW)                                        \
   KEYWORD("null", Token::NULL_LITERAL)                              \
-  KEYWORD_GROUP('p')                                                \
   KEYWORD("package", Token::FUTURE_STRICT_RESERVED_WORD)            \
   KEYWORD("private", Token::FUTURE_STRICT_RESERVED_WORD)            \
   KEYWORD("protected", Token::FUTURE_STRICT_RESERVED_WORD)          \
   KEYWORD("public", Token::FUTURE_STRICT_RESERVED_WORD)             \
-  KEYWORD_GROUP('r')                                                \
   KEYWORD("return", Token::RETURN)                                  \
-  KEYWORD_GROUP('s')                                                \
   KEYWORD("static", Token::FUTURE_STRICT_RESERVED_WORD)             \
   KEYWORD("super", Token::FUTURE_RESERVED_WORD)                     \
   KEYWORD("switch", Token::SWITCH)                                  \
-  KEYWORD_GROUP('t')                                                \
   KEYWORD("this", Token::THIS)                                      \
   KEYWORD("throw", Token::THROW)                                    \
   KEYWORD("true", Token::TRUE_LITERAL)                              \
   KEYWORD("try", Token::TRY)                                        \
   KEYWORD("typeof", Token::TYPEOF)                                  \
-  KEYWORD_GROUP('v')                                                \
   KEYWORD("var", Token::VAR)                                        \
   KEYWORD("void", Token::VOID)                                      \
-  KEYWORD_GROUP('w')                                                \
   KEYWORD("while", Token::WHILE)                                    \
   KEYWORD("with", Token::WITH)                                      \
-  KEYWORD_GROUP('y')                                                \
   KEYWORD("yield", Token::YIELD)
 
 
-static Token::Value KeywordOrIdentifierToken(const uint8_t* input,
+KeywordTable::KeywordTable() {
+  for (int i = 0; i < kSize; i++) {
+    entries_[i].keyword = "";
+    entries_[i].length = 0;
+    entries_[i].token = Token::IDENTIFIER;
+  }
+#define KEYWORD(keyword, token) Add(keyword, token);
+  KEYWORDS(KEYWORD)
+#undef KEYWORD
+}
+
+
+void KeywordTable::Add(const char* keyword, Token::Value token) {
+  int length = StrLength(keyword);
+  ASSERT(length >= kMinLength && length <= kMaxLength);
+  Entry* entry =
+      &entries_[Hash(reinterpret_cast<const uint8_t*>(keyword), length)];
+  // The hash function has to be changed if new keywords collide.
+  CHECK_EQ(0, entry->length);
+  entry->keyword = keyword;
+  entry->length = length;
+  entry->token = token;
+}
+
+
+// ----------------------------------------------------------------------------
+// Character classes
+
+// The classes of the one-byte characters, as computed by the IdentifierStart,
+// IdentifierPart, WhiteSpace and unibrow::LineTerminator predicates.
+const uint8_t UnicodeCache::kOneByteCharFlags[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 4, 4, 8, 0, 0,  // 0x00
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x10
+  4, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x20
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,  // 0x30
+  0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,  // 0x40
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 0, 0, 3,  // 0x50
+  0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,  // 0x60
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,  // 0x70
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x80
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x90
+  4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0,  // 0xa0
+  0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0,  // 0xb0
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,  // 0xc0
+  3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,  // 0xd0
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,  // 0xe0
+  3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,  // 0xf0
+};
+
+
+static Token::Value KeywordOrIdentifierToken(const KeywordTable* table,
+                                             const uint8_t* input,
                                              int input_length,
                                              bool harmony_scoping,
                                              bool harmony_modules) {
   ASSERT(input_length >= 1);
-  const int kMinLength = 2;
-  const int kMaxLength = 10;
-  if (input_length < kMinLength || input_length > kMaxLength) {
-    return Token::IDENTIFIER;
-  }
-  switch (input[0]) {
+  Token::Value token = table->Lookup(input, input_length);
+  switch (token) {
+    case Token::EXPORT:
+    case Token::IMPORT:
+      return harmony_modules ? token : Token::FUTURE_RESERVED_WORD;
+    case Token::LET:
+      return harmony_scoping ? token : Token::FUTURE_STRICT_RESERVED_WORD;
     default:
-#define KEYWORD_GROUP_CASE(ch)                                \
-      break;                                                  \
-    case ch:
-#define KEYWORD(keyword, token)                               \
-    {                                                         \
-      /* 'keyword' is a char array, so sizeof(keyword) is */  \
-      /* strlen(keyword) plus 1 for the NUL char. */          \
-      const int keyword_length = sizeof(keyword) - 1;         \
-      STATIC_ASSERT(keyword_length >= kMinLength);            \
-      STATIC_ASSERT(keyword_length <= kMaxLength);            \
-      if (input_length == keyword_length &&                   \
-          input[1] == keyword[1] &&                           \
-          (keyword_length <= 2 || input[2] == keyword[2]) &&  \
-          (keyword_length <= 3 || input[3] == keyword[3]) &&  \
-          (keyword_length <= 4 || input[4] == keyword[4]) &&  \
-          (keyword_length <= 5 || input[5] == keyword[5]) &&  \
-          (keyword_length <= 6 || input[6] == keyword[6]) &&  \
-          (keyword_length <= 7 || input[7] == keyword[7]) &&  \
-          (keyword_length <= 8 || input[8] == keyword[8]) &&  \
-          (keyword_length <= 9 || input[9] == keyword[9])) {  \
-        return token;                                         \
-      }                                                       \
-    }
-    KEYWORDS(KEYWORD_GROUP_CASE, KEYWORD)
+      return token;
   }
-  return Token::IDENTIFIER;
 }
 
 
@@ -964,7 +976,8 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
 
   if (next_.literal_chars->is_one_byte()) {
     Vector<const uint8_t> chars = next_.literal_chars->one_byte_literal();
-    return KeywordOrIdentifierToken(chars.start(),
+    return KeywordOrIdentifierToken(unicode_cache_->keyword_table(),
+                                    chars.start(),
                                     chars.length(),
                                     harmony_scoping_,
                                     harmony_modules_);
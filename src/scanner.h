@@ -105,6 +105,50 @@ class Utf16CharacterStream {
 };
 
 
+// ---------------------------------------------------------------------
+// Perfect hash table of the keywords.
+
+class KeywordTable {
+ public:
+  KeywordTable();
+
+  // Returns the token of the keyword spelled by the one-byte characters,
+  // or Token::IDENTIFIER. Keywords that are only reserved words unless a
+  // harmony feature is enabled are returned as their harmony token.
+  Token::Value Lookup(const uint8_t* input, int length) const {
+    if (length < kMinLength || length > kMaxLength) return Token::IDENTIFIER;
+    const Entry& entry = entries_[Hash(input, length)];
+    if (entry.length == length &&
+        memcmp(entry.keyword, input, length) == 0) {
+      return entry.token;
+    }
+    return Token::IDENTIFIER;
+  }
+
+ private:
+  struct Entry {
+    const char* keyword;
+    int length;
+    Token::Value token;
+  };
+
+  static const int kMinLength = 2;
+  static const int kMaxLength = 10;
+  static const int kSize = 128;
+
+  // Collision-free for the keywords; the constructor checks that it is.
+  static int Hash(const uint8_t* input, int length) {
+    return ((input[0] + input[1]) * 4 + length * 3) & (kSize - 1);
+  }
+
+  void Add(const char* keyword, Token::Value token);
+
+  Entry entries_[kSize];
+
+  DISALLOW_COPY_AND_ASSIGN(KeywordTable);
+};
+
+
 // ---------------------------------------------------------------------
 // Caching predicates used by scanners.
 
@@ -117,15 +161,50 @@ class UnicodeCache {
     return &utf8_decoder_;
   }
 
-  bool IsIdentifierStart(unibrow::uchar c) { return kIsIdentifierStart.get(c); }
-  bool IsIdentifierPart(unibrow::uchar c) { return kIsIdentifierPart.get(c); }
-  bool IsLineTerminator(unibrow::uchar c) { return kIsLineTerminator.get(c); }
-  bool IsWhiteSpace(unibrow::uchar c) { return kIsWhiteSpace.get(c); }
+  // One-byte characters, which make up almost all of the source code, are
+  // classified by a table lookup.
+  bool IsIdentifierStart(unibrow::uchar c) {
+    if (c <= unibrow::Latin1::kMaxChar) {
+      return (kOneByteCharFlags[c] & kIdentifierStartFlag) != 0;
+    }
+    return kIsIdentifierStart.get(c);
+  }
+  bool IsIdentifierPart(unibrow::uchar c) {
+    if (c <= unibrow::Latin1::kMaxChar) {
+      return (kOneByteCharFlags[c] & kIdentifierPartFlag) != 0;
+    }
+    return kIsIdentifierPart.get(c);
+  }
+  bool IsLineTerminator(unibrow::uchar c) {
+    if (c <= unibrow::Latin1::kMaxChar) {
+      return (kOneByteCharFlags[c] & kLineTerminatorFlag) != 0;
+    }
+    return kIsLineTerminator.get(c);
+  }
+  bool IsWhiteSpace(unibrow::uchar c) {
+    if (c <= unibrow::Latin1::kMaxChar) {
+      return (kOneByteCharFlags[c] & kWhiteSpaceFlag) != 0;
+    }
+    return kIsWhiteSpace.get(c);
+  }
   bool IsWhiteSpaceOrLineTerminator(unibrow::uchar c) {
+    if (c <= unibrow::Latin1::kMaxChar) {
+      return (kOneByteCharFlags[c] &
+              (kWhiteSpaceFlag | kLineTerminatorFlag)) != 0;
+    }
     return kIsWhiteSpaceOrLineTerminator.get(c);
   }
 
+  const KeywordTable* keyword_table() const { return &keyword_table_; }
+
  private:
+  // Flags in kOneByteCharFlags.
+  static const uint8_t kIdentifierStartFlag = 1 << 0;
+  static const uint8_t kIdentifierPartFlag = 1 << 1;
+  static const uint8_t kWhiteSpaceFlag = 1 << 2;
+  static const uint8_t kLineTerminatorFlag = 1 << 3;
+  static const uint8_t kOneByteCharFlags[unibrow::Latin1::kMaxChar + 1];
+
   unibrow::Predicate<IdentifierStart, 128> kIsIdentifierStart;
   unibrow::Predicate<IdentifierPart, 128> kIsIdentifierPart;
   unibrow::Predicate<unibrow::LineTerminator, 128> kIsLineTerminator;
@@ -133,6 +212,7 @@ class UnicodeCache {
   unibrow::Predicate<WhiteSpaceOrLineTerminator, 128>
       kIsWhiteSpaceOrLineTerminator;
   StaticResource<Utf8Decoder> utf8_decoder_;
+  KeywordTable keyword_table_;
 
   DISALLOW_COPY_AND_ASSIGN(UnicodeCache);
 };
@@ -78,9 +78,11 @@ Scope::Scope(Scope* outer_scope, ScopeType scope_type,
     : isolate_(zone->isolate()),
       inner_scopes_(4, zone),
       variables_(zone),
-      internals_(4, zone),
-      temps_(4, zone),
-      params_(4, zone),
+      // Internals and temporaries are rare, and only functions have
+      // parameters, so these lists are allocated when they are needed.
+      internals_(0, zone),
+      temps_(0, zone),
+      params_(scope_type == FUNCTION_SCOPE ? 4 : 0, zone),
       unresolved_(16, zone),
       decls_(4, zone),
       interface_(FLAG_harmony_modules &&
@@ -102,13 +104,15 @@ Scope::Scope(Scope* inner_scope,
              AstValueFactory* value_factory,
              Zone* zone)
     : isolate_(zone->isolate()),
-      inner_scopes_(4, zone),
+      // Deserialized scopes are resolved already, their variables are looked
+      // up in the scope info. Nothing but the inner scope is added to them.
+      inner_scopes_(1, zone),
       variables_(zone),
-      internals_(4, zone),
-      temps_(4, zone),
-      params_(4, zone),
-      unresolved_(16, zone),
-      decls_(4, zone),
+      internals_(0, zone),
+      temps_(0, zone),
+      params_(0, zone),
+      unresolved_(0, zone),
+      decls_(0, zone),
       interface_(NULL),
       already_resolved_(true),
       ast_value_factory_(value_factory),
@@ -165,6 +169,7 @@ void Scope::SetDefaults(ScopeType scope_type,
   illegal_redecl_ = NULL;
   scope_inside_with_ = false;
   scope_contains_with_ = false;
+  try_catch_resume_position_ = RelocInfo::kNoPosition;
   scope_calls_eval_ = false;
   // Inherit the strict mode from the parent scope.
   strict_mode_ = outer_scope != NULL ? outer_scope->strict_mode_ : SLOPPY;
@@ -881,6 +886,9 @@ void Scope::Print(int n) {
   }
   if (scope_inside_with_) Indent(n1, "// scope inside 'with'\n");
   if (scope_contains_with_) Indent(n1, "// scope contains 'with'\n");
+  if (try_catch_resume_position_ != RelocInfo::kNoPosition) {
+    Indent(n1, "// scope contains 'try/catch'\n");
+  }
   if (scope_calls_eval_) Indent(n1, "// scope calls 'eval'\n");
   if (outer_scope_calls_sloppy_eval_) {
     Indent(n1, "// outer scope calls 'eval' in sloppy context\n");
@@ -1122,6 +1130,22 @@ bool Scope::ResolveVariable(CompilationInfo* info,
     }
   }
 
+  // Optimized code continues in the catch block of the unoptimized code,
+  // which only gets the values of context-allocated variables. Variables
+  // referenced where execution may resume after a caught exception live in
+  // the context; the others are dead by then.
+  Scope* declaration_scope = DeclarationScope();
+  if (FLAG_optimize_try_catch &&
+      binding_kind == BOUND &&
+      var->scope() != NULL &&
+      var->scope()->DeclarationScope() == declaration_scope &&
+      declaration_scope->try_catch_resume_position_ !=
+          RelocInfo::kNoPosition &&
+      (proxy->position() == RelocInfo::kNoPosition ||
+       proxy->position() >= declaration_scope->try_catch_resume_position_)) {
+    var->ForceContextAllocation();
+  }
+
   proxy->BindTo(var);
 
   return true;
@@ -1198,9 +1222,14 @@ bool Scope::MustAllocateInContext(Variable* var) {
   // Exceptions: If the scope as a whole has forced context allocation, all
   // variables will have context allocation, even temporaries.  Otherwise
   // temporary variables are always stack-allocated.  Catch-bound variables are
-  // always context-allocated.
+  // always context-allocated.  With --optimize-try-catch, temporaries of a
+  // function containing try/catch are context-allocated as well (see
+  // Scope::ResolveVariable for the other variables).
   if (has_forced_context_allocation()) return true;
-  if (var->mode() == TEMPORARY) return false;
+  if (var->mode() == TEMPORARY) {
+    return FLAG_optimize_try_catch &&
+        try_catch_resume_position_ != RelocInfo::kNoPosition;
+  }
   if (var->mode() == INTERNAL) return true;
   if (is_catch_scope() || is_block_scope() || is_module_scope()) return true;
   if (is_global_scope() && IsLexicalVariableMode(var->mode())) return true;
@@ -210,6 +210,17 @@ class Scope: public ZoneObject {
   // Inform the scope that the corresponding code contains a with statement.
   void RecordWithStatement() { scope_contains_with_ = true; }
 
+  // Inform the scope that the corresponding code contains a try/catch
+  // statement. Once an exception has been caught, execution may resume
+  // anywhere from resume_position on: the start of the statement, or of the
+  // outermost loop containing it.
+  void RecordTryCatchStatement(int resume_position) {
+    if (try_catch_resume_position_ == RelocInfo::kNoPosition ||
+        resume_position < try_catch_resume_position_) {
+      try_catch_resume_position_ = resume_position;
+    }
+  }
+
   // Inform the scope that the corresponding code contains an eval call.
   void RecordEvalCall() { if (!is_global_scope()) scope_calls_eval_ = true; }
 
@@ -462,6 +473,9 @@ class Scope: public ZoneObject {
   bool scope_inside_with_;
   // This scope contains a 'with' statement.
   bool scope_contains_with_;
+  // Smallest resume position of the try/catch statements in this scope or a
+  // nested catch scope or block scope, or kNoPosition if there are none.
+  int try_catch_resume_position_;
   // This scope or a nested catch scope or with scope contain an 'eval' call. At
   // the 'eval' call site this scope is the declaration scope.
   bool scope_calls_eval_;
@@ -261,6 +261,14 @@ void ExternalReferenceTable::PopulateTable(Isolate* isolate) {
       STUB_CACHE_TABLE,
       6,
       "StubCache::secondary_->map");
+  Add(stub_cache->mask_reference(StubCache::kPrimary).address(),
+      STUB_CACHE_TABLE,
+      7,
+      "StubCache::primary_mask_");
+  Add(stub_cache->mask_reference(StubCache::kSecondary).address(),
+      STUB_CACHE_TABLE,
+      8,
+      "StubCache::secondary_mask_");
 
   // Runtime entries
   Add(ExternalReference::delete_handle_scope_extensions(isolate).address(),
@@ -525,6 +533,11 @@ void ExternalReferenceTable::PopulateTable(Isolate* isolate) {
       67,
       "Debug::restarter_frame_function_pointer_address()");
 
+  Add(ExternalReference::try_internalize_string_function(isolate).address(),
+      UNCLASSIFIED,
+      68,
+      "StringTable::LookupStringIfExistsNoAllocate");
+
   // Add a small set of deopt entry addresses to encoder without generating the
   // deopt table code, which isn't possible at deserialization time.
   HandleScope scope(isolate);
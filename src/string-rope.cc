@@ -0,0 +1,322 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/v8.h"
+
+#include "src/string-rope.h"
+#include "src/string-search.h"
+
+namespace v8 {
+namespace internal {
+
+RopeSegmentIterator::RopeSegmentIterator(String* string, int offset)
+    : pending_(8), is_one_byte_(true), buffer8_(NULL), length_(0) {
+  Descend(string, offset);
+  if (length_ == 0) Advance();
+}
+
+
+void RopeSegmentIterator::Descend(String* string, int offset) {
+  // Unlike ConsStringIteratorOp, which restarts from the root once its
+  // fixed size stack overflows, this keeps every pending right subtree, so
+  // deep trees are walked in linear time.
+  while (true) {
+    ConsString* cons = String::VisitFlat(this, string, offset);
+    if (cons == NULL) return;
+    String* first = cons->first();
+    if (offset < first->length()) {
+      pending_.Add(cons->second());
+      string = first;
+    } else {
+      offset -= first->length();
+      string = cons->second();
+    }
+  }
+}
+
+
+void RopeSegmentIterator::Advance() {
+  length_ = 0;
+  while (length_ == 0 && !pending_.is_empty()) {
+    Descend(pending_.RemoveLast(), 0);
+  }
+}
+
+
+void RopeSegmentIterator::Consume(int count) {
+  ASSERT(count <= length_);
+  if (is_one_byte_) {
+    buffer8_ += count;
+  } else {
+    buffer16_ += count;
+  }
+  length_ -= count;
+  if (length_ == 0) Advance();
+}
+
+
+template <typename PatternChar>
+static int SearchSegment(Isolate* isolate,
+                         const RopeSegmentIterator& segment,
+                         Vector<const PatternChar> pattern) {
+  if (segment.length() < pattern.length()) return -1;
+  if (segment.is_one_byte()) {
+    return SearchString(
+        isolate,
+        Vector<const uint8_t>(segment.one_byte_chars(), segment.length()),
+        pattern,
+        0);
+  }
+  return SearchString(
+      isolate,
+      Vector<const uc16>(segment.two_byte_chars(), segment.length()),
+      pattern,
+      0);
+}
+
+
+static void CopySegmentChars(const RopeSegmentIterator& segment,
+                             int from,
+                             int count,
+                             uc16* dest) {
+  if (segment.is_one_byte()) {
+    CopyChars(dest, segment.one_byte_chars() + from, count);
+  } else {
+    CopyChars(dest, segment.two_byte_chars() + from, count);
+  }
+}
+
+
+template <typename PatternChar>
+static int SearchRope(Isolate* isolate,
+                      String* subject,
+                      Vector<const PatternChar> pattern,
+                      int start_index) {
+  int pattern_length = pattern.length();
+  ASSERT(pattern_length <= StringRope::kMaxPatternLength);
+  // Matches that straddle segment boundaries are found in a window holding
+  // the last pattern_length - 1 characters of the preceding segments followed
+  // by the first pattern_length - 1 characters of the next one.
+  uc16 window[2 * StringRope::kMaxPatternLength];
+  int window_length = 0;
+  int position = start_index;
+  for (RopeSegmentIterator segment(subject, start_index);
+       segment.HasMore();
+       segment.Advance()) {
+    int length = segment.length();
+    int taken = 0;
+    if (window_length > 0) {
+      taken = Min(length, pattern_length - 1);
+      CopySegmentChars(segment, 0, taken, window + window_length);
+      int total = window_length + taken;
+      if (total >= pattern_length) {
+        int index = SearchString(isolate,
+                                 Vector<const uc16>(window, total),
+                                 pattern,
+                                 0);
+        if (index != -1) return position - window_length + index;
+      }
+    }
+    int index = SearchSegment(isolate, segment, pattern);
+    if (index != -1) return position + index;
+
+    if (taken == length) {
+      // The whole segment is in the window already.
+      int total = window_length + taken;
+      int keep = Min(total, pattern_length - 1);
+      MemMove(window, window + total - keep, keep * sizeof(uc16));
+      window_length = keep;
+    } else {
+      window_length = Min(length, pattern_length - 1);
+      CopySegmentChars(segment, length - window_length, window_length, window);
+    }
+    position += length;
+  }
+  return -1;
+}
+
+
+int StringRope::IndexOf(Isolate* isolate,
+                        Handle<String> subject,
+                        Handle<String> pattern,
+                        int start_index) {
+  ASSERT(pattern->length() > 0);
+  ASSERT(pattern->length() <= kMaxPatternLength);
+  pattern = String::Flatten(pattern);
+
+  DisallowHeapAllocation no_gc;
+  String::FlatContent pattern_content = pattern->GetFlatContent();
+  if (pattern_content.IsAscii()) {
+    return SearchRope(isolate,
+                      *subject,
+                      pattern_content.ToOneByteVector(),
+                      start_index);
+  }
+  return SearchRope(isolate,
+                    *subject,
+                    pattern_content.ToUC16Vector(),
+                    start_index);
+}
+
+
+static int CompareSegments(const RopeSegmentIterator& x,
+                           const RopeSegmentIterator& y,
+                           int length) {
+  if (x.is_one_byte()) {
+    if (y.is_one_byte()) {
+      return CompareChars(x.one_byte_chars(), y.one_byte_chars(), length);
+    }
+    return CompareChars(x.one_byte_chars(), y.two_byte_chars(), length);
+  }
+  if (y.is_one_byte()) {
+    return CompareChars(x.two_byte_chars(), y.one_byte_chars(), length);
+  }
+  return CompareChars(x.two_byte_chars(), y.two_byte_chars(), length);
+}
+
+
+int StringRope::Compare(String* x, String* y) {
+  DisallowHeapAllocation no_gc;
+  RopeSegmentIterator x_segment(x, 0);
+  RopeSegmentIterator y_segment(y, 0);
+  while (x_segment.HasMore() && y_segment.HasMore()) {
+    int length = Min(x_segment.length(), y_segment.length());
+    int r = CompareSegments(x_segment, y_segment, length);
+    if (r != 0) return r;
+    x_segment.Consume(length);
+    y_segment.Consume(length);
+  }
+  return x->length() - y->length();
+}
+
+
+bool StringRope::MatchesAt(String* subject, String* pattern, int position) {
+  ASSERT(position + pattern->length() <= subject->length());
+  DisallowHeapAllocation no_gc;
+  RopeSegmentIterator subject_segment(subject, position);
+  RopeSegmentIterator pattern_segment(pattern, 0);
+  while (pattern_segment.HasMore()) {
+    ASSERT(subject_segment.HasMore());
+    int length = Min(subject_segment.length(), pattern_segment.length());
+    if (CompareSegments(subject_segment, pattern_segment, length) != 0) {
+      return false;
+    }
+    subject_segment.Consume(length);
+    pattern_segment.Consume(length);
+  }
+  return true;
+}
+
+
+// Returns the number of cons strings on the path to the character at index.
+static int DepthAt(String* string, int index) {
+  int depth = 0;
+  while (string->IsConsString()) {
+    ConsString* cons = ConsString::cast(string);
+    String* first = cons->first();
+    if (index < first->length()) {
+      string = first;
+    } else {
+      index -= first->length();
+      string = cons->second();
+    }
+    depth++;
+  }
+  return depth;
+}
+
+
+uint16_t StringRope::CharCodeAt(Handle<String> subject, int index) {
+  ASSERT(index < subject->length());
+  if (!ShouldWalk(*subject)) {
+    subject = String::Flatten(subject);
+    return subject->Get(index);
+  }
+
+  // Loops over the characters of a string come here for every character,
+  // so a string read over and over is cheaper to flatten. A few recently
+  // read strings are remembered, so that loops reading several strings in
+  // turn (e.g. comparing two strings) flatten all of them. Only addresses
+  // are remembered, they are never dereferenced.
+  Isolate* isolate = subject->GetIsolate();
+  Address* ropes = isolate->recent_rope_reads();
+  int* reads = isolate->recent_rope_read_counts();
+  int i = 0;
+  while (i < Isolate::kRecentRopeReadsSize && ropes[i] != subject->address()) {
+    i++;
+  }
+  if (i < Isolate::kRecentRopeReadsSize) {
+    if (++reads[i] >= kMaxReadsBeforeFlattening) {
+      ropes[i] = NULL;
+      reads[i] = 0;
+      subject = String::Flatten(subject);
+      return subject->Get(index);
+    }
+  } else {
+    // Evict the oldest string.
+    for (i = Isolate::kRecentRopeReadsSize - 1; i > 0; i--) {
+      ropes[i] = ropes[i - 1];
+      reads[i] = reads[i - 1];
+    }
+    ropes[0] = subject->address();
+    reads[0] = 0;
+  }
+
+  if (DepthAt(*subject, index) > kMaxDepth) {
+    Balance(Handle<ConsString>::cast(subject));
+  }
+  return subject->Get(index);
+}
+
+
+static Handle<String> BuildBalanced(Factory* factory,
+                                    const List<Handle<String> >& segments,
+                                    int from,
+                                    int to) {
+  if (to - from == 1) return segments[from];
+  int middle = from + (to - from) / 2;
+  Handle<String> first = BuildBalanced(factory, segments, from, middle);
+  Handle<String> second = BuildBalanced(factory, segments, middle, to);
+  return factory->NewConsString(first, second).ToHandleChecked();
+}
+
+
+void StringRope::Balance(Handle<ConsString> cons) {
+  Isolate* isolate = cons->GetIsolate();
+  List<String*> leaves;
+  {
+    DisallowHeapAllocation no_gc;
+    List<String*> pending;
+    pending.Add(*cons);
+    while (!pending.is_empty()) {
+      String* string = pending.RemoveLast();
+      if (string->IsConsString()) {
+        pending.Add(ConsString::cast(string)->second());
+        pending.Add(ConsString::cast(string)->first());
+      } else if (string->length() > 0) {
+        leaves.Add(string);
+      }
+    }
+  }
+
+  if (leaves.length() < 2 ||
+      cons->length() / leaves.length() < kMinAverageSegmentLength) {
+    String::Flatten(cons);
+    return;
+  }
+
+  List<Handle<String> > segments(leaves.length());
+  for (int i = 0; i < leaves.length(); i++) {
+    segments.Add(handle(leaves[i], isolate));
+  }
+  Factory* factory = isolate->factory();
+  int middle = segments.length() / 2;
+  Handle<String> first = BuildBalanced(factory, segments, 0, middle);
+  Handle<String> second =
+      BuildBalanced(factory, segments, middle, segments.length());
+  cons->set_first(*first);
+  cons->set_second(*second);
+}
+
+} }  // namespace v8::internal
@@ -0,0 +1,114 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_STRING_ROPE_H_
+#define V8_STRING_ROPE_H_
+
+#include "src/objects.h"
+
+namespace v8 {
+namespace internal {
+
+// Iterates over the flat segments of a string in order, walking the tree of
+// a cons string without flattening it. Holds raw pointers, so there must be
+// no allocation while it is in use.
+class RopeSegmentIterator {
+ public:
+  RopeSegmentIterator(String* string, int offset);
+
+  bool HasMore() const { return length_ > 0; }
+  void Advance();
+
+  // The characters of the current segment.
+  bool is_one_byte() const { return is_one_byte_; }
+  const uint8_t* one_byte_chars() const { return buffer8_; }
+  const uc16* two_byte_chars() const { return buffer16_; }
+  int length() const { return length_; }
+
+  // Drops the first count characters of the current segment.
+  void Consume(int count);
+
+  void VisitOneByteString(const uint8_t* chars, int length) {
+    is_one_byte_ = true;
+    buffer8_ = chars;
+    length_ = length;
+  }
+
+  void VisitTwoByteString(const uc16* chars, int length) {
+    is_one_byte_ = false;
+    buffer16_ = chars;
+    length_ = length;
+  }
+
+ private:
+  void Descend(String* string, int offset);
+
+  // Right subtrees still to be visited, innermost last.
+  List<String*> pending_;
+  bool is_one_byte_;
+  union {
+    const uint8_t* buffer8_;
+    const uc16* buffer16_;
+  };
+  int length_;
+
+  DISALLOW_COPY_AND_ASSIGN(RopeSegmentIterator);
+};
+
+
+// String operations that work on long cons strings in place, instead of
+// flattening them first. Flattening copies the whole string, which is wasted
+// when only a part of it is inspected.
+class StringRope : public AllStatic {
+ public:
+  // Shorter strings are flattened, as copying them is cheap and speeds up
+  // later operations on them.
+  static const int kMinLength = 1024;
+  // Longer search patterns are matched against a flattened subject.
+  static const int kMaxPatternLength = 32;
+
+  // Whether an operation on the string should walk its cons tree.
+  static bool ShouldWalk(String* string) {
+    return string->length() >= kMinLength && !string->IsFlat();
+  }
+
+  // Returns the index of the first occurrence of pattern in subject at or
+  // after start_index, or -1. The pattern must not be empty and at most
+  // kMaxPatternLength long.
+  static int IndexOf(Isolate* isolate,
+                     Handle<String> subject,
+                     Handle<String> pattern,
+                     int start_index);
+
+  // Compares the strings by character codes. Returns a negative number, zero
+  // or a positive number if x is less than, equal to or greater than y.
+  static int Compare(String* x, String* y);
+
+  // Whether pattern occurs in subject at position, which must leave room for
+  // the whole pattern.
+  static bool MatchesAt(String* subject, String* pattern, int position);
+
+  // Reads a character. Deep cons strings are balanced first, and cons
+  // strings read repeatedly are flattened, since optimized code only loads
+  // characters of flat strings.
+  static uint16_t CharCodeAt(Handle<String> subject, int index);
+
+  // Rebuilds a cons string as a balanced tree of its segments, or flattens
+  // it if the segments are so short that copying them is cheaper.
+  static void Balance(Handle<ConsString> cons);
+
+ private:
+  // Cons strings this deep at some index are balanced before being read.
+  static const int kMaxDepth = 32;
+  // Cons strings whose segments are shorter than this on average are
+  // flattened instead of being balanced.
+  static const int kMinAverageSegmentLength = 32;
+  // Cons strings read this often while among the recently read ones are
+  // flattened.
+  static const int kMaxReadsBeforeFlattening = 16;
+};
+
+} }  // namespace v8::internal
+
+#endif  // V8_STRING_ROPE_H_
@@ -38,6 +38,18 @@ class StringSearchBase {
   // to compensate for the algorithmic overhead compared to simple brute force.
   static const int kBMMinPatternLength = 7;
 
+  // For subjects shorter than this, scanning a word of characters at a time
+  // does not pay off.
+  static const int kWordScanMinLength = 32;
+
+  // One-byte subjects are scanned with memchr, which is fastest when the
+  // first character of the pattern is rare. After this many false starts,
+  // the linear search switches to scanning a word of characters at a time
+  // if memchr stopped more often than every kWordScanMaxFalseStartDistance
+  // characters on average.
+  static const int kWordScanFalseStarts = 16;
+  static const int kWordScanMaxFalseStartDistance = 32;
+
   static inline bool IsOneByteString(Vector<const uint8_t> string) {
     return true;
   }
@@ -110,6 +122,10 @@ class StringSearch : private StringSearchBase {
                           Vector<const SubjectChar> subject,
                           int start_index);
 
+  static int WordScanSearch(StringSearch<PatternChar, SubjectChar>* search,
+                            Vector<const SubjectChar> subject,
+                            int start_index);
+
   static int InitialSearch(StringSearch<PatternChar, SubjectChar>* search,
                            Vector<const SubjectChar> subject,
                            int start_index);
@@ -135,6 +151,33 @@ class StringSearch : private StringSearchBase {
     return c > String::kMaxOneByteCharCodeU;
   }
 
+  // A word holds this many subject characters, in lanes.
+  static const int kCharsPerWord = sizeof(uintptr_t) / sizeof(SubjectChar);
+  // A word with the lowest bit of every lane set.
+  static const uintptr_t kLaneLowBits = static_cast<uintptr_t>(-1) /
+      ((static_cast<uintptr_t>(1) << (kBitsPerByte * sizeof(SubjectChar))) - 1);
+  // A word with the highest bit of every lane set.
+  static const uintptr_t kLaneHighBits =
+      kLaneLowBits << (kBitsPerByte * sizeof(SubjectChar) - 1);
+
+  static inline uintptr_t LoadWord(const SubjectChar* chars) {
+    uintptr_t word;
+    memcpy(&word, chars, sizeof(word));
+    return word;
+  }
+
+  // Returns a word with the character in every lane.
+  static inline uintptr_t RepeatChar(SubjectChar c) {
+    return kLaneLowBits * c;
+  }
+
+  // Returns a word with the highest bit set in exactly the lanes that are
+  // zero in word. No carry crosses lanes, so there are no false positives.
+  static inline uintptr_t ZeroLanes(uintptr_t word) {
+    uintptr_t low = ~kLaneHighBits;
+    return ~(((word & low) + low) | word | low);
+  }
+
   static inline int CharOccurrence(int* bad_char_occurrence,
                                    SubjectChar char_code) {
     if (sizeof(SubjectChar) == 1) {
@@ -214,6 +257,15 @@ int StringSearch<PatternChar, SubjectChar>::SingleCharSearch(
     }
     SubjectChar search_char = static_cast<SubjectChar>(pattern_first_char);
     int n = subject.length();
+    if (n - i >= kWordScanMinLength) {
+      // Compare a word of characters at a time.
+      const SubjectChar* chars = subject.start();
+      uintptr_t repeated = RepeatChar(search_char);
+      while (i + kCharsPerWord <= n &&
+             ZeroLanes(LoadWord(chars + i) ^ repeated) == 0) {
+        i += kCharsPerWord;
+      }
+    }
     while (i < n) {
       if (subject[i++] == search_char) return i - 1;
     }
@@ -254,8 +306,14 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   PatternChar pattern_first_char = pattern[0];
   int i = index;
   int n = subject.length() - pattern_length;
+  bool use_memchr = sizeof(SubjectChar) == 1 && sizeof(PatternChar) == 1;
+  if (!use_memchr && n - i >= kWordScanMinLength) {
+    return WordScanSearch(search, subject, index);
+  }
+  int false_starts = 0;
+  int false_starts_index = i;
   while (i <= n) {
-    if (sizeof(SubjectChar) == 1 && sizeof(PatternChar) == 1) {
+    if (use_memchr) {
       const SubjectChar* pos = reinterpret_cast<const SubjectChar*>(
           memchr(subject.start() + i,
                  pattern_first_char,
@@ -272,6 +330,58 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
                     pattern_length - 1)) {
       return i - 1;
     }
+    if (use_memchr && ++false_starts == kWordScanFalseStarts) {
+      if (i - false_starts_index <
+              kWordScanFalseStarts * kWordScanMaxFalseStartDistance &&
+          n - i >= kWordScanMinLength) {
+        return WordScanSearch(search, subject, i);
+      }
+      false_starts = 0;
+      false_starts_index = i;
+    }
+  }
+  return -1;
+}
+
+
+// Linear search for short patterns in long subjects. Compares the first and
+// the last character of the pattern against a word of candidate positions at
+// a time, and only compares the full pattern at positions where both match.
+// This is used for two-byte subjects, and for one-byte subjects where the
+// first character is frequent enough to make memchr stop often.
+template <typename PatternChar, typename SubjectChar>
+int StringSearch<PatternChar, SubjectChar>::WordScanSearch(
+    StringSearch<PatternChar, SubjectChar>* search,
+    Vector<const SubjectChar> subject,
+    int index) {
+  Vector<const PatternChar> pattern = search->pattern_;
+  ASSERT(pattern.length() > 1);
+  int pattern_length = pattern.length();
+  // Characters of a two-byte pattern fit the subject, see the constructor.
+  SubjectChar first_char = static_cast<SubjectChar>(pattern[0]);
+  SubjectChar last_char = static_cast<SubjectChar>(pattern[pattern_length - 1]);
+  uintptr_t repeated_first = RepeatChar(first_char);
+  uintptr_t repeated_last = RepeatChar(last_char);
+  const SubjectChar* chars = subject.start();
+  int i = index;
+  int n = subject.length() - pattern_length;
+  for (; i + kCharsPerWord - 1 <= n; i += kCharsPerWord) {
+    uintptr_t candidates =
+        ZeroLanes(LoadWord(chars + i) ^ repeated_first) &
+        ZeroLanes(LoadWord(chars + i + pattern_length - 1) ^ repeated_last);
+    if (candidates == 0) continue;
+    for (int j = i; j < i + kCharsPerWord; j++) {
+      if (chars[j] == first_char &&
+          CharCompare(pattern.start() + 1, chars + j + 1, pattern_length - 1)) {
+        return j;
+      }
+    }
+  }
+  for (; i <= n; i++) {
+    if (chars[i] == first_char &&
+        CharCompare(pattern.start() + 1, chars + i + 1, pattern_length - 1)) {
+      return i;
+    }
   }
   return -1;
 }
@@ -23,16 +23,77 @@ namespace internal {
 
 
 StubCache::StubCache(Isolate* isolate)
-    : isolate_(isolate) { }
+    : isolate_(isolate) {
+  primary_size_ = 1 << TableBits(isolate->stub_cache_primary_table_bits(),
+                                 FLAG_stub_cache_primary_table_bits);
+  secondary_size_ = 1 << TableBits(isolate->stub_cache_secondary_table_bits(),
+                                   FLAG_stub_cache_secondary_table_bits);
+  primary_mask_ = (primary_size_ - 1) << kHeapObjectTagSize;
+  secondary_mask_ = (secondary_size_ - 1) << kHeapObjectTagSize;
+  // The tables must exist before any external reference to them is taken.
+  primary_ = NewArray<Entry>(primary_size_);
+  secondary_ = NewArray<Entry>(secondary_size_);
+}
+
+
+StubCache::~StubCache() {
+  DeleteArray(primary_);
+  DeleteArray(secondary_);
+}
+
+
+int StubCache::TableBits(int requested_bits, int flag_bits) {
+  int bits = requested_bits != 0 ? requested_bits : flag_bits;
+  return Max(kMinTableBits, Min(kMaxTableBits, bits));
+}
 
 
 void StubCache::Initialize() {
-  ASSERT(IsPowerOf2(kPrimaryTableSize));
-  ASSERT(IsPowerOf2(kSecondaryTableSize));
+  ASSERT(IsPowerOf2(primary_size_));
+  ASSERT(IsPowerOf2(secondary_size_));
   Clear();
 }
 
 
+// Entries hold handlers, whose extra IC state is the kind of IC using them.
+static bool IsLoadEntry(Code::Flags flags) {
+  Code::Kind kind = Code::ExtractKindFromFlags(flags);
+  if (kind == Code::HANDLER) {
+    kind = static_cast<Code::Kind>(Code::ExtractExtraICStateFromFlags(flags));
+  }
+  return kind == Code::LOAD_IC || kind == Code::KEYED_LOAD_IC;
+}
+
+
+StatsCounter* StubCache::hit_counter(Code::Flags flags, Table table) {
+  Counters* counters = isolate()->counters();
+  if (IsLoadEntry(flags)) {
+    return table == kPrimary ? counters->stub_cache_load_primary_hits()
+                             : counters->stub_cache_load_secondary_hits();
+  }
+  return table == kPrimary ? counters->stub_cache_store_primary_hits()
+                           : counters->stub_cache_store_secondary_hits();
+}
+
+
+StatsCounter* StubCache::miss_counter(Code::Flags flags) {
+  Counters* counters = isolate()->counters();
+  return IsLoadEntry(flags) ? counters->stub_cache_load_misses()
+                            : counters->stub_cache_store_misses();
+}
+
+
+StatsCounter* StubCache::collision_counter(Code::Flags flags, Table table) {
+  Counters* counters = isolate()->counters();
+  if (IsLoadEntry(flags)) {
+    return table == kPrimary ? counters->stub_cache_load_primary_collisions()
+                             : counters->stub_cache_load_secondary_collisions();
+  }
+  return table == kPrimary ? counters->stub_cache_store_primary_collisions()
+                           : counters->stub_cache_store_secondary_collisions();
+}
+
+
 Code* StubCache::Set(Name* name, Map* map, Code* code) {
   // Get the flags from the code.
   Code::Flags flags = Code::RemoveTypeFromFlags(code->flags());
@@ -59,12 +120,19 @@ Code* StubCache::Set(Name* name, Map* map, Code* code) {
 
   // If the primary entry has useful data in it, we retire it to the
   // secondary cache before overwriting it.
-  if (old_code != isolate_->builtins()->builtin(Builtins::kIllegal)) {
+  Code* empty = isolate_->builtins()->builtin(Builtins::kIllegal);
+  if (old_code != empty) {
     Map* old_map = primary->map;
     Code::Flags old_flags = Code::RemoveTypeFromFlags(old_code->flags());
     int seed = PrimaryOffset(primary->key, old_flags, old_map);
     int secondary_offset = SecondaryOffset(primary->key, old_flags, seed);
     Entry* secondary = entry(secondary_, secondary_offset);
+    if (primary->key != name || primary->map != map) {
+      collision_counter(flags, kPrimary)->Increment();
+    }
+    if (secondary->value != empty) {
+      collision_counter(flags, kSecondary)->Increment();
+    }
     *secondary = *primary;
   }
 
@@ -397,12 +465,12 @@ Handle<Code> StubCache::ComputeStoreElementPolymorphic(
 
 void StubCache::Clear() {
   Code* empty = isolate_->builtins()->builtin(Builtins::kIllegal);
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_size_; i++) {
     primary_[i].key = heap()->empty_string();
     primary_[i].map = NULL;
     primary_[i].value = empty;
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_size_; j++) {
     secondary_[j].key = heap()->empty_string();
     secondary_[j].map = NULL;
     secondary_[j].value = empty;
@@ -415,7 +483,7 @@ void StubCache::CollectMatchingMaps(SmallMapList* types,
                                     Code::Flags flags,
                                     Handle<Context> native_context,
                                     Zone* zone) {
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_size_; i++) {
     if (primary_[i].key == *name) {
       Map* map = primary_[i].map;
       // Map can be NULL, if the stub is constant function call
@@ -430,7 +498,7 @@ void StubCache::CollectMatchingMaps(SmallMapList* types,
     }
   }
 
-  for (int i = 0; i < kSecondaryTableSize; i++) {
+  for (int i = 0; i < secondary_size_; i++) {
     if (secondary_[i].key == *name) {
       Map* map = secondary_[i].map;
       // Map can be NULL, if the stub is constant function call
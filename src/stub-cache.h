@@ -160,6 +160,15 @@ class StubCache {
   }
 
 
+  // The mask that turns a hash into an offset into the given table. Table
+  // sizes are chosen when the isolate is created, so generated code loads the
+  // mask from here instead of embedding it.
+  SCTableReference mask_reference(StubCache::Table table) {
+    return SCTableReference(reinterpret_cast<Address>(
+        table == kPrimary ? &primary_mask_ : &secondary_mask_));
+  }
+
+
   StubCache::Entry* first_entry(StubCache::Table table) {
     switch (table) {
       case StubCache::kPrimary: return StubCache::primary_;
@@ -169,6 +178,18 @@ class StubCache {
     return NULL;
   }
 
+  int primary_table_size() const { return primary_size_; }
+  int secondary_table_size() const { return secondary_size_; }
+
+  // Native counters for probes of the given table by ICs with the given
+  // flags. Only maintained with --native-code-counters.
+  StatsCounter* hit_counter(Code::Flags flags, Table table);
+  StatsCounter* miss_counter(Code::Flags flags);
+  StatsCounter* collision_counter(Code::Flags flags, Table table);
+
+  static const int kMinTableBits = 4;
+  static const int kMaxTableBits = 16;
+
   Isolate* isolate() { return isolate_; }
   Heap* heap() { return isolate()->heap(); }
   Factory* factory() { return isolate()->factory(); }
@@ -185,6 +206,7 @@ class StubCache {
 
  private:
   explicit StubCache(Isolate* isolate);
+  ~StubCache();
 
   // The stub cache has a primary and secondary level.  The two levels have
   // different hashing algorithms in order to avoid simultaneous collisions
@@ -196,7 +218,7 @@ class StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kHeapObjectTagSize.
-  static int PrimaryOffset(Name* name, Code::Flags flags, Map* map) {
+  int PrimaryOffset(Name* name, Code::Flags flags, Map* map) {
     // This works well because the heap object tag size and the hash
     // shift are equal.  Shifting down the length field to get the
     // hash code would effectively throw away two bits of the hash
@@ -216,13 +238,13 @@ class StubCache {
         (static_cast<uint32_t>(flags) & ~Code::kFlagsNotUsedInLookup);
     // Base the offset on a simple combination of name, flags, and map.
     uint32_t key = (map_low32bits + field) ^ iflags;
-    return key & ((kPrimaryTableSize - 1) << kHeapObjectTagSize);
+    return key & primary_mask_;
   }
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kHeapObjectTagSize.
-  static int SecondaryOffset(Name* name, Code::Flags flags, int seed) {
+  int SecondaryOffset(Name* name, Code::Flags flags, int seed) {
     // Use the seed from the primary cache in the secondary cache.
     uint32_t name_low32bits =
         static_cast<uint32_t>(reinterpret_cast<uintptr_t>(name));
@@ -231,7 +253,7 @@ class StubCache {
     uint32_t iflags =
         (static_cast<uint32_t>(flags) & ~Code::kFlagsNotUsedInLookup);
     uint32_t key = (seed - name_low32bits) + iflags;
-    return key & ((kSecondaryTableSize - 1) << kHeapObjectTagSize);
+    return key & secondary_mask_;
   }
 
   // Compute the entry for a given offset in exactly the same way as
@@ -245,13 +267,17 @@ class StubCache {
         reinterpret_cast<Address>(table) + offset * multiplier);
   }
 
-  static const int kPrimaryTableBits = 11;
-  static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
-  static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
-
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  // Returns the requested table size in bits, or the given flag value if no
+  // size was requested, clamped to the supported range.
+  static int TableBits(int requested_bits, int flag_bits);
+
+  int primary_size_;
+  int secondary_size_;
+  // (size - 1) << kHeapObjectTagSize, read by generated code.
+  intptr_t primary_mask_;
+  intptr_t secondary_mask_;
+  Entry* primary_;
+  Entry* secondary_;
   Isolate* isolate_;
 
   friend class Isolate;
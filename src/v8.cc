@@ -8,6 +8,7 @@
 #include "src/base/once.h"
 #include "src/base/platform/platform.h"
 #include "src/bootstrapper.h"
+#include "src/compilation-cache.h"
 #include "src/debug.h"
 #include "src/deoptimizer.h"
 #include "src/elements.h"
@@ -59,6 +60,8 @@ void V8::TearDown() {
   LOperand::TearDownCaches();
   ExternalReference::TearDownMathExpData();
   RegisteredExtension::UnregisterAll();
+  SharedScriptCache::TearDown();
+  ZoneSegmentPool::TearDown();
   Isolate::GlobalTearDown();
 
   Sampler::TearDown();
@@ -325,11 +325,36 @@ static void GenerateKeyNameCheck(MacroAssembler* masm,
 }
 
 
+// Replaces the non-internalized string in |key| with the equal string from
+// the string table. Jumps to |not_found| with |key| unchanged if there is no
+// such string or the key is an array index. The lookup does not allocate,
+// so it is done in C without entering the runtime.
+static void GenerateTryInternalizeKey(MacroAssembler* masm,
+                                      Register key,
+                                      Label* not_found) {
+  Label found;
+  __ Pushad();
+  __ movp(arg_reg_1, key);
+  {
+    AllowExternalCallThatCantCauseGC scope(masm);
+    __ PrepareCallCFunction(1);
+    __ CallCFunction(
+        ExternalReference::try_internalize_string_function(masm->isolate()), 1);
+  }
+  __ JumpIfNotSmi(rax, &found, Label::kNear);
+  __ Popad();
+  __ jmp(not_found);
+
+  __ bind(&found);
+  __ StoreToSafepointRegisterSlot(key, rax);
+  __ Popad();
+}
+
 
 void KeyedLoadIC::GenerateGeneric(MacroAssembler* masm) {
   // The return address is on the stack.
   Label slow, check_name, index_smi, index_name, property_array_property;
-  Label probe_dictionary, check_number_dictionary;
+  Label probe_dictionary, check_number_dictionary, not_unique;
 
   Register receiver = ReceiverRegister();
   Register key = NameRegister();
@@ -379,7 +404,7 @@ void KeyedLoadIC::GenerateGeneric(MacroAssembler* masm) {
   GenerateRuntimeGetProperty(masm);
 
   __ bind(&check_name);
-  GenerateKeyNameCheck(masm, key, rax, rbx, &index_name, &slow);
+  GenerateKeyNameCheck(masm, key, rax, rbx, &index_name, &not_unique);
 
   GenerateKeyedLoadReceiverCheck(
       masm, receiver, rax, Map::kHasNamedInterceptor, &slow);
@@ -481,6 +506,14 @@ void KeyedLoadIC::GenerateGeneric(MacroAssembler* masm) {
   __ bind(&index_name);
   __ IndexFromHash(rbx, key);
   __ jmp(&index_smi);
+
+  // A string key that is not internalized can still be looked up by the
+  // stub if the string table holds an equal string. rax holds the key map.
+  __ bind(&not_unique);
+  __ CmpInstanceType(rax, FIRST_NONSTRING_TYPE);
+  __ j(above_equal, &slow);
+  GenerateTryInternalizeKey(masm, key, &slow);
+  __ jmp(&check_name);
 }
 
 
@@ -714,6 +747,7 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   Label slow, slow_with_tagged_index, fast_object, fast_object_grow;
   Label fast_double, fast_double_grow;
   Label array, extra, check_if_double_array;
+  Label maybe_name_key, unique_name_key, not_unique;
 
   // Check that the object isn't a smi.
   __ JumpIfSmi(rdx, &slow_with_tagged_index);
@@ -725,7 +759,7 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
            Immediate(1 << Map::kIsAccessCheckNeeded | 1 << Map::kIsObserved));
   __ j(not_zero, &slow_with_tagged_index);
   // Check that the key is a smi.
-  __ JumpIfNotSmi(rcx, &slow_with_tagged_index);
+  __ JumpIfNotSmi(rcx, &maybe_name_key);
   __ SmiToInteger32(rcx, rcx);
 
   __ CmpInstanceType(r9, JS_ARRAY_TYPE);
@@ -795,6 +829,30 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
                                   &slow, kCheckMap, kDontIncrementLength);
   KeyedStoreGenerateGenericHelper(masm, &fast_object_grow, &fast_double_grow,
                                   &slow, kDontCheckMap, kIncrementLength);
+
+  // Name key case: store to an existing writable data property of an object
+  // with dictionary properties without calling the runtime.
+  // rax: value
+  // rcx: key
+  // rdx: receiver
+  __ bind(&maybe_name_key);
+  GenerateKeyNameCheck(masm, rcx, rbx, rdi, &slow_with_tagged_index,
+                       &not_unique);
+  __ bind(&unique_name_key);
+  GenerateNameDictionaryReceiverCheck(masm, rdx, rbx, rdi,
+                                      &slow_with_tagged_index);
+  GenerateDictionaryStore(masm, &slow_with_tagged_index, rbx, rcx, rax, rdi,
+                          r8);
+  __ IncrementCounter(masm->isolate()->counters()->keyed_store_generic_dict(),
+                      1);
+  __ ret(0);
+
+  // rbx: key map
+  __ bind(&not_unique);
+  __ CmpInstanceType(rbx, FIRST_NONSTRING_TYPE);
+  __ j(above_equal, &slow_with_tagged_index);
+  GenerateTryInternalizeKey(masm, rcx, &slow_with_tagged_index);
+  __ jmp(&unique_name_key);
 }
 
 
@@ -78,6 +78,14 @@ static void ProbeTable(Isolate* isolate,
     }
 #endif
 
+  StatsCounter* hits = isolate->stub_cache()->hit_counter(flags, table);
+  if (FLAG_native_code_counters && hits->Enabled()) {
+    // IncrementCounter may clobber kScratchRegister, which holds the code.
+    __ movp(offset, kScratchRegister);
+    __ IncrementCounter(hits, 1);
+    __ movp(kScratchRegister, offset);
+  }
+
   // Jump to the first instruction in the code stub.
   __ addp(kScratchRegister, Immediate(Code::kHeaderSize - kHeapObjectTag));
   __ jmp(kScratchRegister);
@@ -168,6 +176,10 @@ void StubCache::GenerateProbe(MacroAssembler* masm,
   // Check that the receiver isn't a smi.
   __ JumpIfSmi(receiver, &miss);
 
+  // The table sizes are only known at runtime, so the masks are loaded.
+  ExternalReference primary_mask(mask_reference(kPrimary));
+  ExternalReference secondary_mask(mask_reference(kSecondary));
+
   // Get the map of the receiver and compute the hash.
   __ movl(scratch, FieldOperand(name, Name::kHashFieldOffset));
   // Use only the low 32 bits of the map pointer.
@@ -175,7 +187,7 @@ void StubCache::GenerateProbe(MacroAssembler* masm,
   __ xorp(scratch, Immediate(flags));
   // We mask out the last two bits because they are not part of the hash and
   // they are always 01 for maps.  Also in the two 'and' instructions below.
-  __ andp(scratch, Immediate((kPrimaryTableSize - 1) << kHeapObjectTagSize));
+  __ andp(scratch, masm->ExternalOperand(primary_mask));
 
   // Probe the primary table.
   ProbeTable(isolate, masm, flags, kPrimary, receiver, name, scratch);
@@ -184,10 +196,10 @@ void StubCache::GenerateProbe(MacroAssembler* masm,
   __ movl(scratch, FieldOperand(name, Name::kHashFieldOffset));
   __ addl(scratch, FieldOperand(receiver, HeapObject::kMapOffset));
   __ xorp(scratch, Immediate(flags));
-  __ andp(scratch, Immediate((kPrimaryTableSize - 1) << kHeapObjectTagSize));
+  __ andp(scratch, masm->ExternalOperand(primary_mask));
   __ subl(scratch, name);
   __ addl(scratch, Immediate(flags));
-  __ andp(scratch, Immediate((kSecondaryTableSize - 1) << kHeapObjectTagSize));
+  __ andp(scratch, masm->ExternalOperand(secondary_mask));
 
   // Probe the secondary table.
   ProbeTable(isolate, masm, flags, kSecondary, receiver, name, scratch);
@@ -196,6 +208,7 @@ void StubCache::GenerateProbe(MacroAssembler* masm,
   // entering the runtime system.
   __ bind(&miss);
   __ IncrementCounter(counters->megamorphic_stub_cache_misses(), 1);
+  __ IncrementCounter(miss_counter(flags), 1);
 }
 
 
@@ -305,6 +305,32 @@ static void GenerateKeyNameCheck(MacroAssembler* masm,
 }
 
 
+// Replaces the non-internalized string in |key| with the equal string from
+// the string table. Jumps to |not_found| with |key| unchanged if there is no
+// such string or the key is an array index. The lookup does not allocate,
+// so it is done in C without entering the runtime.
+static void GenerateTryInternalizeKey(MacroAssembler* masm,
+                                      Register key,
+                                      Label* not_found) {
+  Label found;
+  __ pushad();
+  {
+    AllowExternalCallThatCantCauseGC scope(masm);
+    __ PrepareCallCFunction(1, eax);
+    __ mov(Operand(esp, 0), key);
+    __ CallCFunction(
+        ExternalReference::try_internalize_string_function(masm->isolate()), 1);
+  }
+  __ JumpIfNotSmi(eax, &found, Label::kNear);
+  __ popad();
+  __ jmp(not_found);
+
+  __ bind(&found);
+  __ StoreToSafepointRegisterSlot(key, eax);
+  __ popad();
+}
+
+
 static Operand GenerateMappedArgumentsLookup(MacroAssembler* masm,
                                              Register object,
                                              Register key,
@@ -385,7 +411,7 @@ static Operand GenerateUnmappedArgumentsLookup(MacroAssembler* masm,
 void KeyedLoadIC::GenerateGeneric(MacroAssembler* masm) {
   // The return address is on the stack.
   Label slow, check_name, index_smi, index_name, property_array_property;
-  Label probe_dictionary, check_number_dictionary;
+  Label probe_dictionary, check_number_dictionary, not_unique;
 
   Register receiver = ReceiverRegister();
   Register key = NameRegister();
@@ -441,7 +467,7 @@ void KeyedLoadIC::GenerateGeneric(MacroAssembler* masm) {
   GenerateRuntimeGetProperty(masm);
 
   __ bind(&check_name);
-  GenerateKeyNameCheck(masm, key, eax, ebx, &index_name, &slow);
+  GenerateKeyNameCheck(masm, key, eax, ebx, &index_name, &not_unique);
 
   GenerateKeyedLoadReceiverCheck(
       masm, receiver, eax, Map::kHasNamedInterceptor, &slow);
@@ -552,6 +578,14 @@ void KeyedLoadIC::GenerateGeneric(MacroAssembler* masm) {
   __ IndexFromHash(ebx, key);
   // Now jump to the place where smi keys are handled.
   __ jmp(&index_smi);
+
+  // A string key that is not internalized can still be looked up by the
+  // stub if the string table holds an equal string. eax holds the key map.
+  __ bind(&not_unique);
+  __ CmpInstanceType(eax, FIRST_NONSTRING_TYPE);
+  __ j(above_equal, &slow);
+  GenerateTryInternalizeKey(masm, key, &slow);
+  __ jmp(&check_name);
 }
 
 
@@ -851,6 +885,7 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   Label slow, fast_object, fast_object_grow;
   Label fast_double, fast_double_grow;
   Label array, extra, check_if_double_array;
+  Label maybe_name_key, unique_name_key, not_unique, restore_slow;
 
   // Check that the object isn't a smi.
   __ JumpIfSmi(edx, &slow);
@@ -862,7 +897,7 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
             1 << Map::kIsAccessCheckNeeded | 1 << Map::kIsObserved);
   __ j(not_zero, &slow);
   // Check that the key is a smi.
-  __ JumpIfNotSmi(ecx, &slow);
+  __ JumpIfNotSmi(ecx, &maybe_name_key);
   __ CmpInstanceType(edi, JS_ARRAY_TYPE);
   __ j(equal, &array);
   // Check that the object is some kind of JSObject.
@@ -926,6 +961,34 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
                                   &slow, kCheckMap, kDontIncrementLength);
   KeyedStoreGenerateGenericHelper(masm, &fast_object_grow, &fast_double_grow,
                                   &slow, kDontCheckMap, kIncrementLength);
+
+  // Name key case: store to an existing writable data property of an object
+  // with dictionary properties without calling the runtime.
+  // eax: value
+  // ecx: key
+  // edx: receiver
+  __ bind(&maybe_name_key);
+  GenerateKeyNameCheck(masm, ecx, ebx, edi, &slow, &not_unique);
+  __ bind(&unique_name_key);
+  GenerateNameDictionaryReceiverCheck(masm, edx, ebx, edi, &slow);
+  // Push and restore the receiver to free up a register for the store.
+  __ push(edx);
+  GenerateDictionaryStore(masm, &restore_slow, ebx, ecx, eax, edx, edi);
+  __ Drop(1);
+  __ IncrementCounter(masm->isolate()->counters()->keyed_store_generic_dict(),
+                      1);
+  __ ret(0);
+
+  __ bind(&restore_slow);
+  __ pop(edx);
+  __ jmp(&slow);
+
+  // ebx: key map
+  __ bind(&not_unique);
+  __ CmpInstanceType(ebx, FIRST_NONSTRING_TYPE);
+  __ j(above_equal, &slow);
+  GenerateTryInternalizeKey(masm, ecx, &slow);
+  __ jmp(&unique_name_key);
 }
 
 
@@ -15,7 +15,8 @@ namespace internal {
 // (encoded in the this pointer) and a size in bytes. Segments are
 // chained together forming a LIFO structure with the newest segment
 // available as segment_head_. Segments are allocated using malloc()
-// and de-allocated using free().
+// and de-allocated using free(), unless they can be reused from or
+// returned to the ZoneSegmentPool.
 
 class Segment {
  public:
@@ -44,6 +45,71 @@ class Segment {
 };
 
 
+Segment* ZoneSegmentPool::free_segments_[kSizeClassCount];
+size_t ZoneSegmentPool::size_ = 0;
+static base::LazyMutex zone_segment_pool_mutex = LAZY_MUTEX_INITIALIZER;
+
+
+int ZoneSegmentPool::SizeClass(int size) {
+  STATIC_ASSERT(Zone::kMinimumSegmentSize << (kSizeClassCount - 1) ==
+                Zone::kMaximumSegmentSize);
+  if (size < Zone::kMinimumSegmentSize ||
+      size > Zone::kMaximumSegmentSize ||
+      !IsPowerOf2(size)) {
+    return -1;
+  }
+  return WhichPowerOf2(size) - WhichPowerOf2(Zone::kMinimumSegmentSize);
+}
+
+
+Segment* ZoneSegmentPool::Take(int size) {
+  int size_class = SizeClass(size);
+  if (size_class == -1) return NULL;
+  base::LockGuard<base::Mutex> lock_guard(zone_segment_pool_mutex.Pointer());
+  Segment* result = free_segments_[size_class];
+  if (result != NULL) {
+    free_segments_[size_class] = result->next();
+    size_ -= size;
+  }
+  return result;
+}
+
+
+void ZoneSegmentPool::Release(Segment* segment, int size) {
+  int size_class = SizeClass(size);
+  if (size_class != -1) {
+    size_t max_size = static_cast<size_t>(FLAG_zone_segment_pool_size) * MB;
+    base::LockGuard<base::Mutex> lock_guard(zone_segment_pool_mutex.Pointer());
+    if (size_ + size <= max_size) {
+      segment->Initialize(free_segments_[size_class], size);
+      free_segments_[size_class] = segment;
+      size_ += size;
+      return;
+    }
+  }
+  Malloced::Delete(segment);
+}
+
+
+void ZoneSegmentPool::TearDown() {
+  base::LockGuard<base::Mutex> lock_guard(zone_segment_pool_mutex.Pointer());
+  for (int i = 0; i < kSizeClassCount; i++) {
+    while (free_segments_[i] != NULL) {
+      Segment* segment = free_segments_[i];
+      free_segments_[i] = segment->next();
+      Malloced::Delete(segment);
+    }
+  }
+  size_ = 0;
+}
+
+
+size_t ZoneSegmentPool::size() {
+  base::LockGuard<base::Mutex> lock_guard(zone_segment_pool_mutex.Pointer());
+  return size_;
+}
+
+
 Zone::Zone(Isolate* isolate)
     : allocation_size_(0),
       segment_bytes_allocated_(0),
@@ -140,7 +206,15 @@ void Zone::DeleteKeptSegment() {
 // Creates a new segment, sets it size, and pushes it to the front
 // of the segment chain. Returns the new segment.
 Segment* Zone::NewSegment(int size) {
-  Segment* result = reinterpret_cast<Segment*>(Malloced::New(size));
+  Segment* result = ZoneSegmentPool::Take(size);
+  if (result != NULL) {
+    // The segment may still be poisoned from its previous zone.
+    ASAN_UNPOISON_MEMORY_REGION(result, size);
+    isolate_->counters()->zone_segments_reused()->Increment();
+  } else {
+    result = reinterpret_cast<Segment*>(Malloced::New(size));
+    isolate_->counters()->zone_segments_allocated()->Increment();
+  }
   adjust_segment_bytes_allocated(size);
   if (result != NULL) {
     result->Initialize(segment_head_, size);
@@ -153,7 +227,7 @@ Segment* Zone::NewSegment(int size) {
 // Deletes the given segment. Does not touch the segment chain.
 void Zone::DeleteSegment(Segment* segment, int size) {
   adjust_segment_bytes_allocated(-size);
-  Malloced::Delete(segment);
+  ZoneSegmentPool::Release(segment, size);
 }
 
 
@@ -187,6 +261,15 @@ Address Zone::NewExpand(int size) {
     // All the while making sure to allocate a segment large enough to hold the
     // requested size.
     new_size = Max(min_new_size, static_cast<size_t>(kMaximumSegmentSize));
+  } else {
+    // Round to a power of two, so that the segment can be pooled, but keep
+    // the growth rate when there is room for the requested size.
+    size_t rounded = RoundUpToPowerOf2(static_cast<uint32_t>(new_size));
+    if (rounded / 2 >= Max(min_new_size,
+                           static_cast<size_t>(kMinimumSegmentSize))) {
+      rounded /= 2;
+    }
+    new_size = rounded;
   }
   if (new_size > INT_MAX) {
     V8::FatalProcessOutOfMemory("Zone");
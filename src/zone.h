@@ -63,6 +63,7 @@ class Zone {
 
  private:
   friend class Isolate;
+  friend class ZoneSegmentPool;
 
   // All pointers returned from New() have this alignment.  In addition, if the
   // object being allocated has a size that is divisible by 8 then its alignment
@@ -74,7 +75,8 @@ class Zone {
   static const int kAlignment = kPointerSize;
 #endif
 
-  // Never allocate segments smaller than this size in bytes.
+  // Never allocate segments smaller than this size in bytes. Segment sizes
+  // up to kMaximumSegmentSize are powers of two (see ZoneSegmentPool).
   static const int kMinimumSegmentSize = 8 * KB;
 
   // Never allocate segments larger than this size in bytes.
@@ -118,6 +120,42 @@ class Zone {
 };
 
 
+// A process wide pool of free zone segments. Zones come and go all the
+// time, e.g. one for every compilation, and would otherwise malloc and free
+// their segments anew each time. Segments of the same power of two size are
+// interchangeable, so the pool keeps them by size, up to a total of
+// --zone-segment-pool-size MB. The pool is shared by all threads, which only
+// take its lock once per segment, i.e. at most once per kMinimumSegmentSize
+// bytes of zone allocation.
+class ZoneSegmentPool : public AllStatic {
+ public:
+  // Returns a free segment of the given size, or NULL.
+  static Segment* Take(int size);
+
+  // Keeps the segment for reuse if it has a pooled size and the pool has
+  // room for it, and frees it otherwise.
+  static void Release(Segment* segment, int size);
+
+  // Frees all segments in the pool.
+  static void TearDown();
+
+  // The memory held by the pool, in bytes.
+  static size_t size();
+
+ private:
+  // Pooled sizes are the powers of two from kMinimumSegmentSize to
+  // kMaximumSegmentSize of Zone.
+  static const int kSizeClassCount = 8;
+
+  // Returns the index of the free list for segments of the given size, or -1
+  // if segments of this size are not pooled.
+  static int SizeClass(int size);
+
+  static Segment* free_segments_[kSizeClassCount];
+  static size_t size_;
+};
+
+
 // ZoneObject is an abstraction that helps define classes of objects
 // allocated in the Zone. Use it as a base class; see ast.h.
 class ZoneObject {
@@ -237,3 +237,34 @@ TEST(CodeRange) {
 
   code_range.TearDown();
 }
+
+
+static size_t AllocateInNewZone(Isolate* isolate, int count, int size) {
+  Zone zone(isolate);
+  for (int i = 0; i < count; i++) zone.New(size);
+  return ZoneSegmentPool::size();
+}
+
+
+TEST(ZoneSegmentPool) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  ZoneSegmentPool::TearDown();
+
+  // The segments of a deleted zone are pooled, and a zone that grows the
+  // same way takes all of them out of the pool again.
+  AllocateInNewZone(isolate, 100, 1 * KB);
+  size_t pooled = ZoneSegmentPool::size();
+  CHECK_GT(static_cast<int>(pooled), 100 * KB);
+  CHECK_EQ(0, static_cast<int>(AllocateInNewZone(isolate, 100, 1 * KB)));
+  CHECK_EQ(static_cast<int>(pooled),
+           static_cast<int>(ZoneSegmentPool::size()));
+
+  // Oversized segments are not pooled.
+  AllocateInNewZone(isolate, 1, 2 * MB);
+  CHECK_EQ(static_cast<int>(pooled),
+           static_cast<int>(ZoneSegmentPool::size()));
+
+  ZoneSegmentPool::TearDown();
+  CHECK_EQ(0, static_cast<int>(ZoneSegmentPool::size()));
+}
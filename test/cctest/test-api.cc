@@ -47,6 +47,7 @@
 #include "src/objects.h"
 #include "src/parser.h"
 #include "src/snapshot.h"
+#include "src/stub-cache.h"
 #include "src/unicode-inl.h"
 #include "src/utils.h"
 #include "src/vm-state.h"
@@ -14915,6 +14916,152 @@ TEST(CompileWithInvalidCachedData) {
 }
 
 
+// A cache store which keeps the last stored entry in memory.
+class SingleEntryCacheStore : public v8::ScriptCompiler::CacheStore {
+ public:
+  SingleEntryCacheStore() : data_(NULL), length_(0), lookups_(0), stores_(0) {
+    key_[0] = '\0';
+  }
+  virtual ~SingleEntryCacheStore() { delete[] data_; }
+
+  virtual v8::ScriptCompiler::CachedData* Lookup(const char* key) {
+    lookups_++;
+    if (data_ == NULL || strcmp(key, key_) != 0) return NULL;
+    uint8_t* copy = new uint8_t[length_];
+    i::MemCopy(copy, data_, length_);
+    return new v8::ScriptCompiler::CachedData(
+        copy, length_, v8::ScriptCompiler::CachedData::BufferOwned);
+  }
+
+  virtual void Store(const char* key, const uint8_t* data, int length) {
+    stores_++;
+    CHECK(strlen(key) < sizeof(key_));
+    i::StrNCpy(i::Vector<char>(key_, sizeof(key_)), key, sizeof(key_));
+    delete[] data_;
+    data_ = new uint8_t[length];
+    i::MemCopy(data_, data, length);
+    length_ = length;
+  }
+
+  uint8_t* data() { return data_; }
+  int length() { return length_; }
+  int lookups() { return lookups_; }
+  int stores() { return stores_; }
+
+ private:
+  char key_[128];
+  uint8_t* data_;
+  int length_;
+  int lookups_;
+  int stores_;
+};
+
+
+TEST(PersistentScriptCache) {
+  v8::V8::Initialize();
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+  i::FLAG_min_preparse_length = 0;
+  i::CompilationCache* compilation_cache =
+      CcTest::i_isolate()->compilation_cache();
+  SingleEntryCacheStore store;
+  isolate->SetScriptCacheStore(&store);
+
+  const char* source = "function foo() { return 5; }\n"
+      "function bar() { return foo() + 7; }  bar();";
+  CHECK_EQ(12, CompileRun(source)->Int32Value());
+  CHECK_EQ(1, store.lookups());
+  CHECK_EQ(1, store.stores());
+  CHECK_GT(store.length(), 0);
+
+  // A script found in the compilation cache does not use the store.
+  CHECK_EQ(12, CompileRun(source)->Int32Value());
+  CHECK_EQ(1, store.lookups());
+
+  // Without the compilation cache, the stored data is used.
+  compilation_cache->Clear();
+  CHECK_EQ(12, CompileRun(source)->Int32Value());
+  CHECK_EQ(2, store.lookups());
+  CHECK_EQ(1, store.stores());
+
+  // A different source does not find the stored data.
+  compilation_cache->Clear();
+  CHECK_EQ(13, CompileRun("function foo() { return 6; }\n"
+                          "function bar() { return foo() + 7; }  bar();")
+                   ->Int32Value());
+  CHECK_EQ(3, store.lookups());
+  CHECK_EQ(2, store.stores());
+
+  // Corrupted data is ignored, and the data is produced again.
+  compilation_cache->Clear();
+  store.data()[store.length() - 1] ^= 0xff;
+  v8::TryCatch try_catch;
+  CHECK_EQ(13, CompileRun("function foo() { return 6; }\n"
+                          "function bar() { return foo() + 7; }  bar();")
+                   ->Int32Value());
+  CHECK(!try_catch.HasCaught());
+  CHECK_EQ(4, store.lookups());
+  CHECK_EQ(3, store.stores());
+
+  isolate->SetScriptCacheStore(NULL);
+}
+
+
+TEST(SharedScriptCache) {
+  i::FLAG_shared_script_cache = true;
+  i::FLAG_min_preparse_length = 0;
+  const char* source = "function foo() { return 5; }\n"
+      "function bar() { return foo() + 7; }  bar();";
+  for (int i = 0; i < 2; i++) {
+    v8::Isolate* isolate = v8::Isolate::New();
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope scope(isolate);
+      LocalContext context(isolate);
+      CHECK_EQ(12, CompileRun(source)->Int32Value());
+    }
+    isolate->Dispose();
+    // The second isolate uses the data the first one inserted.
+    CHECK_EQ(1, i::SharedScriptCache::length());
+  }
+  CHECK_GT(i::SharedScriptCache::size(), 0);
+
+  // Entries are copied in and out of the cache.
+  i::ScriptData* data = i::SharedScriptCache::Lookup("no such key");
+  CHECK_EQ(NULL, data);
+  {
+    v8::Isolate* isolate = v8::Isolate::New();
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope scope(isolate);
+      LocalContext context(isolate);
+      v8::ScriptCompiler::Source other(v8_str("function baz() {}"));
+      v8::ScriptCompiler::CompileUnbound(
+          isolate, &other, v8::ScriptCompiler::kProduceDataToCache);
+      const v8::ScriptCompiler::CachedData* cd = other.GetCachedData();
+      data = i::ScriptData::New(reinterpret_cast<const char*>(cd->data),
+                                cd->length);
+      i::SharedScriptCache::Insert("key", data);
+      delete data;
+    }
+    isolate->Dispose();
+  }
+  CHECK_EQ(2, i::SharedScriptCache::length());
+  data = i::SharedScriptCache::Lookup("key");
+  CHECK(data->SanityCheck());
+  delete data;
+
+  // The least recently used entries are evicted.
+  i::FLAG_shared_script_cache_size = 0;
+  data = i::SharedScriptCache::Lookup("key");
+  i::SharedScriptCache::Insert("another key", data);
+  delete data;
+  CHECK_EQ(0, i::SharedScriptCache::length());
+  CHECK(i::SharedScriptCache::size() == 0);
+}
+
+
 // This tests that we do not allow dictionary load/call inline caches
 // to use functions that have not yet been compiled.  The potential
 // problem of loading a function that has not yet been compiled can
@@ -17811,6 +17958,29 @@ TEST(SetResourceConstraintsInThread) {
 }
 
 
+TEST(SetResourceConstraintsStubCacheSize) {
+  v8::Isolate* isolate = v8::Isolate::New();
+  v8::ResourceConstraints constraints;
+  constraints.set_stub_cache_primary_table_bits(6);
+  constraints.set_stub_cache_secondary_table_bits(
+      i::StubCache::kMaxTableBits + 4);
+  CHECK(v8::SetResourceConstraints(isolate, &constraints));
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope scope(isolate);
+    LocalContext env(isolate);
+    CompileRun("var o = { x: 1 }; for (var i = 0; i < 10; i++) o.x;");
+
+    i::StubCache* stub_cache =
+        reinterpret_cast<i::Isolate*>(isolate)->stub_cache();
+    CHECK_EQ(1 << 6, stub_cache->primary_table_size());
+    CHECK_EQ(1 << i::StubCache::kMaxTableBits,
+             stub_cache->secondary_table_size());
+  }
+  isolate->Dispose();
+}
+
+
 THREADED_TEST(GetHeapStatistics) {
   LocalContext c1;
   v8::HandleScope scope(c1->GetIsolate());
@@ -17945,6 +18115,64 @@ TEST(VisitExternalStrings) {
 }
 
 
+static void WriteTestFile(i::Vector<char> name,
+                          const char* suffix,
+                          const void* data,
+                          size_t size) {
+  i::SNPrintF(name, "%s.%s", i::FLAG_testing_serialization_file, suffix);
+  FILE* file = v8::base::OS::FOpen(name.start(), "wb");
+  CHECK(file != NULL);
+  CHECK(fwrite(data, 1, size, file) == size);
+  fclose(file);
+}
+
+
+TEST(ExternalStringFromFile) {
+  i::EmbeddedVector<char, 256> one_byte_name;
+  i::EmbeddedVector<char, 256> two_byte_name;
+  i::EmbeddedVector<char, 256> empty_name;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+
+  {
+    v8::HandleScope scope(isolate);
+    const char* source = "var mapped = 6 * 7; mapped";
+    WriteTestFile(one_byte_name, "one-byte", source, strlen(source));
+    Local<String> string =
+        String::NewExternalFromFile(isolate, one_byte_name.start());
+    CHECK(string->IsExternalAscii());
+    CHECK_EQ(42, v8_compile(string)->Run()->Int32Value());
+  }
+
+  {
+    v8::HandleScope scope(isolate);
+    const uint16_t chars[] = { 's', 0x2603, 'w' };
+    WriteTestFile(two_byte_name, "two-byte", chars, sizeof(chars));
+    Local<String> string = String::NewExternalFromFile(
+        isolate, two_byte_name.start(), String::kTwoByteFile);
+    CHECK(string->IsExternal());
+    CHECK_EQ(3, string->Length());
+    String::Value value(string);
+    CHECK_EQ(0x2603, (*value)[1]);
+  }
+
+  // Files that cannot be mapped.
+  {
+    v8::HandleScope scope(isolate);
+    WriteTestFile(empty_name, "empty", "", 0);
+    CHECK(String::NewExternalFromFile(isolate, empty_name.start()).IsEmpty());
+    v8::base::OS::Remove(empty_name.start());
+    CHECK(String::NewExternalFromFile(isolate, empty_name.start()).IsEmpty());
+  }
+
+  // The files are unmapped once their strings are collected.
+  CcTest::i_isolate()->compilation_cache()->Clear();
+  CcTest::heap()->CollectAllAvailableGarbage();
+  v8::base::OS::Remove(one_byte_name.start());
+  v8::base::OS::Remove(two_byte_name.start());
+}
+
+
 TEST(ExternalStringCollectedAtTearDown) {
   int destroyed = 0;
   v8::Isolate* isolate = v8::Isolate::New();
@@ -21489,6 +21717,61 @@ THREADED_TEST(JSONParseNumber) {
 }
 
 
+THREADED_TEST(JSONParseBuffer) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  Handle<Object> global = context->Global();
+
+  // ASCII input is copied without UTF-8 decoding.
+  char buffer[] = "{\"a\":[1,\"x\\ty\"],\"b\":{\"c\":true}}";
+  Local<Value> obj = v8::JSON::Parse(isolate, buffer);
+  memset(buffer, 0, sizeof(buffer));
+  global->Set(v8_str("obj"), obj);
+  ExpectString("JSON.stringify(obj)",
+               "{\"a\":[1,\"x\\ty\"],\"b\":{\"c\":true}}");
+
+  // UTF-8 input.
+  obj = v8::JSON::Parse(isolate, "[\"\xC3\xA9\"]");
+  global->Set(v8_str("obj"), obj);
+  ExpectInt32("obj[0].charCodeAt(0)", 0xE9);
+
+  // Syntax errors are thrown and do not keep the buffer alive.
+  {
+    v8::TryCatch try_catch;
+    char bad[] = "{\"a\":}";
+    CHECK(v8::JSON::Parse(isolate, bad).IsEmpty());
+    CHECK(try_catch.HasCaught());
+    memset(bad, 'x', sizeof(bad) - 1);
+    CHECK(!try_catch.Message().IsEmpty());
+  }
+  CcTest::heap()->CollectAllGarbage(i::Heap::kNoGCFlags);
+
+  // Streaming input. ASCII text is parsed in place from an external string
+  // that takes over the collected chunks.
+  v8::JSON::StreamingParser parser(isolate);
+  const char* chunks[] = { "{\"ke", "y\":[1,2", ",3]", "}" };
+  for (size_t i = 0; i < ARRAY_SIZE(chunks); i++) {
+    parser.Append(chunks[i], i::StrLength(chunks[i]));
+  }
+  obj = parser.Finish();
+  global->Set(v8_str("obj"), obj);
+  ExpectString("JSON.stringify(obj)", "{\"key\":[1,2,3]}");
+  parser.Append("42", 2);
+  obj = parser.Finish();
+  CHECK_EQ(42, obj->Int32Value());
+  CcTest::heap()->CollectAllGarbage(i::Heap::kNoGCFlags);
+  ExpectString("JSON.stringify(obj)", "{\"key\":[1,2,3]}");
+
+  // Streaming UTF-8 input, split within a character.
+  parser.Append("[\"\xC3", 3);
+  parser.Append("\xA9\"]", 3);
+  obj = parser.Finish();
+  global->Set(v8_str("obj"), obj);
+  ExpectInt32("obj[0].charCodeAt(0)", 0xE9);
+}
+
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
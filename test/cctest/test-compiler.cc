@@ -362,6 +362,52 @@ TEST(FeedbackVectorUnaffectedByScopeChanges) {
 }
 
 
+static bool IsGlobalFunctionCompiled(const char* name) {
+  Handle<JSFunction> f = Handle<JSFunction>::cast(GetGlobalProperty(name));
+  return f->shared()->is_compiled();
+}
+
+
+TEST(CompileHints) {
+  if (i::FLAG_always_opt || !i::FLAG_lazy) return;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+
+  const char* source =
+      "function called() { return 1; }\n"
+      "function not_called() { return 2; }\n"
+      "function outer() { return function inner() { return 3; }; }\n"
+      "function run() { return called() + outer()(); }\n";
+  v8::ScriptCompiler::Source first_source(v8_str(source));
+  v8::Local<v8::UnboundScript> first =
+      v8::ScriptCompiler::CompileUnbound(isolate, &first_source);
+  first->BindToCurrentContext()->Run();
+  CHECK_EQ(4, CompileRun("run()")->Int32Value());
+
+  // The functions that ran, in source order.
+  int positions[8];
+  CHECK_EQ(4, first->GetCompiledFunctionPositions(positions, 8));
+  CHECK_EQ(static_cast<int>(strstr(source, "() { return 1") - source),
+           positions[0]);
+  CHECK_EQ(static_cast<int>(strstr(source, "() { return 3") - source),
+           positions[2]);
+
+  // A changed comment keeps the positions but misses the compilation cache.
+  ScopedVector<char> second_chars(StrLength(source) + 16);
+  SNPrintF(second_chars, "%s// second", source);
+  v8::ScriptCompiler::Source second_source(v8_str(second_chars.start()));
+  second_source.SetCompileHints(positions, 4);
+  v8::ScriptCompiler::Compile(isolate, &second_source)->Run();
+  CHECK(IsGlobalFunctionCompiled("called"));
+  CHECK(!IsGlobalFunctionCompiled("not_called"));
+  CHECK(IsGlobalFunctionCompiled("outer"));
+  CHECK(IsGlobalFunctionCompiled("run"));
+  CompileRun("var inner = outer();");
+  CHECK(IsGlobalFunctionCompiled("inner"));
+}
+
+
 // Test that optimized code for different closures is actually shared
 // immediately by the FastNewClosureStub when run in the same context.
 TEST(OptimizedCodeSharing) {
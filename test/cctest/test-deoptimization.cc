@@ -695,3 +695,47 @@ TEST(DeoptimizeLoadICStoreICNested) {
   CHECK_EQ(1, env->Global()->Get(v8_str("count"))->Int32Value());
   CHECK_EQ(13, env->Global()->Get(v8_str("result"))->Int32Value());
 }
+
+
+TEST(DeoptimizeLoopDetection) {
+  if (i::FLAG_always_opt || !i::FLAG_crankshaft) return;
+  i::FLAG_deopt_loop_threshold = 3;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  i::DeoptimizationStatistics* statistics =
+      CcTest::i_isolate()->deoptimizer_data()->statistics();
+  int sites_before = statistics->site_count();
+
+  // Every optimization of f is invalidated at the same property load by a
+  // receiver with a map it has not seen yet.
+  {
+    AllowNativesSyntaxNoInlining options;
+    CompileRun(
+        "function f(o) { return o.x; };"
+        "var shapes = [{x: 1}, {x: 2, a: 0}, {x: 3, b: 0}, {x: 4, c: 0},"
+        "              {x: 5, d: 0}];"
+        "f(shapes[0]);"
+        "f(shapes[0]);"
+        "for (var i = 1; i < 4; i++) {"
+        "  %OptimizeFunctionOnNextCall(f);"
+        "  f(shapes[i - 1]);"
+        "  f(shapes[i]);"
+        "}");
+  }
+  if (!CcTest::i_isolate()->use_crankshaft()) return;
+
+  Handle<JSFunction> f = GetJSFunction(env->Global(), "f");
+  CHECK(!f->IsOptimized());
+  CHECK_LT(sites_before, statistics->site_count());
+
+  // The reoptimized function uses a generic load and survives new maps.
+  {
+    AllowNativesSyntaxNoInlining options;
+    CompileRun(
+        "%OptimizeFunctionOnNextCall(f);"
+        "f(shapes[3]);"
+        "var result = f(shapes[4]);");
+  }
+  CHECK(f->IsOptimized());
+  CHECK_EQ(5, env->Global()->Get(v8_str("result"))->Int32Value());
+}
@@ -1088,11 +1088,69 @@ TEST(TestCodeFlushing) {
 }
 
 
+TEST(TestCodeFlushingAdaptive) {
+  // If we do not flush code this test is invalid.
+  if (!FLAG_flush_code) return;
+  i::FLAG_allow_natives_syntax = true;
+  i::FLAG_optimize_for_size = false;
+  i::FLAG_adaptive_code_flushing = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+  const char* source = "function foo() {"
+                       "  var x = 42;"
+                       "  var y = 42;"
+                       "  var z = x + y;"
+                       "};"
+                       "foo()";
+  Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+  { v8::HandleScope scope(CcTest::isolate());
+    CompileRun(source);
+  }
+  Handle<Object> func_value =
+      Object::GetProperty(isolate->global_object(), foo_name).ToHandleChecked();
+  CHECK(func_value->IsJSFunction());
+  Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+  CHECK(function->shared()->is_compiled());
+  CHECK_EQ(0, function->shared()->flush_count());
+
+  // Old code is flushed the first time.
+  const int kAgingThreshold = 6;
+  for (int i = 0; i < kAgingThreshold; i++) {
+    CcTest::heap()->CollectAllGarbage(Heap::kAbortIncrementalMarkingMask);
+  }
+  if (function->IsOptimized()) return;
+  CHECK(!function->shared()->is_compiled());
+  CHECK_EQ(1, function->shared()->flush_count());
+
+  // Once the function was recompiled, its code is kept while there is no
+  // memory pressure.
+  CompileRun("foo()");
+  CHECK(function->shared()->is_compiled());
+  for (int i = 0; i < kAgingThreshold; i++) {
+    CcTest::heap()->CollectAllGarbage(Heap::kAbortIncrementalMarkingMask);
+  }
+  if (function->IsOptimized()) return;
+  CHECK(function->shared()->is_compiled());
+
+  // A low memory notification flushes it again.
+  CcTest::heap()->CollectAllAvailableGarbage("low memory notification");
+  CHECK(!function->shared()->is_compiled());
+  CHECK_EQ(2, function->shared()->flush_count());
+  CompileRun("foo()");
+  CHECK(function->shared()->is_compiled());
+}
+
+
 TEST(TestCodeFlushingPreAged) {
   // If we do not flush code this test is invalid.
   if (!FLAG_flush_code) return;
   i::FLAG_allow_natives_syntax = true;
   i::FLAG_optimize_for_size = true;
+  // The function is flushed again after it was recompiled.
+  i::FLAG_adaptive_code_flushing = false;
   CcTest::InitializeVM();
   Isolate* isolate = CcTest::i_isolate();
   Factory* factory = isolate->factory();
@@ -1158,6 +1216,8 @@ TEST(TestCodeFlushingIncremental) {
   if (!FLAG_flush_code || !FLAG_flush_code_incrementally) return;
   i::FLAG_allow_natives_syntax = true;
   i::FLAG_optimize_for_size = false;
+  // The recompiled function must become a flushing candidate again.
+  i::FLAG_adaptive_code_flushing = false;
   CcTest::InitializeVM();
   Isolate* isolate = CcTest::i_isolate();
   Factory* factory = isolate->factory();
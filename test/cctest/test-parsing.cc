@@ -108,6 +108,56 @@ TEST(ScanKeywords) {
 }
 
 
+TEST(ScanOneByteCharacterClasses) {
+  // The table driven classification of one-byte characters agrees with the
+  // Unicode predicates.
+  i::UnicodeCache unicode_cache;
+  for (unibrow::uchar c = 0; c <= unibrow::Latin1::kMaxChar; c++) {
+    CHECK_EQ(i::IdentifierStart::Is(c), unicode_cache.IsIdentifierStart(c));
+    CHECK_EQ(i::IdentifierPart::Is(c), unicode_cache.IsIdentifierPart(c));
+    CHECK_EQ(i::WhiteSpace::Is(c), unicode_cache.IsWhiteSpace(c));
+    CHECK_EQ(unibrow::LineTerminator::Is(c),
+             unicode_cache.IsLineTerminator(c));
+    CHECK_EQ(i::WhiteSpaceOrLineTerminator::Is(c),
+             unicode_cache.IsWhiteSpaceOrLineTerminator(c));
+  }
+  CHECK(!unicode_cache.IsIdentifierStart(static_cast<unibrow::uchar>(-1)));
+  CHECK(unicode_cache.IsWhiteSpace(0xFEFF));
+  CHECK(unicode_cache.IsLineTerminator(0x2028));
+
+  // Harmony keywords are reserved words unless the feature is enabled.
+  static const char* sources[] = { "export", "import", "let" };
+  static const i::Token::Value tokens[] = {
+    i::Token::FUTURE_RESERVED_WORD,
+    i::Token::FUTURE_RESERVED_WORD,
+    i::Token::FUTURE_STRICT_RESERVED_WORD
+  };
+  for (int i = 0; i < static_cast<int>(ARRAY_SIZE(sources)); i++) {
+    i::Utf8ToUtf16CharacterStream stream(
+        reinterpret_cast<const i::byte*>(sources[i]),
+        i::StrLength(sources[i]));
+    i::Scanner scanner(&unicode_cache);
+    scanner.Initialize(&stream);
+    CHECK_EQ(tokens[i], scanner.Next());
+    CHECK_EQ(i::Token::EOS, scanner.Next());
+  }
+
+  // Identifiers with non-ASCII one-byte characters.
+  // UTF-8 for "\u00e9t\u00e9\u00a0\u00ff0 \u00b5".
+  const char* latin1 = "\xc3\xa9t\xc3\xa9\xc2\xa0\xc3\xbf" "0 \xc2\xb5";
+  i::Utf8ToUtf16CharacterStream stream(
+      reinterpret_cast<const i::byte*>(latin1), i::StrLength(latin1));
+  i::Scanner scanner(&unicode_cache);
+  scanner.Initialize(&stream);
+  CHECK_EQ(i::Token::IDENTIFIER, scanner.Next());
+  CHECK_EQ(3, scanner.location().end_pos - scanner.location().beg_pos);
+  CHECK_EQ(i::Token::IDENTIFIER, scanner.Next());
+  CHECK_EQ(2, scanner.location().end_pos - scanner.location().beg_pos);
+  CHECK_EQ(i::Token::IDENTIFIER, scanner.Next());
+  CHECK_EQ(i::Token::EOS, scanner.Next());
+}
+
+
 TEST(ScanHTMLEndComments) {
   v8::V8::Initialize();
   v8::Isolate* isolate = CcTest::isolate();
@@ -2054,6 +2104,96 @@ TEST(DontRegressPreParserDataSizes) {
 }
 
 
+TEST(PreparseSideTable) {
+  // Parsing a script again seeks over the lazy functions skipped by the first
+  // parse, instead of preparsing them again.
+  i::FLAG_preparse_side_table = true;
+  v8::V8::Initialize();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope handles(isolate);
+  i::Factory* factory = CcTest::i_isolate()->factory();
+
+  int marker;
+  CcTest::i_isolate()->stack_guard()->SetStackLimit(
+      reinterpret_cast<uintptr_t>(&marker) - 128 * 1024);
+
+  const char* program =
+      "function foo() { return [1, 2]; }\n"
+      "var x = { get bar() { 'use strict'; return { a: 1, b: 2 }; } };\n";
+  int foo_start = static_cast<int>(strchr(program, '{') - program);
+  i::Handle<i::String> source =
+      factory->NewStringFromUtf8(i::CStrVector(program)).ToHandleChecked();
+  i::Handle<i::Script> script = factory->NewScript(source);
+  CHECK(script->preparse_data()->IsUndefined());
+
+  {
+    i::CompilationInfoWithZone info(script);
+    CHECK(i::Parser::Parse(&info, true));
+  }
+  CHECK(script->preparse_data()->IsByteArray());
+  i::ByteArray* table = i::ByteArray::cast(script->preparse_data());
+  CHECK_EQ(2 * i::FunctionEntry::kSize * i::kIntSize, table->length());
+  CHECK_EQ(foo_start, table->get_int(i::FunctionEntry::kStartPositionIndex));
+  CHECK_EQ(1, table->get_int(i::FunctionEntry::kLiteralCountIndex));
+  CHECK_EQ(i::STRICT,
+           table->get_int(i::FunctionEntry::kSize +
+                          i::FunctionEntry::kStrictModeIndex));
+
+  // Change the literal count in the table, and check that the next parse
+  // takes it from there.
+  reinterpret_cast<int*>(table->GetDataStartAddress())[
+      i::FunctionEntry::kLiteralCountIndex] = 7;
+  i::ScriptData* data = NULL;
+  {
+    i::CompilationInfoWithZone info(script);
+    info.SetCachedData(&data, i::PRODUCE_CACHED_DATA);
+    CHECK(i::Parser::Parse(&info, true));
+  }
+  CHECK(data);
+  CHECK(!data->HasError());
+  CHECK_EQ(2, data->function_count());
+  data->Initialize();
+  i::FunctionEntry entry = data->GetFunctionEntry(foo_start);
+  CHECK(entry.is_valid());
+  CHECK_EQ(7, entry.literal_count());
+  delete data;
+}
+
+
+TEST(BlocksHaveExactCapacity) {
+  // Blocks collect their statements in a shared buffer before they allocate
+  // their list, so nested blocks must not see each other's statements.
+  v8::V8::Initialize();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope handles(isolate);
+  i::Factory* factory = CcTest::i_isolate()->factory();
+
+  int marker;
+  CcTest::i_isolate()->stack_guard()->SetStackLimit(
+      reinterpret_cast<uintptr_t>(&marker) - 128 * 1024);
+
+  const char* program = "{ a; { b; { } c; } d; e; }";
+  i::Handle<i::String> source =
+      factory->NewStringFromUtf8(i::CStrVector(program)).ToHandleChecked();
+  i::Handle<i::Script> script = factory->NewScript(source);
+  i::CompilationInfoWithZone info(script);
+  CHECK(i::Parser::Parse(&info));
+  i::ZoneList<i::Statement*>* body = info.function()->body();
+  CHECK_EQ(1, body->length());
+  i::Block* outer = body->at(0)->AsBlock();
+  CHECK(outer != NULL);
+  CHECK_EQ(4, outer->statements()->length());
+  CHECK_EQ(4, outer->statements()->capacity());
+  CHECK(outer->statements()->at(0)->IsExpressionStatement());
+  i::Block* inner = outer->statements()->at(1)->AsBlock();
+  CHECK(inner != NULL);
+  CHECK_EQ(3, inner->statements()->length());
+  CHECK_EQ(3, inner->statements()->capacity());
+  CHECK(inner->statements()->at(1)->AsBlock()->statements()->is_empty());
+  CHECK(outer->statements()->at(3)->IsExpressionStatement());
+}
+
+
 TEST(FunctionDeclaresItselfStrict) {
   // Tests that we produce the right kinds of errors when a function declares
   // itself strict (we cannot produce there errors as soon as we see the
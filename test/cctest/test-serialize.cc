@@ -647,6 +647,134 @@ DEPENDENT_TEST(ContextDeserialization, ContextSerialization) {
 }
 
 
+TEST(ContextSerializationWithExtraCode) {
+  if (!Snapshot::HaveASnapshotToStartFrom()) {
+    // Like mksnapshot with --extra-code.
+    FLAG_track_double_fields = false;
+    Isolate* isolate = CcTest::i_isolate();
+    CcTest::i_isolate()->enable_serializer();
+    v8::V8::Initialize();
+    v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate);
+    Heap* heap = isolate->heap();
+
+    v8::Persistent<v8::Context> env;
+    {
+      HandleScope scope(isolate);
+      env.Reset(v8_isolate, v8::Context::New(v8_isolate));
+    }
+    ASSERT(!env.IsEmpty());
+    {
+      v8::HandleScope handle_scope(v8_isolate);
+      v8::Local<v8::Context>::New(v8_isolate, env)->Enter();
+    }
+    // Extra code that runs one of its functions.
+    {
+      v8::HandleScope handle_scope(v8_isolate);
+      CompileRun("function warm(x) { return x + 1; }"
+                 "function cold(x) { return x - 1; }"
+                 "warm(1);");
+    }
+    // Make sure all builtin scripts are cached.
+    { HandleScope scope(isolate);
+      for (int i = 0; i < Natives::GetBuiltinsCount(); i++) {
+        isolate->bootstrapper()->NativesSourceLookup(i);
+      }
+    }
+    // If we don't do this then we end up with a stray root pointing at the
+    // context even after we have disposed of env.
+    heap->CollectAllGarbage(Heap::kNoGCFlags);
+
+    int file_name_length = StrLength(FLAG_testing_serialization_file) + 10;
+    Vector<char> startup_name = Vector<char>::New(file_name_length + 1);
+    SNPrintF(startup_name, "%s.startup", FLAG_testing_serialization_file);
+
+    {
+      v8::HandleScope handle_scope(v8_isolate);
+      v8::Local<v8::Context>::New(v8_isolate, env)->Exit();
+    }
+
+    i::Object* raw_context = *v8::Utils::OpenPersistent(env);
+
+    env.Reset();
+
+    FileByteSink startup_sink(startup_name.start());
+    StartupSerializer startup_serializer(isolate, &startup_sink);
+    startup_serializer.SerializeStrongReferences();
+
+    FileByteSink partial_sink(FLAG_testing_serialization_file);
+    PartialSerializer p_ser(isolate, &startup_serializer, &partial_sink);
+    p_ser.Serialize(&raw_context);
+    startup_serializer.SerializeWeakReferences();
+
+    partial_sink.WriteSpaceUsed(
+        p_ser.CurrentAllocationAddress(NEW_SPACE),
+        p_ser.CurrentAllocationAddress(OLD_POINTER_SPACE),
+        p_ser.CurrentAllocationAddress(OLD_DATA_SPACE),
+        p_ser.CurrentAllocationAddress(CODE_SPACE),
+        p_ser.CurrentAllocationAddress(MAP_SPACE),
+        p_ser.CurrentAllocationAddress(CELL_SPACE),
+        p_ser.CurrentAllocationAddress(PROPERTY_CELL_SPACE));
+
+    startup_sink.WriteSpaceUsed(
+        startup_serializer.CurrentAllocationAddress(NEW_SPACE),
+        startup_serializer.CurrentAllocationAddress(OLD_POINTER_SPACE),
+        startup_serializer.CurrentAllocationAddress(OLD_DATA_SPACE),
+        startup_serializer.CurrentAllocationAddress(CODE_SPACE),
+        startup_serializer.CurrentAllocationAddress(MAP_SPACE),
+        startup_serializer.CurrentAllocationAddress(CELL_SPACE),
+        startup_serializer.CurrentAllocationAddress(PROPERTY_CELL_SPACE));
+    startup_name.Dispose();
+  }
+}
+
+
+static Handle<JSFunction> GetGlobalFunction(Isolate* isolate,
+                                            Handle<Context> context,
+                                            const char* name) {
+  Handle<GlobalObject> global(context->global_object(), isolate);
+  Handle<Object> function = Object::GetProperty(
+      global, isolate->factory()->InternalizeUtf8String(name))
+      .ToHandleChecked();
+  CHECK(function->IsJSFunction());
+  return Handle<JSFunction>::cast(function);
+}
+
+
+DEPENDENT_TEST(ContextDeserializationWithExtraCode,
+               ContextSerializationWithExtraCode) {
+  if (!Snapshot::HaveASnapshotToStartFrom()) {
+    int file_name_length = StrLength(FLAG_testing_serialization_file) + 10;
+    Vector<char> startup_name = Vector<char>::New(file_name_length + 1);
+    SNPrintF(startup_name, "%s.startup", FLAG_testing_serialization_file);
+
+    CHECK(InitializeFromFile(startup_name.start()));
+    startup_name.Dispose();
+
+    const char* file_name = FLAG_testing_serialization_file;
+
+    int snapshot_size = 0;
+    byte* snapshot = ReadBytes(file_name, &snapshot_size);
+
+    Isolate* isolate = CcTest::i_isolate();
+    Object* root;
+    {
+      SnapshotByteSource source(snapshot, snapshot_size);
+      Deserializer deserializer(&source);
+      ReserveSpaceForSnapshot(&deserializer, file_name);
+      deserializer.DeserializePartial(isolate, &root);
+      CHECK(root->IsContext());
+    }
+    HandleScope handle_scope(isolate);
+    Handle<Context> context(Context::cast(root), isolate);
+
+    // The function run by the extra code comes back compiled, the other one
+    // is still lazy.
+    CHECK(GetGlobalFunction(isolate, context, "warm")->shared()->is_compiled());
+    CHECK(!GetGlobalFunction(isolate, context, "cold")->shared()->is_compiled());
+  }
+}
+
+
 TEST(TestThatAlwaysSucceeds) {
 }
 
@@ -1085,6 +1085,65 @@ TEST(CachedHashOverflow) {
 }
 
 
+TEST(InternalizationCache) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  // The same contents internalize to the same string through every kind of
+  // key, whether the cache or the string table answers.
+  Handle<String> key = factory->InternalizeUtf8String("cachedKey");
+  CHECK(key.is_identical_to(factory->InternalizeUtf8String("cachedKey")));
+  static const uint8_t one_byte[] = "cachedKey";
+  CHECK(key.is_identical_to(factory->InternalizeOneByteString(
+      Vector<const uint8_t>(one_byte, 9))));
+  static const uc16 two_byte[] =
+      { 'c', 'a', 'c', 'h', 'e', 'd', 'K', 'e', 'y' };
+  CHECK(key.is_identical_to(factory->InternalizeTwoByteString(
+      Vector<const uc16>(two_byte, 9))));
+  Handle<String> flat = factory->NewStringFromAsciiChecked("cachedKey");
+  CHECK(key.is_identical_to(factory->InternalizeString(flat)));
+
+  // Strings that share a cache entry are told apart.
+  for (int i = 0; i < 1000; i++) {
+    EmbeddedVector<char, 16> name;
+    SNPrintF(name, "key%d", i);
+    Handle<String> first = factory->InternalizeUtf8String(name.start());
+    CHECK(first->IsUtf8EqualTo(CStrVector(name.start())));
+    CHECK(first.is_identical_to(factory->InternalizeUtf8String(name.start())));
+  }
+
+  // The cache does not outlive its strings.
+  CcTest::heap()->CollectAllGarbage(Heap::kNoGCFlags);
+  CHECK(key.is_identical_to(factory->InternalizeUtf8String("cachedKey")));
+  Handle<String> other = factory->InternalizeUtf8String("key999");
+  CHECK(other->IsUtf8EqualTo(CStrVector("key999")));
+}
+
+
+TEST(InternalizationCacheJsonKeys) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  // Keys of parsed JSON come back as the strings in the cache.
+  Handle<String> key = factory->InternalizeUtf8String("jsonCachedKey");
+  v8::Local<v8::Value> result =
+      CompileRun("JSON.parse('[{\"jsonCachedKey\": 1},"
+                 "{\"jsonCachedKey\": 2}]')");
+  Handle<JSArray> array = v8::Utils::OpenHandle(*result.As<v8::Array>());
+  for (int i = 0; i < 2; i++) {
+    Handle<JSObject> object(
+        JSObject::cast(FixedArray::cast(array->elements())->get(i)));
+    Handle<Map> map(object->map());
+    Name* name = map->instance_descriptors()->GetKey(0);
+    CHECK_EQ(*key, name);
+  }
+}
+
+
 TEST(SliceFromCons) {
   FLAG_string_slices = true;
   CcTest::InitializeVM();
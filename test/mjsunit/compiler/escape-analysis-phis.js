@@ -0,0 +1,96 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --use-escape-analysis
+
+
+// Test objects replaced in every iteration of a loop.
+(function testLoopPhi() {
+  function Point(x, y) {
+    this.x = x;
+    this.y = y;
+  }
+  function walk(n) {
+    var p = new Point(0, 0);
+    for (var i = 0; i < n; i++) {
+      p = new Point(p.x + 1, p.y + 2);
+    }
+    return p.x + p.y;
+  }
+  assertEquals(30, walk(10)); assertEquals(30, walk(10));
+  %OptimizeFunctionOnNextCall(walk);
+  assertEquals(30, walk(10));
+  assertEquals(0, walk(0));
+})();
+
+
+// Test result objects returned from several places of an inlined function.
+(function testInlinedReturnPhi() {
+  function next(state, limit) {
+    if (state.i < limit) return { value: state.i++, done: false };
+    return { value: undefined, done: true };
+  }
+  function sum(limit) {
+    var state = { i: 0 };
+    var result = 0;
+    for (var r = next(state, limit); !r.done; r = next(state, limit)) {
+      result += r.value;
+    }
+    return result;
+  }
+  assertEquals(45, sum(10)); assertEquals(45, sum(10));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(45, sum(10));
+  assertEquals(0, sum(0));
+})();
+
+
+// Test merged objects that are live at the same time.
+(function testOverlappingPhi() {
+  function pick(mode) {
+    var a = { x: 1 };
+    var b = { x: 2 };
+    var p = mode ? a : b;
+    p.x = 3;
+    return a.x * 10 + b.x;
+  }
+  assertEquals(32, pick(true)); assertEquals(13, pick(false));
+  %OptimizeFunctionOnNextCall(pick);
+  assertEquals(32, pick(true)); assertEquals(13, pick(false));
+})();
+
+
+// Test deoptimization with merged objects in local variables.
+(function testDeoptPhi() {
+  var deopt = { deopt: false };
+  function merge(mode) {
+    var o = mode ? { a: 1, b: 2 } : { a: 3, b: 4 };
+    deopt.deopt;
+    return o.a + o.b;
+  }
+  assertEquals(3, merge(true)); assertEquals(7, merge(false));
+  %OptimizeFunctionOnNextCall(merge);
+  assertEquals(3, merge(true)); assertEquals(7, merge(false));
+  delete deopt.deopt;
+  assertEquals(3, merge(true)); assertEquals(7, merge(false));
+})();
+
+
+// Test deoptimization inside a loop carrying an object.
+(function testDeoptLoopPhi() {
+  var deopt = { deopt: false };
+  function loop(n) {
+    var p = { x: 0, y: 0 };
+    for (var i = 0; i < n; i++) {
+      p = { x: p.x + i, y: p.y - i };
+      if (i == 5) deopt.deopt;
+    }
+    return p.x - p.y;
+  }
+  assertEquals(90, loop(10)); assertEquals(90, loop(10));
+  %OptimizeFunctionOnNextCall(loop);
+  assertEquals(90, loop(10));
+  delete deopt.deopt;
+  assertEquals(90, loop(10));
+})();
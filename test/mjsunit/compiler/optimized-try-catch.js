@@ -0,0 +1,168 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --optimize-try-catch --allow-natives-syntax
+
+// Exceptions caught in optimized code.
+function thrower(x) {
+  if (x < 0) throw "negative " + x;
+  return x;
+}
+
+function catchValue(x) {
+  var state = "start";
+  try {
+    state = "try";
+    var result = thrower(x);
+    state = "done";
+    return result;
+  } catch (e) {
+    return e + " " + state;
+  }
+}
+
+assertEquals(1, catchValue(1));
+assertEquals("negative -1 try", catchValue(-1));
+%OptimizeFunctionOnNextCall(catchValue);
+assertEquals(2, catchValue(2));
+assertOptimized(catchValue);
+assertEquals("negative -2 try", catchValue(-2));
+assertOptimized(catchValue);
+assertEquals(3, catchValue(3));
+assertEquals("negative -3 try", catchValue(-3));
+assertOptimized(catchValue);
+
+
+// Locals that are dead once an exception is caught stay on the stack.
+function setupThenCatch(x) {
+  var a = x + 1;
+  var b = a * 2;
+  var live = b - 1;
+  try {
+    return thrower(x - 2);
+  } catch (e) {
+    return e + " " + live;
+  }
+}
+
+assertEquals(1, setupThenCatch(3));
+assertEquals("negative -1 3", setupThenCatch(1));
+%OptimizeFunctionOnNextCall(setupThenCatch);
+assertEquals(2, setupThenCatch(4));
+assertOptimized(setupThenCatch);
+assertEquals("negative -1 3", setupThenCatch(1));
+assertOptimized(setupThenCatch);
+
+
+// Leaving the try block by break, continue and falling through.
+function loops(n) {
+  var sum = 0;
+  for (var i = 0; i < n; i++) {
+    try {
+      if (i == 2) continue;
+      if (i == 5) break;
+      sum += thrower(i == 3 ? -i : i);
+    } catch (e) {
+      sum += 100;
+    }
+    sum += 1000;
+  }
+  return sum;
+}
+
+assertEquals(4105, loops(10));
+assertEquals(4105, loops(10));
+%OptimizeFunctionOnNextCall(loops);
+assertEquals(4105, loops(10));
+assertOptimized(loops);
+assertEquals(2001, loops(2));
+
+
+// Eager deoptimization inside the try block.
+function deoptInTry(o) {
+  var seen = 0;
+  try {
+    seen = o.x;
+    thrower(o.y);
+  } catch (e) {
+    return "caught " + seen;
+  }
+  return seen;
+}
+
+assertEquals(1, deoptInTry({ x: 1, y: 1 }));
+assertEquals("caught 2", deoptInTry({ x: 2, y: -1 }));
+%OptimizeFunctionOnNextCall(deoptInTry);
+assertEquals(3, deoptInTry({ x: 3, y: 1 }));
+assertEquals("caught 4", deoptInTry({ a: 0, x: 4, y: -1 }));
+assertEquals(5, deoptInTry({ a: 0, x: 5, y: 1 }));
+
+
+// Eager deoptimization inside the try block with locals on the stack.
+function deoptInTryWithLocals(o, x) {
+  var a, b, c;
+  a = x + 1;
+  c = a * 2;
+  for (var i = 0; i < 2; i++) c += i;
+  b = c - 1;
+  try {
+    var p = o.p;
+    thrower(p);
+    return p + x + b;
+  } catch (e) {
+    return e + " " + a + " " + b;
+  }
+}
+
+assertEquals(7, deoptInTryWithLocals({ p: 2 }, 1));
+assertEquals("negative -1 2 4", deoptInTryWithLocals({ p: -1 }, 1));
+%OptimizeFunctionOnNextCall(deoptInTryWithLocals);
+assertEquals(7, deoptInTryWithLocals({ p: 2 }, 1));
+assertEquals(13, deoptInTryWithLocals({ q: 0, p: 2 }, 3));
+%OptimizeFunctionOnNextCall(deoptInTryWithLocals);
+assertEquals(13, deoptInTryWithLocals({ q: 0, p: 2 }, 3));
+assertEquals("negative -2 4 8", deoptInTryWithLocals({ r: 0, p: -2 }, 3));
+
+
+// Exceptions thrown by the runtime and caught with the arguments intact.
+function runtimeThrow(a, b) {
+  try {
+    return "foo" in a;
+  } catch (e) {
+    return [e instanceof TypeError, a, b];
+  }
+}
+
+assertTrue(runtimeThrow({ foo: 1 }, 0));
+assertEquals([true, 1, 2], runtimeThrow(1, 2));
+%OptimizeFunctionOnNextCall(runtimeThrow);
+assertTrue(runtimeThrow({ foo: 1 }, 0));
+assertEquals([true, 3, 4], runtimeThrow(3, 4));
+assertOptimized(runtimeThrow);
+
+
+// Uncaught exceptions propagate past the optimized frame.
+function rethrow(x) {
+  try {
+    thrower(x);
+  } catch (e) {
+    throw "re" + e;
+  }
+  return x;
+}
+
+function callRethrow(x) {
+  try {
+    return rethrow(x);
+  } catch (e) {
+    return e;
+  }
+}
+
+assertEquals(1, callRethrow(1));
+assertEquals("renegative -1", callRethrow(-1));
+%OptimizeFunctionOnNextCall(rethrow);
+%OptimizeFunctionOnNextCall(callRethrow);
+assertEquals(2, callRethrow(2));
+assertEquals("renegative -2", callRethrow(-2));
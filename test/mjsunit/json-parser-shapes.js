@@ -0,0 +1,59 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Test JSON.parse on large sources with records of alternating shapes and
+// strings that need the slow scanning path at various offsets.
+
+function record(i) {
+  switch (i % 3) {
+    case 0: return { id: i, name: "n" + i, tags: [i] };
+    case 1: return { id: i, label: "l" + i };
+    case 2: return { id: i, name: "m" + i, extra: { deep: i } };
+  }
+}
+
+var records = [];
+for (var i = 0; i < 300; i++) records.push(record(i));
+var parsed = JSON.parse(JSON.stringify(records));
+assertEquals(records, parsed);
+for (var i = 3; i < 300; i++) {
+  assertTrue(%HaveSameMap(parsed[i], parsed[i - 3]));
+}
+
+// Keys that only share a prefix with the cached key.
+var source = "[";
+for (var i = 0; i < 200; i++) {
+  source += (i % 2 ? '{"ab":1,"abc":2}' : '{"ab":1,"abd":3}') + ",";
+}
+source += '{"ab":1,"ab":2}]';
+parsed = JSON.parse(source);
+for (var i = 0; i < 200; i++) {
+  assertEquals(i % 2 ? 2 : undefined, parsed[i].abc);
+  assertEquals(i % 2 ? undefined : 3, parsed[i].abd);
+}
+assertEquals(2, parsed[200].ab);
+
+// Special characters at every offset within a word.
+var padding = "";
+for (var i = 0; i < 100; i++) padding += "x";
+for (var i = 0; i < 20; i++) {
+  var prefix = padding.substring(0, i);
+  var suffix = padding.substring(i);
+  assertEquals(prefix + "\"" + suffix,
+               JSON.parse('"' + prefix + '\\"' + suffix + '"'));
+  assertEquals(prefix + "\\" + suffix,
+               JSON.parse('"' + prefix + '\\\\' + suffix + '"'));
+  assertEquals(prefix + "é" + suffix,
+               JSON.parse('"' + prefix + "é" + suffix + '"'));
+  assertEquals(prefix, JSON.parse('"' + prefix + '"'));
+  assertThrows(function() {
+    JSON.parse('"' + prefix + "\n" + suffix + '"');
+  }, SyntaxError);
+  assertThrows(function() {
+    JSON.parse('"' + prefix + "\u001f" + suffix + '"');
+  }, SyntaxError);
+  assertThrows(function() { JSON.parse('"' + prefix); }, SyntaxError);
+}
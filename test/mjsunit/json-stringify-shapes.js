@@ -0,0 +1,42 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Test JSON.stringify on records of repeated shapes, with keys that need
+// escaping, and on outputs of varying size.
+
+var records = [];
+for (var i = 0; i < 500; i++) {
+  var record = { id: i, "quo\"te": "q" + i, "back\\slash": i % 2 == 0 };
+  record["ctrl\n"] = null;
+  record["été"] = [i];
+  if (i % 3 == 0) record["☃"] = "snow";
+  records.push(record);
+}
+var json = JSON.stringify(records);
+assertEquals(records, JSON.parse(json));
+assertEquals('{"id":0,"quo\\"te":"q0","back\\\\slash":true,' +
+             '"ctrl\\n":null,"été":[0],"☃":"snow"}',
+             JSON.stringify(records[0]));
+
+// Keys whose hashes collide in the key cache.
+var object = {};
+for (var i = 0; i < 1000; i++) object["key" + i] = i;
+assertEquals(object, JSON.parse(JSON.stringify(object)));
+
+// Outputs alternating between large and small.
+var large = [];
+for (var i = 0; i < 10000; i++) large.push({ a: i, b: "x" });
+for (var i = 0; i < 3; i++) {
+  assertEquals(large, JSON.parse(JSON.stringify(large)));
+  assertEquals('{"a":1}', JSON.stringify({ a: 1 }));
+  assertEquals("[]", JSON.stringify([]));
+}
+
+// Outputs that switch to two-byte characters after the first part grew.
+var late = [];
+for (var i = 0; i < 3000; i++) late.push("abc" + i);
+late.push("☃");
+for (var i = 0; i < 2; i++) {
+  assertEquals(late, JSON.parse(JSON.stringify(late)));
+}
@@ -0,0 +1,77 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Test generic keyed loads and stores on objects with dictionary properties,
+// using keys that are not internalized strings.
+
+function load(o, k) { return o[k]; }
+function store(o, k, v) { o[k] = v; }
+
+// Make the keyed ICs megamorphic.
+for (var i = 0; i < 10; i++) {
+  var o = {};
+  o["p" + i] = i;
+  load(o, "p" + i);
+  store(o, "p" + i, i);
+}
+
+var dict = {};
+for (var i = 0; i < 100; i++) dict["key" + i] = i;
+delete dict.key99;
+assertFalse(%HasFastProperties(dict));
+
+// Existing properties, with freshly built (non-internalized) keys.
+for (var i = 0; i < 99; i++) {
+  var key = "key" + i;
+  assertEquals(i, load(dict, key));
+  store(dict, key, i * 2);
+  assertEquals(i * 2, load(dict, key));
+  assertEquals(i * 2, dict["key" + i]);
+}
+
+// Keys without an internalized counterpart.
+assertEquals(undefined, load(dict, "nokey" + 1));
+store(dict, "newkey" + 1, 42);
+assertEquals(42, dict.newkey1);
+assertEquals(42, load(dict, "newkey" + 1));
+
+// Keys that are array indices.
+store(dict, "1" + "7", 17);
+assertEquals(17, dict[17]);
+assertEquals(17, load(dict, "1" + "7"));
+
+// Read-only properties must not be written.
+Object.defineProperty(dict, "ro", { value: 1, writable: false });
+store(dict, "r" + "o", 2);
+assertEquals(1, dict.ro);
+assertThrows(function() {
+  "use strict";
+  var k = "r" + "o";
+  dict[k] = 2;
+}, TypeError);
+
+// Accessors must be called.
+var setter_value;
+Object.defineProperty(dict, "acc", {
+  get: function() { return "got"; },
+  set: function(v) { setter_value = v; }
+});
+store(dict, "a" + "cc", 7);
+assertEquals(7, setter_value);
+assertEquals("got", load(dict, "a" + "cc"));
+
+// Non-string keys.
+var key_object = { toString: function() { return "key" + 3; } };
+assertEquals(6, load(dict, key_object));
+store(dict, key_object, 3);
+assertEquals(3, dict.key3);
+
+// Global objects keep their properties in cells.
+var global = this;
+global.global_dict_prop = 1;
+store(global, "global_dict" + "_prop", 2);
+assertEquals(2, global_dict_prop);
+assertEquals(2, load(global, "global_dict" + "_prop"));
@@ -0,0 +1,31 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-backtracks-before-fallback=1000
+
+// Test that regexps running on bytecode switch to the linear-time engine
+// once they backtrack too much.
+
+var subject = "";
+for (var i = 0; i < 10000; i++) subject += "a";
+
+var re = /(a+)+$/;
+assertEquals(null, re.exec(subject + "b"));
+assertEquals(["aab", "aa"], /(a+)+b/.exec("xaab"));
+for (var i = 0; i < 20; i++) {
+  assertEquals(["aa", "aa"], re.exec("baa"));
+  assertEquals(null, re.exec(subject + "b"));
+}
+
+// Regexps that cannot run on the linear engine keep backtracking.
+var backreference = /(a+)\1b/;
+for (var i = 0; i < 20; i++) {
+  assertEquals(null, backreference.exec(subject.substring(0, 200)));
+  assertEquals(["aab", "a"], backreference.exec("xaab"));
+}
+
+// The fallback keeps the results of global regexps.
+var global_re = /(x+x+)+(y)/g;
+var text = "xxxxy " + subject.substring(0, 30).replace(/a/g, "x") + " xxy";
+assertEquals(["xxxxy", "xxy"], text.match(global_re));
@@ -0,0 +1,68 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-linear-engine
+
+// Test that regexps give the same results on the linear-time engine as on
+// Irregexp.
+
+function check(re, subject, expected) {
+  re.lastIndex = 0;
+  assertEquals(expected, re.exec(subject), String(re));
+}
+
+// Alternatives and quantifiers keep their priority.
+check(/(a|ab)(c|bcd)(d*)/, "abcd", ["abcd", "a", "bcd", ""]);
+check(/(a+)(a*)/, "aaa", ["aaa", "aaa", ""]);
+check(/(a+?)(a*)/, "aaa", ["aaa", "a", "aa"]);
+check(/(a{2,3})(a?)/, "aaaa", ["aaaa", "aaa", "a"]);
+check(/(a{2,3}?)(a*)/, "aaaa", ["aaaa", "aa", "aa"]);
+check(/x{3}/, "xxyxxx", ["xxx"]);
+check(/a{0}b/, "ab", ["b"]);
+
+// Captures in quantified atoms are reset on every iteration.
+check(/(?:(a)|b)+/, "ab", ["ab", undefined]);
+check(/(z)((a+)?(b+)?(c))*/, "zaacbbbcac",
+      ["zaacbbbcac", "z", "ac", "a", undefined, "c"]);
+check(/(a)|(b)/, "b", ["b", undefined, "b"]);
+
+// Iterations that match the empty string.
+check(/(a*)*/, "b", ["", undefined]);
+check(/(a*)+/, "b", ["", ""]);
+check(/(?:a?)*?b/, "aab", ["aab"]);
+check(/(a|)*b/, "aab", ["aab", "a"]);
+
+// Character classes, case insensitivity and assertions.
+check(/[^a-c]+/, "abcdefabc", ["def"]);
+check(/[^]/, "\n", ["\n"]);
+check(/[]/, "a", null);
+check(/\w+\s\d/, "foo bar 7", ["bar 7"]);
+check(/STRASSE/i, "strasse", ["strasse"]);
+check(/[a-z]+/i, "12AbC34", ["AbC"]);
+check(/[^a-z]+/i, "abc12DEF", ["12"]);
+check(/\bfoo\b/, "afoo foo", ["foo"]);
+check(/\Boo\B/, "foo fooo", ["oo"]);
+check(/^b$/m, "a\nb\nc", ["b"]);
+check(/^b/, "a\nb", null);
+check(/a$/, "a\na", ["a"]);
+check(/.+/, "ab\ncd", ["ab"]);
+check(/☃+/, "snow ☃☃!", ["☃☃"]);
+
+// Global matching.
+assertEquals("1a2b3c", "a1b2c3".replace(/(\w)(\d)/g, "$2$1"));
+assertEquals(["a1", "b2", "c3"], "a1b2c3".match(/\w\d/g));
+assertEquals(["", "", ""], "ab".match(/x*/g));
+
+// Regexps that need backtracking still run on Irregexp.
+check(/(a)\1/, "baab", ["aa", "a"]);
+check(/a(?=b)/, "acab", ["a"]);
+check(/a(?!b)/, "abac", ["a"]);
+
+// Pathological patterns run in linear time.
+var subject = "";
+for (var i = 0; i < 10000; i++) subject += "a";
+check(/(a+)+$/, subject + "b", null);
+check(/(a|aa)*c/, subject, null);
+check(/(x+x+)+y/, subject.replace(/a/g, "x"), null);
+check(/^(a+)+$/, subject, [subject, subject]);
@@ -0,0 +1,52 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-results-cache-size=4
+
+// Test that cached results of global replacements, matches and splits on
+// non-internalized subjects are only reused for equal keys, and that the
+// last match info is restored from the cache.
+
+function line(i) {
+  return "2014-06-0" + (i % 3) + " 12:00:0" + (i % 7) +
+         " GET /index.html?user=" + (i % 5) + " 200 [cache=" + (i % 2) + "] Mozilla/5.0 (X11; Linux x86_64)";
+}
+
+var date_re = /(\d+)-(\d+)-(\d+)/g;
+var user_re = /user=(\d)/g;
+var missing_re = /nothing here/g;
+for (var i = 0; i < 100; i++) {
+  var subject = line(i);
+  assertEquals("06/0" + (i % 3) + "/2014" + subject.substring(10),
+               subject.replace(date_re, "$2/$3/$1"));
+  assertEquals("0" + (i % 3), RegExp.$3);
+  assertEquals("2014-06-0" + (i % 3), RegExp.lastMatch);
+
+  var replaced = subject.replace(user_re, "u$1");
+  assertEquals(-1, replaced.indexOf("user="));
+  assertEquals(String(i % 5), RegExp.$1);
+  assertEquals("user=" + (i % 5), RegExp.lastMatch);
+
+  // A different replacement for the same regexp and subject.
+  assertEquals(subject.replace("user=", "id="),
+               subject.replace(user_re, "id=$1"));
+
+  // The empty replacement.
+  assertEquals(subject.substring(10), subject.replace(date_re, ""));
+  assertEquals("06", RegExp.$2);
+
+  // No match keeps the last match info of the previous regexp.
+  assertEquals(subject, subject.replace(missing_re, "x"));
+  assertEquals("06", RegExp.$2);
+
+  assertEquals(["2014-06-0" + (i % 3)], subject.match(/\d+-\d+-\d+/g));
+  assertEquals(["GET", "/index.html?user=" + (i % 5)],
+               subject.split(" ").slice(2, 4));
+}
+
+// Equal subjects built in different ways share cached results.
+var a = line(1) + line(2);
+var b = (line(1) + line(2)).split("").join("");
+assertEquals(a.replace(date_re, "[$&]"), b.replace(date_re, "[$&]"));
+assertEquals("2014-06-02", RegExp.lastMatch);
@@ -0,0 +1,48 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=3
+
+// Test that regexps give the same results on bytecode and, once executed
+// often enough, on native code.
+
+function check(re, subject, expected) {
+  for (var i = 0; i < 6; i++) {
+    re.lastIndex = 0;
+    assertEquals(expected, re.exec(subject));
+  }
+}
+
+check(/(a+)(b*)c/, "xxaaabbcyy", ["aaabbc", "aaa", "bb"]);
+check(/(\d+)-(\d+)?/, "tel 555-", ["555-", "555", undefined]);
+check(/(x)|(y)/, "y", ["y", undefined, "y"]);
+check(/(a)\1/i, "bAab", ["Aa", "A"]);
+check(/☃+/, "snow ☃☃!", ["☃☃"]);
+check(/^b/m, "a\nb", ["b"]);
+
+// Global regexps with many matches, on both one-byte and two-byte subjects.
+var global_re = /(\w)(\d)/g;
+for (var i = 0; i < 6; i++) {
+  assertEquals("1a2b3c", "a1b2c3".replace(global_re, "$2$1"));
+  assertEquals("1a2b3c☃", "a1b2c3☃".replace(global_re, "$2$1"));
+  assertEquals(["a1", "b2", "c3"], "a1b2c3".match(global_re));
+}
+
+// Sticky state is kept across the tier-up.
+var sticky = /o/g;
+var subject = "foo boo";
+var positions = [];
+while (sticky.exec(subject) !== null) positions.push(sticky.lastIndex);
+assertEquals([2, 3, 6, 7], positions);
+
+// Many registers.
+var many = /(a)(b)(c)(d)(e)(f)(g)(h)(i)(j)(k)(l)(m)(n)(o)(p)(q)(r)(s)(t)/;
+for (var i = 0; i < 6; i++) {
+  var match = many.exec("-abcdefghijklmnopqrst-");
+  assertEquals(21, match.length);
+  assertEquals("t", match[20]);
+}
+
+// Regexps that fail to match.
+check(/z+$/, "zzzy", null);
@@ -0,0 +1,7 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// AUTO-GENERATED BY tools/generate-runtime-tests.py, DO NOT MODIFY
+// Flags: --allow-natives-syntax --harmony
+var _sub = "foo";
+var _pat = "foo";
+var _position = 1;
+%StringMatchesAt(_sub, _pat, _position);
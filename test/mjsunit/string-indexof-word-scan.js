@@ -0,0 +1,55 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Test searches for short patterns in long subjects, which compare a word of
+// characters at a time.
+
+function naiveIndexOf(subject, pattern, start) {
+  for (var i = start; i + pattern.length <= subject.length; i++) {
+    if (subject.substring(i, i + pattern.length) == pattern) return i;
+  }
+  return -1;
+}
+
+function check(subject, pattern) {
+  for (var start = 0; start < subject.length; start += 7) {
+    assertEquals(naiveIndexOf(subject, pattern, start),
+                 subject.indexOf(pattern, start), pattern + " @" + start);
+  }
+}
+
+// Subjects full of the first or the last character of the pattern.
+var line = "";
+for (var i = 0; i < 50; i++) line += '"key' + i + '": "value", ';
+check(line, '"key4');
+check(line, '", "k');
+check(line, '"value"');
+check(line, '"');
+check(line, "x");
+check(line + "end", "end");
+
+// Two-byte subjects, with one-byte and two-byte patterns.
+var snow = "";
+for (var i = 0; i < 40; i++) snow += "☃a☃" + i + "b";
+check(snow, "☃3");
+check(snow, "9b☃");
+check(snow, "a☃1");
+check(snow, "☃");
+check(snow, "3");
+check(snow, "☀");
+check(snow, "ă");
+
+// Matches in the tail that is shorter than a word.
+var tail = "";
+for (var i = 0; i < 100; i++) tail += "a";
+check(tail + "ab", "ab");
+check(tail + "b", "ab");
+check(tail + "☃b", "☃b");
+
+// Split and replace with string separators take the same path.
+var fields = line.split('", "');
+assertEquals(50, fields.length);
+assertEquals('key1": "value', fields[1]);
+assertEquals(line.length - 49, line.replace(/", "/g, '","').length);
+assertEquals(tail + "-b", (tail + "ab").replace("ab", "-b"));
@@ -0,0 +1,88 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --harmony-strings
+
+// Test string operations on long cons strings, which search, compare and
+// read them without flattening.
+
+function rope(pieces) {
+  var result = "";
+  for (var i = 0; i < pieces.length; i++) result += pieces[i];
+  return result;
+}
+
+var pieces = [];
+for (var i = 0; i < 200; i++) pieces.push("segment-" + i + "-abcdefghij;");
+
+// Patterns that straddle one or more segment boundaries.
+assertEquals(pieces.join("").indexOf("j;segment-150"),
+             rope(pieces).indexOf("j;segment-150"));
+assertEquals(pieces.join("").indexOf(";segment-7-a", 100),
+             rope(pieces).indexOf(";segment-7-a", 100));
+assertEquals(-1, rope(pieces).indexOf("j;segment-200"));
+assertEquals(-1, rope(pieces).indexOf("segment-1-", 30));
+
+// Tiny segments shorter than the pattern.
+var tiny = [];
+for (var i = 0; i < 2000; i++) tiny.push(String.fromCharCode(97 + i % 26));
+assertEquals(tiny.join("").indexOf("xyzabcdefghijklmnop"),
+             rope(tiny).indexOf("xyzabcdefghijklmnop"));
+assertEquals(tiny.join("").lastIndexOf("fghijklmnopqrstuvwx"),
+             rope(tiny).lastIndexOf("fghijklmnopqrstuvwx"));
+
+// Two-byte segments mixed with one-byte segments.
+var mixed = pieces.slice();
+mixed[100] = "snow☃man;";
+var mixed_rope = rope(mixed);
+assertEquals(mixed.join("").indexOf("☃man;segment-101"),
+             mixed_rope.indexOf("☃man;segment-101"));
+assertEquals(mixed.join("").indexOf("j;snow"), mixed_rope.indexOf("j;snow"));
+
+// Comparison of ropes with differently placed segment boundaries.
+var left = rope(pieces);
+var right = rope([pieces.join("").substring(0, 777),
+                  pieces.join("").substring(777)]);
+assertTrue(left == right);
+assertEquals(0, left.localeCompare(right));
+assertTrue(rope(pieces) < rope(pieces) + "x");
+assertTrue(rope(mixed) > rope(pieces));
+assertFalse(rope(mixed) < rope(pieces));
+var smaller = pieces.slice();
+smaller[199] = "segment-199-abcdefghii;";
+assertTrue(rope(smaller) < rope(pieces));
+
+// Character reads, including reads of deep ropes.
+var deep = rope(pieces);
+var flat = pieces.join("");
+for (var i = 0; i < flat.length; i += 97) {
+  assertEquals(flat.charCodeAt(i), deep.charCodeAt(i));
+}
+var deeper = "";
+for (var i = 0; i < 3000; i++) deeper = "0123456789abcdef" + deeper;
+assertEquals(102, deeper.charCodeAt(15));
+assertEquals(48, deeper.charCodeAt(16 * 2999));
+assertEquals(57, deeper.charCodeAt(16 * 1500 + 9));
+for (var i = 0; i < 48000; i += 1001) {
+  assertEquals("0123456789abcdef".charCodeAt(i % 16), deeper.charCodeAt(i));
+}
+
+// Two ropes read in turn, as in a character by character comparison.
+var left = rope(pieces);
+var right = rope(pieces);
+for (var i = 0; i < flat.length; i++) {
+  assertEquals(left.charCodeAt(i), right.charCodeAt(i));
+}
+
+// Prefix and suffix checks at positions inside the rope.
+assertTrue(deep.startsWith("segment-0-"));
+var position = flat.indexOf(";segment-51") - 1;
+assertTrue(deep.startsWith("j;segment-51-abc", position));
+assertFalse(deep.startsWith("segment-51", 100));
+assertTrue(deep.endsWith("segment-199-abcdefghij;"));
+assertTrue(deep.endsWith("segment-3", flat.indexOf("segment-3-") + 9));
+assertFalse(deep.endsWith("segment-3", 100));
+assertTrue(mixed_rope.startsWith("snow☃", flat.indexOf("segment-100-")));
+assertFalse(deep.startsWith(deep + "x"));
+assertTrue(deep.endsWith(rope(pieces.slice(150))));
@@ -539,6 +539,8 @@
         '../../src/libplatform/task-queue.h',
         '../../src/libplatform/worker-thread.cc',
         '../../src/libplatform/worker-thread.h',
+        '../../src/linear-regexp.cc',
+        '../../src/linear-regexp.h',
         '../../src/list-inl.h',
         '../../src/list.h',
         '../../src/lithium-allocator-inl.h',
@@ -630,6 +632,8 @@
         '../../src/store-buffer-inl.h',
         '../../src/store-buffer.cc',
         '../../src/store-buffer.h',
+        '../../src/string-rope.cc',
+        '../../src/string-rope.h',
         '../../src/string-search.cc',
         '../../src/string-search.h',
         '../../src/string-stream.cc',
@@ -54,9 +54,10 @@ class BaselineScanner {
                   Encoding encoding,
                   v8::base::ElapsedTimer* timer,
                   int repeat)
-      : stream_(NULL) {
+      : stream_(NULL), length_(0) {
     int length = 0;
     source_ = ReadFileAndRepeat(fname, &length, repeat);
+    length_ = length;
     unicode_cache_ = new UnicodeCache();
     scanner_ = new Scanner(unicode_cache_);
     switch (encoding) {
@@ -98,11 +99,15 @@ class BaselineScanner {
     return res;
   }
 
+  // The length of the scanned source in bytes.
+  int length() const { return length_; }
+
  private:
   UnicodeCache* unicode_cache_;
   Scanner* scanner_;
   const byte* source_;
   BufferedUtf16CharacterStream* stream_;
+  int length_;
 };
 
 
@@ -127,21 +132,35 @@ struct TokenWithLocation {
 };
 
 
+// Counts of what was scanned, for reporting the throughput.
+struct ScanStatistics {
+  ScanStatistics() : bytes(0), tokens(0) { }
+  double bytes;
+  double tokens;
+};
+
+
 v8::base::TimeDelta RunBaselineScanner(const char* fname, Isolate* isolate,
                                        Encoding encoding, bool dump_tokens,
                                        std::vector<TokenWithLocation>* tokens,
-                                       int repeat) {
+                                       int repeat,
+                                       ScanStatistics* statistics) {
   v8::base::ElapsedTimer timer;
   BaselineScanner scanner(fname, isolate, encoding, &timer, repeat);
   Token::Value token;
   int beg, end;
+  int count = 0;
   do {
     token = scanner.Next(&beg, &end);
+    count++;
     if (dump_tokens) {
       tokens->push_back(TokenWithLocation(token, beg, end));
     }
   } while (token != Token::EOS);
-  return timer.Elapsed();
+  v8::base::TimeDelta time = timer.Elapsed();
+  statistics->bytes += scanner.length();
+  statistics->tokens += count;
+  return time;
 }
 
 
@@ -161,7 +180,8 @@ v8::base::TimeDelta ProcessFile(
     Encoding encoding,
     Isolate* isolate,
     bool print_tokens,
-    int repeat) {
+    int repeat,
+    ScanStatistics* statistics) {
   if (print_tokens) {
     printf("Processing file %s\n", fname);
   }
@@ -170,7 +190,7 @@ v8::base::TimeDelta ProcessFile(
   v8::base::TimeDelta baseline_time;
   baseline_time = RunBaselineScanner(
       fname, isolate, encoding, print_tokens,
-      &baseline_tokens, repeat);
+      &baseline_tokens, repeat, statistics);
   if (print_tokens) {
     PrintTokens("Baseline", baseline_tokens);
   }
@@ -214,15 +234,21 @@ int main(int argc, char* argv[]) {
     {
       v8::Context::Scope scope(context);
       double baseline_total = 0;
+      ScanStatistics statistics;
       for (size_t i = 0; i < fnames.size(); i++) {
         v8::base::TimeDelta time;
         time = ProcessFile(fnames[i].c_str(), encoding,
                            reinterpret_cast<Isolate*>(isolate), print_tokens,
-                           repeat);
+                           repeat, &statistics);
         baseline_total += time.InMillisecondsF();
       }
       if (benchmark.empty()) benchmark = "Baseline";
       printf("%s(RunTime): %.f ms\n", benchmark.c_str(), baseline_total);
+      if (baseline_total > 0) {
+        printf("%s(Throughput): %.1f MB/s, %.f tokens/ms\n", benchmark.c_str(),
+               statistics.bytes / MB / (baseline_total / 1000),
+               statistics.tokens / baseline_total);
+      }
     }
   }
   v8::V8::Dispose();